@@ -0,0 +1,87 @@
+#include <stdio.h>
+#include <math.h>
+
+#include <binned.h>
+
+#include "../config.h"
+
+/*[[[cog
+import cog
+from src.gen import vectorizations
+from src.gen import utils
+]]]*/
+//[[[end]]]
+
+int main(int argc, char** argv){
+  int index;
+  (void)argc;
+  (void)argv;
+
+  printf("{\n");
+
+  /*[[[cog
+  def print_vectorization(vectorization, code_block):
+    code_block.write('printf("  \\\"vectorization\\\": \\\"{}\\\",\\n");'.format(vectorization.name))
+  code_block = utils.CodeBlock()
+  vectorizations.iterate_all_vectorizations(print_vectorization, code_block)
+  cog.out(str(code_block))
+  ]]]*/
+  #if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+    printf("  \"vectorization\": \"AVX512\",\n");
+
+  #elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+    printf("  \"vectorization\": \"AVX\",\n");
+
+  #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+    printf("  \"vectorization\": \"SSE\",\n");
+
+  #else
+    printf("  \"vectorization\": \"SISD\",\n");
+
+  #endif
+  //[[[end]]]
+
+  #ifdef reproBLAS_DISPATCH
+    printf("  \"dispatch\": true,\n");
+  #else
+    printf("  \"dispatch\": false,\n");
+  #endif
+
+  #ifdef reproBLAS_MPI
+    printf("  \"mpi\": true,\n");
+  #else
+    printf("  \"mpi\": false,\n");
+  #endif
+
+  printf("  \"dimaxindex\": %d,\n", binned_DBMAXINDEX);
+
+  printf("  \"simaxindex\": %d,\n", binned_SBMAXINDEX);
+
+  printf("  \"dimaxfold\": %d,\n", binned_DBMAXFOLD);
+
+  printf("  \"simaxfold\": %d,\n", binned_SBMAXFOLD);
+
+  printf("  \"didefaultfold\": %d,\n", DIDEFAULTFOLD);
+
+  printf("  \"sidefaultfold\": %d,\n", SIDEFAULTFOLD);
+
+  printf("  \"diendurance\": %d,\n", binned_DBENDURANCE);
+
+  printf("  \"siendurance\": %d,\n", binned_SBENDURANCE);
+
+  printf("  \"dibins\": [\"%a\"", 2.0 * ldexp(0.75, DBL_MAX_EXP - 1));
+  for(index = 1; index <= binned_DBMAXINDEX; index++){
+    printf(", \"%a\"", ldexp(0.75, (DBL_MAX_EXP + DBL_MANT_DIG - DBWIDTH + 1 - index * DBWIDTH)));
+  }
+  printf("],\n");
+
+  printf("  \"sibins\": [\"%a\"", (double)ldexpf(0.75, FLT_MAX_EXP));
+  for(index = 1; index <= binned_SBMAXINDEX; index++){
+    printf(", \"%a\"", (double)ldexpf(0.75, (FLT_MAX_EXP + FLT_MANT_DIG - SBWIDTH + 1 - index * SBWIDTH)));
+  }
+  printf("]\n");
+
+  printf("}\n");
+
+  return 0;
+}
@@ -0,0 +1,446 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../config.h"
+#include "../common/common.h"
+#include "binnedBLAS.h"
+
+/*[[[cog
+import cog
+import generate
+import dataTypes
+import amax
+import vectorizations
+
+code_block = generate.CodeBlock()
+vectorizations.conditionally_include_vectorizations(code_block)
+cog.out(str(code_block))
+]]]*/
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  #include <immintrin.h>
+
+#elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+  #include <immintrin.h>
+
+#elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+  #include <emmintrin.h>
+
+#else
+
+
+#endif
+//[[[end]]]
+
+
+/**
+ * @internal
+ * @brief  Find maximum magnitude in vector of complex single precision
+ *
+ * Returns the magnitude of the element of maximum magnitude in an array.
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param amax scalar return
+ *
+ * @author Willow Ahrens
+ * @date   15 Jan 2016
+ */
+void binnedBLAS_camax_sub(const int N, const void *X, const int incX, void *amax) {
+  const float *x = (const float*)X;
+  /*[[[cog
+  cog.out(generate.generate(amax.AMax(dataTypes.FloatComplex, "N", "x", "incX", "amax"), cog.inFile, args, params, mode))
+  ]]]*/
+  #if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+    float max_buffer_tmp[16] __attribute__((aligned(64))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m512 x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7;
+    __m512 m_0;
+    m_0 = _mm512_setzero_ps();
+
+    if(incX == 1){
+
+      for(i = 0; i + 64 <= N; i += 64, x += 128){
+        x_0 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x)));
+        x_1 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 16));
+        x_2 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 32));
+        x_3 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 48));
+        x_4 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 64));
+        x_5 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 80));
+        x_6 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 96));
+        x_7 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 112));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        m_0 = _mm512_max_ps(m_0, x_2);
+        m_0 = _mm512_max_ps(m_0, x_3);
+        m_0 = _mm512_max_ps(m_0, x_4);
+        m_0 = _mm512_max_ps(m_0, x_5);
+        m_0 = _mm512_max_ps(m_0, x_6);
+        m_0 = _mm512_max_ps(m_0, x_7);
+      }
+      if(i + 32 <= N){
+        x_0 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x)));
+        x_1 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 16));
+        x_2 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 32));
+        x_3 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 48));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        m_0 = _mm512_max_ps(m_0, x_2);
+        m_0 = _mm512_max_ps(m_0, x_3);
+        i += 32, x += 64;
+      }
+      if(i + 16 <= N){
+        x_0 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x)));
+        x_1 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x) + 16));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        i += 16, x += 32;
+      }
+      if(i + 8 <= N){
+        x_0 = _mm512_abs_ps(_mm512_loadu_ps(((float*)x)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        i += 8, x += 16;
+      }
+      if(i < N){
+        x_0 = _mm512_abs_ps(_mm512_maskz_loadu_ps((__mmask16)((1U << ((N - i) * 2)) - 1), ((float*)x)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        x += ((N - i) * 2);
+      }
+    }else{
+
+      for(i = 0; i + 64 <= N; i += 64, x += ((ptrdiff_t)incX * 128)){
+        x_0 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)], ((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]));
+        x_1 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 30) + 1)], ((float*)x)[((ptrdiff_t)incX * 30)], ((float*)x)[(((ptrdiff_t)incX * 28) + 1)], ((float*)x)[((ptrdiff_t)incX * 28)], ((float*)x)[(((ptrdiff_t)incX * 26) + 1)], ((float*)x)[((ptrdiff_t)incX * 26)], ((float*)x)[(((ptrdiff_t)incX * 24) + 1)], ((float*)x)[((ptrdiff_t)incX * 24)], ((float*)x)[(((ptrdiff_t)incX * 22) + 1)], ((float*)x)[((ptrdiff_t)incX * 22)], ((float*)x)[(((ptrdiff_t)incX * 20) + 1)], ((float*)x)[((ptrdiff_t)incX * 20)], ((float*)x)[(((ptrdiff_t)incX * 18) + 1)], ((float*)x)[((ptrdiff_t)incX * 18)], ((float*)x)[(((ptrdiff_t)incX * 16) + 1)], ((float*)x)[((ptrdiff_t)incX * 16)]));
+        x_2 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 46) + 1)], ((float*)x)[((ptrdiff_t)incX * 46)], ((float*)x)[(((ptrdiff_t)incX * 44) + 1)], ((float*)x)[((ptrdiff_t)incX * 44)], ((float*)x)[(((ptrdiff_t)incX * 42) + 1)], ((float*)x)[((ptrdiff_t)incX * 42)], ((float*)x)[(((ptrdiff_t)incX * 40) + 1)], ((float*)x)[((ptrdiff_t)incX * 40)], ((float*)x)[(((ptrdiff_t)incX * 38) + 1)], ((float*)x)[((ptrdiff_t)incX * 38)], ((float*)x)[(((ptrdiff_t)incX * 36) + 1)], ((float*)x)[((ptrdiff_t)incX * 36)], ((float*)x)[(((ptrdiff_t)incX * 34) + 1)], ((float*)x)[((ptrdiff_t)incX * 34)], ((float*)x)[(((ptrdiff_t)incX * 32) + 1)], ((float*)x)[((ptrdiff_t)incX * 32)]));
+        x_3 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 62) + 1)], ((float*)x)[((ptrdiff_t)incX * 62)], ((float*)x)[(((ptrdiff_t)incX * 60) + 1)], ((float*)x)[((ptrdiff_t)incX * 60)], ((float*)x)[(((ptrdiff_t)incX * 58) + 1)], ((float*)x)[((ptrdiff_t)incX * 58)], ((float*)x)[(((ptrdiff_t)incX * 56) + 1)], ((float*)x)[((ptrdiff_t)incX * 56)], ((float*)x)[(((ptrdiff_t)incX * 54) + 1)], ((float*)x)[((ptrdiff_t)incX * 54)], ((float*)x)[(((ptrdiff_t)incX * 52) + 1)], ((float*)x)[((ptrdiff_t)incX * 52)], ((float*)x)[(((ptrdiff_t)incX * 50) + 1)], ((float*)x)[((ptrdiff_t)incX * 50)], ((float*)x)[(((ptrdiff_t)incX * 48) + 1)], ((float*)x)[((ptrdiff_t)incX * 48)]));
+        x_4 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 78) + 1)], ((float*)x)[((ptrdiff_t)incX * 78)], ((float*)x)[(((ptrdiff_t)incX * 76) + 1)], ((float*)x)[((ptrdiff_t)incX * 76)], ((float*)x)[(((ptrdiff_t)incX * 74) + 1)], ((float*)x)[((ptrdiff_t)incX * 74)], ((float*)x)[(((ptrdiff_t)incX * 72) + 1)], ((float*)x)[((ptrdiff_t)incX * 72)], ((float*)x)[(((ptrdiff_t)incX * 70) + 1)], ((float*)x)[((ptrdiff_t)incX * 70)], ((float*)x)[(((ptrdiff_t)incX * 68) + 1)], ((float*)x)[((ptrdiff_t)incX * 68)], ((float*)x)[(((ptrdiff_t)incX * 66) + 1)], ((float*)x)[((ptrdiff_t)incX * 66)], ((float*)x)[(((ptrdiff_t)incX * 64) + 1)], ((float*)x)[((ptrdiff_t)incX * 64)]));
+        x_5 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 94) + 1)], ((float*)x)[((ptrdiff_t)incX * 94)], ((float*)x)[(((ptrdiff_t)incX * 92) + 1)], ((float*)x)[((ptrdiff_t)incX * 92)], ((float*)x)[(((ptrdiff_t)incX * 90) + 1)], ((float*)x)[((ptrdiff_t)incX * 90)], ((float*)x)[(((ptrdiff_t)incX * 88) + 1)], ((float*)x)[((ptrdiff_t)incX * 88)], ((float*)x)[(((ptrdiff_t)incX * 86) + 1)], ((float*)x)[((ptrdiff_t)incX * 86)], ((float*)x)[(((ptrdiff_t)incX * 84) + 1)], ((float*)x)[((ptrdiff_t)incX * 84)], ((float*)x)[(((ptrdiff_t)incX * 82) + 1)], ((float*)x)[((ptrdiff_t)incX * 82)], ((float*)x)[(((ptrdiff_t)incX * 80) + 1)], ((float*)x)[((ptrdiff_t)incX * 80)]));
+        x_6 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 110) + 1)], ((float*)x)[((ptrdiff_t)incX * 110)], ((float*)x)[(((ptrdiff_t)incX * 108) + 1)], ((float*)x)[((ptrdiff_t)incX * 108)], ((float*)x)[(((ptrdiff_t)incX * 106) + 1)], ((float*)x)[((ptrdiff_t)incX * 106)], ((float*)x)[(((ptrdiff_t)incX * 104) + 1)], ((float*)x)[((ptrdiff_t)incX * 104)], ((float*)x)[(((ptrdiff_t)incX * 102) + 1)], ((float*)x)[((ptrdiff_t)incX * 102)], ((float*)x)[(((ptrdiff_t)incX * 100) + 1)], ((float*)x)[((ptrdiff_t)incX * 100)], ((float*)x)[(((ptrdiff_t)incX * 98) + 1)], ((float*)x)[((ptrdiff_t)incX * 98)], ((float*)x)[(((ptrdiff_t)incX * 96) + 1)], ((float*)x)[((ptrdiff_t)incX * 96)]));
+        x_7 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 126) + 1)], ((float*)x)[((ptrdiff_t)incX * 126)], ((float*)x)[(((ptrdiff_t)incX * 124) + 1)], ((float*)x)[((ptrdiff_t)incX * 124)], ((float*)x)[(((ptrdiff_t)incX * 122) + 1)], ((float*)x)[((ptrdiff_t)incX * 122)], ((float*)x)[(((ptrdiff_t)incX * 120) + 1)], ((float*)x)[((ptrdiff_t)incX * 120)], ((float*)x)[(((ptrdiff_t)incX * 118) + 1)], ((float*)x)[((ptrdiff_t)incX * 118)], ((float*)x)[(((ptrdiff_t)incX * 116) + 1)], ((float*)x)[((ptrdiff_t)incX * 116)], ((float*)x)[(((ptrdiff_t)incX * 114) + 1)], ((float*)x)[((ptrdiff_t)incX * 114)], ((float*)x)[(((ptrdiff_t)incX * 112) + 1)], ((float*)x)[((ptrdiff_t)incX * 112)]));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        m_0 = _mm512_max_ps(m_0, x_2);
+        m_0 = _mm512_max_ps(m_0, x_3);
+        m_0 = _mm512_max_ps(m_0, x_4);
+        m_0 = _mm512_max_ps(m_0, x_5);
+        m_0 = _mm512_max_ps(m_0, x_6);
+        m_0 = _mm512_max_ps(m_0, x_7);
+      }
+      if(i + 32 <= N){
+        x_0 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)], ((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]));
+        x_1 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 30) + 1)], ((float*)x)[((ptrdiff_t)incX * 30)], ((float*)x)[(((ptrdiff_t)incX * 28) + 1)], ((float*)x)[((ptrdiff_t)incX * 28)], ((float*)x)[(((ptrdiff_t)incX * 26) + 1)], ((float*)x)[((ptrdiff_t)incX * 26)], ((float*)x)[(((ptrdiff_t)incX * 24) + 1)], ((float*)x)[((ptrdiff_t)incX * 24)], ((float*)x)[(((ptrdiff_t)incX * 22) + 1)], ((float*)x)[((ptrdiff_t)incX * 22)], ((float*)x)[(((ptrdiff_t)incX * 20) + 1)], ((float*)x)[((ptrdiff_t)incX * 20)], ((float*)x)[(((ptrdiff_t)incX * 18) + 1)], ((float*)x)[((ptrdiff_t)incX * 18)], ((float*)x)[(((ptrdiff_t)incX * 16) + 1)], ((float*)x)[((ptrdiff_t)incX * 16)]));
+        x_2 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 46) + 1)], ((float*)x)[((ptrdiff_t)incX * 46)], ((float*)x)[(((ptrdiff_t)incX * 44) + 1)], ((float*)x)[((ptrdiff_t)incX * 44)], ((float*)x)[(((ptrdiff_t)incX * 42) + 1)], ((float*)x)[((ptrdiff_t)incX * 42)], ((float*)x)[(((ptrdiff_t)incX * 40) + 1)], ((float*)x)[((ptrdiff_t)incX * 40)], ((float*)x)[(((ptrdiff_t)incX * 38) + 1)], ((float*)x)[((ptrdiff_t)incX * 38)], ((float*)x)[(((ptrdiff_t)incX * 36) + 1)], ((float*)x)[((ptrdiff_t)incX * 36)], ((float*)x)[(((ptrdiff_t)incX * 34) + 1)], ((float*)x)[((ptrdiff_t)incX * 34)], ((float*)x)[(((ptrdiff_t)incX * 32) + 1)], ((float*)x)[((ptrdiff_t)incX * 32)]));
+        x_3 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 62) + 1)], ((float*)x)[((ptrdiff_t)incX * 62)], ((float*)x)[(((ptrdiff_t)incX * 60) + 1)], ((float*)x)[((ptrdiff_t)incX * 60)], ((float*)x)[(((ptrdiff_t)incX * 58) + 1)], ((float*)x)[((ptrdiff_t)incX * 58)], ((float*)x)[(((ptrdiff_t)incX * 56) + 1)], ((float*)x)[((ptrdiff_t)incX * 56)], ((float*)x)[(((ptrdiff_t)incX * 54) + 1)], ((float*)x)[((ptrdiff_t)incX * 54)], ((float*)x)[(((ptrdiff_t)incX * 52) + 1)], ((float*)x)[((ptrdiff_t)incX * 52)], ((float*)x)[(((ptrdiff_t)incX * 50) + 1)], ((float*)x)[((ptrdiff_t)incX * 50)], ((float*)x)[(((ptrdiff_t)incX * 48) + 1)], ((float*)x)[((ptrdiff_t)incX * 48)]));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        m_0 = _mm512_max_ps(m_0, x_2);
+        m_0 = _mm512_max_ps(m_0, x_3);
+        i += 32, x += ((ptrdiff_t)incX * 64);
+      }
+      if(i + 16 <= N){
+        x_0 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)], ((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]));
+        x_1 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 30) + 1)], ((float*)x)[((ptrdiff_t)incX * 30)], ((float*)x)[(((ptrdiff_t)incX * 28) + 1)], ((float*)x)[((ptrdiff_t)incX * 28)], ((float*)x)[(((ptrdiff_t)incX * 26) + 1)], ((float*)x)[((ptrdiff_t)incX * 26)], ((float*)x)[(((ptrdiff_t)incX * 24) + 1)], ((float*)x)[((ptrdiff_t)incX * 24)], ((float*)x)[(((ptrdiff_t)incX * 22) + 1)], ((float*)x)[((ptrdiff_t)incX * 22)], ((float*)x)[(((ptrdiff_t)incX * 20) + 1)], ((float*)x)[((ptrdiff_t)incX * 20)], ((float*)x)[(((ptrdiff_t)incX * 18) + 1)], ((float*)x)[((ptrdiff_t)incX * 18)], ((float*)x)[(((ptrdiff_t)incX * 16) + 1)], ((float*)x)[((ptrdiff_t)incX * 16)]));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        i += 16, x += ((ptrdiff_t)incX * 32);
+      }
+      if(i + 8 <= N){
+        x_0 = _mm512_abs_ps(_mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)], ((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        i += 8, x += ((ptrdiff_t)incX * 16);
+      }
+      if(i < N){
+        x_0 = _mm512_abs_ps(_mm512_castpd_ps(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), (double*)((float*)x), 8)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        x += ((ptrdiff_t)incX * (N - i) * 2);
+      }
+    }
+    _mm512_store_ps(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[3] ? max_buffer_tmp[1]: max_buffer_tmp[3]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[5] ? max_buffer_tmp[1]: max_buffer_tmp[5]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[7] ? max_buffer_tmp[1]: max_buffer_tmp[7]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[8] ? max_buffer_tmp[0]: max_buffer_tmp[8]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[9] ? max_buffer_tmp[1]: max_buffer_tmp[9]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[10] ? max_buffer_tmp[0]: max_buffer_tmp[10]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[11] ? max_buffer_tmp[1]: max_buffer_tmp[11]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[12] ? max_buffer_tmp[0]: max_buffer_tmp[12]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[13] ? max_buffer_tmp[1]: max_buffer_tmp[13]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[14] ? max_buffer_tmp[0]: max_buffer_tmp[14]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[15] ? max_buffer_tmp[1]: max_buffer_tmp[15]);
+    ((float*)amax)[0] = max_buffer_tmp[0];
+    ((float*)amax)[1] = max_buffer_tmp[1];
+
+  #elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+    __m256 abs_mask_tmp;
+    {
+      __m256 tmp;
+      tmp = _mm256_set1_ps(1);
+      abs_mask_tmp = _mm256_set1_ps(-1);
+      abs_mask_tmp = _mm256_xor_ps(abs_mask_tmp, tmp);
+      tmp = _mm256_cmp_ps(tmp, tmp, 0);
+      abs_mask_tmp = _mm256_xor_ps(abs_mask_tmp, tmp);
+    }
+    float max_buffer_tmp[8] __attribute__((aligned(32))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m256 x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7;
+    __m256 m_0;
+    m_0 = _mm256_setzero_ps();
+
+    if(incX == 1){
+
+      for(i = 0; i + 32 <= N; i += 32, x += 64){
+        x_0 = _mm256_and_ps(_mm256_loadu_ps(((float*)x)), abs_mask_tmp);
+        x_1 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 8), abs_mask_tmp);
+        x_2 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 16), abs_mask_tmp);
+        x_3 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 24), abs_mask_tmp);
+        x_4 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 32), abs_mask_tmp);
+        x_5 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 40), abs_mask_tmp);
+        x_6 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 48), abs_mask_tmp);
+        x_7 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 56), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        m_0 = _mm256_max_ps(m_0, x_2);
+        m_0 = _mm256_max_ps(m_0, x_3);
+        m_0 = _mm256_max_ps(m_0, x_4);
+        m_0 = _mm256_max_ps(m_0, x_5);
+        m_0 = _mm256_max_ps(m_0, x_6);
+        m_0 = _mm256_max_ps(m_0, x_7);
+      }
+      if(i + 16 <= N){
+        x_0 = _mm256_and_ps(_mm256_loadu_ps(((float*)x)), abs_mask_tmp);
+        x_1 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 8), abs_mask_tmp);
+        x_2 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 16), abs_mask_tmp);
+        x_3 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 24), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        m_0 = _mm256_max_ps(m_0, x_2);
+        m_0 = _mm256_max_ps(m_0, x_3);
+        i += 16, x += 32;
+      }
+      if(i + 8 <= N){
+        x_0 = _mm256_and_ps(_mm256_loadu_ps(((float*)x)), abs_mask_tmp);
+        x_1 = _mm256_and_ps(_mm256_loadu_ps(((float*)x) + 8), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        i += 8, x += 16;
+      }
+      if(i + 4 <= N){
+        x_0 = _mm256_and_ps(_mm256_loadu_ps(((float*)x)), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        i += 4, x += 8;
+      }
+      if(i < N){
+        x_0 = _mm256_and_ps((__m256)_mm256_set_pd(0, (N - i)>2?((double*)((float*)x))[2]:0, (N - i)>1?((double*)((float*)x))[1]:0, ((double*)((float*)x))[0]), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        x += ((N - i) * 2);
+      }
+    }else{
+
+      for(i = 0; i + 32 <= N; i += 32, x += ((ptrdiff_t)incX * 64)){
+        x_0 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]), abs_mask_tmp);
+        x_1 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)]), abs_mask_tmp);
+        x_2 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 22) + 1)], ((float*)x)[((ptrdiff_t)incX * 22)], ((float*)x)[(((ptrdiff_t)incX * 20) + 1)], ((float*)x)[((ptrdiff_t)incX * 20)], ((float*)x)[(((ptrdiff_t)incX * 18) + 1)], ((float*)x)[((ptrdiff_t)incX * 18)], ((float*)x)[(((ptrdiff_t)incX * 16) + 1)], ((float*)x)[((ptrdiff_t)incX * 16)]), abs_mask_tmp);
+        x_3 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 30) + 1)], ((float*)x)[((ptrdiff_t)incX * 30)], ((float*)x)[(((ptrdiff_t)incX * 28) + 1)], ((float*)x)[((ptrdiff_t)incX * 28)], ((float*)x)[(((ptrdiff_t)incX * 26) + 1)], ((float*)x)[((ptrdiff_t)incX * 26)], ((float*)x)[(((ptrdiff_t)incX * 24) + 1)], ((float*)x)[((ptrdiff_t)incX * 24)]), abs_mask_tmp);
+        x_4 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 38) + 1)], ((float*)x)[((ptrdiff_t)incX * 38)], ((float*)x)[(((ptrdiff_t)incX * 36) + 1)], ((float*)x)[((ptrdiff_t)incX * 36)], ((float*)x)[(((ptrdiff_t)incX * 34) + 1)], ((float*)x)[((ptrdiff_t)incX * 34)], ((float*)x)[(((ptrdiff_t)incX * 32) + 1)], ((float*)x)[((ptrdiff_t)incX * 32)]), abs_mask_tmp);
+        x_5 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 46) + 1)], ((float*)x)[((ptrdiff_t)incX * 46)], ((float*)x)[(((ptrdiff_t)incX * 44) + 1)], ((float*)x)[((ptrdiff_t)incX * 44)], ((float*)x)[(((ptrdiff_t)incX * 42) + 1)], ((float*)x)[((ptrdiff_t)incX * 42)], ((float*)x)[(((ptrdiff_t)incX * 40) + 1)], ((float*)x)[((ptrdiff_t)incX * 40)]), abs_mask_tmp);
+        x_6 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 54) + 1)], ((float*)x)[((ptrdiff_t)incX * 54)], ((float*)x)[(((ptrdiff_t)incX * 52) + 1)], ((float*)x)[((ptrdiff_t)incX * 52)], ((float*)x)[(((ptrdiff_t)incX * 50) + 1)], ((float*)x)[((ptrdiff_t)incX * 50)], ((float*)x)[(((ptrdiff_t)incX * 48) + 1)], ((float*)x)[((ptrdiff_t)incX * 48)]), abs_mask_tmp);
+        x_7 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 62) + 1)], ((float*)x)[((ptrdiff_t)incX * 62)], ((float*)x)[(((ptrdiff_t)incX * 60) + 1)], ((float*)x)[((ptrdiff_t)incX * 60)], ((float*)x)[(((ptrdiff_t)incX * 58) + 1)], ((float*)x)[((ptrdiff_t)incX * 58)], ((float*)x)[(((ptrdiff_t)incX * 56) + 1)], ((float*)x)[((ptrdiff_t)incX * 56)]), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        m_0 = _mm256_max_ps(m_0, x_2);
+        m_0 = _mm256_max_ps(m_0, x_3);
+        m_0 = _mm256_max_ps(m_0, x_4);
+        m_0 = _mm256_max_ps(m_0, x_5);
+        m_0 = _mm256_max_ps(m_0, x_6);
+        m_0 = _mm256_max_ps(m_0, x_7);
+      }
+      if(i + 16 <= N){
+        x_0 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]), abs_mask_tmp);
+        x_1 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)]), abs_mask_tmp);
+        x_2 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 22) + 1)], ((float*)x)[((ptrdiff_t)incX * 22)], ((float*)x)[(((ptrdiff_t)incX * 20) + 1)], ((float*)x)[((ptrdiff_t)incX * 20)], ((float*)x)[(((ptrdiff_t)incX * 18) + 1)], ((float*)x)[((ptrdiff_t)incX * 18)], ((float*)x)[(((ptrdiff_t)incX * 16) + 1)], ((float*)x)[((ptrdiff_t)incX * 16)]), abs_mask_tmp);
+        x_3 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 30) + 1)], ((float*)x)[((ptrdiff_t)incX * 30)], ((float*)x)[(((ptrdiff_t)incX * 28) + 1)], ((float*)x)[((ptrdiff_t)incX * 28)], ((float*)x)[(((ptrdiff_t)incX * 26) + 1)], ((float*)x)[((ptrdiff_t)incX * 26)], ((float*)x)[(((ptrdiff_t)incX * 24) + 1)], ((float*)x)[((ptrdiff_t)incX * 24)]), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        m_0 = _mm256_max_ps(m_0, x_2);
+        m_0 = _mm256_max_ps(m_0, x_3);
+        i += 16, x += ((ptrdiff_t)incX * 32);
+      }
+      if(i + 8 <= N){
+        x_0 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]), abs_mask_tmp);
+        x_1 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)]), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        i += 8, x += ((ptrdiff_t)incX * 16);
+      }
+      if(i + 4 <= N){
+        x_0 = _mm256_and_ps(_mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        i += 4, x += ((ptrdiff_t)incX * 8);
+      }
+      if(i < N){
+        x_0 = _mm256_and_ps((__m256)_mm256_set_pd(0, (N - i)>2?((double*)((float*)x))[((ptrdiff_t)incX * 2)]:0, (N - i)>1?((double*)((float*)x))[(ptrdiff_t)incX]:0, ((double*)((float*)x))[0]), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        x += ((ptrdiff_t)incX * (N - i) * 2);
+      }
+    }
+    _mm256_store_ps(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[3] ? max_buffer_tmp[1]: max_buffer_tmp[3]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[5] ? max_buffer_tmp[1]: max_buffer_tmp[5]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[7] ? max_buffer_tmp[1]: max_buffer_tmp[7]);
+    ((float*)amax)[0] = max_buffer_tmp[0];
+    ((float*)amax)[1] = max_buffer_tmp[1];
+
+  #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+    __m128 abs_mask_tmp;
+    {
+      __m128 tmp;
+      tmp = _mm_set1_ps(1);
+      abs_mask_tmp = _mm_set1_ps(-1);
+      abs_mask_tmp = _mm_xor_ps(abs_mask_tmp, tmp);
+      tmp = _mm_cmpeq_ps(tmp, tmp);
+      abs_mask_tmp = _mm_xor_ps(abs_mask_tmp, tmp);
+    }
+    float max_buffer_tmp[4] __attribute__((aligned(16))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m128 x_0, x_1, x_2, x_3, x_4, x_5;
+    __m128 m_0;
+    m_0 = _mm_setzero_ps();
+
+    if(incX == 1){
+
+      for(i = 0; i + 12 <= N; i += 12, x += 24){
+        x_0 = _mm_and_ps(_mm_loadu_ps(((float*)x)), abs_mask_tmp);
+        x_1 = _mm_and_ps(_mm_loadu_ps(((float*)x) + 4), abs_mask_tmp);
+        x_2 = _mm_and_ps(_mm_loadu_ps(((float*)x) + 8), abs_mask_tmp);
+        x_3 = _mm_and_ps(_mm_loadu_ps(((float*)x) + 12), abs_mask_tmp);
+        x_4 = _mm_and_ps(_mm_loadu_ps(((float*)x) + 16), abs_mask_tmp);
+        x_5 = _mm_and_ps(_mm_loadu_ps(((float*)x) + 20), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        m_0 = _mm_max_ps(m_0, x_2);
+        m_0 = _mm_max_ps(m_0, x_3);
+        m_0 = _mm_max_ps(m_0, x_4);
+        m_0 = _mm_max_ps(m_0, x_5);
+      }
+      if(i + 8 <= N){
+        x_0 = _mm_and_ps(_mm_loadu_ps(((float*)x)), abs_mask_tmp);
+        x_1 = _mm_and_ps(_mm_loadu_ps(((float*)x) + 4), abs_mask_tmp);
+        x_2 = _mm_and_ps(_mm_loadu_ps(((float*)x) + 8), abs_mask_tmp);
+        x_3 = _mm_and_ps(_mm_loadu_ps(((float*)x) + 12), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        m_0 = _mm_max_ps(m_0, x_2);
+        m_0 = _mm_max_ps(m_0, x_3);
+        i += 8, x += 16;
+      }
+      if(i + 4 <= N){
+        x_0 = _mm_and_ps(_mm_loadu_ps(((float*)x)), abs_mask_tmp);
+        x_1 = _mm_and_ps(_mm_loadu_ps(((float*)x) + 4), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        i += 4, x += 8;
+      }
+      if(i + 2 <= N){
+        x_0 = _mm_and_ps(_mm_loadu_ps(((float*)x)), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        i += 2, x += 4;
+      }
+      if(i < N){
+        x_0 = _mm_and_ps(_mm_set_ps(0, 0, ((float*)x)[1], ((float*)x)[0]), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        x += ((N - i) * 2);
+      }
+    }else{
+
+      for(i = 0; i + 12 <= N; i += 12, x += ((ptrdiff_t)incX * 24)){
+        x_0 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]), abs_mask_tmp);
+        x_1 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)]), abs_mask_tmp);
+        x_2 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)]), abs_mask_tmp);
+        x_3 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)]), abs_mask_tmp);
+        x_4 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 18) + 1)], ((float*)x)[((ptrdiff_t)incX * 18)], ((float*)x)[(((ptrdiff_t)incX * 16) + 1)], ((float*)x)[((ptrdiff_t)incX * 16)]), abs_mask_tmp);
+        x_5 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 22) + 1)], ((float*)x)[((ptrdiff_t)incX * 22)], ((float*)x)[(((ptrdiff_t)incX * 20) + 1)], ((float*)x)[((ptrdiff_t)incX * 20)]), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        m_0 = _mm_max_ps(m_0, x_2);
+        m_0 = _mm_max_ps(m_0, x_3);
+        m_0 = _mm_max_ps(m_0, x_4);
+        m_0 = _mm_max_ps(m_0, x_5);
+      }
+      if(i + 8 <= N){
+        x_0 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]), abs_mask_tmp);
+        x_1 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)]), abs_mask_tmp);
+        x_2 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)]), abs_mask_tmp);
+        x_3 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)]), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        m_0 = _mm_max_ps(m_0, x_2);
+        m_0 = _mm_max_ps(m_0, x_3);
+        i += 8, x += ((ptrdiff_t)incX * 16);
+      }
+      if(i + 4 <= N){
+        x_0 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]), abs_mask_tmp);
+        x_1 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)]), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        i += 4, x += ((ptrdiff_t)incX * 8);
+      }
+      if(i + 2 <= N){
+        x_0 = _mm_and_ps(_mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        i += 2, x += ((ptrdiff_t)incX * 4);
+      }
+      if(i < N){
+        x_0 = _mm_and_ps(_mm_set_ps(0, 0, ((float*)x)[1], ((float*)x)[0]), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        x += ((ptrdiff_t)incX * (N - i) * 2);
+      }
+    }
+    _mm_store_ps(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[3] ? max_buffer_tmp[1]: max_buffer_tmp[3]);
+    ((float*)amax)[0] = max_buffer_tmp[0];
+    ((float*)amax)[1] = max_buffer_tmp[1];
+
+  #else
+    int i;
+
+    float x_0, x_1;
+    float m_0, m_1;
+    m_0 = 0;
+    m_1 = 0;
+
+    if(incX == 1){
+
+      for(i = 0; i + 1 <= N; i += 1, x += 2){
+        x_0 = fabsf(((float*)x)[0]);
+        x_1 = fabsf(((float*)x)[1]);
+        m_0 = (m_0 > x_0? m_0: x_0);
+        m_1 = (m_1 > x_1? m_1: x_1);
+      }
+    }else{
+
+      for(i = 0; i + 1 <= N; i += 1, x += ((ptrdiff_t)incX * 2)){
+        x_0 = fabsf(((float*)x)[0]);
+        x_1 = fabsf(((float*)x)[1]);
+        m_0 = (m_0 > x_0? m_0: x_0);
+        m_1 = (m_1 > x_1? m_1: x_1);
+      }
+    }
+    ((float*)amax)[0] = m_0;
+    ((float*)amax)[1] = m_1;
+
+  #endif
+  //[[[end]]]
+}
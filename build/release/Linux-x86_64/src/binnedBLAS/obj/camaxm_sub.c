@@ -0,0 +1,542 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../config.h"
+#include "../common/common.h"
+#include "binnedBLAS.h"
+
+/*[[[cog
+import cog
+import generate
+import dataTypes
+import amaxm
+import vectorizations
+
+code_block = generate.CodeBlock()
+vectorizations.conditionally_include_vectorizations(code_block)
+cog.out(str(code_block))
+]]]*/
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  #include <immintrin.h>
+
+#elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+  #include <immintrin.h>
+
+#elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+  #include <emmintrin.h>
+
+#else
+
+
+#endif
+//[[[end]]]
+
+/**
+ * @internal
+ * @brief  Find maximum magnitude pairwise product between vectors of complex single precision
+ *
+ * Returns the magnitude of the pairwise product of maximum magnitude between X and Y.
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param amaxm scalar return
+ *
+ * @author Willow Ahrens
+ * @date   15 Jan 2016
+ */
+void binnedBLAS_camaxm_sub(const int N, const void *X, const int incX, const void *Y, const int incY, void *amaxm){
+  const float *x = (const float*)X;
+  const float *y = (const float*)Y;
+  /*[[[cog
+  cog.out(generate.generate(amaxm.AMaxM(dataTypes.FloatComplex, "N", "x", "incX", "y", "incY", "amaxm"), cog.inFile, args, params, mode))
+  ]]]*/
+  #if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+    float max_buffer_tmp[16] __attribute__((aligned(64))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m512 x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7;
+    __m512 y_0, y_1, y_2, y_3;
+    __m512 m_0;
+    m_0 = _mm512_setzero_ps();
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 32 <= N; i += 32, x += 64, y += 64){
+        x_0 = _mm512_loadu_ps(((float*)x));
+        x_1 = _mm512_loadu_ps(((float*)x) + 16);
+        x_2 = _mm512_loadu_ps(((float*)x) + 32);
+        x_3 = _mm512_loadu_ps(((float*)x) + 48);
+        y_0 = _mm512_loadu_ps(((float*)y));
+        y_1 = _mm512_loadu_ps(((float*)y) + 16);
+        y_2 = _mm512_loadu_ps(((float*)y) + 32);
+        y_3 = _mm512_loadu_ps(((float*)y) + 48);
+        x_4 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_0, 0xB1), _mm512_permute_ps(y_0, 0xF5)));
+        x_5 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_1, 0xB1), _mm512_permute_ps(y_1, 0xF5)));
+        x_6 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_2, 0xB1), _mm512_permute_ps(y_2, 0xF5)));
+        x_7 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_3, 0xB1), _mm512_permute_ps(y_3, 0xF5)));
+        x_0 = _mm512_abs_ps(_mm512_mul_ps(x_0, _mm512_permute_ps(y_0, 0xA0)));
+        x_1 = _mm512_abs_ps(_mm512_mul_ps(x_1, _mm512_permute_ps(y_1, 0xA0)));
+        x_2 = _mm512_abs_ps(_mm512_mul_ps(x_2, _mm512_permute_ps(y_2, 0xA0)));
+        x_3 = _mm512_abs_ps(_mm512_mul_ps(x_3, _mm512_permute_ps(y_3, 0xA0)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        m_0 = _mm512_max_ps(m_0, x_2);
+        m_0 = _mm512_max_ps(m_0, x_3);
+        m_0 = _mm512_max_ps(m_0, x_4);
+        m_0 = _mm512_max_ps(m_0, x_5);
+        m_0 = _mm512_max_ps(m_0, x_6);
+        m_0 = _mm512_max_ps(m_0, x_7);
+      }
+      if(i + 16 <= N){
+        x_0 = _mm512_loadu_ps(((float*)x));
+        x_1 = _mm512_loadu_ps(((float*)x) + 16);
+        y_0 = _mm512_loadu_ps(((float*)y));
+        y_1 = _mm512_loadu_ps(((float*)y) + 16);
+        x_2 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_0, 0xB1), _mm512_permute_ps(y_0, 0xF5)));
+        x_3 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_1, 0xB1), _mm512_permute_ps(y_1, 0xF5)));
+        x_0 = _mm512_abs_ps(_mm512_mul_ps(x_0, _mm512_permute_ps(y_0, 0xA0)));
+        x_1 = _mm512_abs_ps(_mm512_mul_ps(x_1, _mm512_permute_ps(y_1, 0xA0)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        m_0 = _mm512_max_ps(m_0, x_2);
+        m_0 = _mm512_max_ps(m_0, x_3);
+        i += 16, x += 32, y += 32;
+      }
+      if(i + 8 <= N){
+        x_0 = _mm512_loadu_ps(((float*)x));
+        y_0 = _mm512_loadu_ps(((float*)y));
+        x_1 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_0, 0xB1), _mm512_permute_ps(y_0, 0xF5)));
+        x_0 = _mm512_abs_ps(_mm512_mul_ps(x_0, _mm512_permute_ps(y_0, 0xA0)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        i += 8, x += 16, y += 16;
+      }
+      if(i < N){
+        x_0 = _mm512_maskz_loadu_ps((__mmask16)((1U << ((N - i) * 2)) - 1), ((float*)x));
+        y_0 = _mm512_maskz_loadu_ps((__mmask16)((1U << ((N - i) * 2)) - 1), ((float*)y));
+        x_1 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_0, 0xB1), _mm512_permute_ps(y_0, 0xF5)));
+        x_0 = _mm512_abs_ps(_mm512_mul_ps(x_0, _mm512_permute_ps(y_0, 0xA0)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        x += ((N - i) * 2), y += ((N - i) * 2);
+      }
+    }else{
+
+      for(i = 0; i + 32 <= N; i += 32, x += ((ptrdiff_t)incX * 64), y += ((ptrdiff_t)incY * 64)){
+        x_0 = _mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)], ((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]);
+        x_1 = _mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 30) + 1)], ((float*)x)[((ptrdiff_t)incX * 30)], ((float*)x)[(((ptrdiff_t)incX * 28) + 1)], ((float*)x)[((ptrdiff_t)incX * 28)], ((float*)x)[(((ptrdiff_t)incX * 26) + 1)], ((float*)x)[((ptrdiff_t)incX * 26)], ((float*)x)[(((ptrdiff_t)incX * 24) + 1)], ((float*)x)[((ptrdiff_t)incX * 24)], ((float*)x)[(((ptrdiff_t)incX * 22) + 1)], ((float*)x)[((ptrdiff_t)incX * 22)], ((float*)x)[(((ptrdiff_t)incX * 20) + 1)], ((float*)x)[((ptrdiff_t)incX * 20)], ((float*)x)[(((ptrdiff_t)incX * 18) + 1)], ((float*)x)[((ptrdiff_t)incX * 18)], ((float*)x)[(((ptrdiff_t)incX * 16) + 1)], ((float*)x)[((ptrdiff_t)incX * 16)]);
+        x_2 = _mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 46) + 1)], ((float*)x)[((ptrdiff_t)incX * 46)], ((float*)x)[(((ptrdiff_t)incX * 44) + 1)], ((float*)x)[((ptrdiff_t)incX * 44)], ((float*)x)[(((ptrdiff_t)incX * 42) + 1)], ((float*)x)[((ptrdiff_t)incX * 42)], ((float*)x)[(((ptrdiff_t)incX * 40) + 1)], ((float*)x)[((ptrdiff_t)incX * 40)], ((float*)x)[(((ptrdiff_t)incX * 38) + 1)], ((float*)x)[((ptrdiff_t)incX * 38)], ((float*)x)[(((ptrdiff_t)incX * 36) + 1)], ((float*)x)[((ptrdiff_t)incX * 36)], ((float*)x)[(((ptrdiff_t)incX * 34) + 1)], ((float*)x)[((ptrdiff_t)incX * 34)], ((float*)x)[(((ptrdiff_t)incX * 32) + 1)], ((float*)x)[((ptrdiff_t)incX * 32)]);
+        x_3 = _mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 62) + 1)], ((float*)x)[((ptrdiff_t)incX * 62)], ((float*)x)[(((ptrdiff_t)incX * 60) + 1)], ((float*)x)[((ptrdiff_t)incX * 60)], ((float*)x)[(((ptrdiff_t)incX * 58) + 1)], ((float*)x)[((ptrdiff_t)incX * 58)], ((float*)x)[(((ptrdiff_t)incX * 56) + 1)], ((float*)x)[((ptrdiff_t)incX * 56)], ((float*)x)[(((ptrdiff_t)incX * 54) + 1)], ((float*)x)[((ptrdiff_t)incX * 54)], ((float*)x)[(((ptrdiff_t)incX * 52) + 1)], ((float*)x)[((ptrdiff_t)incX * 52)], ((float*)x)[(((ptrdiff_t)incX * 50) + 1)], ((float*)x)[((ptrdiff_t)incX * 50)], ((float*)x)[(((ptrdiff_t)incX * 48) + 1)], ((float*)x)[((ptrdiff_t)incX * 48)]);
+        y_0 = _mm512_set_ps(((float*)y)[(((ptrdiff_t)incY * 14) + 1)], ((float*)y)[((ptrdiff_t)incY * 14)], ((float*)y)[(((ptrdiff_t)incY * 12) + 1)], ((float*)y)[((ptrdiff_t)incY * 12)], ((float*)y)[(((ptrdiff_t)incY * 10) + 1)], ((float*)y)[((ptrdiff_t)incY * 10)], ((float*)y)[(((ptrdiff_t)incY * 8) + 1)], ((float*)y)[((ptrdiff_t)incY * 8)], ((float*)y)[(((ptrdiff_t)incY * 6) + 1)], ((float*)y)[((ptrdiff_t)incY * 6)], ((float*)y)[(((ptrdiff_t)incY * 4) + 1)], ((float*)y)[((ptrdiff_t)incY * 4)], ((float*)y)[(((ptrdiff_t)incY * 2) + 1)], ((float*)y)[((ptrdiff_t)incY * 2)], ((float*)y)[1], ((float*)y)[0]);
+        y_1 = _mm512_set_ps(((float*)y)[(((ptrdiff_t)incY * 30) + 1)], ((float*)y)[((ptrdiff_t)incY * 30)], ((float*)y)[(((ptrdiff_t)incY * 28) + 1)], ((float*)y)[((ptrdiff_t)incY * 28)], ((float*)y)[(((ptrdiff_t)incY * 26) + 1)], ((float*)y)[((ptrdiff_t)incY * 26)], ((float*)y)[(((ptrdiff_t)incY * 24) + 1)], ((float*)y)[((ptrdiff_t)incY * 24)], ((float*)y)[(((ptrdiff_t)incY * 22) + 1)], ((float*)y)[((ptrdiff_t)incY * 22)], ((float*)y)[(((ptrdiff_t)incY * 20) + 1)], ((float*)y)[((ptrdiff_t)incY * 20)], ((float*)y)[(((ptrdiff_t)incY * 18) + 1)], ((float*)y)[((ptrdiff_t)incY * 18)], ((float*)y)[(((ptrdiff_t)incY * 16) + 1)], ((float*)y)[((ptrdiff_t)incY * 16)]);
+        y_2 = _mm512_set_ps(((float*)y)[(((ptrdiff_t)incY * 46) + 1)], ((float*)y)[((ptrdiff_t)incY * 46)], ((float*)y)[(((ptrdiff_t)incY * 44) + 1)], ((float*)y)[((ptrdiff_t)incY * 44)], ((float*)y)[(((ptrdiff_t)incY * 42) + 1)], ((float*)y)[((ptrdiff_t)incY * 42)], ((float*)y)[(((ptrdiff_t)incY * 40) + 1)], ((float*)y)[((ptrdiff_t)incY * 40)], ((float*)y)[(((ptrdiff_t)incY * 38) + 1)], ((float*)y)[((ptrdiff_t)incY * 38)], ((float*)y)[(((ptrdiff_t)incY * 36) + 1)], ((float*)y)[((ptrdiff_t)incY * 36)], ((float*)y)[(((ptrdiff_t)incY * 34) + 1)], ((float*)y)[((ptrdiff_t)incY * 34)], ((float*)y)[(((ptrdiff_t)incY * 32) + 1)], ((float*)y)[((ptrdiff_t)incY * 32)]);
+        y_3 = _mm512_set_ps(((float*)y)[(((ptrdiff_t)incY * 62) + 1)], ((float*)y)[((ptrdiff_t)incY * 62)], ((float*)y)[(((ptrdiff_t)incY * 60) + 1)], ((float*)y)[((ptrdiff_t)incY * 60)], ((float*)y)[(((ptrdiff_t)incY * 58) + 1)], ((float*)y)[((ptrdiff_t)incY * 58)], ((float*)y)[(((ptrdiff_t)incY * 56) + 1)], ((float*)y)[((ptrdiff_t)incY * 56)], ((float*)y)[(((ptrdiff_t)incY * 54) + 1)], ((float*)y)[((ptrdiff_t)incY * 54)], ((float*)y)[(((ptrdiff_t)incY * 52) + 1)], ((float*)y)[((ptrdiff_t)incY * 52)], ((float*)y)[(((ptrdiff_t)incY * 50) + 1)], ((float*)y)[((ptrdiff_t)incY * 50)], ((float*)y)[(((ptrdiff_t)incY * 48) + 1)], ((float*)y)[((ptrdiff_t)incY * 48)]);
+        x_4 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_0, 0xB1), _mm512_permute_ps(y_0, 0xF5)));
+        x_5 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_1, 0xB1), _mm512_permute_ps(y_1, 0xF5)));
+        x_6 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_2, 0xB1), _mm512_permute_ps(y_2, 0xF5)));
+        x_7 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_3, 0xB1), _mm512_permute_ps(y_3, 0xF5)));
+        x_0 = _mm512_abs_ps(_mm512_mul_ps(x_0, _mm512_permute_ps(y_0, 0xA0)));
+        x_1 = _mm512_abs_ps(_mm512_mul_ps(x_1, _mm512_permute_ps(y_1, 0xA0)));
+        x_2 = _mm512_abs_ps(_mm512_mul_ps(x_2, _mm512_permute_ps(y_2, 0xA0)));
+        x_3 = _mm512_abs_ps(_mm512_mul_ps(x_3, _mm512_permute_ps(y_3, 0xA0)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        m_0 = _mm512_max_ps(m_0, x_2);
+        m_0 = _mm512_max_ps(m_0, x_3);
+        m_0 = _mm512_max_ps(m_0, x_4);
+        m_0 = _mm512_max_ps(m_0, x_5);
+        m_0 = _mm512_max_ps(m_0, x_6);
+        m_0 = _mm512_max_ps(m_0, x_7);
+      }
+      if(i + 16 <= N){
+        x_0 = _mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)], ((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]);
+        x_1 = _mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 30) + 1)], ((float*)x)[((ptrdiff_t)incX * 30)], ((float*)x)[(((ptrdiff_t)incX * 28) + 1)], ((float*)x)[((ptrdiff_t)incX * 28)], ((float*)x)[(((ptrdiff_t)incX * 26) + 1)], ((float*)x)[((ptrdiff_t)incX * 26)], ((float*)x)[(((ptrdiff_t)incX * 24) + 1)], ((float*)x)[((ptrdiff_t)incX * 24)], ((float*)x)[(((ptrdiff_t)incX * 22) + 1)], ((float*)x)[((ptrdiff_t)incX * 22)], ((float*)x)[(((ptrdiff_t)incX * 20) + 1)], ((float*)x)[((ptrdiff_t)incX * 20)], ((float*)x)[(((ptrdiff_t)incX * 18) + 1)], ((float*)x)[((ptrdiff_t)incX * 18)], ((float*)x)[(((ptrdiff_t)incX * 16) + 1)], ((float*)x)[((ptrdiff_t)incX * 16)]);
+        y_0 = _mm512_set_ps(((float*)y)[(((ptrdiff_t)incY * 14) + 1)], ((float*)y)[((ptrdiff_t)incY * 14)], ((float*)y)[(((ptrdiff_t)incY * 12) + 1)], ((float*)y)[((ptrdiff_t)incY * 12)], ((float*)y)[(((ptrdiff_t)incY * 10) + 1)], ((float*)y)[((ptrdiff_t)incY * 10)], ((float*)y)[(((ptrdiff_t)incY * 8) + 1)], ((float*)y)[((ptrdiff_t)incY * 8)], ((float*)y)[(((ptrdiff_t)incY * 6) + 1)], ((float*)y)[((ptrdiff_t)incY * 6)], ((float*)y)[(((ptrdiff_t)incY * 4) + 1)], ((float*)y)[((ptrdiff_t)incY * 4)], ((float*)y)[(((ptrdiff_t)incY * 2) + 1)], ((float*)y)[((ptrdiff_t)incY * 2)], ((float*)y)[1], ((float*)y)[0]);
+        y_1 = _mm512_set_ps(((float*)y)[(((ptrdiff_t)incY * 30) + 1)], ((float*)y)[((ptrdiff_t)incY * 30)], ((float*)y)[(((ptrdiff_t)incY * 28) + 1)], ((float*)y)[((ptrdiff_t)incY * 28)], ((float*)y)[(((ptrdiff_t)incY * 26) + 1)], ((float*)y)[((ptrdiff_t)incY * 26)], ((float*)y)[(((ptrdiff_t)incY * 24) + 1)], ((float*)y)[((ptrdiff_t)incY * 24)], ((float*)y)[(((ptrdiff_t)incY * 22) + 1)], ((float*)y)[((ptrdiff_t)incY * 22)], ((float*)y)[(((ptrdiff_t)incY * 20) + 1)], ((float*)y)[((ptrdiff_t)incY * 20)], ((float*)y)[(((ptrdiff_t)incY * 18) + 1)], ((float*)y)[((ptrdiff_t)incY * 18)], ((float*)y)[(((ptrdiff_t)incY * 16) + 1)], ((float*)y)[((ptrdiff_t)incY * 16)]);
+        x_2 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_0, 0xB1), _mm512_permute_ps(y_0, 0xF5)));
+        x_3 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_1, 0xB1), _mm512_permute_ps(y_1, 0xF5)));
+        x_0 = _mm512_abs_ps(_mm512_mul_ps(x_0, _mm512_permute_ps(y_0, 0xA0)));
+        x_1 = _mm512_abs_ps(_mm512_mul_ps(x_1, _mm512_permute_ps(y_1, 0xA0)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        m_0 = _mm512_max_ps(m_0, x_2);
+        m_0 = _mm512_max_ps(m_0, x_3);
+        i += 16, x += ((ptrdiff_t)incX * 32), y += ((ptrdiff_t)incY * 32);
+      }
+      if(i + 8 <= N){
+        x_0 = _mm512_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)], ((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]);
+        y_0 = _mm512_set_ps(((float*)y)[(((ptrdiff_t)incY * 14) + 1)], ((float*)y)[((ptrdiff_t)incY * 14)], ((float*)y)[(((ptrdiff_t)incY * 12) + 1)], ((float*)y)[((ptrdiff_t)incY * 12)], ((float*)y)[(((ptrdiff_t)incY * 10) + 1)], ((float*)y)[((ptrdiff_t)incY * 10)], ((float*)y)[(((ptrdiff_t)incY * 8) + 1)], ((float*)y)[((ptrdiff_t)incY * 8)], ((float*)y)[(((ptrdiff_t)incY * 6) + 1)], ((float*)y)[((ptrdiff_t)incY * 6)], ((float*)y)[(((ptrdiff_t)incY * 4) + 1)], ((float*)y)[((ptrdiff_t)incY * 4)], ((float*)y)[(((ptrdiff_t)incY * 2) + 1)], ((float*)y)[((ptrdiff_t)incY * 2)], ((float*)y)[1], ((float*)y)[0]);
+        x_1 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_0, 0xB1), _mm512_permute_ps(y_0, 0xF5)));
+        x_0 = _mm512_abs_ps(_mm512_mul_ps(x_0, _mm512_permute_ps(y_0, 0xA0)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        i += 8, x += ((ptrdiff_t)incX * 16), y += ((ptrdiff_t)incY * 16);
+      }
+      if(i < N){
+        x_0 = _mm512_castpd_ps(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), (double*)((float*)x), 8));
+        y_0 = _mm512_castpd_ps(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incY * 7), ((ptrdiff_t)incY * 6), ((ptrdiff_t)incY * 5), ((ptrdiff_t)incY * 4), ((ptrdiff_t)incY * 3), ((ptrdiff_t)incY * 2), (ptrdiff_t)incY, 0), (double*)((float*)y), 8));
+        x_1 = _mm512_abs_ps(_mm512_mul_ps(_mm512_permute_ps(x_0, 0xB1), _mm512_permute_ps(y_0, 0xF5)));
+        x_0 = _mm512_abs_ps(_mm512_mul_ps(x_0, _mm512_permute_ps(y_0, 0xA0)));
+        m_0 = _mm512_max_ps(m_0, x_0);
+        m_0 = _mm512_max_ps(m_0, x_1);
+        x += ((ptrdiff_t)incX * (N - i) * 2), y += ((ptrdiff_t)incY * (N - i) * 2);
+      }
+    }
+    _mm512_store_ps(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[3] ? max_buffer_tmp[1]: max_buffer_tmp[3]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[5] ? max_buffer_tmp[1]: max_buffer_tmp[5]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[7] ? max_buffer_tmp[1]: max_buffer_tmp[7]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[8] ? max_buffer_tmp[0]: max_buffer_tmp[8]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[9] ? max_buffer_tmp[1]: max_buffer_tmp[9]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[10] ? max_buffer_tmp[0]: max_buffer_tmp[10]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[11] ? max_buffer_tmp[1]: max_buffer_tmp[11]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[12] ? max_buffer_tmp[0]: max_buffer_tmp[12]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[13] ? max_buffer_tmp[1]: max_buffer_tmp[13]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[14] ? max_buffer_tmp[0]: max_buffer_tmp[14]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[15] ? max_buffer_tmp[1]: max_buffer_tmp[15]);
+    ((float*)amaxm)[0] = max_buffer_tmp[0];
+    ((float*)amaxm)[1] = max_buffer_tmp[1];
+
+  #elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+    __m256 abs_mask_tmp;
+    {
+      __m256 tmp;
+      tmp = _mm256_set1_ps(1);
+      abs_mask_tmp = _mm256_set1_ps(-1);
+      abs_mask_tmp = _mm256_xor_ps(abs_mask_tmp, tmp);
+      tmp = _mm256_cmp_ps(tmp, tmp, 0);
+      abs_mask_tmp = _mm256_xor_ps(abs_mask_tmp, tmp);
+    }
+    float max_buffer_tmp[8] __attribute__((aligned(32))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m256 x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7;
+    __m256 y_0, y_1, y_2, y_3;
+    __m256 m_0;
+    m_0 = _mm256_setzero_ps();
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 16 <= N; i += 16, x += 32, y += 32){
+        x_0 = _mm256_loadu_ps(((float*)x));
+        x_1 = _mm256_loadu_ps(((float*)x) + 8);
+        x_2 = _mm256_loadu_ps(((float*)x) + 16);
+        x_3 = _mm256_loadu_ps(((float*)x) + 24);
+        y_0 = _mm256_loadu_ps(((float*)y));
+        y_1 = _mm256_loadu_ps(((float*)y) + 8);
+        y_2 = _mm256_loadu_ps(((float*)y) + 16);
+        y_3 = _mm256_loadu_ps(((float*)y) + 24);
+        x_4 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_0, 0xB1), _mm256_permute_ps(y_0, 0xF5)), abs_mask_tmp);
+        x_5 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_1, 0xB1), _mm256_permute_ps(y_1, 0xF5)), abs_mask_tmp);
+        x_6 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_2, 0xB1), _mm256_permute_ps(y_2, 0xF5)), abs_mask_tmp);
+        x_7 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_3, 0xB1), _mm256_permute_ps(y_3, 0xF5)), abs_mask_tmp);
+        x_0 = _mm256_and_ps(_mm256_mul_ps(x_0, _mm256_permute_ps(y_0, 0xA0)), abs_mask_tmp);
+        x_1 = _mm256_and_ps(_mm256_mul_ps(x_1, _mm256_permute_ps(y_1, 0xA0)), abs_mask_tmp);
+        x_2 = _mm256_and_ps(_mm256_mul_ps(x_2, _mm256_permute_ps(y_2, 0xA0)), abs_mask_tmp);
+        x_3 = _mm256_and_ps(_mm256_mul_ps(x_3, _mm256_permute_ps(y_3, 0xA0)), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        m_0 = _mm256_max_ps(m_0, x_2);
+        m_0 = _mm256_max_ps(m_0, x_3);
+        m_0 = _mm256_max_ps(m_0, x_4);
+        m_0 = _mm256_max_ps(m_0, x_5);
+        m_0 = _mm256_max_ps(m_0, x_6);
+        m_0 = _mm256_max_ps(m_0, x_7);
+      }
+      if(i + 8 <= N){
+        x_0 = _mm256_loadu_ps(((float*)x));
+        x_1 = _mm256_loadu_ps(((float*)x) + 8);
+        y_0 = _mm256_loadu_ps(((float*)y));
+        y_1 = _mm256_loadu_ps(((float*)y) + 8);
+        x_2 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_0, 0xB1), _mm256_permute_ps(y_0, 0xF5)), abs_mask_tmp);
+        x_3 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_1, 0xB1), _mm256_permute_ps(y_1, 0xF5)), abs_mask_tmp);
+        x_0 = _mm256_and_ps(_mm256_mul_ps(x_0, _mm256_permute_ps(y_0, 0xA0)), abs_mask_tmp);
+        x_1 = _mm256_and_ps(_mm256_mul_ps(x_1, _mm256_permute_ps(y_1, 0xA0)), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        m_0 = _mm256_max_ps(m_0, x_2);
+        m_0 = _mm256_max_ps(m_0, x_3);
+        i += 8, x += 16, y += 16;
+      }
+      if(i + 4 <= N){
+        x_0 = _mm256_loadu_ps(((float*)x));
+        y_0 = _mm256_loadu_ps(((float*)y));
+        x_1 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_0, 0xB1), _mm256_permute_ps(y_0, 0xF5)), abs_mask_tmp);
+        x_0 = _mm256_and_ps(_mm256_mul_ps(x_0, _mm256_permute_ps(y_0, 0xA0)), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        i += 4, x += 8, y += 8;
+      }
+      if(i < N){
+        x_0 = (__m256)_mm256_set_pd(0, (N - i)>2?((double*)((float*)x))[2]:0, (N - i)>1?((double*)((float*)x))[1]:0, ((double*)((float*)x))[0]);
+        y_0 = (__m256)_mm256_set_pd(0, (N - i)>2?((double*)((float*)y))[2]:0, (N - i)>1?((double*)((float*)y))[1]:0, ((double*)((float*)y))[0]);
+        x_1 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_0, 0xB1), _mm256_permute_ps(y_0, 0xF5)), abs_mask_tmp);
+        x_0 = _mm256_and_ps(_mm256_mul_ps(x_0, _mm256_permute_ps(y_0, 0xA0)), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        x += ((N - i) * 2), y += ((N - i) * 2);
+      }
+    }else{
+
+      for(i = 0; i + 16 <= N; i += 16, x += ((ptrdiff_t)incX * 32), y += ((ptrdiff_t)incY * 32)){
+        x_0 = _mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]);
+        x_1 = _mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)]);
+        x_2 = _mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 22) + 1)], ((float*)x)[((ptrdiff_t)incX * 22)], ((float*)x)[(((ptrdiff_t)incX * 20) + 1)], ((float*)x)[((ptrdiff_t)incX * 20)], ((float*)x)[(((ptrdiff_t)incX * 18) + 1)], ((float*)x)[((ptrdiff_t)incX * 18)], ((float*)x)[(((ptrdiff_t)incX * 16) + 1)], ((float*)x)[((ptrdiff_t)incX * 16)]);
+        x_3 = _mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 30) + 1)], ((float*)x)[((ptrdiff_t)incX * 30)], ((float*)x)[(((ptrdiff_t)incX * 28) + 1)], ((float*)x)[((ptrdiff_t)incX * 28)], ((float*)x)[(((ptrdiff_t)incX * 26) + 1)], ((float*)x)[((ptrdiff_t)incX * 26)], ((float*)x)[(((ptrdiff_t)incX * 24) + 1)], ((float*)x)[((ptrdiff_t)incX * 24)]);
+        y_0 = _mm256_set_ps(((float*)y)[(((ptrdiff_t)incY * 6) + 1)], ((float*)y)[((ptrdiff_t)incY * 6)], ((float*)y)[(((ptrdiff_t)incY * 4) + 1)], ((float*)y)[((ptrdiff_t)incY * 4)], ((float*)y)[(((ptrdiff_t)incY * 2) + 1)], ((float*)y)[((ptrdiff_t)incY * 2)], ((float*)y)[1], ((float*)y)[0]);
+        y_1 = _mm256_set_ps(((float*)y)[(((ptrdiff_t)incY * 14) + 1)], ((float*)y)[((ptrdiff_t)incY * 14)], ((float*)y)[(((ptrdiff_t)incY * 12) + 1)], ((float*)y)[((ptrdiff_t)incY * 12)], ((float*)y)[(((ptrdiff_t)incY * 10) + 1)], ((float*)y)[((ptrdiff_t)incY * 10)], ((float*)y)[(((ptrdiff_t)incY * 8) + 1)], ((float*)y)[((ptrdiff_t)incY * 8)]);
+        y_2 = _mm256_set_ps(((float*)y)[(((ptrdiff_t)incY * 22) + 1)], ((float*)y)[((ptrdiff_t)incY * 22)], ((float*)y)[(((ptrdiff_t)incY * 20) + 1)], ((float*)y)[((ptrdiff_t)incY * 20)], ((float*)y)[(((ptrdiff_t)incY * 18) + 1)], ((float*)y)[((ptrdiff_t)incY * 18)], ((float*)y)[(((ptrdiff_t)incY * 16) + 1)], ((float*)y)[((ptrdiff_t)incY * 16)]);
+        y_3 = _mm256_set_ps(((float*)y)[(((ptrdiff_t)incY * 30) + 1)], ((float*)y)[((ptrdiff_t)incY * 30)], ((float*)y)[(((ptrdiff_t)incY * 28) + 1)], ((float*)y)[((ptrdiff_t)incY * 28)], ((float*)y)[(((ptrdiff_t)incY * 26) + 1)], ((float*)y)[((ptrdiff_t)incY * 26)], ((float*)y)[(((ptrdiff_t)incY * 24) + 1)], ((float*)y)[((ptrdiff_t)incY * 24)]);
+        x_4 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_0, 0xB1), _mm256_permute_ps(y_0, 0xF5)), abs_mask_tmp);
+        x_5 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_1, 0xB1), _mm256_permute_ps(y_1, 0xF5)), abs_mask_tmp);
+        x_6 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_2, 0xB1), _mm256_permute_ps(y_2, 0xF5)), abs_mask_tmp);
+        x_7 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_3, 0xB1), _mm256_permute_ps(y_3, 0xF5)), abs_mask_tmp);
+        x_0 = _mm256_and_ps(_mm256_mul_ps(x_0, _mm256_permute_ps(y_0, 0xA0)), abs_mask_tmp);
+        x_1 = _mm256_and_ps(_mm256_mul_ps(x_1, _mm256_permute_ps(y_1, 0xA0)), abs_mask_tmp);
+        x_2 = _mm256_and_ps(_mm256_mul_ps(x_2, _mm256_permute_ps(y_2, 0xA0)), abs_mask_tmp);
+        x_3 = _mm256_and_ps(_mm256_mul_ps(x_3, _mm256_permute_ps(y_3, 0xA0)), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        m_0 = _mm256_max_ps(m_0, x_2);
+        m_0 = _mm256_max_ps(m_0, x_3);
+        m_0 = _mm256_max_ps(m_0, x_4);
+        m_0 = _mm256_max_ps(m_0, x_5);
+        m_0 = _mm256_max_ps(m_0, x_6);
+        m_0 = _mm256_max_ps(m_0, x_7);
+      }
+      if(i + 8 <= N){
+        x_0 = _mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]);
+        x_1 = _mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 14) + 1)], ((float*)x)[((ptrdiff_t)incX * 14)], ((float*)x)[(((ptrdiff_t)incX * 12) + 1)], ((float*)x)[((ptrdiff_t)incX * 12)], ((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)]);
+        y_0 = _mm256_set_ps(((float*)y)[(((ptrdiff_t)incY * 6) + 1)], ((float*)y)[((ptrdiff_t)incY * 6)], ((float*)y)[(((ptrdiff_t)incY * 4) + 1)], ((float*)y)[((ptrdiff_t)incY * 4)], ((float*)y)[(((ptrdiff_t)incY * 2) + 1)], ((float*)y)[((ptrdiff_t)incY * 2)], ((float*)y)[1], ((float*)y)[0]);
+        y_1 = _mm256_set_ps(((float*)y)[(((ptrdiff_t)incY * 14) + 1)], ((float*)y)[((ptrdiff_t)incY * 14)], ((float*)y)[(((ptrdiff_t)incY * 12) + 1)], ((float*)y)[((ptrdiff_t)incY * 12)], ((float*)y)[(((ptrdiff_t)incY * 10) + 1)], ((float*)y)[((ptrdiff_t)incY * 10)], ((float*)y)[(((ptrdiff_t)incY * 8) + 1)], ((float*)y)[((ptrdiff_t)incY * 8)]);
+        x_2 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_0, 0xB1), _mm256_permute_ps(y_0, 0xF5)), abs_mask_tmp);
+        x_3 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_1, 0xB1), _mm256_permute_ps(y_1, 0xF5)), abs_mask_tmp);
+        x_0 = _mm256_and_ps(_mm256_mul_ps(x_0, _mm256_permute_ps(y_0, 0xA0)), abs_mask_tmp);
+        x_1 = _mm256_and_ps(_mm256_mul_ps(x_1, _mm256_permute_ps(y_1, 0xA0)), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        m_0 = _mm256_max_ps(m_0, x_2);
+        m_0 = _mm256_max_ps(m_0, x_3);
+        i += 8, x += ((ptrdiff_t)incX * 16), y += ((ptrdiff_t)incY * 16);
+      }
+      if(i + 4 <= N){
+        x_0 = _mm256_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)], ((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]);
+        y_0 = _mm256_set_ps(((float*)y)[(((ptrdiff_t)incY * 6) + 1)], ((float*)y)[((ptrdiff_t)incY * 6)], ((float*)y)[(((ptrdiff_t)incY * 4) + 1)], ((float*)y)[((ptrdiff_t)incY * 4)], ((float*)y)[(((ptrdiff_t)incY * 2) + 1)], ((float*)y)[((ptrdiff_t)incY * 2)], ((float*)y)[1], ((float*)y)[0]);
+        x_1 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_0, 0xB1), _mm256_permute_ps(y_0, 0xF5)), abs_mask_tmp);
+        x_0 = _mm256_and_ps(_mm256_mul_ps(x_0, _mm256_permute_ps(y_0, 0xA0)), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        i += 4, x += ((ptrdiff_t)incX * 8), y += ((ptrdiff_t)incY * 8);
+      }
+      if(i < N){
+        x_0 = (__m256)_mm256_set_pd(0, (N - i)>2?((double*)((float*)x))[((ptrdiff_t)incX * 2)]:0, (N - i)>1?((double*)((float*)x))[(ptrdiff_t)incX]:0, ((double*)((float*)x))[0]);
+        y_0 = (__m256)_mm256_set_pd(0, (N - i)>2?((double*)((float*)y))[((ptrdiff_t)incY * 2)]:0, (N - i)>1?((double*)((float*)y))[(ptrdiff_t)incY]:0, ((double*)((float*)y))[0]);
+        x_1 = _mm256_and_ps(_mm256_mul_ps(_mm256_permute_ps(x_0, 0xB1), _mm256_permute_ps(y_0, 0xF5)), abs_mask_tmp);
+        x_0 = _mm256_and_ps(_mm256_mul_ps(x_0, _mm256_permute_ps(y_0, 0xA0)), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, x_0);
+        m_0 = _mm256_max_ps(m_0, x_1);
+        x += ((ptrdiff_t)incX * (N - i) * 2), y += ((ptrdiff_t)incY * (N - i) * 2);
+      }
+    }
+    _mm256_store_ps(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[3] ? max_buffer_tmp[1]: max_buffer_tmp[3]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[5] ? max_buffer_tmp[1]: max_buffer_tmp[5]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[7] ? max_buffer_tmp[1]: max_buffer_tmp[7]);
+    ((float*)amaxm)[0] = max_buffer_tmp[0];
+    ((float*)amaxm)[1] = max_buffer_tmp[1];
+
+  #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+    __m128 abs_mask_tmp;
+    {
+      __m128 tmp;
+      tmp = _mm_set1_ps(1);
+      abs_mask_tmp = _mm_set1_ps(-1);
+      abs_mask_tmp = _mm_xor_ps(abs_mask_tmp, tmp);
+      tmp = _mm_cmpeq_ps(tmp, tmp);
+      abs_mask_tmp = _mm_xor_ps(abs_mask_tmp, tmp);
+    }
+    float max_buffer_tmp[4] __attribute__((aligned(16))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m128 x_0, x_1, x_2, x_3, x_4, x_5;
+    __m128 y_0, y_1, y_2;
+    __m128 m_0;
+    m_0 = _mm_setzero_ps();
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 6 <= N; i += 6, x += 12, y += 12){
+        x_0 = _mm_loadu_ps(((float*)x));
+        x_1 = _mm_loadu_ps(((float*)x) + 4);
+        x_2 = _mm_loadu_ps(((float*)x) + 8);
+        y_0 = _mm_loadu_ps(((float*)y));
+        y_1 = _mm_loadu_ps(((float*)y) + 4);
+        y_2 = _mm_loadu_ps(((float*)y) + 8);
+        x_3 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_0, x_0, 0xB1), _mm_shuffle_ps(y_0, y_0, 0xF5)), abs_mask_tmp);
+        x_4 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_1, x_1, 0xB1), _mm_shuffle_ps(y_1, y_1, 0xF5)), abs_mask_tmp);
+        x_5 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_2, x_2, 0xB1), _mm_shuffle_ps(y_2, y_2, 0xF5)), abs_mask_tmp);
+        x_0 = _mm_and_ps(_mm_mul_ps(x_0, _mm_shuffle_ps(y_0, y_0, 0xA0)), abs_mask_tmp);
+        x_1 = _mm_and_ps(_mm_mul_ps(x_1, _mm_shuffle_ps(y_1, y_1, 0xA0)), abs_mask_tmp);
+        x_2 = _mm_and_ps(_mm_mul_ps(x_2, _mm_shuffle_ps(y_2, y_2, 0xA0)), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        m_0 = _mm_max_ps(m_0, x_2);
+        m_0 = _mm_max_ps(m_0, x_3);
+        m_0 = _mm_max_ps(m_0, x_4);
+        m_0 = _mm_max_ps(m_0, x_5);
+      }
+      if(i + 4 <= N){
+        x_0 = _mm_loadu_ps(((float*)x));
+        x_1 = _mm_loadu_ps(((float*)x) + 4);
+        y_0 = _mm_loadu_ps(((float*)y));
+        y_1 = _mm_loadu_ps(((float*)y) + 4);
+        x_2 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_0, x_0, 0xB1), _mm_shuffle_ps(y_0, y_0, 0xF5)), abs_mask_tmp);
+        x_3 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_1, x_1, 0xB1), _mm_shuffle_ps(y_1, y_1, 0xF5)), abs_mask_tmp);
+        x_0 = _mm_and_ps(_mm_mul_ps(x_0, _mm_shuffle_ps(y_0, y_0, 0xA0)), abs_mask_tmp);
+        x_1 = _mm_and_ps(_mm_mul_ps(x_1, _mm_shuffle_ps(y_1, y_1, 0xA0)), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        m_0 = _mm_max_ps(m_0, x_2);
+        m_0 = _mm_max_ps(m_0, x_3);
+        i += 4, x += 8, y += 8;
+      }
+      if(i + 2 <= N){
+        x_0 = _mm_loadu_ps(((float*)x));
+        y_0 = _mm_loadu_ps(((float*)y));
+        x_1 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_0, x_0, 0xB1), _mm_shuffle_ps(y_0, y_0, 0xF5)), abs_mask_tmp);
+        x_0 = _mm_and_ps(_mm_mul_ps(x_0, _mm_shuffle_ps(y_0, y_0, 0xA0)), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        i += 2, x += 4, y += 4;
+      }
+      if(i < N){
+        x_0 = _mm_set_ps(0, 0, ((float*)x)[1], ((float*)x)[0]);
+        y_0 = _mm_set_ps(0, 0, ((float*)y)[1], ((float*)y)[0]);
+        x_1 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_0, x_0, 0xB1), _mm_shuffle_ps(y_0, y_0, 0xF5)), abs_mask_tmp);
+        x_0 = _mm_and_ps(_mm_mul_ps(x_0, _mm_shuffle_ps(y_0, y_0, 0xA0)), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        x += ((N - i) * 2), y += ((N - i) * 2);
+      }
+    }else{
+
+      for(i = 0; i + 6 <= N; i += 6, x += ((ptrdiff_t)incX * 12), y += ((ptrdiff_t)incY * 12)){
+        x_0 = _mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]);
+        x_1 = _mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)]);
+        x_2 = _mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 10) + 1)], ((float*)x)[((ptrdiff_t)incX * 10)], ((float*)x)[(((ptrdiff_t)incX * 8) + 1)], ((float*)x)[((ptrdiff_t)incX * 8)]);
+        y_0 = _mm_set_ps(((float*)y)[(((ptrdiff_t)incY * 2) + 1)], ((float*)y)[((ptrdiff_t)incY * 2)], ((float*)y)[1], ((float*)y)[0]);
+        y_1 = _mm_set_ps(((float*)y)[(((ptrdiff_t)incY * 6) + 1)], ((float*)y)[((ptrdiff_t)incY * 6)], ((float*)y)[(((ptrdiff_t)incY * 4) + 1)], ((float*)y)[((ptrdiff_t)incY * 4)]);
+        y_2 = _mm_set_ps(((float*)y)[(((ptrdiff_t)incY * 10) + 1)], ((float*)y)[((ptrdiff_t)incY * 10)], ((float*)y)[(((ptrdiff_t)incY * 8) + 1)], ((float*)y)[((ptrdiff_t)incY * 8)]);
+        x_3 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_0, x_0, 0xB1), _mm_shuffle_ps(y_0, y_0, 0xF5)), abs_mask_tmp);
+        x_4 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_1, x_1, 0xB1), _mm_shuffle_ps(y_1, y_1, 0xF5)), abs_mask_tmp);
+        x_5 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_2, x_2, 0xB1), _mm_shuffle_ps(y_2, y_2, 0xF5)), abs_mask_tmp);
+        x_0 = _mm_and_ps(_mm_mul_ps(x_0, _mm_shuffle_ps(y_0, y_0, 0xA0)), abs_mask_tmp);
+        x_1 = _mm_and_ps(_mm_mul_ps(x_1, _mm_shuffle_ps(y_1, y_1, 0xA0)), abs_mask_tmp);
+        x_2 = _mm_and_ps(_mm_mul_ps(x_2, _mm_shuffle_ps(y_2, y_2, 0xA0)), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        m_0 = _mm_max_ps(m_0, x_2);
+        m_0 = _mm_max_ps(m_0, x_3);
+        m_0 = _mm_max_ps(m_0, x_4);
+        m_0 = _mm_max_ps(m_0, x_5);
+      }
+      if(i + 4 <= N){
+        x_0 = _mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]);
+        x_1 = _mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 6) + 1)], ((float*)x)[((ptrdiff_t)incX * 6)], ((float*)x)[(((ptrdiff_t)incX * 4) + 1)], ((float*)x)[((ptrdiff_t)incX * 4)]);
+        y_0 = _mm_set_ps(((float*)y)[(((ptrdiff_t)incY * 2) + 1)], ((float*)y)[((ptrdiff_t)incY * 2)], ((float*)y)[1], ((float*)y)[0]);
+        y_1 = _mm_set_ps(((float*)y)[(((ptrdiff_t)incY * 6) + 1)], ((float*)y)[((ptrdiff_t)incY * 6)], ((float*)y)[(((ptrdiff_t)incY * 4) + 1)], ((float*)y)[((ptrdiff_t)incY * 4)]);
+        x_2 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_0, x_0, 0xB1), _mm_shuffle_ps(y_0, y_0, 0xF5)), abs_mask_tmp);
+        x_3 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_1, x_1, 0xB1), _mm_shuffle_ps(y_1, y_1, 0xF5)), abs_mask_tmp);
+        x_0 = _mm_and_ps(_mm_mul_ps(x_0, _mm_shuffle_ps(y_0, y_0, 0xA0)), abs_mask_tmp);
+        x_1 = _mm_and_ps(_mm_mul_ps(x_1, _mm_shuffle_ps(y_1, y_1, 0xA0)), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        m_0 = _mm_max_ps(m_0, x_2);
+        m_0 = _mm_max_ps(m_0, x_3);
+        i += 4, x += ((ptrdiff_t)incX * 8), y += ((ptrdiff_t)incY * 8);
+      }
+      if(i + 2 <= N){
+        x_0 = _mm_set_ps(((float*)x)[(((ptrdiff_t)incX * 2) + 1)], ((float*)x)[((ptrdiff_t)incX * 2)], ((float*)x)[1], ((float*)x)[0]);
+        y_0 = _mm_set_ps(((float*)y)[(((ptrdiff_t)incY * 2) + 1)], ((float*)y)[((ptrdiff_t)incY * 2)], ((float*)y)[1], ((float*)y)[0]);
+        x_1 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_0, x_0, 0xB1), _mm_shuffle_ps(y_0, y_0, 0xF5)), abs_mask_tmp);
+        x_0 = _mm_and_ps(_mm_mul_ps(x_0, _mm_shuffle_ps(y_0, y_0, 0xA0)), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        i += 2, x += ((ptrdiff_t)incX * 4), y += ((ptrdiff_t)incY * 4);
+      }
+      if(i < N){
+        x_0 = _mm_set_ps(0, 0, ((float*)x)[1], ((float*)x)[0]);
+        y_0 = _mm_set_ps(0, 0, ((float*)y)[1], ((float*)y)[0]);
+        x_1 = _mm_and_ps(_mm_mul_ps(_mm_shuffle_ps(x_0, x_0, 0xB1), _mm_shuffle_ps(y_0, y_0, 0xF5)), abs_mask_tmp);
+        x_0 = _mm_and_ps(_mm_mul_ps(x_0, _mm_shuffle_ps(y_0, y_0, 0xA0)), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, x_0);
+        m_0 = _mm_max_ps(m_0, x_1);
+        x += ((ptrdiff_t)incX * (N - i) * 2), y += ((ptrdiff_t)incY * (N - i) * 2);
+      }
+    }
+    _mm_store_ps(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[1] = (max_buffer_tmp[1] > max_buffer_tmp[3] ? max_buffer_tmp[1]: max_buffer_tmp[3]);
+    ((float*)amaxm)[0] = max_buffer_tmp[0];
+    ((float*)amaxm)[1] = max_buffer_tmp[1];
+
+  #else
+    int i;
+
+    float x_0, x_1, x_2, x_3;
+    float y_0, y_1;
+    float m_0, m_1;
+    m_0 = 0;
+    m_1 = 0;
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 1 <= N; i += 1, x += 2, y += 2){
+        x_0 = ((float*)x)[0];
+        x_1 = ((float*)x)[1];
+        y_0 = ((float*)y)[0];
+        y_1 = ((float*)y)[1];
+        x_2 = fabsf((x_1 * y_1));
+        x_3 = fabsf((x_0 * y_1));
+        x_0 = fabsf((x_0 * y_0));
+        x_1 = fabsf((x_1 * y_0));
+        m_0 = (m_0 > x_0? m_0: x_0);
+        m_1 = (m_1 > x_1? m_1: x_1);
+        m_0 = (m_0 > x_2? m_0: x_2);
+        m_1 = (m_1 > x_3? m_1: x_3);
+      }
+    }else{
+
+      for(i = 0; i + 1 <= N; i += 1, x += ((ptrdiff_t)incX * 2), y += ((ptrdiff_t)incY * 2)){
+        x_0 = ((float*)x)[0];
+        x_1 = ((float*)x)[1];
+        y_0 = ((float*)y)[0];
+        y_1 = ((float*)y)[1];
+        x_2 = fabsf((x_1 * y_1));
+        x_3 = fabsf((x_0 * y_1));
+        x_0 = fabsf((x_0 * y_0));
+        x_1 = fabsf((x_1 * y_0));
+        m_0 = (m_0 > x_0? m_0: x_0);
+        m_1 = (m_1 > x_1? m_1: x_1);
+        m_0 = (m_0 > x_2? m_0: x_2);
+        m_1 = (m_1 > x_3? m_1: x_3);
+      }
+    }
+    ((float*)amaxm)[0] = m_0;
+    ((float*)amaxm)[1] = m_1;
+
+  #endif
+  //[[[end]]]
+}
@@ -0,0 +1,550 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../config.h"
+#include "../common/common.h"
+#include "binnedBLAS.h"
+
+/*[[[cog
+import cog
+import generate
+import dataTypes
+import amaxm
+import vectorizations
+
+code_block = generate.CodeBlock()
+vectorizations.conditionally_include_vectorizations(code_block)
+cog.out(str(code_block))
+]]]*/
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  #include <immintrin.h>
+
+#elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+  #include <immintrin.h>
+
+#elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+  #include <emmintrin.h>
+
+#else
+
+
+#endif
+//[[[end]]]
+
+/**
+ * @internal
+ * @brief  Find maximum absolute value pairwise product between vectors of double precision
+ *
+ * Returns the absolute value of the pairwise product of maximum absolute value between X and Y.
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return absolute maximum value multiple of X and Y
+ *
+ * @author Willow Ahrens
+ * @date   15 Jan 2016
+ */
+double binnedBLAS_damaxm(const int N, const double *X, const int incX, const double *Y, const int incY){
+  double amaxm;
+  /*[[[cog
+  cog.out(generate.generate(amaxm.AMaxM(dataTypes.Double, "N", "X", "incX", "Y", "incY", "(&amaxm)"), cog.inFile, args, params, mode))
+  ]]]*/
+  #if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+    double max_buffer_tmp[8] __attribute__((aligned(64))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m512d X_0, X_1, X_2, X_3, X_4, X_5, X_6;
+    __m512d Y_0, Y_1, Y_2, Y_3, Y_4, Y_5, Y_6;
+    __m512d m_0;
+    m_0 = _mm512_setzero_pd();
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 56 <= N; i += 56, X += 56, Y += 56){
+        X_0 = _mm512_loadu_pd(X);
+        X_1 = _mm512_loadu_pd(X + 8);
+        X_2 = _mm512_loadu_pd(X + 16);
+        X_3 = _mm512_loadu_pd(X + 24);
+        X_4 = _mm512_loadu_pd(X + 32);
+        X_5 = _mm512_loadu_pd(X + 40);
+        X_6 = _mm512_loadu_pd(X + 48);
+        Y_0 = _mm512_loadu_pd(Y);
+        Y_1 = _mm512_loadu_pd(Y + 8);
+        Y_2 = _mm512_loadu_pd(Y + 16);
+        Y_3 = _mm512_loadu_pd(Y + 24);
+        Y_4 = _mm512_loadu_pd(Y + 32);
+        Y_5 = _mm512_loadu_pd(Y + 40);
+        Y_6 = _mm512_loadu_pd(Y + 48);
+        X_0 = _mm512_abs_pd(_mm512_mul_pd(X_0, Y_0));
+        X_1 = _mm512_abs_pd(_mm512_mul_pd(X_1, Y_1));
+        X_2 = _mm512_abs_pd(_mm512_mul_pd(X_2, Y_2));
+        X_3 = _mm512_abs_pd(_mm512_mul_pd(X_3, Y_3));
+        X_4 = _mm512_abs_pd(_mm512_mul_pd(X_4, Y_4));
+        X_5 = _mm512_abs_pd(_mm512_mul_pd(X_5, Y_5));
+        X_6 = _mm512_abs_pd(_mm512_mul_pd(X_6, Y_6));
+        m_0 = _mm512_max_pd(m_0, X_0);
+        m_0 = _mm512_max_pd(m_0, X_1);
+        m_0 = _mm512_max_pd(m_0, X_2);
+        m_0 = _mm512_max_pd(m_0, X_3);
+        m_0 = _mm512_max_pd(m_0, X_4);
+        m_0 = _mm512_max_pd(m_0, X_5);
+        m_0 = _mm512_max_pd(m_0, X_6);
+      }
+      if(i + 32 <= N){
+        X_0 = _mm512_loadu_pd(X);
+        X_1 = _mm512_loadu_pd(X + 8);
+        X_2 = _mm512_loadu_pd(X + 16);
+        X_3 = _mm512_loadu_pd(X + 24);
+        Y_0 = _mm512_loadu_pd(Y);
+        Y_1 = _mm512_loadu_pd(Y + 8);
+        Y_2 = _mm512_loadu_pd(Y + 16);
+        Y_3 = _mm512_loadu_pd(Y + 24);
+        X_0 = _mm512_abs_pd(_mm512_mul_pd(X_0, Y_0));
+        X_1 = _mm512_abs_pd(_mm512_mul_pd(X_1, Y_1));
+        X_2 = _mm512_abs_pd(_mm512_mul_pd(X_2, Y_2));
+        X_3 = _mm512_abs_pd(_mm512_mul_pd(X_3, Y_3));
+        m_0 = _mm512_max_pd(m_0, X_0);
+        m_0 = _mm512_max_pd(m_0, X_1);
+        m_0 = _mm512_max_pd(m_0, X_2);
+        m_0 = _mm512_max_pd(m_0, X_3);
+        i += 32, X += 32, Y += 32;
+      }
+      if(i + 16 <= N){
+        X_0 = _mm512_loadu_pd(X);
+        X_1 = _mm512_loadu_pd(X + 8);
+        Y_0 = _mm512_loadu_pd(Y);
+        Y_1 = _mm512_loadu_pd(Y + 8);
+        X_0 = _mm512_abs_pd(_mm512_mul_pd(X_0, Y_0));
+        X_1 = _mm512_abs_pd(_mm512_mul_pd(X_1, Y_1));
+        m_0 = _mm512_max_pd(m_0, X_0);
+        m_0 = _mm512_max_pd(m_0, X_1);
+        i += 16, X += 16, Y += 16;
+      }
+      if(i + 8 <= N){
+        X_0 = _mm512_loadu_pd(X);
+        Y_0 = _mm512_loadu_pd(Y);
+        X_0 = _mm512_abs_pd(_mm512_mul_pd(X_0, Y_0));
+        m_0 = _mm512_max_pd(m_0, X_0);
+        i += 8, X += 8, Y += 8;
+      }
+      if(i < N){
+        X_0 = _mm512_maskz_loadu_pd((__mmask8)((1U << (N - i)) - 1), X);
+        Y_0 = _mm512_maskz_loadu_pd((__mmask8)((1U << (N - i)) - 1), Y);
+        X_0 = _mm512_abs_pd(_mm512_mul_pd(X_0, Y_0));
+        m_0 = _mm512_max_pd(m_0, X_0);
+        X += (N - i), Y += (N - i);
+      }
+    }else{
+
+      for(i = 0; i + 56 <= N; i += 56, X += ((ptrdiff_t)incX * 56), Y += ((ptrdiff_t)incY * 56)){
+        X_0 = _mm512_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm512_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)], X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]);
+        X_2 = _mm512_set_pd(X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)], X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]);
+        X_3 = _mm512_set_pd(X[((ptrdiff_t)incX * 31)], X[((ptrdiff_t)incX * 30)], X[((ptrdiff_t)incX * 29)], X[((ptrdiff_t)incX * 28)], X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)], X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)]);
+        X_4 = _mm512_set_pd(X[((ptrdiff_t)incX * 39)], X[((ptrdiff_t)incX * 38)], X[((ptrdiff_t)incX * 37)], X[((ptrdiff_t)incX * 36)], X[((ptrdiff_t)incX * 35)], X[((ptrdiff_t)incX * 34)], X[((ptrdiff_t)incX * 33)], X[((ptrdiff_t)incX * 32)]);
+        X_5 = _mm512_set_pd(X[((ptrdiff_t)incX * 47)], X[((ptrdiff_t)incX * 46)], X[((ptrdiff_t)incX * 45)], X[((ptrdiff_t)incX * 44)], X[((ptrdiff_t)incX * 43)], X[((ptrdiff_t)incX * 42)], X[((ptrdiff_t)incX * 41)], X[((ptrdiff_t)incX * 40)]);
+        X_6 = _mm512_set_pd(X[((ptrdiff_t)incX * 55)], X[((ptrdiff_t)incX * 54)], X[((ptrdiff_t)incX * 53)], X[((ptrdiff_t)incX * 52)], X[((ptrdiff_t)incX * 51)], X[((ptrdiff_t)incX * 50)], X[((ptrdiff_t)incX * 49)], X[((ptrdiff_t)incX * 48)]);
+        Y_0 = _mm512_set_pd(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm512_set_pd(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)], Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)]);
+        Y_2 = _mm512_set_pd(Y[((ptrdiff_t)incY * 23)], Y[((ptrdiff_t)incY * 22)], Y[((ptrdiff_t)incY * 21)], Y[((ptrdiff_t)incY * 20)], Y[((ptrdiff_t)incY * 19)], Y[((ptrdiff_t)incY * 18)], Y[((ptrdiff_t)incY * 17)], Y[((ptrdiff_t)incY * 16)]);
+        Y_3 = _mm512_set_pd(Y[((ptrdiff_t)incY * 31)], Y[((ptrdiff_t)incY * 30)], Y[((ptrdiff_t)incY * 29)], Y[((ptrdiff_t)incY * 28)], Y[((ptrdiff_t)incY * 27)], Y[((ptrdiff_t)incY * 26)], Y[((ptrdiff_t)incY * 25)], Y[((ptrdiff_t)incY * 24)]);
+        Y_4 = _mm512_set_pd(Y[((ptrdiff_t)incY * 39)], Y[((ptrdiff_t)incY * 38)], Y[((ptrdiff_t)incY * 37)], Y[((ptrdiff_t)incY * 36)], Y[((ptrdiff_t)incY * 35)], Y[((ptrdiff_t)incY * 34)], Y[((ptrdiff_t)incY * 33)], Y[((ptrdiff_t)incY * 32)]);
+        Y_5 = _mm512_set_pd(Y[((ptrdiff_t)incY * 47)], Y[((ptrdiff_t)incY * 46)], Y[((ptrdiff_t)incY * 45)], Y[((ptrdiff_t)incY * 44)], Y[((ptrdiff_t)incY * 43)], Y[((ptrdiff_t)incY * 42)], Y[((ptrdiff_t)incY * 41)], Y[((ptrdiff_t)incY * 40)]);
+        Y_6 = _mm512_set_pd(Y[((ptrdiff_t)incY * 55)], Y[((ptrdiff_t)incY * 54)], Y[((ptrdiff_t)incY * 53)], Y[((ptrdiff_t)incY * 52)], Y[((ptrdiff_t)incY * 51)], Y[((ptrdiff_t)incY * 50)], Y[((ptrdiff_t)incY * 49)], Y[((ptrdiff_t)incY * 48)]);
+        X_0 = _mm512_abs_pd(_mm512_mul_pd(X_0, Y_0));
+        X_1 = _mm512_abs_pd(_mm512_mul_pd(X_1, Y_1));
+        X_2 = _mm512_abs_pd(_mm512_mul_pd(X_2, Y_2));
+        X_3 = _mm512_abs_pd(_mm512_mul_pd(X_3, Y_3));
+        X_4 = _mm512_abs_pd(_mm512_mul_pd(X_4, Y_4));
+        X_5 = _mm512_abs_pd(_mm512_mul_pd(X_5, Y_5));
+        X_6 = _mm512_abs_pd(_mm512_mul_pd(X_6, Y_6));
+        m_0 = _mm512_max_pd(m_0, X_0);
+        m_0 = _mm512_max_pd(m_0, X_1);
+        m_0 = _mm512_max_pd(m_0, X_2);
+        m_0 = _mm512_max_pd(m_0, X_3);
+        m_0 = _mm512_max_pd(m_0, X_4);
+        m_0 = _mm512_max_pd(m_0, X_5);
+        m_0 = _mm512_max_pd(m_0, X_6);
+      }
+      if(i + 32 <= N){
+        X_0 = _mm512_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm512_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)], X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]);
+        X_2 = _mm512_set_pd(X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)], X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]);
+        X_3 = _mm512_set_pd(X[((ptrdiff_t)incX * 31)], X[((ptrdiff_t)incX * 30)], X[((ptrdiff_t)incX * 29)], X[((ptrdiff_t)incX * 28)], X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)], X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)]);
+        Y_0 = _mm512_set_pd(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm512_set_pd(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)], Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)]);
+        Y_2 = _mm512_set_pd(Y[((ptrdiff_t)incY * 23)], Y[((ptrdiff_t)incY * 22)], Y[((ptrdiff_t)incY * 21)], Y[((ptrdiff_t)incY * 20)], Y[((ptrdiff_t)incY * 19)], Y[((ptrdiff_t)incY * 18)], Y[((ptrdiff_t)incY * 17)], Y[((ptrdiff_t)incY * 16)]);
+        Y_3 = _mm512_set_pd(Y[((ptrdiff_t)incY * 31)], Y[((ptrdiff_t)incY * 30)], Y[((ptrdiff_t)incY * 29)], Y[((ptrdiff_t)incY * 28)], Y[((ptrdiff_t)incY * 27)], Y[((ptrdiff_t)incY * 26)], Y[((ptrdiff_t)incY * 25)], Y[((ptrdiff_t)incY * 24)]);
+        X_0 = _mm512_abs_pd(_mm512_mul_pd(X_0, Y_0));
+        X_1 = _mm512_abs_pd(_mm512_mul_pd(X_1, Y_1));
+        X_2 = _mm512_abs_pd(_mm512_mul_pd(X_2, Y_2));
+        X_3 = _mm512_abs_pd(_mm512_mul_pd(X_3, Y_3));
+        m_0 = _mm512_max_pd(m_0, X_0);
+        m_0 = _mm512_max_pd(m_0, X_1);
+        m_0 = _mm512_max_pd(m_0, X_2);
+        m_0 = _mm512_max_pd(m_0, X_3);
+        i += 32, X += ((ptrdiff_t)incX * 32), Y += ((ptrdiff_t)incY * 32);
+      }
+      if(i + 16 <= N){
+        X_0 = _mm512_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm512_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)], X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]);
+        Y_0 = _mm512_set_pd(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm512_set_pd(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)], Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)]);
+        X_0 = _mm512_abs_pd(_mm512_mul_pd(X_0, Y_0));
+        X_1 = _mm512_abs_pd(_mm512_mul_pd(X_1, Y_1));
+        m_0 = _mm512_max_pd(m_0, X_0);
+        m_0 = _mm512_max_pd(m_0, X_1);
+        i += 16, X += ((ptrdiff_t)incX * 16), Y += ((ptrdiff_t)incY * 16);
+      }
+      if(i + 8 <= N){
+        X_0 = _mm512_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        Y_0 = _mm512_set_pd(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        X_0 = _mm512_abs_pd(_mm512_mul_pd(X_0, Y_0));
+        m_0 = _mm512_max_pd(m_0, X_0);
+        i += 8, X += ((ptrdiff_t)incX * 8), Y += ((ptrdiff_t)incY * 8);
+      }
+      if(i < N){
+        X_0 = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8);
+        Y_0 = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incY * 7), ((ptrdiff_t)incY * 6), ((ptrdiff_t)incY * 5), ((ptrdiff_t)incY * 4), ((ptrdiff_t)incY * 3), ((ptrdiff_t)incY * 2), (ptrdiff_t)incY, 0), Y, 8);
+        X_0 = _mm512_abs_pd(_mm512_mul_pd(X_0, Y_0));
+        m_0 = _mm512_max_pd(m_0, X_0);
+        X += ((ptrdiff_t)incX * (N - i)), Y += ((ptrdiff_t)incY * (N - i));
+      }
+    }
+    _mm512_store_pd(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+    (&amaxm)[0] = max_buffer_tmp[0];
+
+  #elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+    __m256d abs_mask_tmp;
+    {
+      __m256d tmp;
+      tmp = _mm256_set1_pd(1);
+      abs_mask_tmp = _mm256_set1_pd(-1);
+      abs_mask_tmp = _mm256_xor_pd(abs_mask_tmp, tmp);
+      tmp = _mm256_cmp_pd(tmp, tmp, 0);
+      abs_mask_tmp = _mm256_xor_pd(abs_mask_tmp, tmp);
+    }
+    double max_buffer_tmp[4] __attribute__((aligned(32))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m256d X_0, X_1, X_2, X_3, X_4, X_5, X_6;
+    __m256d Y_0, Y_1, Y_2, Y_3, Y_4, Y_5, Y_6;
+    __m256d m_0;
+    m_0 = _mm256_setzero_pd();
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 28 <= N; i += 28, X += 28, Y += 28){
+        X_0 = _mm256_loadu_pd(X);
+        X_1 = _mm256_loadu_pd(X + 4);
+        X_2 = _mm256_loadu_pd(X + 8);
+        X_3 = _mm256_loadu_pd(X + 12);
+        X_4 = _mm256_loadu_pd(X + 16);
+        X_5 = _mm256_loadu_pd(X + 20);
+        X_6 = _mm256_loadu_pd(X + 24);
+        Y_0 = _mm256_loadu_pd(Y);
+        Y_1 = _mm256_loadu_pd(Y + 4);
+        Y_2 = _mm256_loadu_pd(Y + 8);
+        Y_3 = _mm256_loadu_pd(Y + 12);
+        Y_4 = _mm256_loadu_pd(Y + 16);
+        Y_5 = _mm256_loadu_pd(Y + 20);
+        Y_6 = _mm256_loadu_pd(Y + 24);
+        X_0 = _mm256_and_pd(_mm256_mul_pd(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_pd(_mm256_mul_pd(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm256_and_pd(_mm256_mul_pd(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm256_and_pd(_mm256_mul_pd(X_3, Y_3), abs_mask_tmp);
+        X_4 = _mm256_and_pd(_mm256_mul_pd(X_4, Y_4), abs_mask_tmp);
+        X_5 = _mm256_and_pd(_mm256_mul_pd(X_5, Y_5), abs_mask_tmp);
+        X_6 = _mm256_and_pd(_mm256_mul_pd(X_6, Y_6), abs_mask_tmp);
+        m_0 = _mm256_max_pd(m_0, X_0);
+        m_0 = _mm256_max_pd(m_0, X_1);
+        m_0 = _mm256_max_pd(m_0, X_2);
+        m_0 = _mm256_max_pd(m_0, X_3);
+        m_0 = _mm256_max_pd(m_0, X_4);
+        m_0 = _mm256_max_pd(m_0, X_5);
+        m_0 = _mm256_max_pd(m_0, X_6);
+      }
+      if(i + 16 <= N){
+        X_0 = _mm256_loadu_pd(X);
+        X_1 = _mm256_loadu_pd(X + 4);
+        X_2 = _mm256_loadu_pd(X + 8);
+        X_3 = _mm256_loadu_pd(X + 12);
+        Y_0 = _mm256_loadu_pd(Y);
+        Y_1 = _mm256_loadu_pd(Y + 4);
+        Y_2 = _mm256_loadu_pd(Y + 8);
+        Y_3 = _mm256_loadu_pd(Y + 12);
+        X_0 = _mm256_and_pd(_mm256_mul_pd(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_pd(_mm256_mul_pd(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm256_and_pd(_mm256_mul_pd(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm256_and_pd(_mm256_mul_pd(X_3, Y_3), abs_mask_tmp);
+        m_0 = _mm256_max_pd(m_0, X_0);
+        m_0 = _mm256_max_pd(m_0, X_1);
+        m_0 = _mm256_max_pd(m_0, X_2);
+        m_0 = _mm256_max_pd(m_0, X_3);
+        i += 16, X += 16, Y += 16;
+      }
+      if(i + 8 <= N){
+        X_0 = _mm256_loadu_pd(X);
+        X_1 = _mm256_loadu_pd(X + 4);
+        Y_0 = _mm256_loadu_pd(Y);
+        Y_1 = _mm256_loadu_pd(Y + 4);
+        X_0 = _mm256_and_pd(_mm256_mul_pd(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_pd(_mm256_mul_pd(X_1, Y_1), abs_mask_tmp);
+        m_0 = _mm256_max_pd(m_0, X_0);
+        m_0 = _mm256_max_pd(m_0, X_1);
+        i += 8, X += 8, Y += 8;
+      }
+      if(i + 4 <= N){
+        X_0 = _mm256_loadu_pd(X);
+        Y_0 = _mm256_loadu_pd(Y);
+        X_0 = _mm256_and_pd(_mm256_mul_pd(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm256_max_pd(m_0, X_0);
+        i += 4, X += 4, Y += 4;
+      }
+      if(i < N){
+        X_0 = _mm256_set_pd(0, (N - i)>2?X[2]:0, (N - i)>1?X[1]:0, X[0]);
+        Y_0 = _mm256_set_pd(0, (N - i)>2?Y[2]:0, (N - i)>1?Y[1]:0, Y[0]);
+        X_0 = _mm256_and_pd(_mm256_mul_pd(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm256_max_pd(m_0, X_0);
+        X += (N - i), Y += (N - i);
+      }
+    }else{
+
+      for(i = 0; i + 28 <= N; i += 28, X += ((ptrdiff_t)incX * 28), Y += ((ptrdiff_t)incY * 28)){
+        X_0 = _mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]);
+        X_2 = _mm256_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]);
+        X_3 = _mm256_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]);
+        X_4 = _mm256_set_pd(X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]);
+        X_5 = _mm256_set_pd(X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)]);
+        X_6 = _mm256_set_pd(X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)], X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)]);
+        Y_0 = _mm256_set_pd(Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm256_set_pd(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)]);
+        Y_2 = _mm256_set_pd(Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)]);
+        Y_3 = _mm256_set_pd(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)]);
+        Y_4 = _mm256_set_pd(Y[((ptrdiff_t)incY * 19)], Y[((ptrdiff_t)incY * 18)], Y[((ptrdiff_t)incY * 17)], Y[((ptrdiff_t)incY * 16)]);
+        Y_5 = _mm256_set_pd(Y[((ptrdiff_t)incY * 23)], Y[((ptrdiff_t)incY * 22)], Y[((ptrdiff_t)incY * 21)], Y[((ptrdiff_t)incY * 20)]);
+        Y_6 = _mm256_set_pd(Y[((ptrdiff_t)incY * 27)], Y[((ptrdiff_t)incY * 26)], Y[((ptrdiff_t)incY * 25)], Y[((ptrdiff_t)incY * 24)]);
+        X_0 = _mm256_and_pd(_mm256_mul_pd(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_pd(_mm256_mul_pd(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm256_and_pd(_mm256_mul_pd(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm256_and_pd(_mm256_mul_pd(X_3, Y_3), abs_mask_tmp);
+        X_4 = _mm256_and_pd(_mm256_mul_pd(X_4, Y_4), abs_mask_tmp);
+        X_5 = _mm256_and_pd(_mm256_mul_pd(X_5, Y_5), abs_mask_tmp);
+        X_6 = _mm256_and_pd(_mm256_mul_pd(X_6, Y_6), abs_mask_tmp);
+        m_0 = _mm256_max_pd(m_0, X_0);
+        m_0 = _mm256_max_pd(m_0, X_1);
+        m_0 = _mm256_max_pd(m_0, X_2);
+        m_0 = _mm256_max_pd(m_0, X_3);
+        m_0 = _mm256_max_pd(m_0, X_4);
+        m_0 = _mm256_max_pd(m_0, X_5);
+        m_0 = _mm256_max_pd(m_0, X_6);
+      }
+      if(i + 16 <= N){
+        X_0 = _mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]);
+        X_2 = _mm256_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]);
+        X_3 = _mm256_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]);
+        Y_0 = _mm256_set_pd(Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm256_set_pd(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)]);
+        Y_2 = _mm256_set_pd(Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)]);
+        Y_3 = _mm256_set_pd(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)]);
+        X_0 = _mm256_and_pd(_mm256_mul_pd(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_pd(_mm256_mul_pd(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm256_and_pd(_mm256_mul_pd(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm256_and_pd(_mm256_mul_pd(X_3, Y_3), abs_mask_tmp);
+        m_0 = _mm256_max_pd(m_0, X_0);
+        m_0 = _mm256_max_pd(m_0, X_1);
+        m_0 = _mm256_max_pd(m_0, X_2);
+        m_0 = _mm256_max_pd(m_0, X_3);
+        i += 16, X += ((ptrdiff_t)incX * 16), Y += ((ptrdiff_t)incY * 16);
+      }
+      if(i + 8 <= N){
+        X_0 = _mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]);
+        Y_0 = _mm256_set_pd(Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm256_set_pd(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)]);
+        X_0 = _mm256_and_pd(_mm256_mul_pd(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_pd(_mm256_mul_pd(X_1, Y_1), abs_mask_tmp);
+        m_0 = _mm256_max_pd(m_0, X_0);
+        m_0 = _mm256_max_pd(m_0, X_1);
+        i += 8, X += ((ptrdiff_t)incX * 8), Y += ((ptrdiff_t)incY * 8);
+      }
+      if(i + 4 <= N){
+        X_0 = _mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        Y_0 = _mm256_set_pd(Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        X_0 = _mm256_and_pd(_mm256_mul_pd(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm256_max_pd(m_0, X_0);
+        i += 4, X += ((ptrdiff_t)incX * 4), Y += ((ptrdiff_t)incY * 4);
+      }
+      if(i < N){
+        X_0 = _mm256_set_pd(0, (N - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N - i)>1?X[(ptrdiff_t)incX]:0, X[0]);
+        Y_0 = _mm256_set_pd(0, (N - i)>2?Y[((ptrdiff_t)incY * 2)]:0, (N - i)>1?Y[(ptrdiff_t)incY]:0, Y[0]);
+        X_0 = _mm256_and_pd(_mm256_mul_pd(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm256_max_pd(m_0, X_0);
+        X += ((ptrdiff_t)incX * (N - i)), Y += ((ptrdiff_t)incY * (N - i));
+      }
+    }
+    _mm256_store_pd(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+    (&amaxm)[0] = max_buffer_tmp[0];
+
+  #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+    __m128d abs_mask_tmp;
+    {
+      __m128d tmp;
+      tmp = _mm_set1_pd(1);
+      abs_mask_tmp = _mm_set1_pd(-1);
+      abs_mask_tmp = _mm_xor_pd(abs_mask_tmp, tmp);
+      tmp = _mm_cmpeq_pd(tmp, tmp);
+      abs_mask_tmp = _mm_xor_pd(abs_mask_tmp, tmp);
+    }
+    double max_buffer_tmp[2] __attribute__((aligned(16))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m128d X_0, X_1, X_2, X_3;
+    __m128d Y_0, Y_1, Y_2, Y_3;
+    __m128d m_0;
+    m_0 = _mm_setzero_pd();
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 8 <= N; i += 8, X += 8, Y += 8){
+        X_0 = _mm_loadu_pd(X);
+        X_1 = _mm_loadu_pd(X + 2);
+        X_2 = _mm_loadu_pd(X + 4);
+        X_3 = _mm_loadu_pd(X + 6);
+        Y_0 = _mm_loadu_pd(Y);
+        Y_1 = _mm_loadu_pd(Y + 2);
+        Y_2 = _mm_loadu_pd(Y + 4);
+        Y_3 = _mm_loadu_pd(Y + 6);
+        X_0 = _mm_and_pd(_mm_mul_pd(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm_and_pd(_mm_mul_pd(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm_and_pd(_mm_mul_pd(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm_and_pd(_mm_mul_pd(X_3, Y_3), abs_mask_tmp);
+        m_0 = _mm_max_pd(m_0, X_0);
+        m_0 = _mm_max_pd(m_0, X_1);
+        m_0 = _mm_max_pd(m_0, X_2);
+        m_0 = _mm_max_pd(m_0, X_3);
+      }
+      if(i + 4 <= N){
+        X_0 = _mm_loadu_pd(X);
+        X_1 = _mm_loadu_pd(X + 2);
+        Y_0 = _mm_loadu_pd(Y);
+        Y_1 = _mm_loadu_pd(Y + 2);
+        X_0 = _mm_and_pd(_mm_mul_pd(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm_and_pd(_mm_mul_pd(X_1, Y_1), abs_mask_tmp);
+        m_0 = _mm_max_pd(m_0, X_0);
+        m_0 = _mm_max_pd(m_0, X_1);
+        i += 4, X += 4, Y += 4;
+      }
+      if(i + 2 <= N){
+        X_0 = _mm_loadu_pd(X);
+        Y_0 = _mm_loadu_pd(Y);
+        X_0 = _mm_and_pd(_mm_mul_pd(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm_max_pd(m_0, X_0);
+        i += 2, X += 2, Y += 2;
+      }
+      if(i < N){
+        X_0 = _mm_set_pd(0, X[0]);
+        Y_0 = _mm_set_pd(0, Y[0]);
+        X_0 = _mm_and_pd(_mm_mul_pd(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm_max_pd(m_0, X_0);
+        X += (N - i), Y += (N - i);
+      }
+    }else{
+
+      for(i = 0; i + 8 <= N; i += 8, X += ((ptrdiff_t)incX * 8), Y += ((ptrdiff_t)incY * 8)){
+        X_0 = _mm_set_pd(X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]);
+        X_2 = _mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]);
+        X_3 = _mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]);
+        Y_0 = _mm_set_pd(Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm_set_pd(Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)]);
+        Y_2 = _mm_set_pd(Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)]);
+        Y_3 = _mm_set_pd(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)]);
+        X_0 = _mm_and_pd(_mm_mul_pd(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm_and_pd(_mm_mul_pd(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm_and_pd(_mm_mul_pd(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm_and_pd(_mm_mul_pd(X_3, Y_3), abs_mask_tmp);
+        m_0 = _mm_max_pd(m_0, X_0);
+        m_0 = _mm_max_pd(m_0, X_1);
+        m_0 = _mm_max_pd(m_0, X_2);
+        m_0 = _mm_max_pd(m_0, X_3);
+      }
+      if(i + 4 <= N){
+        X_0 = _mm_set_pd(X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]);
+        Y_0 = _mm_set_pd(Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm_set_pd(Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)]);
+        X_0 = _mm_and_pd(_mm_mul_pd(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm_and_pd(_mm_mul_pd(X_1, Y_1), abs_mask_tmp);
+        m_0 = _mm_max_pd(m_0, X_0);
+        m_0 = _mm_max_pd(m_0, X_1);
+        i += 4, X += ((ptrdiff_t)incX * 4), Y += ((ptrdiff_t)incY * 4);
+      }
+      if(i + 2 <= N){
+        X_0 = _mm_set_pd(X[(ptrdiff_t)incX], X[0]);
+        Y_0 = _mm_set_pd(Y[(ptrdiff_t)incY], Y[0]);
+        X_0 = _mm_and_pd(_mm_mul_pd(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm_max_pd(m_0, X_0);
+        i += 2, X += ((ptrdiff_t)incX * 2), Y += ((ptrdiff_t)incY * 2);
+      }
+      if(i < N){
+        X_0 = _mm_set_pd(0, X[0]);
+        Y_0 = _mm_set_pd(0, Y[0]);
+        X_0 = _mm_and_pd(_mm_mul_pd(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm_max_pd(m_0, X_0);
+        X += ((ptrdiff_t)incX * (N - i)), Y += ((ptrdiff_t)incY * (N - i));
+      }
+    }
+    _mm_store_pd(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+    (&amaxm)[0] = max_buffer_tmp[0];
+
+  #else
+    int i;
+
+    double X_0;
+    double Y_0;
+    double m_0;
+    m_0 = 0;
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 1 <= N; i += 1, X += 1, Y += 1){
+        X_0 = X[0];
+        Y_0 = Y[0];
+        X_0 = fabs((X_0 * Y_0));
+        m_0 = (m_0 > X_0? m_0: X_0);
+      }
+    }else{
+
+      for(i = 0; i + 1 <= N; i += 1, X += (ptrdiff_t)incX, Y += (ptrdiff_t)incY){
+        X_0 = X[0];
+        Y_0 = Y[0];
+        X_0 = fabs((X_0 * Y_0));
+        m_0 = (m_0 > X_0? m_0: X_0);
+      }
+    }
+    (&amaxm)[0] = m_0;
+
+  #endif
+  //[[[end]]]
+  return amaxm;
+}
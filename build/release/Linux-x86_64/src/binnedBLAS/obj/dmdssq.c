@@ -0,0 +1,7024 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../config.h"
+#include "../common/common.h"
+#include "binnedBLAS.h"
+
+/*[[[cog
+import cog
+import generate
+import dataTypes
+import depositSSq
+import vectorizations
+from src.common import blockSize
+from scripts import terminal
+
+code_block = generate.CodeBlock()
+vectorizations.conditionally_include_vectorizations(code_block)
+cog.out(str(code_block))
+
+cog.outl()
+
+cog.out(generate.generate(blockSize.BlockSize("dmdssq", "N_block_MAX", 32, terminal.get_diendurance(), terminal.get_diendurance(), ["bench_rdnrm2_fold_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+]]]*/
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  #include <immintrin.h>
+
+#elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+  #include <immintrin.h>
+
+#elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+  #include <emmintrin.h>
+
+#else
+
+
+#endif
+
+#define N_block_MAX 2048
+//[[[end]]]
+
+
+/**
+ * @internal
+ * @brief Add to scaled manually specified binned double precision Y the scaled sum of squares of elements of double precision vector X
+ *
+ * Add to Y the scaled binned sum of the squares of each element of X. The scaling of each square is performed using #binned_dscale()
+ *
+ * @param fold the fold of the binned types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param scaleY the scaling factor of Y
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ * @return the new scaling factor of Y
+ *
+ * @author Willow Ahrens
+ * @date   18 Jan 2016
+ */
+double binnedBLAS_dmdssq(const int fold, const int N, const double *X, const int incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY){
+  double amax;
+  double scl = scaleY;
+  double new_scl;
+  int i, j;
+  int N_block = N_block_MAX;
+  int deposits = 0;
+
+  for (i = 0; i < N; i += N_block) {
+    N_block = MIN((N - i), N_block);
+
+    amax = binnedBLAS_damax(N_block, X, incX);
+
+    if (isinf(amax) || isinf(priY[0])){
+      for (j = 0; j < N_block; j++){
+        priY[0] += fabs(X[(ptrdiff_t)j * incX]);
+      }
+    }
+    if (isnan(priY[0])){
+      return binned_dscale(1.0);
+    } else if (isinf(priY[0])){
+      X += (ptrdiff_t)N_block * incX;
+      continue;
+    }
+
+    if (deposits + N_block > binned_DBENDURANCE) {
+      binned_dmrenorm(fold, priY, incpriY, carY, inccarY);
+      deposits = 0;
+    }
+
+    new_scl = binned_dscale(amax);
+    if (new_scl > scl) {
+      if(scl > 0.0){
+        binned_dmdrescale(fold, new_scl, scl, priY, incpriY, carY, inccarY);
+      }
+      scl = new_scl;
+    }
+
+    amax /= scl;
+    amax = amax * amax;
+
+    binned_dmdupdate(fold, amax, priY, incpriY, carY, inccarY);
+
+    /*[[[cog
+      cog.out(generate.generate(depositSSq.DepositSSq(dataTypes.Double, "fold", "N_block", "X", "incX", "priY", "incpriY", "scl"), cog.inFile, args, params, mode))
+      ]]]*/
+    {
+      #if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+        __m512d scale_mask_inv = _mm512_set1_pd(1.0 / scl);
+        __m512i blp_mask_tmp;
+        {
+          __m512i tmp;
+          blp_mask_tmp = _mm512_castpd_si512(_mm512_set1_pd(1.0));
+          tmp = _mm512_castpd_si512(_mm512_set1_pd(1.0 + (DBL_EPSILON * 1.0001)));
+          blp_mask_tmp = _mm512_xor_si512(blp_mask_tmp, tmp);
+        }
+        __m512d cons_tmp; (void)cons_tmp;
+        double cons_buffer_tmp[8] __attribute__((aligned(64))); (void)cons_buffer_tmp;
+        unsigned int SIMD_daz_ftz_old_tmp = 0;
+        unsigned int SIMD_daz_ftz_new_tmp = 0;
+
+
+        switch(fold){
+          case 2:
+            {
+              int i;
+              __m512d X_0, X_1, X_2, X_3, X_4, X_5;
+              __m512d compression_0;
+              __m512d expansion_0;
+              __m512d q_0;
+              __m512d s_0_0;
+              __m512d s_1_0;
+
+              s_0_0 = _mm512_set1_pd(*(priY));
+              s_1_0 = _mm512_set1_pd(*(priY + (ptrdiff_t)incpriY));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 48 <= N_block; i += 48, X += 48){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 528), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 536), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 544), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 552), _MM_HINT_T0);
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_loadu_pd(X + 16), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_loadu_pd(X + 24), scale_mask_inv);
+                    X_4 = _mm512_mul_pd(_mm512_loadu_pd(X + 32), scale_mask_inv);
+                    X_5 = _mm512_mul_pd(_mm512_loadu_pd(X + 40), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+                    X_4 = _mm512_mul_pd(X_4, X_4);
+                    X_5 = _mm512_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_2, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_2 = _mm512_fmadd_pd(q_0, expansion_0, X_2);
+                    X_2 = _mm512_fmadd_pd(q_0, expansion_0, X_2);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_3 = _mm512_fmadd_pd(q_0, expansion_0, X_3);
+                    X_3 = _mm512_fmadd_pd(q_0, expansion_0, X_3);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_4, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_4 = _mm512_fmadd_pd(q_0, expansion_0, X_4);
+                    X_4 = _mm512_fmadd_pd(q_0, expansion_0, X_4);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_4), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_5, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_5 = _mm512_fmadd_pd(q_0, expansion_0, X_5);
+                    X_5 = _mm512_fmadd_pd(q_0, expansion_0, X_5);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_5), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_loadu_pd(X + 16), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_loadu_pd(X + 24), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_2, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_2 = _mm512_fmadd_pd(q_0, expansion_0, X_2);
+                    X_2 = _mm512_fmadd_pd(q_0, expansion_0, X_2);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_3 = _mm512_fmadd_pd(q_0, expansion_0, X_3);
+                    X_3 = _mm512_fmadd_pd(q_0, expansion_0, X_3);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    i += 32, X += 32;
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    i += 16, X += 16;
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += 8;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_maskz_loadu_pd((__mmask8)((1U << (N_block - i)) - 1), X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 48 <= N_block; i += 48, X += 48){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 528), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 536), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 544), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 552), _MM_HINT_T0);
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_loadu_pd(X + 16), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_loadu_pd(X + 24), scale_mask_inv);
+                    X_4 = _mm512_mul_pd(_mm512_loadu_pd(X + 32), scale_mask_inv);
+                    X_5 = _mm512_mul_pd(_mm512_loadu_pd(X + 40), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+                    X_4 = _mm512_mul_pd(X_4, X_4);
+                    X_5 = _mm512_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_2 = _mm512_add_pd(X_2, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_3 = _mm512_add_pd(X_3, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_4), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_4 = _mm512_add_pd(X_4, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_4), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_5 = _mm512_add_pd(X_5, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_5), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_loadu_pd(X + 16), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_loadu_pd(X + 24), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_2 = _mm512_add_pd(X_2, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_3 = _mm512_add_pd(X_3, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    i += 32, X += 32;
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    i += 16, X += 16;
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += 8;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_maskz_loadu_pd((__mmask8)((1U << (N_block - i)) - 1), X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 48 <= N_block; i += 48, X += ((ptrdiff_t)incX * 48)){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 16), 8), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 24), 8), scale_mask_inv);
+                    X_4 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 32), 8), scale_mask_inv);
+                    X_5 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 40), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+                    X_4 = _mm512_mul_pd(X_4, X_4);
+                    X_5 = _mm512_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_2, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_2 = _mm512_fmadd_pd(q_0, expansion_0, X_2);
+                    X_2 = _mm512_fmadd_pd(q_0, expansion_0, X_2);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_3 = _mm512_fmadd_pd(q_0, expansion_0, X_3);
+                    X_3 = _mm512_fmadd_pd(q_0, expansion_0, X_3);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_4, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_4 = _mm512_fmadd_pd(q_0, expansion_0, X_4);
+                    X_4 = _mm512_fmadd_pd(q_0, expansion_0, X_4);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_4), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_5, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_5 = _mm512_fmadd_pd(q_0, expansion_0, X_5);
+                    X_5 = _mm512_fmadd_pd(q_0, expansion_0, X_5);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_5), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 16), 8), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 24), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_2, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_2 = _mm512_fmadd_pd(q_0, expansion_0, X_2);
+                    X_2 = _mm512_fmadd_pd(q_0, expansion_0, X_2);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_3 = _mm512_fmadd_pd(q_0, expansion_0, X_3);
+                    X_3 = _mm512_fmadd_pd(q_0, expansion_0, X_3);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    i += 32, X += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    i += 16, X += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N_block - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 48 <= N_block; i += 48, X += ((ptrdiff_t)incX * 48)){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 16), 8), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 24), 8), scale_mask_inv);
+                    X_4 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 32), 8), scale_mask_inv);
+                    X_5 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 40), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+                    X_4 = _mm512_mul_pd(X_4, X_4);
+                    X_5 = _mm512_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_2 = _mm512_add_pd(X_2, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_3 = _mm512_add_pd(X_3, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_4), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_4 = _mm512_add_pd(X_4, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_4), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_5 = _mm512_add_pd(X_5, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_5), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 16), 8), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 24), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_2 = _mm512_add_pd(X_2, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_3 = _mm512_add_pd(X_3, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    i += 32, X += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    i += 16, X += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N_block - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              s_0_0 = _mm512_sub_pd(s_0_0, _mm512_set_pd(priY[0], priY[0], priY[0], priY[0], priY[0], priY[0], priY[0], 0));
+              _mm512_store_pd(cons_buffer_tmp, s_0_0);
+              priY[0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+              s_1_0 = _mm512_sub_pd(s_1_0, _mm512_set_pd(priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], 0));
+              _mm512_store_pd(cons_buffer_tmp, s_1_0);
+              priY[(ptrdiff_t)incpriY] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 3:
+            {
+              int i;
+              __m512d X_0, X_1, X_2, X_3;
+              __m512d compression_0;
+              __m512d expansion_0;
+              __m512d q_0, q_1, q_2, q_3;
+              __m512d s_0_0, s_0_1, s_0_2, s_0_3;
+              __m512d s_1_0, s_1_1, s_1_2, s_1_3;
+              __m512d s_2_0, s_2_1, s_2_2, s_2_3;
+
+              s_0_0 = s_0_1 = s_0_2 = s_0_3 = _mm512_set1_pd(*(priY));
+              s_1_0 = s_1_1 = s_1_2 = s_1_3 = _mm512_set1_pd(*(priY + (ptrdiff_t)incpriY));
+              s_2_0 = s_2_1 = s_2_2 = s_2_3 = _mm512_set1_pd(*(priY + ((ptrdiff_t)incpriY * 2)));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 32 <= N_block; i += 32, X += 32){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 528), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 536), _MM_HINT_T0);
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_loadu_pd(X + 16), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_loadu_pd(X + 24), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_2, compression_0)), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm512_fmadd_pd(q_1, expansion_0, X_1);
+                    X_2 = _mm512_fmadd_pd(q_2, expansion_0, X_2);
+                    X_3 = _mm512_fmadd_pd(q_3, expansion_0, X_3);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm512_fmadd_pd(q_1, expansion_0, X_1);
+                    X_2 = _mm512_fmadd_pd(q_2, expansion_0, X_2);
+                    X_3 = _mm512_fmadd_pd(q_3, expansion_0, X_3);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    q_2 = s_1_2;
+                    q_3 = s_1_3;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    q_2 = _mm512_sub_pd(q_2, s_1_2);
+                    q_3 = _mm512_sub_pd(q_3, s_1_3);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    X_2 = _mm512_add_pd(X_2, q_2);
+                    X_3 = _mm512_add_pd(X_3, q_3);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    s_2_2 = _mm512_add_pd(s_2_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    s_2_3 = _mm512_add_pd(s_2_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm512_fmadd_pd(q_1, expansion_0, X_1);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm512_fmadd_pd(q_1, expansion_0, X_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    i += 16, X += 16;
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += 8;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_maskz_loadu_pd((__mmask8)((1U << (N_block - i)) - 1), X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 32 <= N_block; i += 32, X += 32){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 528), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 536), _MM_HINT_T0);
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_loadu_pd(X + 16), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_loadu_pd(X + 24), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    X_2 = _mm512_add_pd(X_2, q_2);
+                    X_3 = _mm512_add_pd(X_3, q_3);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    q_2 = s_1_2;
+                    q_3 = s_1_3;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    q_2 = _mm512_sub_pd(q_2, s_1_2);
+                    q_3 = _mm512_sub_pd(q_3, s_1_3);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    X_2 = _mm512_add_pd(X_2, q_2);
+                    X_3 = _mm512_add_pd(X_3, q_3);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    s_2_2 = _mm512_add_pd(s_2_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    s_2_3 = _mm512_add_pd(s_2_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    i += 16, X += 16;
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += 8;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_maskz_loadu_pd((__mmask8)((1U << (N_block - i)) - 1), X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 32 <= N_block; i += 32, X += ((ptrdiff_t)incX * 32)){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 16), 8), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 24), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_2, compression_0)), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm512_fmadd_pd(q_1, expansion_0, X_1);
+                    X_2 = _mm512_fmadd_pd(q_2, expansion_0, X_2);
+                    X_3 = _mm512_fmadd_pd(q_3, expansion_0, X_3);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm512_fmadd_pd(q_1, expansion_0, X_1);
+                    X_2 = _mm512_fmadd_pd(q_2, expansion_0, X_2);
+                    X_3 = _mm512_fmadd_pd(q_3, expansion_0, X_3);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    q_2 = s_1_2;
+                    q_3 = s_1_3;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    q_2 = _mm512_sub_pd(q_2, s_1_2);
+                    q_3 = _mm512_sub_pd(q_3, s_1_3);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    X_2 = _mm512_add_pd(X_2, q_2);
+                    X_3 = _mm512_add_pd(X_3, q_3);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    s_2_2 = _mm512_add_pd(s_2_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    s_2_3 = _mm512_add_pd(s_2_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm512_fmadd_pd(q_1, expansion_0, X_1);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm512_fmadd_pd(q_1, expansion_0, X_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    i += 16, X += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N_block - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 32 <= N_block; i += 32, X += ((ptrdiff_t)incX * 32)){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_2 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 16), 8), scale_mask_inv);
+                    X_3 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 24), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+                    X_2 = _mm512_mul_pd(X_2, X_2);
+                    X_3 = _mm512_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    X_2 = _mm512_add_pd(X_2, q_2);
+                    X_3 = _mm512_add_pd(X_3, q_3);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    q_2 = s_1_2;
+                    q_3 = s_1_3;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    q_2 = _mm512_sub_pd(q_2, s_1_2);
+                    q_3 = _mm512_sub_pd(q_3, s_1_3);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    X_2 = _mm512_add_pd(X_2, q_2);
+                    X_3 = _mm512_add_pd(X_3, q_3);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    s_2_2 = _mm512_add_pd(s_2_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_2), blp_mask_tmp)));
+                    s_2_3 = _mm512_add_pd(s_2_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_3), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    X_1 = _mm512_add_pd(X_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    i += 16, X += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N_block - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              s_0_0 = _mm512_sub_pd(s_0_0, _mm512_set_pd(priY[0], priY[0], priY[0], priY[0], priY[0], priY[0], priY[0], 0));
+              cons_tmp = _mm512_set1_pd(*(priY));
+              s_0_0 = _mm512_add_pd(s_0_0, _mm512_sub_pd(s_0_1, cons_tmp));
+              s_0_0 = _mm512_add_pd(s_0_0, _mm512_sub_pd(s_0_2, cons_tmp));
+              s_0_0 = _mm512_add_pd(s_0_0, _mm512_sub_pd(s_0_3, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_0_0);
+              priY[0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+              s_1_0 = _mm512_sub_pd(s_1_0, _mm512_set_pd(priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], 0));
+              cons_tmp = _mm512_set1_pd(*(priY + (ptrdiff_t)incpriY));
+              s_1_0 = _mm512_add_pd(s_1_0, _mm512_sub_pd(s_1_1, cons_tmp));
+              s_1_0 = _mm512_add_pd(s_1_0, _mm512_sub_pd(s_1_2, cons_tmp));
+              s_1_0 = _mm512_add_pd(s_1_0, _mm512_sub_pd(s_1_3, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_1_0);
+              priY[(ptrdiff_t)incpriY] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+              s_2_0 = _mm512_sub_pd(s_2_0, _mm512_set_pd(priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], 0));
+              cons_tmp = _mm512_set1_pd(*(priY + ((ptrdiff_t)incpriY * 2)));
+              s_2_0 = _mm512_add_pd(s_2_0, _mm512_sub_pd(s_2_1, cons_tmp));
+              s_2_0 = _mm512_add_pd(s_2_0, _mm512_sub_pd(s_2_2, cons_tmp));
+              s_2_0 = _mm512_add_pd(s_2_0, _mm512_sub_pd(s_2_3, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_2_0);
+              priY[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 4:
+            {
+              int i;
+              __m512d X_0, X_1;
+              __m512d compression_0;
+              __m512d expansion_0;
+              __m512d q_0;
+              __m512d s_0_0;
+              __m512d s_1_0;
+              __m512d s_2_0;
+              __m512d s_3_0;
+
+              s_0_0 = _mm512_set1_pd(*(priY));
+              s_1_0 = _mm512_set1_pd(*(priY + (ptrdiff_t)incpriY));
+              s_2_0 = _mm512_set1_pd(*(priY + ((ptrdiff_t)incpriY * 2)));
+              s_3_0 = _mm512_set1_pd(*(priY + ((ptrdiff_t)incpriY * 3)));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 16 <= N_block; i += 16, X += 16){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += 8;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_maskz_loadu_pd((__mmask8)((1U << (N_block - i)) - 1), X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 16 <= N_block; i += 16, X += 16){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_loadu_pd(X + 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += 8;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_maskz_loadu_pd((__mmask8)((1U << (N_block - i)) - 1), X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 16 <= N_block; i += 16, X += ((ptrdiff_t)incX * 16)){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm512_fmadd_pd(q_0, expansion_0, X_1);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N_block - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 16 <= N_block; i += 16, X += ((ptrdiff_t)incX * 16)){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_1 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X + ((ptrdiff_t)incX * 8), 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+                    X_1 = _mm512_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_1 = _mm512_add_pd(X_1, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_1), blp_mask_tmp)));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N_block - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    X_0 = _mm512_add_pd(X_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              s_0_0 = _mm512_sub_pd(s_0_0, _mm512_set_pd(priY[0], priY[0], priY[0], priY[0], priY[0], priY[0], priY[0], 0));
+              _mm512_store_pd(cons_buffer_tmp, s_0_0);
+              priY[0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+              s_1_0 = _mm512_sub_pd(s_1_0, _mm512_set_pd(priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], 0));
+              _mm512_store_pd(cons_buffer_tmp, s_1_0);
+              priY[(ptrdiff_t)incpriY] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+              s_2_0 = _mm512_sub_pd(s_2_0, _mm512_set_pd(priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], 0));
+              _mm512_store_pd(cons_buffer_tmp, s_2_0);
+              priY[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+              s_3_0 = _mm512_sub_pd(s_3_0, _mm512_set_pd(priY[((ptrdiff_t)incpriY * 3)], priY[((ptrdiff_t)incpriY * 3)], priY[((ptrdiff_t)incpriY * 3)], priY[((ptrdiff_t)incpriY * 3)], priY[((ptrdiff_t)incpriY * 3)], priY[((ptrdiff_t)incpriY * 3)], priY[((ptrdiff_t)incpriY * 3)], 0));
+              _mm512_store_pd(cons_buffer_tmp, s_3_0);
+              priY[((ptrdiff_t)incpriY * 3)] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          default:
+            {
+              int i, j;
+              __m512d X_0;
+              __m512d compression_0;
+              __m512d expansion_0;
+              __m512d q_0;
+              __m512d s_0;
+              __m512d s_buffer[binned_DBMAXFOLD];
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[j] = _mm512_set1_pd(*(priY + ((ptrdiff_t)incpriY * j)));
+              }
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 8 <= N_block; i += 8, X += 8){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      X_0 = _mm512_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm512_add_pd(s_buffer[j], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_maskz_loadu_pd((__mmask8)((1U << (N_block - i)) - 1), X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      X_0 = _mm512_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm512_add_pd(s_buffer[j], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 8 <= N_block; i += 8, X += 8){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    X_0 = _mm512_mul_pd(_mm512_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      X_0 = _mm512_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm512_add_pd(s_buffer[j], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_maskz_loadu_pd((__mmask8)((1U << (N_block - i)) - 1), X), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      X_0 = _mm512_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm512_add_pd(s_buffer[j], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 8 <= N_block; i += 8, X += ((ptrdiff_t)incX * 8)){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      X_0 = _mm512_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm512_add_pd(s_buffer[j], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N_block - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(X_0, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm512_fmadd_pd(q_0, expansion_0, X_0);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      X_0 = _mm512_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm512_add_pd(s_buffer[j], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 8 <= N_block; i += 8, X += ((ptrdiff_t)incX * 8)){
+                    X_0 = _mm512_mul_pd(_mm512_i64gather_pd(_mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      X_0 = _mm512_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm512_add_pd(s_buffer[j], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                  }
+                  if(i < N_block){
+                    X_0 = _mm512_mul_pd(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << (N_block - i)) - 1), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 8), scale_mask_inv);
+                    X_0 = _mm512_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      X_0 = _mm512_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm512_add_pd(s_buffer[j], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(X_0), blp_mask_tmp)));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[j] = _mm512_sub_pd(s_buffer[j], _mm512_set_pd(priY[((ptrdiff_t)incpriY * j)], priY[((ptrdiff_t)incpriY * j)], priY[((ptrdiff_t)incpriY * j)], priY[((ptrdiff_t)incpriY * j)], priY[((ptrdiff_t)incpriY * j)], priY[((ptrdiff_t)incpriY * j)], priY[((ptrdiff_t)incpriY * j)], 0));
+                _mm512_store_pd(cons_buffer_tmp, s_buffer[j]);
+                priY[((ptrdiff_t)incpriY * j)] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+              }
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+        }
+
+      #elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+        __m256d scale_mask_inv = _mm256_set1_pd(1.0 / scl);
+        __m256d blp_mask_tmp;
+        {
+          __m256d tmp;
+          blp_mask_tmp = _mm256_set1_pd(1.0);
+          tmp = _mm256_set1_pd(1.0 + (DBL_EPSILON * 1.0001));
+          blp_mask_tmp = _mm256_xor_pd(blp_mask_tmp, tmp);
+        }
+        __m256d cons_tmp; (void)cons_tmp;
+        double cons_buffer_tmp[4] __attribute__((aligned(32))); (void)cons_buffer_tmp;
+        unsigned int SIMD_daz_ftz_old_tmp = 0;
+        unsigned int SIMD_daz_ftz_new_tmp = 0;
+
+
+        switch(fold){
+          case 2:
+            {
+              int i;
+              __m256d X_0, X_1, X_2, X_3, X_4, X_5;
+              __m256d compression_0;
+              __m256d expansion_0;
+              __m256d q_0;
+              __m256d s_0_0;
+              __m256d s_1_0;
+
+              s_0_0 = _mm256_broadcast_sd(priY);
+              s_1_0 = _mm256_broadcast_sd(priY + (ptrdiff_t)incpriY);
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 24 <= N_block; i += 24, X += 24){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 528), _MM_HINT_T0);
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_loadu_pd(X + 8), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_loadu_pd(X + 12), scale_mask_inv);
+                    X_4 = _mm256_mul_pd(_mm256_loadu_pd(X + 16), scale_mask_inv);
+                    X_5 = _mm256_mul_pd(_mm256_loadu_pd(X + 20), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+                    X_4 = _mm256_mul_pd(X_4, X_4);
+                    X_5 = _mm256_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_2 = _mm256_fmadd_pd(q_0, expansion_0, X_2);
+                    X_2 = _mm256_fmadd_pd(q_0, expansion_0, X_2);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_2 = _mm256_add_pd(_mm256_add_pd(X_2, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_3 = _mm256_fmadd_pd(q_0, expansion_0, X_3);
+                    X_3 = _mm256_fmadd_pd(q_0, expansion_0, X_3);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_3 = _mm256_add_pd(_mm256_add_pd(X_3, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_4, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_4 = _mm256_fmadd_pd(q_0, expansion_0, X_4);
+                    X_4 = _mm256_fmadd_pd(q_0, expansion_0, X_4);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_4 = _mm256_add_pd(_mm256_add_pd(X_4, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_4, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_5 = _mm256_fmadd_pd(q_0, expansion_0, X_5);
+                    X_5 = _mm256_fmadd_pd(q_0, expansion_0, X_5);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_5 = _mm256_add_pd(_mm256_add_pd(X_5, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_5, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_loadu_pd(X + 8), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_loadu_pd(X + 12), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_2 = _mm256_fmadd_pd(q_0, expansion_0, X_2);
+                    X_2 = _mm256_fmadd_pd(q_0, expansion_0, X_2);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_2 = _mm256_add_pd(_mm256_add_pd(X_2, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_3 = _mm256_fmadd_pd(q_0, expansion_0, X_3);
+                    X_3 = _mm256_fmadd_pd(q_0, expansion_0, X_3);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_3 = _mm256_add_pd(_mm256_add_pd(X_3, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    i += 16, X += 16;
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    i += 8, X += 8;
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[2]:0, (N_block - i)>1?X[1]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 24 <= N_block; i += 24, X += 24){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 528), _MM_HINT_T0);
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_loadu_pd(X + 8), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_loadu_pd(X + 12), scale_mask_inv);
+                    X_4 = _mm256_mul_pd(_mm256_loadu_pd(X + 16), scale_mask_inv);
+                    X_5 = _mm256_mul_pd(_mm256_loadu_pd(X + 20), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+                    X_4 = _mm256_mul_pd(X_4, X_4);
+                    X_5 = _mm256_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_2 = _mm256_add_pd(X_2, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_3 = _mm256_add_pd(X_3, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_4 = _mm256_add_pd(X_4, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_4, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_5 = _mm256_add_pd(X_5, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_5, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_loadu_pd(X + 8), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_loadu_pd(X + 12), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_2 = _mm256_add_pd(X_2, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_3 = _mm256_add_pd(X_3, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    i += 16, X += 16;
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    i += 8, X += 8;
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[2]:0, (N_block - i)>1?X[1]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 24 <= N_block; i += 24, X += ((ptrdiff_t)incX * 24)){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]), scale_mask_inv);
+                    X_4 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]), scale_mask_inv);
+                    X_5 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+                    X_4 = _mm256_mul_pd(X_4, X_4);
+                    X_5 = _mm256_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_2 = _mm256_fmadd_pd(q_0, expansion_0, X_2);
+                    X_2 = _mm256_fmadd_pd(q_0, expansion_0, X_2);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_2 = _mm256_add_pd(_mm256_add_pd(X_2, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_3 = _mm256_fmadd_pd(q_0, expansion_0, X_3);
+                    X_3 = _mm256_fmadd_pd(q_0, expansion_0, X_3);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_3 = _mm256_add_pd(_mm256_add_pd(X_3, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_4, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_4 = _mm256_fmadd_pd(q_0, expansion_0, X_4);
+                    X_4 = _mm256_fmadd_pd(q_0, expansion_0, X_4);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_4 = _mm256_add_pd(_mm256_add_pd(X_4, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_4, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_5 = _mm256_fmadd_pd(q_0, expansion_0, X_5);
+                    X_5 = _mm256_fmadd_pd(q_0, expansion_0, X_5);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_5 = _mm256_add_pd(_mm256_add_pd(X_5, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_5, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_2 = _mm256_fmadd_pd(q_0, expansion_0, X_2);
+                    X_2 = _mm256_fmadd_pd(q_0, expansion_0, X_2);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_2 = _mm256_add_pd(_mm256_add_pd(X_2, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_3 = _mm256_fmadd_pd(q_0, expansion_0, X_3);
+                    X_3 = _mm256_fmadd_pd(q_0, expansion_0, X_3);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_3 = _mm256_add_pd(_mm256_add_pd(X_3, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    i += 16, X += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N_block - i)>1?X[(ptrdiff_t)incX]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 24 <= N_block; i += 24, X += ((ptrdiff_t)incX * 24)){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]), scale_mask_inv);
+                    X_4 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]), scale_mask_inv);
+                    X_5 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+                    X_4 = _mm256_mul_pd(X_4, X_4);
+                    X_5 = _mm256_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_2 = _mm256_add_pd(X_2, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_3 = _mm256_add_pd(X_3, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_4 = _mm256_add_pd(X_4, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_4, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_5 = _mm256_add_pd(X_5, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_5, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_2 = _mm256_add_pd(X_2, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_3 = _mm256_add_pd(X_3, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_3, blp_mask_tmp));
+                    i += 16, X += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N_block - i)>1?X[(ptrdiff_t)incX]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              s_0_0 = _mm256_sub_pd(s_0_0, _mm256_set_pd(priY[0], priY[0], priY[0], 0));
+              _mm256_store_pd(cons_buffer_tmp, s_0_0);
+              priY[0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+              s_1_0 = _mm256_sub_pd(s_1_0, _mm256_set_pd(priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], 0));
+              _mm256_store_pd(cons_buffer_tmp, s_1_0);
+              priY[(ptrdiff_t)incpriY] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 3:
+            {
+              int i;
+              __m256d X_0, X_1, X_2, X_3;
+              __m256d compression_0;
+              __m256d expansion_0;
+              __m256d q_0, q_1, q_2, q_3;
+              __m256d s_0_0, s_0_1, s_0_2, s_0_3;
+              __m256d s_1_0, s_1_1, s_1_2, s_1_3;
+              __m256d s_2_0, s_2_1, s_2_2, s_2_3;
+
+              s_0_0 = s_0_1 = s_0_2 = s_0_3 = _mm256_broadcast_sd(priY);
+              s_1_0 = s_1_1 = s_1_2 = s_1_3 = _mm256_broadcast_sd(priY + (ptrdiff_t)incpriY);
+              s_2_0 = s_2_1 = s_2_2 = s_2_3 = _mm256_broadcast_sd(priY + ((ptrdiff_t)incpriY * 2));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 16 <= N_block; i += 16, X += 16){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_loadu_pd(X + 8), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_loadu_pd(X + 12), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(_mm256_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(_mm256_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm256_fmadd_pd(q_1, expansion_0, X_1);
+                    X_2 = _mm256_fmadd_pd(q_2, expansion_0, X_2);
+                    X_3 = _mm256_fmadd_pd(q_3, expansion_0, X_3);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm256_fmadd_pd(q_1, expansion_0, X_1);
+                    X_2 = _mm256_fmadd_pd(q_2, expansion_0, X_2);
+                    X_3 = _mm256_fmadd_pd(q_3, expansion_0, X_3);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    q_1 = _mm256_mul_pd(q_1, expansion_0);
+                    q_2 = _mm256_mul_pd(q_2, expansion_0);
+                    q_3 = _mm256_mul_pd(q_3, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_1), q_1);
+                    X_2 = _mm256_add_pd(_mm256_add_pd(X_2, q_2), q_2);
+                    X_3 = _mm256_add_pd(_mm256_add_pd(X_3, q_3), q_3);
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    q_2 = s_1_2;
+                    q_3 = s_1_3;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(X_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    q_2 = _mm256_sub_pd(q_2, s_1_2);
+                    q_3 = _mm256_sub_pd(q_3, s_1_3);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    X_2 = _mm256_add_pd(X_2, q_2);
+                    X_3 = _mm256_add_pd(X_3, q_3);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    s_2_2 = _mm256_add_pd(s_2_2, _mm256_or_pd(X_2, blp_mask_tmp));
+                    s_2_3 = _mm256_add_pd(s_2_3, _mm256_or_pd(X_3, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm256_fmadd_pd(q_1, expansion_0, X_1);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm256_fmadd_pd(q_1, expansion_0, X_1);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    q_1 = _mm256_mul_pd(q_1, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_1), q_1);
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    i += 8, X += 8;
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[2]:0, (N_block - i)>1?X[1]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 16 <= N_block; i += 16, X += 16){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_loadu_pd(X + 8), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_loadu_pd(X + 12), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(X_2, blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    X_2 = _mm256_add_pd(X_2, q_2);
+                    X_3 = _mm256_add_pd(X_3, q_3);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    q_2 = s_1_2;
+                    q_3 = s_1_3;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(X_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    q_2 = _mm256_sub_pd(q_2, s_1_2);
+                    q_3 = _mm256_sub_pd(q_3, s_1_3);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    X_2 = _mm256_add_pd(X_2, q_2);
+                    X_3 = _mm256_add_pd(X_3, q_3);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    s_2_2 = _mm256_add_pd(s_2_2, _mm256_or_pd(X_2, blp_mask_tmp));
+                    s_2_3 = _mm256_add_pd(s_2_3, _mm256_or_pd(X_3, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    i += 8, X += 8;
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[2]:0, (N_block - i)>1?X[1]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 16 <= N_block; i += 16, X += ((ptrdiff_t)incX * 16)){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(_mm256_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(_mm256_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm256_fmadd_pd(q_1, expansion_0, X_1);
+                    X_2 = _mm256_fmadd_pd(q_2, expansion_0, X_2);
+                    X_3 = _mm256_fmadd_pd(q_3, expansion_0, X_3);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm256_fmadd_pd(q_1, expansion_0, X_1);
+                    X_2 = _mm256_fmadd_pd(q_2, expansion_0, X_2);
+                    X_3 = _mm256_fmadd_pd(q_3, expansion_0, X_3);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    q_1 = _mm256_mul_pd(q_1, expansion_0);
+                    q_2 = _mm256_mul_pd(q_2, expansion_0);
+                    q_3 = _mm256_mul_pd(q_3, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_1), q_1);
+                    X_2 = _mm256_add_pd(_mm256_add_pd(X_2, q_2), q_2);
+                    X_3 = _mm256_add_pd(_mm256_add_pd(X_3, q_3), q_3);
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    q_2 = s_1_2;
+                    q_3 = s_1_3;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(X_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    q_2 = _mm256_sub_pd(q_2, s_1_2);
+                    q_3 = _mm256_sub_pd(q_3, s_1_3);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    X_2 = _mm256_add_pd(X_2, q_2);
+                    X_3 = _mm256_add_pd(X_3, q_3);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    s_2_2 = _mm256_add_pd(s_2_2, _mm256_or_pd(X_2, blp_mask_tmp));
+                    s_2_3 = _mm256_add_pd(s_2_3, _mm256_or_pd(X_3, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm256_fmadd_pd(q_1, expansion_0, X_1);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_1 = _mm256_fmadd_pd(q_1, expansion_0, X_1);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    q_1 = _mm256_mul_pd(q_1, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_1), q_1);
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N_block - i)>1?X[(ptrdiff_t)incX]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 16 <= N_block; i += 16, X += ((ptrdiff_t)incX * 16)){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_2 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_3 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+                    X_2 = _mm256_mul_pd(X_2, X_2);
+                    X_3 = _mm256_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(X_2, blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    X_2 = _mm256_add_pd(X_2, q_2);
+                    X_3 = _mm256_add_pd(X_3, q_3);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    q_2 = s_1_2;
+                    q_3 = s_1_3;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(X_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    q_2 = _mm256_sub_pd(q_2, s_1_2);
+                    q_3 = _mm256_sub_pd(q_3, s_1_3);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    X_2 = _mm256_add_pd(X_2, q_2);
+                    X_3 = _mm256_add_pd(X_3, q_3);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    s_2_2 = _mm256_add_pd(s_2_2, _mm256_or_pd(X_2, blp_mask_tmp));
+                    s_2_3 = _mm256_add_pd(s_2_3, _mm256_or_pd(X_3, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    X_1 = _mm256_add_pd(X_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(X_1, blp_mask_tmp));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N_block - i)>1?X[(ptrdiff_t)incX]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              s_0_0 = _mm256_sub_pd(s_0_0, _mm256_set_pd(priY[0], priY[0], priY[0], 0));
+              cons_tmp = _mm256_broadcast_sd(priY);
+              s_0_0 = _mm256_add_pd(s_0_0, _mm256_sub_pd(s_0_1, cons_tmp));
+              s_0_0 = _mm256_add_pd(s_0_0, _mm256_sub_pd(s_0_2, cons_tmp));
+              s_0_0 = _mm256_add_pd(s_0_0, _mm256_sub_pd(s_0_3, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_0_0);
+              priY[0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+              s_1_0 = _mm256_sub_pd(s_1_0, _mm256_set_pd(priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], 0));
+              cons_tmp = _mm256_broadcast_sd(priY + (ptrdiff_t)incpriY);
+              s_1_0 = _mm256_add_pd(s_1_0, _mm256_sub_pd(s_1_1, cons_tmp));
+              s_1_0 = _mm256_add_pd(s_1_0, _mm256_sub_pd(s_1_2, cons_tmp));
+              s_1_0 = _mm256_add_pd(s_1_0, _mm256_sub_pd(s_1_3, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_1_0);
+              priY[(ptrdiff_t)incpriY] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+              s_2_0 = _mm256_sub_pd(s_2_0, _mm256_set_pd(priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], 0));
+              cons_tmp = _mm256_broadcast_sd(priY + ((ptrdiff_t)incpriY * 2));
+              s_2_0 = _mm256_add_pd(s_2_0, _mm256_sub_pd(s_2_1, cons_tmp));
+              s_2_0 = _mm256_add_pd(s_2_0, _mm256_sub_pd(s_2_2, cons_tmp));
+              s_2_0 = _mm256_add_pd(s_2_0, _mm256_sub_pd(s_2_3, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_2_0);
+              priY[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 4:
+            {
+              int i;
+              __m256d X_0, X_1;
+              __m256d compression_0;
+              __m256d expansion_0;
+              __m256d q_0;
+              __m256d s_0_0;
+              __m256d s_1_0;
+              __m256d s_2_0;
+              __m256d s_3_0;
+
+              s_0_0 = _mm256_broadcast_sd(priY);
+              s_1_0 = _mm256_broadcast_sd(priY + (ptrdiff_t)incpriY);
+              s_2_0 = _mm256_broadcast_sd(priY + ((ptrdiff_t)incpriY * 2));
+              s_3_0 = _mm256_broadcast_sd(priY + ((ptrdiff_t)incpriY * 3));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 8 <= N_block; i += 8, X += 8){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[2]:0, (N_block - i)>1?X[1]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 8 <= N_block; i += 8, X += 8){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_loadu_pd(X + 4), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[2]:0, (N_block - i)>1?X[1]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 8 <= N_block; i += 8, X += ((ptrdiff_t)incX * 8)){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    X_1 = _mm256_fmadd_pd(q_0, expansion_0, X_1);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_1 = _mm256_add_pd(_mm256_add_pd(X_1, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N_block - i)>1?X[(ptrdiff_t)incX]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 8 <= N_block; i += 8, X += ((ptrdiff_t)incX * 8)){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+                    X_1 = _mm256_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_1 = _mm256_add_pd(X_1, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_1, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N_block - i)>1?X[(ptrdiff_t)incX]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    X_0 = _mm256_add_pd(X_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              s_0_0 = _mm256_sub_pd(s_0_0, _mm256_set_pd(priY[0], priY[0], priY[0], 0));
+              _mm256_store_pd(cons_buffer_tmp, s_0_0);
+              priY[0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+              s_1_0 = _mm256_sub_pd(s_1_0, _mm256_set_pd(priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], priY[(ptrdiff_t)incpriY], 0));
+              _mm256_store_pd(cons_buffer_tmp, s_1_0);
+              priY[(ptrdiff_t)incpriY] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+              s_2_0 = _mm256_sub_pd(s_2_0, _mm256_set_pd(priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], priY[((ptrdiff_t)incpriY * 2)], 0));
+              _mm256_store_pd(cons_buffer_tmp, s_2_0);
+              priY[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+              s_3_0 = _mm256_sub_pd(s_3_0, _mm256_set_pd(priY[((ptrdiff_t)incpriY * 3)], priY[((ptrdiff_t)incpriY * 3)], priY[((ptrdiff_t)incpriY * 3)], 0));
+              _mm256_store_pd(cons_buffer_tmp, s_3_0);
+              priY[((ptrdiff_t)incpriY * 3)] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          default:
+            {
+              int i, j;
+              __m256d X_0;
+              __m256d compression_0;
+              __m256d expansion_0;
+              __m256d q_0;
+              __m256d s_0;
+              __m256d s_buffer[binned_DBMAXFOLD];
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[j] = _mm256_broadcast_sd(priY + ((ptrdiff_t)incpriY * j));
+              }
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 4 <= N_block; i += 4, X += 4){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      X_0 = _mm256_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm256_add_pd(s_buffer[j], _mm256_or_pd(X_0, blp_mask_tmp));
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[2]:0, (N_block - i)>1?X[1]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      X_0 = _mm256_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm256_add_pd(s_buffer[j], _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 4 <= N_block; i += 4, X += 4){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    X_0 = _mm256_mul_pd(_mm256_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      X_0 = _mm256_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm256_add_pd(s_buffer[j], _mm256_or_pd(X_0, blp_mask_tmp));
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[2]:0, (N_block - i)>1?X[1]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      X_0 = _mm256_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm256_add_pd(s_buffer[j], _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 4 <= N_block; i += 4, X += ((ptrdiff_t)incX * 4)){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      X_0 = _mm256_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm256_add_pd(s_buffer[j], _mm256_or_pd(X_0, blp_mask_tmp));
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N_block - i)>1?X[(ptrdiff_t)incX]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    #if defined(__FMA__)
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    X_0 = _mm256_fmadd_pd(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = _mm256_mul_pd(q_0, expansion_0);
+                    X_0 = _mm256_add_pd(_mm256_add_pd(X_0, q_0), q_0);
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      X_0 = _mm256_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm256_add_pd(s_buffer[j], _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 4 <= N_block; i += 4, X += ((ptrdiff_t)incX * 4)){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      X_0 = _mm256_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm256_add_pd(s_buffer[j], _mm256_or_pd(X_0, blp_mask_tmp));
+                  }
+                  if(i < N_block){
+                    X_0 = _mm256_mul_pd(_mm256_set_pd(0, (N_block - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N_block - i)>1?X[(ptrdiff_t)incX]:0, X[0]), scale_mask_inv);
+                    X_0 = _mm256_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[j] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      X_0 = _mm256_add_pd(X_0, q_0);
+                    }
+                    s_buffer[j] = _mm256_add_pd(s_buffer[j], _mm256_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[j] = _mm256_sub_pd(s_buffer[j], _mm256_set_pd(priY[((ptrdiff_t)incpriY * j)], priY[((ptrdiff_t)incpriY * j)], priY[((ptrdiff_t)incpriY * j)], 0));
+                _mm256_store_pd(cons_buffer_tmp, s_buffer[j]);
+                priY[((ptrdiff_t)incpriY * j)] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+              }
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+        }
+
+      #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+        __m128d scale_mask_inv = _mm_set1_pd(1.0 / scl);
+        __m128d blp_mask_tmp;
+        {
+          __m128d tmp;
+          blp_mask_tmp = _mm_set1_pd(1.0);
+          tmp = _mm_set1_pd(1.0 + (DBL_EPSILON * 1.0001));
+          blp_mask_tmp = _mm_xor_pd(blp_mask_tmp, tmp);
+        }
+        __m128d cons_tmp; (void)cons_tmp;
+        double cons_buffer_tmp[2] __attribute__((aligned(16))); (void)cons_buffer_tmp;
+        unsigned int SIMD_daz_ftz_old_tmp = 0;
+        unsigned int SIMD_daz_ftz_new_tmp = 0;
+
+
+        switch(fold){
+          case 2:
+            {
+              int i;
+              __m128d X_0, X_1;
+              __m128d compression_0;
+              __m128d expansion_0;
+              __m128d q_0, q_1;
+              __m128d s_0_0, s_0_1;
+              __m128d s_1_0, s_1_1;
+
+              s_0_0 = s_0_1 = _mm_load1_pd(priY);
+              s_1_0 = s_1_1 = _mm_load1_pd(priY + (ptrdiff_t)incpriY);
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 4 <= N_block; i += 4, X += 4){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_1), q_1);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(X_1, blp_mask_tmp));
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += 2;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 4 <= N_block; i += 4, X += 4){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    X_1 = _mm_add_pd(X_1, q_1);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(X_1, blp_mask_tmp));
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += 2;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 4 <= N_block; i += 4, X += ((ptrdiff_t)incX * 4)){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_1), q_1);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(X_1, blp_mask_tmp));
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += ((ptrdiff_t)incX * 2);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 4 <= N_block; i += 4, X += ((ptrdiff_t)incX * 4)){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    X_1 = _mm_add_pd(X_1, q_1);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(X_1, blp_mask_tmp));
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += ((ptrdiff_t)incX * 2);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              s_0_0 = _mm_sub_pd(s_0_0, _mm_set_pd(priY[0], 0));
+              cons_tmp = _mm_load1_pd(priY);
+              s_0_0 = _mm_add_pd(s_0_0, _mm_sub_pd(s_0_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_0_0);
+              priY[0] = cons_buffer_tmp[0] + cons_buffer_tmp[1];
+              s_1_0 = _mm_sub_pd(s_1_0, _mm_set_pd(priY[(ptrdiff_t)incpriY], 0));
+              cons_tmp = _mm_load1_pd(priY + (ptrdiff_t)incpriY);
+              s_1_0 = _mm_add_pd(s_1_0, _mm_sub_pd(s_1_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_1_0);
+              priY[(ptrdiff_t)incpriY] = cons_buffer_tmp[0] + cons_buffer_tmp[1];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 3:
+            {
+              int i;
+              __m128d X_0, X_1, X_2;
+              __m128d compression_0;
+              __m128d expansion_0;
+              __m128d q_0;
+              __m128d s_0_0;
+              __m128d s_1_0;
+              __m128d s_2_0;
+
+              s_0_0 = _mm_load1_pd(priY);
+              s_1_0 = _mm_load1_pd(priY + (ptrdiff_t)incpriY);
+              s_2_0 = _mm_load1_pd(priY + ((ptrdiff_t)incpriY * 2));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 6 <= N_block; i += 6, X += 6){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += 2;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 6 <= N_block; i += 6, X += 6){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += 2;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 6 <= N_block; i += 6, X += ((ptrdiff_t)incX * 6)){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += ((ptrdiff_t)incX * 2);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 6 <= N_block; i += 6, X += ((ptrdiff_t)incX * 6)){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += ((ptrdiff_t)incX * 2);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              s_0_0 = _mm_sub_pd(s_0_0, _mm_set_pd(priY[0], 0));
+              _mm_store_pd(cons_buffer_tmp, s_0_0);
+              priY[0] = cons_buffer_tmp[0] + cons_buffer_tmp[1];
+              s_1_0 = _mm_sub_pd(s_1_0, _mm_set_pd(priY[(ptrdiff_t)incpriY], 0));
+              _mm_store_pd(cons_buffer_tmp, s_1_0);
+              priY[(ptrdiff_t)incpriY] = cons_buffer_tmp[0] + cons_buffer_tmp[1];
+              s_2_0 = _mm_sub_pd(s_2_0, _mm_set_pd(priY[((ptrdiff_t)incpriY * 2)], 0));
+              _mm_store_pd(cons_buffer_tmp, s_2_0);
+              priY[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[1];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 4:
+            {
+              int i;
+              __m128d X_0, X_1, X_2, X_3, X_4, X_5;
+              __m128d compression_0;
+              __m128d expansion_0;
+              __m128d q_0;
+              __m128d s_0_0;
+              __m128d s_1_0;
+              __m128d s_2_0;
+              __m128d s_3_0;
+
+              s_0_0 = _mm_load1_pd(priY);
+              s_1_0 = _mm_load1_pd(priY + (ptrdiff_t)incpriY);
+              s_2_0 = _mm_load1_pd(priY + ((ptrdiff_t)incpriY * 2));
+              s_3_0 = _mm_load1_pd(priY + ((ptrdiff_t)incpriY * 3));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 12 <= N_block; i += 12, X += 12){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_loadu_pd(X + 6), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_loadu_pd(X + 8), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_loadu_pd(X + 10), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_3 = _mm_add_pd(_mm_add_pd(X_3, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_4, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_4 = _mm_add_pd(_mm_add_pd(X_4, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_4 = _mm_add_pd(X_4, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_4 = _mm_add_pd(X_4, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_5 = _mm_add_pd(_mm_add_pd(X_5, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_5 = _mm_add_pd(X_5, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_5 = _mm_add_pd(X_5, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_5, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_loadu_pd(X + 6), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_3 = _mm_add_pd(_mm_add_pd(X_3, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    i += 8, X += 8;
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += 2;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 12 <= N_block; i += 12, X += 12){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_loadu_pd(X + 6), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_loadu_pd(X + 8), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_loadu_pd(X + 10), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_4 = _mm_add_pd(X_4, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_4 = _mm_add_pd(X_4, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_4 = _mm_add_pd(X_4, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_5 = _mm_add_pd(X_5, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_5 = _mm_add_pd(X_5, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_5 = _mm_add_pd(X_5, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_5, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_loadu_pd(X + 6), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    i += 8, X += 8;
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += 2;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 12 <= N_block; i += 12, X += ((ptrdiff_t)incX * 12)){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_3 = _mm_add_pd(_mm_add_pd(X_3, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_4, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_4 = _mm_add_pd(_mm_add_pd(X_4, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_4 = _mm_add_pd(X_4, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_4 = _mm_add_pd(X_4, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_5 = _mm_add_pd(_mm_add_pd(X_5, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_5 = _mm_add_pd(X_5, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_5 = _mm_add_pd(X_5, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_5, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_3 = _mm_add_pd(_mm_add_pd(X_3, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += ((ptrdiff_t)incX * 2);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 12 <= N_block; i += 12, X += ((ptrdiff_t)incX * 12)){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_4 = _mm_add_pd(X_4, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_4 = _mm_add_pd(X_4, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_4 = _mm_add_pd(X_4, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_4, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_5 = _mm_add_pd(X_5, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_5 = _mm_add_pd(X_5, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_5 = _mm_add_pd(X_5, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_5, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_2 = _mm_add_pd(X_2, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_2, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_3 = _mm_add_pd(X_3, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_3, blp_mask_tmp));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_1 = _mm_add_pd(X_1, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += ((ptrdiff_t)incX * 2);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    X_0 = _mm_add_pd(X_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              s_0_0 = _mm_sub_pd(s_0_0, _mm_set_pd(priY[0], 0));
+              _mm_store_pd(cons_buffer_tmp, s_0_0);
+              priY[0] = cons_buffer_tmp[0] + cons_buffer_tmp[1];
+              s_1_0 = _mm_sub_pd(s_1_0, _mm_set_pd(priY[(ptrdiff_t)incpriY], 0));
+              _mm_store_pd(cons_buffer_tmp, s_1_0);
+              priY[(ptrdiff_t)incpriY] = cons_buffer_tmp[0] + cons_buffer_tmp[1];
+              s_2_0 = _mm_sub_pd(s_2_0, _mm_set_pd(priY[((ptrdiff_t)incpriY * 2)], 0));
+              _mm_store_pd(cons_buffer_tmp, s_2_0);
+              priY[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[1];
+              s_3_0 = _mm_sub_pd(s_3_0, _mm_set_pd(priY[((ptrdiff_t)incpriY * 3)], 0));
+              _mm_store_pd(cons_buffer_tmp, s_3_0);
+              priY[((ptrdiff_t)incpriY * 3)] = cons_buffer_tmp[0] + cons_buffer_tmp[1];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          default:
+            {
+              int i, j;
+              __m128d X_0, X_1, X_2, X_3, X_4, X_5, X_6, X_7, X_8, X_9, X_10, X_11, X_12, X_13;
+              __m128d compression_0;
+              __m128d expansion_0;
+              __m128d q_0, q_1;
+              __m128d s_0, s_1;
+              __m128d s_buffer[(binned_DBMAXFOLD * 2)];
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[(j * 2)] = s_buffer[((j * 2) + 1)] = _mm_load1_pd(priY + ((ptrdiff_t)incpriY * j));
+              }
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 28 <= N_block; i += 28, X += 28){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 528), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 536), _MM_HINT_T0);
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_loadu_pd(X + 6), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_loadu_pd(X + 8), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_loadu_pd(X + 10), scale_mask_inv);
+                    X_6 = _mm_mul_pd(_mm_loadu_pd(X + 12), scale_mask_inv);
+                    X_7 = _mm_mul_pd(_mm_loadu_pd(X + 14), scale_mask_inv);
+                    X_8 = _mm_mul_pd(_mm_loadu_pd(X + 16), scale_mask_inv);
+                    X_9 = _mm_mul_pd(_mm_loadu_pd(X + 18), scale_mask_inv);
+                    X_10 = _mm_mul_pd(_mm_loadu_pd(X + 20), scale_mask_inv);
+                    X_11 = _mm_mul_pd(_mm_loadu_pd(X + 22), scale_mask_inv);
+                    X_12 = _mm_mul_pd(_mm_loadu_pd(X + 24), scale_mask_inv);
+                    X_13 = _mm_mul_pd(_mm_loadu_pd(X + 26), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+                    X_6 = _mm_mul_pd(X_6, X_6);
+                    X_7 = _mm_mul_pd(X_7, X_7);
+                    X_8 = _mm_mul_pd(X_8, X_8);
+                    X_9 = _mm_mul_pd(X_9, X_9);
+                    X_10 = _mm_mul_pd(X_10, X_10);
+                    X_11 = _mm_mul_pd(X_11, X_11);
+                    X_12 = _mm_mul_pd(X_12, X_12);
+                    X_13 = _mm_mul_pd(X_13, X_13);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    X_3 = _mm_add_pd(_mm_add_pd(X_3, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_4, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_5, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_4 = _mm_add_pd(_mm_add_pd(X_4, q_0), q_0);
+                    X_5 = _mm_add_pd(_mm_add_pd(X_5, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_4, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_5, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_4 = _mm_add_pd(X_4, q_0);
+                      X_5 = _mm_add_pd(X_5, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_4, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_5, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_6, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_7, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_6 = _mm_add_pd(_mm_add_pd(X_6, q_0), q_0);
+                    X_7 = _mm_add_pd(_mm_add_pd(X_7, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_6, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_7, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_6 = _mm_add_pd(X_6, q_0);
+                      X_7 = _mm_add_pd(X_7, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_6, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_7, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_8, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_9, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_8 = _mm_add_pd(_mm_add_pd(X_8, q_0), q_0);
+                    X_9 = _mm_add_pd(_mm_add_pd(X_9, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_8, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_9, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_8 = _mm_add_pd(X_8, q_0);
+                      X_9 = _mm_add_pd(X_9, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_8, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_9, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_10, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_11, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_10 = _mm_add_pd(_mm_add_pd(X_10, q_0), q_0);
+                    X_11 = _mm_add_pd(_mm_add_pd(X_11, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_10, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_11, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_10 = _mm_add_pd(X_10, q_0);
+                      X_11 = _mm_add_pd(X_11, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_10, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_11, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_12, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_13, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_12 = _mm_add_pd(_mm_add_pd(X_12, q_0), q_0);
+                    X_13 = _mm_add_pd(_mm_add_pd(X_13, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_12, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_13, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_12 = _mm_add_pd(X_12, q_0);
+                      X_13 = _mm_add_pd(X_13, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_12, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_13, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_loadu_pd(X + 6), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_loadu_pd(X + 8), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_loadu_pd(X + 10), scale_mask_inv);
+                    X_6 = _mm_mul_pd(_mm_loadu_pd(X + 12), scale_mask_inv);
+                    X_7 = _mm_mul_pd(_mm_loadu_pd(X + 14), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+                    X_6 = _mm_mul_pd(X_6, X_6);
+                    X_7 = _mm_mul_pd(X_7, X_7);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    X_3 = _mm_add_pd(_mm_add_pd(X_3, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_4, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_5, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_4 = _mm_add_pd(_mm_add_pd(X_4, q_0), q_0);
+                    X_5 = _mm_add_pd(_mm_add_pd(X_5, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_4, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_5, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_4 = _mm_add_pd(X_4, q_0);
+                      X_5 = _mm_add_pd(X_5, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_4, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_5, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_6, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_7, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_6 = _mm_add_pd(_mm_add_pd(X_6, q_0), q_0);
+                    X_7 = _mm_add_pd(_mm_add_pd(X_7, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_6, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_7, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_6 = _mm_add_pd(X_6, q_0);
+                      X_7 = _mm_add_pd(X_7, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_6, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_7, blp_mask_tmp));
+                    i += 16, X += 16;
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_loadu_pd(X + 6), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    X_3 = _mm_add_pd(_mm_add_pd(X_3, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    i += 8, X += 8;
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += 2;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }else{
+                  for(i = 0; i + 28 <= N_block; i += 28, X += 28){
+                    _mm_prefetch((const char*)(X + 512), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 520), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 528), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(X + 536), _MM_HINT_T0);
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_loadu_pd(X + 6), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_loadu_pd(X + 8), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_loadu_pd(X + 10), scale_mask_inv);
+                    X_6 = _mm_mul_pd(_mm_loadu_pd(X + 12), scale_mask_inv);
+                    X_7 = _mm_mul_pd(_mm_loadu_pd(X + 14), scale_mask_inv);
+                    X_8 = _mm_mul_pd(_mm_loadu_pd(X + 16), scale_mask_inv);
+                    X_9 = _mm_mul_pd(_mm_loadu_pd(X + 18), scale_mask_inv);
+                    X_10 = _mm_mul_pd(_mm_loadu_pd(X + 20), scale_mask_inv);
+                    X_11 = _mm_mul_pd(_mm_loadu_pd(X + 22), scale_mask_inv);
+                    X_12 = _mm_mul_pd(_mm_loadu_pd(X + 24), scale_mask_inv);
+                    X_13 = _mm_mul_pd(_mm_loadu_pd(X + 26), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+                    X_6 = _mm_mul_pd(X_6, X_6);
+                    X_7 = _mm_mul_pd(X_7, X_7);
+                    X_8 = _mm_mul_pd(X_8, X_8);
+                    X_9 = _mm_mul_pd(X_9, X_9);
+                    X_10 = _mm_mul_pd(X_10, X_10);
+                    X_11 = _mm_mul_pd(X_11, X_11);
+                    X_12 = _mm_mul_pd(X_12, X_12);
+                    X_13 = _mm_mul_pd(X_13, X_13);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_4, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_5, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_4 = _mm_add_pd(X_4, q_0);
+                      X_5 = _mm_add_pd(X_5, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_4, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_5, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_6, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_7, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_6 = _mm_add_pd(X_6, q_0);
+                      X_7 = _mm_add_pd(X_7, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_6, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_7, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_8, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_9, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_8 = _mm_add_pd(X_8, q_0);
+                      X_9 = _mm_add_pd(X_9, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_8, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_9, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_10, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_11, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_10 = _mm_add_pd(X_10, q_0);
+                      X_11 = _mm_add_pd(X_11, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_10, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_11, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_12, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_13, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_12 = _mm_add_pd(X_12, q_0);
+                      X_13 = _mm_add_pd(X_13, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_12, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_13, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_loadu_pd(X + 6), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_loadu_pd(X + 8), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_loadu_pd(X + 10), scale_mask_inv);
+                    X_6 = _mm_mul_pd(_mm_loadu_pd(X + 12), scale_mask_inv);
+                    X_7 = _mm_mul_pd(_mm_loadu_pd(X + 14), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+                    X_6 = _mm_mul_pd(X_6, X_6);
+                    X_7 = _mm_mul_pd(X_7, X_7);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_4, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_5, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_4 = _mm_add_pd(X_4, q_0);
+                      X_5 = _mm_add_pd(X_5, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_4, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_5, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_6, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_7, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_6 = _mm_add_pd(X_6, q_0);
+                      X_7 = _mm_add_pd(X_7, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_6, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_7, blp_mask_tmp));
+                    i += 16, X += 16;
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_loadu_pd(X + 4), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_loadu_pd(X + 6), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    i += 8, X += 8;
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_loadu_pd(X + 2), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += 4;
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_loadu_pd(X), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += 2;
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    X += (N_block - i);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                  expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                  for(i = 0; i + 28 <= N_block; i += 28, X += ((ptrdiff_t)incX * 28)){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)]), scale_mask_inv);
+                    X_6 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]), scale_mask_inv);
+                    X_7 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)]), scale_mask_inv);
+                    X_8 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]), scale_mask_inv);
+                    X_9 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)]), scale_mask_inv);
+                    X_10 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)]), scale_mask_inv);
+                    X_11 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)]), scale_mask_inv);
+                    X_12 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)]), scale_mask_inv);
+                    X_13 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+                    X_6 = _mm_mul_pd(X_6, X_6);
+                    X_7 = _mm_mul_pd(X_7, X_7);
+                    X_8 = _mm_mul_pd(X_8, X_8);
+                    X_9 = _mm_mul_pd(X_9, X_9);
+                    X_10 = _mm_mul_pd(X_10, X_10);
+                    X_11 = _mm_mul_pd(X_11, X_11);
+                    X_12 = _mm_mul_pd(X_12, X_12);
+                    X_13 = _mm_mul_pd(X_13, X_13);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    X_3 = _mm_add_pd(_mm_add_pd(X_3, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_4, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_5, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_4 = _mm_add_pd(_mm_add_pd(X_4, q_0), q_0);
+                    X_5 = _mm_add_pd(_mm_add_pd(X_5, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_4, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_5, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_4 = _mm_add_pd(X_4, q_0);
+                      X_5 = _mm_add_pd(X_5, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_4, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_5, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_6, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_7, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_6 = _mm_add_pd(_mm_add_pd(X_6, q_0), q_0);
+                    X_7 = _mm_add_pd(_mm_add_pd(X_7, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_6, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_7, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_6 = _mm_add_pd(X_6, q_0);
+                      X_7 = _mm_add_pd(X_7, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_6, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_7, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_8, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_9, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_8 = _mm_add_pd(_mm_add_pd(X_8, q_0), q_0);
+                    X_9 = _mm_add_pd(_mm_add_pd(X_9, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_8, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_9, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_8 = _mm_add_pd(X_8, q_0);
+                      X_9 = _mm_add_pd(X_9, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_8, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_9, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_10, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_11, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_10 = _mm_add_pd(_mm_add_pd(X_10, q_0), q_0);
+                    X_11 = _mm_add_pd(_mm_add_pd(X_11, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_10, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_11, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_10 = _mm_add_pd(X_10, q_0);
+                      X_11 = _mm_add_pd(X_11, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_10, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_11, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_12, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_13, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_12 = _mm_add_pd(_mm_add_pd(X_12, q_0), q_0);
+                    X_13 = _mm_add_pd(_mm_add_pd(X_13, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_12, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_13, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_12 = _mm_add_pd(X_12, q_0);
+                      X_13 = _mm_add_pd(X_13, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_12, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_13, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)]), scale_mask_inv);
+                    X_6 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]), scale_mask_inv);
+                    X_7 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+                    X_6 = _mm_mul_pd(X_6, X_6);
+                    X_7 = _mm_mul_pd(X_7, X_7);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    X_3 = _mm_add_pd(_mm_add_pd(X_3, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_4, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_5, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_4 = _mm_add_pd(_mm_add_pd(X_4, q_0), q_0);
+                    X_5 = _mm_add_pd(_mm_add_pd(X_5, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_4, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_5, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_4 = _mm_add_pd(X_4, q_0);
+                      X_5 = _mm_add_pd(X_5, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_4, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_5, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_6, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_7, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_6 = _mm_add_pd(_mm_add_pd(X_6, q_0), q_0);
+                    X_7 = _mm_add_pd(_mm_add_pd(X_7, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_6, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_7, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_6 = _mm_add_pd(X_6, q_0);
+                      X_7 = _mm_add_pd(X_7, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_6, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_7, blp_mask_tmp));
+                    i += 16, X += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_2, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_2 = _mm_add_pd(_mm_add_pd(X_2, q_0), q_0);
+                    X_3 = _mm_add_pd(_mm_add_pd(X_3, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(X_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    q_1 = _mm_mul_pd(q_1, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    X_1 = _mm_add_pd(_mm_add_pd(X_1, q_1), q_1);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += ((ptrdiff_t)incX * 2);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(X_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_0 = _mm_mul_pd(q_0, expansion_0);
+                    X_0 = _mm_add_pd(_mm_add_pd(X_0, q_0), q_0);
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }else{
+                  for(i = 0; i + 28 <= N_block; i += 28, X += ((ptrdiff_t)incX * 28)){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)]), scale_mask_inv);
+                    X_6 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]), scale_mask_inv);
+                    X_7 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)]), scale_mask_inv);
+                    X_8 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]), scale_mask_inv);
+                    X_9 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)]), scale_mask_inv);
+                    X_10 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)]), scale_mask_inv);
+                    X_11 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)]), scale_mask_inv);
+                    X_12 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)]), scale_mask_inv);
+                    X_13 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+                    X_6 = _mm_mul_pd(X_6, X_6);
+                    X_7 = _mm_mul_pd(X_7, X_7);
+                    X_8 = _mm_mul_pd(X_8, X_8);
+                    X_9 = _mm_mul_pd(X_9, X_9);
+                    X_10 = _mm_mul_pd(X_10, X_10);
+                    X_11 = _mm_mul_pd(X_11, X_11);
+                    X_12 = _mm_mul_pd(X_12, X_12);
+                    X_13 = _mm_mul_pd(X_13, X_13);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_4, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_5, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_4 = _mm_add_pd(X_4, q_0);
+                      X_5 = _mm_add_pd(X_5, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_4, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_5, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_6, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_7, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_6 = _mm_add_pd(X_6, q_0);
+                      X_7 = _mm_add_pd(X_7, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_6, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_7, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_8, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_9, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_8 = _mm_add_pd(X_8, q_0);
+                      X_9 = _mm_add_pd(X_9, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_8, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_9, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_10, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_11, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_10 = _mm_add_pd(X_10, q_0);
+                      X_11 = _mm_add_pd(X_11, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_10, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_11, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_12, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_13, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_12 = _mm_add_pd(X_12, q_0);
+                      X_13 = _mm_add_pd(X_13, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_12, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_13, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]), scale_mask_inv);
+                    X_4 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]), scale_mask_inv);
+                    X_5 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)]), scale_mask_inv);
+                    X_6 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]), scale_mask_inv);
+                    X_7 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+                    X_4 = _mm_mul_pd(X_4, X_4);
+                    X_5 = _mm_mul_pd(X_5, X_5);
+                    X_6 = _mm_mul_pd(X_6, X_6);
+                    X_7 = _mm_mul_pd(X_7, X_7);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_4, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_5, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_4 = _mm_add_pd(X_4, q_0);
+                      X_5 = _mm_add_pd(X_5, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_4, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_5, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_6, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_7, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_6 = _mm_add_pd(X_6, q_0);
+                      X_7 = _mm_add_pd(X_7, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_6, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_7, blp_mask_tmp));
+                    i += 16, X += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 8 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_2 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]), scale_mask_inv);
+                    X_3 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+                    X_2 = _mm_mul_pd(X_2, X_2);
+                    X_3 = _mm_mul_pd(X_3, X_3);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_2, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_3, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_2 = _mm_add_pd(X_2, q_0);
+                      X_3 = _mm_add_pd(X_3, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_2, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_3, blp_mask_tmp));
+                    i += 8, X += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 4 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_1 = _mm_mul_pd(_mm_set_pd(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+                    X_1 = _mm_mul_pd(X_1, X_1);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(X_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                      X_1 = _mm_add_pd(X_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(X_1, blp_mask_tmp));
+                    i += 4, X += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 2 <= N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(X[(ptrdiff_t)incX], X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    i += 2, X += ((ptrdiff_t)incX * 2);
+                  }
+                  if(i < N_block){
+                    X_0 = _mm_mul_pd(_mm_set_pd(0, X[0]), scale_mask_inv);
+                    X_0 = _mm_mul_pd(X_0, X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(X_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      X_0 = _mm_add_pd(X_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(X_0, blp_mask_tmp));
+                    X += ((ptrdiff_t)incX * (N_block - i));
+                  }
+                }
+              }
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[(j * 2)] = _mm_sub_pd(s_buffer[(j * 2)], _mm_set_pd(priY[((ptrdiff_t)incpriY * j)], 0));
+                cons_tmp = _mm_load1_pd(priY + ((ptrdiff_t)incpriY * j));
+                s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_sub_pd(s_buffer[((j * 2) + 1)], cons_tmp));
+                _mm_store_pd(cons_buffer_tmp, s_buffer[(j * 2)]);
+                priY[((ptrdiff_t)incpriY * j)] = cons_buffer_tmp[0] + cons_buffer_tmp[1];
+              }
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+        }
+
+      #else
+        double scale_mask_inv = 1.0 / scl;
+        long_double blp_tmp; (void)blp_tmp;
+        double cons_tmp; (void)cons_tmp;
+
+
+        switch(fold){
+          case 3:
+            {
+              int i;
+              double X_0;
+              double compression_0;
+              double expansion_0;
+              double q_0;
+              double s_0_0;
+              double s_1_0;
+              double s_2_0;
+
+              s_0_0 = priY[0];
+              s_1_0 = priY[(ptrdiff_t)incpriY];
+              s_2_0 = priY[((ptrdiff_t)incpriY * 2)];
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = binned_DMCOMPRESSION;
+                  expansion_0 = binned_DMEXPANSION * 0.5;
+                  for(i = 0; i + 1 <= N_block; i += 1, X += 1){
+                    X_0 = (X[0] * scale_mask_inv);
+                    X_0 = (X_0 * X_0);
+
+                    q_0 = s_0_0;
+                    blp_tmp.d = (X_0 * compression_0);
+                    blp_tmp.l |= 1;
+                    s_0_0 = s_0_0 + blp_tmp.d;
+                    q_0 = (q_0 - s_0_0);
+                    #if defined(FP_FAST_FMA)
+                    X_0 = fma(q_0, expansion_0, X_0);
+                    X_0 = fma(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = (q_0 * expansion_0);
+                    X_0 = ((X_0 + q_0) + q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_1_0 = s_1_0 + blp_tmp.d;
+                    q_0 = (q_0 - s_1_0);
+                    X_0 = (X_0 + q_0);
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_2_0 = s_2_0 + blp_tmp.d;
+                  }
+                }else{
+                  for(i = 0; i + 1 <= N_block; i += 1, X += 1){
+                    X_0 = (X[0] * scale_mask_inv);
+                    X_0 = (X_0 * X_0);
+
+                    q_0 = s_0_0;
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_0_0 = s_0_0 + blp_tmp.d;
+                    q_0 = (q_0 - s_0_0);
+                    X_0 = (X_0 + q_0);
+                    q_0 = s_1_0;
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_1_0 = s_1_0 + blp_tmp.d;
+                    q_0 = (q_0 - s_1_0);
+                    X_0 = (X_0 + q_0);
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_2_0 = s_2_0 + blp_tmp.d;
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = binned_DMCOMPRESSION;
+                  expansion_0 = binned_DMEXPANSION * 0.5;
+                  for(i = 0; i + 1 <= N_block; i += 1, X += (ptrdiff_t)incX){
+                    X_0 = (X[0] * scale_mask_inv);
+                    X_0 = (X_0 * X_0);
+
+                    q_0 = s_0_0;
+                    blp_tmp.d = (X_0 * compression_0);
+                    blp_tmp.l |= 1;
+                    s_0_0 = s_0_0 + blp_tmp.d;
+                    q_0 = (q_0 - s_0_0);
+                    #if defined(FP_FAST_FMA)
+                    X_0 = fma(q_0, expansion_0, X_0);
+                    X_0 = fma(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = (q_0 * expansion_0);
+                    X_0 = ((X_0 + q_0) + q_0);
+                    #endif
+                    q_0 = s_1_0;
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_1_0 = s_1_0 + blp_tmp.d;
+                    q_0 = (q_0 - s_1_0);
+                    X_0 = (X_0 + q_0);
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_2_0 = s_2_0 + blp_tmp.d;
+                  }
+                }else{
+                  for(i = 0; i + 1 <= N_block; i += 1, X += (ptrdiff_t)incX){
+                    X_0 = (X[0] * scale_mask_inv);
+                    X_0 = (X_0 * X_0);
+
+                    q_0 = s_0_0;
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_0_0 = s_0_0 + blp_tmp.d;
+                    q_0 = (q_0 - s_0_0);
+                    X_0 = (X_0 + q_0);
+                    q_0 = s_1_0;
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_1_0 = s_1_0 + blp_tmp.d;
+                    q_0 = (q_0 - s_1_0);
+                    X_0 = (X_0 + q_0);
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_2_0 = s_2_0 + blp_tmp.d;
+                  }
+                }
+              }
+
+              priY[0] = s_0_0;
+              priY[(ptrdiff_t)incpriY] = s_1_0;
+              priY[((ptrdiff_t)incpriY * 2)] = s_2_0;
+
+            }
+            break;
+          default:
+            {
+              int i, j;
+              double X_0;
+              double compression_0;
+              double expansion_0;
+              double q_0;
+              double s_0;
+              double s_buffer[binned_DBMAXFOLD];
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[j] = priY[((ptrdiff_t)incpriY * j)];
+              }
+
+              if(incX == 1){
+                if(binned_dmindex0(priY)){
+                  compression_0 = binned_DMCOMPRESSION;
+                  expansion_0 = binned_DMEXPANSION * 0.5;
+                  for(i = 0; i + 1 <= N_block; i += 1, X += 1){
+                    X_0 = (X[0] * scale_mask_inv);
+                    X_0 = (X_0 * X_0);
+
+                    s_0 = s_buffer[0];
+                    blp_tmp.d = (X_0 * compression_0);
+                    blp_tmp.l |= 1;
+                    q_0 = s_0 + blp_tmp.d;
+                    s_buffer[0] = q_0;
+                    q_0 = (s_0 - q_0);
+                    #if defined(FP_FAST_FMA)
+                    X_0 = fma(q_0, expansion_0, X_0);
+                    X_0 = fma(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = (q_0 * expansion_0);
+                    X_0 = ((X_0 + q_0) + q_0);
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      blp_tmp.d = X_0;
+                      blp_tmp.l |= 1;
+                      q_0 = s_0 + blp_tmp.d;
+                      s_buffer[j] = q_0;
+                      q_0 = (s_0 - q_0);
+                      X_0 = (X_0 + q_0);
+                    }
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_buffer[j] = s_buffer[j] + blp_tmp.d;
+                  }
+                }else{
+                  for(i = 0; i + 1 <= N_block; i += 1, X += 1){
+                    X_0 = (X[0] * scale_mask_inv);
+                    X_0 = (X_0 * X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      blp_tmp.d = X_0;
+                      blp_tmp.l |= 1;
+                      q_0 = s_0 + blp_tmp.d;
+                      s_buffer[j] = q_0;
+                      q_0 = (s_0 - q_0);
+                      X_0 = (X_0 + q_0);
+                    }
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_buffer[j] = s_buffer[j] + blp_tmp.d;
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY)){
+                  compression_0 = binned_DMCOMPRESSION;
+                  expansion_0 = binned_DMEXPANSION * 0.5;
+                  for(i = 0; i + 1 <= N_block; i += 1, X += (ptrdiff_t)incX){
+                    X_0 = (X[0] * scale_mask_inv);
+                    X_0 = (X_0 * X_0);
+
+                    s_0 = s_buffer[0];
+                    blp_tmp.d = (X_0 * compression_0);
+                    blp_tmp.l |= 1;
+                    q_0 = s_0 + blp_tmp.d;
+                    s_buffer[0] = q_0;
+                    q_0 = (s_0 - q_0);
+                    #if defined(FP_FAST_FMA)
+                    X_0 = fma(q_0, expansion_0, X_0);
+                    X_0 = fma(q_0, expansion_0, X_0);
+                    #else
+                    q_0 = (q_0 * expansion_0);
+                    X_0 = ((X_0 + q_0) + q_0);
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      blp_tmp.d = X_0;
+                      blp_tmp.l |= 1;
+                      q_0 = s_0 + blp_tmp.d;
+                      s_buffer[j] = q_0;
+                      q_0 = (s_0 - q_0);
+                      X_0 = (X_0 + q_0);
+                    }
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_buffer[j] = s_buffer[j] + blp_tmp.d;
+                  }
+                }else{
+                  for(i = 0; i + 1 <= N_block; i += 1, X += (ptrdiff_t)incX){
+                    X_0 = (X[0] * scale_mask_inv);
+                    X_0 = (X_0 * X_0);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[j];
+                      blp_tmp.d = X_0;
+                      blp_tmp.l |= 1;
+                      q_0 = s_0 + blp_tmp.d;
+                      s_buffer[j] = q_0;
+                      q_0 = (s_0 - q_0);
+                      X_0 = (X_0 + q_0);
+                    }
+                    blp_tmp.d = X_0;
+                    blp_tmp.l |= 1;
+                    s_buffer[j] = s_buffer[j] + blp_tmp.d;
+                  }
+                }
+              }
+
+              for(j = 0; j < fold; j += 1){
+                priY[((ptrdiff_t)incpriY * j)] = s_buffer[j];
+              }
+
+            }
+            break;
+        }
+
+      #endif
+
+        }
+    //[[[end]]]
+
+    deposits += N_block;
+  }
+
+  binned_dmrenorm(fold, priY, incpriY, carY, inccarY);
+
+  if (ISNANINF(priY[0])){
+    return binned_dscale(1.0);
+  } else {
+    return scl;
+  }
+}
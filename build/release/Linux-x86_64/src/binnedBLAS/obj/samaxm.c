@@ -0,0 +1,650 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../config.h"
+#include "../common/common.h"
+#include "binnedBLAS.h"
+
+/*[[[cog
+import cog
+import generate
+import dataTypes
+import amaxm
+import vectorizations
+
+code_block = generate.CodeBlock()
+vectorizations.conditionally_include_vectorizations(code_block)
+cog.out(str(code_block))
+]]]*/
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  #include <immintrin.h>
+
+#elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+  #include <immintrin.h>
+
+#elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+  #include <emmintrin.h>
+
+#else
+
+
+#endif
+//[[[end]]]
+
+/**
+ * @internal
+ * @brief  Find maximum absolute value pairwise product between vectors of single precision
+ *
+ * Returns the absolute value of the pairwise product of maximum absolute value between X and Y.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return absolute maximum value multiple of X and Y
+ *
+ * @author Willow Ahrens
+ * @date   15 Jan 2016
+ */
+float binnedBLAS_samaxm(const int N, const float *X, const int incX, const float *Y, const int incY){
+  float amaxm;
+  /*[[[cog
+  cog.out(generate.generate(amaxm.AMaxM(dataTypes.Float, "N", "X", "incX", "Y", "incY", "(&amaxm)"), cog.inFile, args, params, mode))
+  ]]]*/
+  #if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+    float max_buffer_tmp[16] __attribute__((aligned(64))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m512 X_0, X_1, X_2, X_3, X_4, X_5, X_6, X_7;
+    __m512 Y_0, Y_1, Y_2, Y_3, Y_4, Y_5, Y_6, Y_7;
+    __m512 m_0;
+    m_0 = _mm512_setzero_ps();
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 128 <= N; i += 128, X += 128, Y += 128){
+        X_0 = _mm512_loadu_ps(X);
+        X_1 = _mm512_loadu_ps(X + 16);
+        X_2 = _mm512_loadu_ps(X + 32);
+        X_3 = _mm512_loadu_ps(X + 48);
+        X_4 = _mm512_loadu_ps(X + 64);
+        X_5 = _mm512_loadu_ps(X + 80);
+        X_6 = _mm512_loadu_ps(X + 96);
+        X_7 = _mm512_loadu_ps(X + 112);
+        Y_0 = _mm512_loadu_ps(Y);
+        Y_1 = _mm512_loadu_ps(Y + 16);
+        Y_2 = _mm512_loadu_ps(Y + 32);
+        Y_3 = _mm512_loadu_ps(Y + 48);
+        Y_4 = _mm512_loadu_ps(Y + 64);
+        Y_5 = _mm512_loadu_ps(Y + 80);
+        Y_6 = _mm512_loadu_ps(Y + 96);
+        Y_7 = _mm512_loadu_ps(Y + 112);
+        X_0 = _mm512_abs_ps(_mm512_mul_ps(X_0, Y_0));
+        X_1 = _mm512_abs_ps(_mm512_mul_ps(X_1, Y_1));
+        X_2 = _mm512_abs_ps(_mm512_mul_ps(X_2, Y_2));
+        X_3 = _mm512_abs_ps(_mm512_mul_ps(X_3, Y_3));
+        X_4 = _mm512_abs_ps(_mm512_mul_ps(X_4, Y_4));
+        X_5 = _mm512_abs_ps(_mm512_mul_ps(X_5, Y_5));
+        X_6 = _mm512_abs_ps(_mm512_mul_ps(X_6, Y_6));
+        X_7 = _mm512_abs_ps(_mm512_mul_ps(X_7, Y_7));
+        m_0 = _mm512_max_ps(m_0, X_0);
+        m_0 = _mm512_max_ps(m_0, X_1);
+        m_0 = _mm512_max_ps(m_0, X_2);
+        m_0 = _mm512_max_ps(m_0, X_3);
+        m_0 = _mm512_max_ps(m_0, X_4);
+        m_0 = _mm512_max_ps(m_0, X_5);
+        m_0 = _mm512_max_ps(m_0, X_6);
+        m_0 = _mm512_max_ps(m_0, X_7);
+      }
+      if(i + 64 <= N){
+        X_0 = _mm512_loadu_ps(X);
+        X_1 = _mm512_loadu_ps(X + 16);
+        X_2 = _mm512_loadu_ps(X + 32);
+        X_3 = _mm512_loadu_ps(X + 48);
+        Y_0 = _mm512_loadu_ps(Y);
+        Y_1 = _mm512_loadu_ps(Y + 16);
+        Y_2 = _mm512_loadu_ps(Y + 32);
+        Y_3 = _mm512_loadu_ps(Y + 48);
+        X_0 = _mm512_abs_ps(_mm512_mul_ps(X_0, Y_0));
+        X_1 = _mm512_abs_ps(_mm512_mul_ps(X_1, Y_1));
+        X_2 = _mm512_abs_ps(_mm512_mul_ps(X_2, Y_2));
+        X_3 = _mm512_abs_ps(_mm512_mul_ps(X_3, Y_3));
+        m_0 = _mm512_max_ps(m_0, X_0);
+        m_0 = _mm512_max_ps(m_0, X_1);
+        m_0 = _mm512_max_ps(m_0, X_2);
+        m_0 = _mm512_max_ps(m_0, X_3);
+        i += 64, X += 64, Y += 64;
+      }
+      if(i + 32 <= N){
+        X_0 = _mm512_loadu_ps(X);
+        X_1 = _mm512_loadu_ps(X + 16);
+        Y_0 = _mm512_loadu_ps(Y);
+        Y_1 = _mm512_loadu_ps(Y + 16);
+        X_0 = _mm512_abs_ps(_mm512_mul_ps(X_0, Y_0));
+        X_1 = _mm512_abs_ps(_mm512_mul_ps(X_1, Y_1));
+        m_0 = _mm512_max_ps(m_0, X_0);
+        m_0 = _mm512_max_ps(m_0, X_1);
+        i += 32, X += 32, Y += 32;
+      }
+      if(i + 16 <= N){
+        X_0 = _mm512_loadu_ps(X);
+        Y_0 = _mm512_loadu_ps(Y);
+        X_0 = _mm512_abs_ps(_mm512_mul_ps(X_0, Y_0));
+        m_0 = _mm512_max_ps(m_0, X_0);
+        i += 16, X += 16, Y += 16;
+      }
+      if(i < N){
+        X_0 = _mm512_maskz_loadu_ps((__mmask16)((1U << (N - i)) - 1), X);
+        Y_0 = _mm512_maskz_loadu_ps((__mmask16)((1U << (N - i)) - 1), Y);
+        X_0 = _mm512_abs_ps(_mm512_mul_ps(X_0, Y_0));
+        m_0 = _mm512_max_ps(m_0, X_0);
+        X += (N - i), Y += (N - i);
+      }
+    }else{
+
+      for(i = 0; i + 128 <= N; i += 128, X += ((ptrdiff_t)incX * 128), Y += ((ptrdiff_t)incY * 128)){
+        X_0 = _mm512_set_ps(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)], X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)], X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm512_set_ps(X[((ptrdiff_t)incX * 31)], X[((ptrdiff_t)incX * 30)], X[((ptrdiff_t)incX * 29)], X[((ptrdiff_t)incX * 28)], X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)], X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)], X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)], X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]);
+        X_2 = _mm512_set_ps(X[((ptrdiff_t)incX * 47)], X[((ptrdiff_t)incX * 46)], X[((ptrdiff_t)incX * 45)], X[((ptrdiff_t)incX * 44)], X[((ptrdiff_t)incX * 43)], X[((ptrdiff_t)incX * 42)], X[((ptrdiff_t)incX * 41)], X[((ptrdiff_t)incX * 40)], X[((ptrdiff_t)incX * 39)], X[((ptrdiff_t)incX * 38)], X[((ptrdiff_t)incX * 37)], X[((ptrdiff_t)incX * 36)], X[((ptrdiff_t)incX * 35)], X[((ptrdiff_t)incX * 34)], X[((ptrdiff_t)incX * 33)], X[((ptrdiff_t)incX * 32)]);
+        X_3 = _mm512_set_ps(X[((ptrdiff_t)incX * 63)], X[((ptrdiff_t)incX * 62)], X[((ptrdiff_t)incX * 61)], X[((ptrdiff_t)incX * 60)], X[((ptrdiff_t)incX * 59)], X[((ptrdiff_t)incX * 58)], X[((ptrdiff_t)incX * 57)], X[((ptrdiff_t)incX * 56)], X[((ptrdiff_t)incX * 55)], X[((ptrdiff_t)incX * 54)], X[((ptrdiff_t)incX * 53)], X[((ptrdiff_t)incX * 52)], X[((ptrdiff_t)incX * 51)], X[((ptrdiff_t)incX * 50)], X[((ptrdiff_t)incX * 49)], X[((ptrdiff_t)incX * 48)]);
+        X_4 = _mm512_set_ps(X[((ptrdiff_t)incX * 79)], X[((ptrdiff_t)incX * 78)], X[((ptrdiff_t)incX * 77)], X[((ptrdiff_t)incX * 76)], X[((ptrdiff_t)incX * 75)], X[((ptrdiff_t)incX * 74)], X[((ptrdiff_t)incX * 73)], X[((ptrdiff_t)incX * 72)], X[((ptrdiff_t)incX * 71)], X[((ptrdiff_t)incX * 70)], X[((ptrdiff_t)incX * 69)], X[((ptrdiff_t)incX * 68)], X[((ptrdiff_t)incX * 67)], X[((ptrdiff_t)incX * 66)], X[((ptrdiff_t)incX * 65)], X[((ptrdiff_t)incX * 64)]);
+        X_5 = _mm512_set_ps(X[((ptrdiff_t)incX * 95)], X[((ptrdiff_t)incX * 94)], X[((ptrdiff_t)incX * 93)], X[((ptrdiff_t)incX * 92)], X[((ptrdiff_t)incX * 91)], X[((ptrdiff_t)incX * 90)], X[((ptrdiff_t)incX * 89)], X[((ptrdiff_t)incX * 88)], X[((ptrdiff_t)incX * 87)], X[((ptrdiff_t)incX * 86)], X[((ptrdiff_t)incX * 85)], X[((ptrdiff_t)incX * 84)], X[((ptrdiff_t)incX * 83)], X[((ptrdiff_t)incX * 82)], X[((ptrdiff_t)incX * 81)], X[((ptrdiff_t)incX * 80)]);
+        X_6 = _mm512_set_ps(X[((ptrdiff_t)incX * 111)], X[((ptrdiff_t)incX * 110)], X[((ptrdiff_t)incX * 109)], X[((ptrdiff_t)incX * 108)], X[((ptrdiff_t)incX * 107)], X[((ptrdiff_t)incX * 106)], X[((ptrdiff_t)incX * 105)], X[((ptrdiff_t)incX * 104)], X[((ptrdiff_t)incX * 103)], X[((ptrdiff_t)incX * 102)], X[((ptrdiff_t)incX * 101)], X[((ptrdiff_t)incX * 100)], X[((ptrdiff_t)incX * 99)], X[((ptrdiff_t)incX * 98)], X[((ptrdiff_t)incX * 97)], X[((ptrdiff_t)incX * 96)]);
+        X_7 = _mm512_set_ps(X[((ptrdiff_t)incX * 127)], X[((ptrdiff_t)incX * 126)], X[((ptrdiff_t)incX * 125)], X[((ptrdiff_t)incX * 124)], X[((ptrdiff_t)incX * 123)], X[((ptrdiff_t)incX * 122)], X[((ptrdiff_t)incX * 121)], X[((ptrdiff_t)incX * 120)], X[((ptrdiff_t)incX * 119)], X[((ptrdiff_t)incX * 118)], X[((ptrdiff_t)incX * 117)], X[((ptrdiff_t)incX * 116)], X[((ptrdiff_t)incX * 115)], X[((ptrdiff_t)incX * 114)], X[((ptrdiff_t)incX * 113)], X[((ptrdiff_t)incX * 112)]);
+        Y_0 = _mm512_set_ps(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)], Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)], Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm512_set_ps(Y[((ptrdiff_t)incY * 31)], Y[((ptrdiff_t)incY * 30)], Y[((ptrdiff_t)incY * 29)], Y[((ptrdiff_t)incY * 28)], Y[((ptrdiff_t)incY * 27)], Y[((ptrdiff_t)incY * 26)], Y[((ptrdiff_t)incY * 25)], Y[((ptrdiff_t)incY * 24)], Y[((ptrdiff_t)incY * 23)], Y[((ptrdiff_t)incY * 22)], Y[((ptrdiff_t)incY * 21)], Y[((ptrdiff_t)incY * 20)], Y[((ptrdiff_t)incY * 19)], Y[((ptrdiff_t)incY * 18)], Y[((ptrdiff_t)incY * 17)], Y[((ptrdiff_t)incY * 16)]);
+        Y_2 = _mm512_set_ps(Y[((ptrdiff_t)incY * 47)], Y[((ptrdiff_t)incY * 46)], Y[((ptrdiff_t)incY * 45)], Y[((ptrdiff_t)incY * 44)], Y[((ptrdiff_t)incY * 43)], Y[((ptrdiff_t)incY * 42)], Y[((ptrdiff_t)incY * 41)], Y[((ptrdiff_t)incY * 40)], Y[((ptrdiff_t)incY * 39)], Y[((ptrdiff_t)incY * 38)], Y[((ptrdiff_t)incY * 37)], Y[((ptrdiff_t)incY * 36)], Y[((ptrdiff_t)incY * 35)], Y[((ptrdiff_t)incY * 34)], Y[((ptrdiff_t)incY * 33)], Y[((ptrdiff_t)incY * 32)]);
+        Y_3 = _mm512_set_ps(Y[((ptrdiff_t)incY * 63)], Y[((ptrdiff_t)incY * 62)], Y[((ptrdiff_t)incY * 61)], Y[((ptrdiff_t)incY * 60)], Y[((ptrdiff_t)incY * 59)], Y[((ptrdiff_t)incY * 58)], Y[((ptrdiff_t)incY * 57)], Y[((ptrdiff_t)incY * 56)], Y[((ptrdiff_t)incY * 55)], Y[((ptrdiff_t)incY * 54)], Y[((ptrdiff_t)incY * 53)], Y[((ptrdiff_t)incY * 52)], Y[((ptrdiff_t)incY * 51)], Y[((ptrdiff_t)incY * 50)], Y[((ptrdiff_t)incY * 49)], Y[((ptrdiff_t)incY * 48)]);
+        Y_4 = _mm512_set_ps(Y[((ptrdiff_t)incY * 79)], Y[((ptrdiff_t)incY * 78)], Y[((ptrdiff_t)incY * 77)], Y[((ptrdiff_t)incY * 76)], Y[((ptrdiff_t)incY * 75)], Y[((ptrdiff_t)incY * 74)], Y[((ptrdiff_t)incY * 73)], Y[((ptrdiff_t)incY * 72)], Y[((ptrdiff_t)incY * 71)], Y[((ptrdiff_t)incY * 70)], Y[((ptrdiff_t)incY * 69)], Y[((ptrdiff_t)incY * 68)], Y[((ptrdiff_t)incY * 67)], Y[((ptrdiff_t)incY * 66)], Y[((ptrdiff_t)incY * 65)], Y[((ptrdiff_t)incY * 64)]);
+        Y_5 = _mm512_set_ps(Y[((ptrdiff_t)incY * 95)], Y[((ptrdiff_t)incY * 94)], Y[((ptrdiff_t)incY * 93)], Y[((ptrdiff_t)incY * 92)], Y[((ptrdiff_t)incY * 91)], Y[((ptrdiff_t)incY * 90)], Y[((ptrdiff_t)incY * 89)], Y[((ptrdiff_t)incY * 88)], Y[((ptrdiff_t)incY * 87)], Y[((ptrdiff_t)incY * 86)], Y[((ptrdiff_t)incY * 85)], Y[((ptrdiff_t)incY * 84)], Y[((ptrdiff_t)incY * 83)], Y[((ptrdiff_t)incY * 82)], Y[((ptrdiff_t)incY * 81)], Y[((ptrdiff_t)incY * 80)]);
+        Y_6 = _mm512_set_ps(Y[((ptrdiff_t)incY * 111)], Y[((ptrdiff_t)incY * 110)], Y[((ptrdiff_t)incY * 109)], Y[((ptrdiff_t)incY * 108)], Y[((ptrdiff_t)incY * 107)], Y[((ptrdiff_t)incY * 106)], Y[((ptrdiff_t)incY * 105)], Y[((ptrdiff_t)incY * 104)], Y[((ptrdiff_t)incY * 103)], Y[((ptrdiff_t)incY * 102)], Y[((ptrdiff_t)incY * 101)], Y[((ptrdiff_t)incY * 100)], Y[((ptrdiff_t)incY * 99)], Y[((ptrdiff_t)incY * 98)], Y[((ptrdiff_t)incY * 97)], Y[((ptrdiff_t)incY * 96)]);
+        Y_7 = _mm512_set_ps(Y[((ptrdiff_t)incY * 127)], Y[((ptrdiff_t)incY * 126)], Y[((ptrdiff_t)incY * 125)], Y[((ptrdiff_t)incY * 124)], Y[((ptrdiff_t)incY * 123)], Y[((ptrdiff_t)incY * 122)], Y[((ptrdiff_t)incY * 121)], Y[((ptrdiff_t)incY * 120)], Y[((ptrdiff_t)incY * 119)], Y[((ptrdiff_t)incY * 118)], Y[((ptrdiff_t)incY * 117)], Y[((ptrdiff_t)incY * 116)], Y[((ptrdiff_t)incY * 115)], Y[((ptrdiff_t)incY * 114)], Y[((ptrdiff_t)incY * 113)], Y[((ptrdiff_t)incY * 112)]);
+        X_0 = _mm512_abs_ps(_mm512_mul_ps(X_0, Y_0));
+        X_1 = _mm512_abs_ps(_mm512_mul_ps(X_1, Y_1));
+        X_2 = _mm512_abs_ps(_mm512_mul_ps(X_2, Y_2));
+        X_3 = _mm512_abs_ps(_mm512_mul_ps(X_3, Y_3));
+        X_4 = _mm512_abs_ps(_mm512_mul_ps(X_4, Y_4));
+        X_5 = _mm512_abs_ps(_mm512_mul_ps(X_5, Y_5));
+        X_6 = _mm512_abs_ps(_mm512_mul_ps(X_6, Y_6));
+        X_7 = _mm512_abs_ps(_mm512_mul_ps(X_7, Y_7));
+        m_0 = _mm512_max_ps(m_0, X_0);
+        m_0 = _mm512_max_ps(m_0, X_1);
+        m_0 = _mm512_max_ps(m_0, X_2);
+        m_0 = _mm512_max_ps(m_0, X_3);
+        m_0 = _mm512_max_ps(m_0, X_4);
+        m_0 = _mm512_max_ps(m_0, X_5);
+        m_0 = _mm512_max_ps(m_0, X_6);
+        m_0 = _mm512_max_ps(m_0, X_7);
+      }
+      if(i + 64 <= N){
+        X_0 = _mm512_set_ps(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)], X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)], X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm512_set_ps(X[((ptrdiff_t)incX * 31)], X[((ptrdiff_t)incX * 30)], X[((ptrdiff_t)incX * 29)], X[((ptrdiff_t)incX * 28)], X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)], X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)], X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)], X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]);
+        X_2 = _mm512_set_ps(X[((ptrdiff_t)incX * 47)], X[((ptrdiff_t)incX * 46)], X[((ptrdiff_t)incX * 45)], X[((ptrdiff_t)incX * 44)], X[((ptrdiff_t)incX * 43)], X[((ptrdiff_t)incX * 42)], X[((ptrdiff_t)incX * 41)], X[((ptrdiff_t)incX * 40)], X[((ptrdiff_t)incX * 39)], X[((ptrdiff_t)incX * 38)], X[((ptrdiff_t)incX * 37)], X[((ptrdiff_t)incX * 36)], X[((ptrdiff_t)incX * 35)], X[((ptrdiff_t)incX * 34)], X[((ptrdiff_t)incX * 33)], X[((ptrdiff_t)incX * 32)]);
+        X_3 = _mm512_set_ps(X[((ptrdiff_t)incX * 63)], X[((ptrdiff_t)incX * 62)], X[((ptrdiff_t)incX * 61)], X[((ptrdiff_t)incX * 60)], X[((ptrdiff_t)incX * 59)], X[((ptrdiff_t)incX * 58)], X[((ptrdiff_t)incX * 57)], X[((ptrdiff_t)incX * 56)], X[((ptrdiff_t)incX * 55)], X[((ptrdiff_t)incX * 54)], X[((ptrdiff_t)incX * 53)], X[((ptrdiff_t)incX * 52)], X[((ptrdiff_t)incX * 51)], X[((ptrdiff_t)incX * 50)], X[((ptrdiff_t)incX * 49)], X[((ptrdiff_t)incX * 48)]);
+        Y_0 = _mm512_set_ps(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)], Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)], Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm512_set_ps(Y[((ptrdiff_t)incY * 31)], Y[((ptrdiff_t)incY * 30)], Y[((ptrdiff_t)incY * 29)], Y[((ptrdiff_t)incY * 28)], Y[((ptrdiff_t)incY * 27)], Y[((ptrdiff_t)incY * 26)], Y[((ptrdiff_t)incY * 25)], Y[((ptrdiff_t)incY * 24)], Y[((ptrdiff_t)incY * 23)], Y[((ptrdiff_t)incY * 22)], Y[((ptrdiff_t)incY * 21)], Y[((ptrdiff_t)incY * 20)], Y[((ptrdiff_t)incY * 19)], Y[((ptrdiff_t)incY * 18)], Y[((ptrdiff_t)incY * 17)], Y[((ptrdiff_t)incY * 16)]);
+        Y_2 = _mm512_set_ps(Y[((ptrdiff_t)incY * 47)], Y[((ptrdiff_t)incY * 46)], Y[((ptrdiff_t)incY * 45)], Y[((ptrdiff_t)incY * 44)], Y[((ptrdiff_t)incY * 43)], Y[((ptrdiff_t)incY * 42)], Y[((ptrdiff_t)incY * 41)], Y[((ptrdiff_t)incY * 40)], Y[((ptrdiff_t)incY * 39)], Y[((ptrdiff_t)incY * 38)], Y[((ptrdiff_t)incY * 37)], Y[((ptrdiff_t)incY * 36)], Y[((ptrdiff_t)incY * 35)], Y[((ptrdiff_t)incY * 34)], Y[((ptrdiff_t)incY * 33)], Y[((ptrdiff_t)incY * 32)]);
+        Y_3 = _mm512_set_ps(Y[((ptrdiff_t)incY * 63)], Y[((ptrdiff_t)incY * 62)], Y[((ptrdiff_t)incY * 61)], Y[((ptrdiff_t)incY * 60)], Y[((ptrdiff_t)incY * 59)], Y[((ptrdiff_t)incY * 58)], Y[((ptrdiff_t)incY * 57)], Y[((ptrdiff_t)incY * 56)], Y[((ptrdiff_t)incY * 55)], Y[((ptrdiff_t)incY * 54)], Y[((ptrdiff_t)incY * 53)], Y[((ptrdiff_t)incY * 52)], Y[((ptrdiff_t)incY * 51)], Y[((ptrdiff_t)incY * 50)], Y[((ptrdiff_t)incY * 49)], Y[((ptrdiff_t)incY * 48)]);
+        X_0 = _mm512_abs_ps(_mm512_mul_ps(X_0, Y_0));
+        X_1 = _mm512_abs_ps(_mm512_mul_ps(X_1, Y_1));
+        X_2 = _mm512_abs_ps(_mm512_mul_ps(X_2, Y_2));
+        X_3 = _mm512_abs_ps(_mm512_mul_ps(X_3, Y_3));
+        m_0 = _mm512_max_ps(m_0, X_0);
+        m_0 = _mm512_max_ps(m_0, X_1);
+        m_0 = _mm512_max_ps(m_0, X_2);
+        m_0 = _mm512_max_ps(m_0, X_3);
+        i += 64, X += ((ptrdiff_t)incX * 64), Y += ((ptrdiff_t)incY * 64);
+      }
+      if(i + 32 <= N){
+        X_0 = _mm512_set_ps(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)], X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)], X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm512_set_ps(X[((ptrdiff_t)incX * 31)], X[((ptrdiff_t)incX * 30)], X[((ptrdiff_t)incX * 29)], X[((ptrdiff_t)incX * 28)], X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)], X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)], X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)], X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]);
+        Y_0 = _mm512_set_ps(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)], Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)], Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm512_set_ps(Y[((ptrdiff_t)incY * 31)], Y[((ptrdiff_t)incY * 30)], Y[((ptrdiff_t)incY * 29)], Y[((ptrdiff_t)incY * 28)], Y[((ptrdiff_t)incY * 27)], Y[((ptrdiff_t)incY * 26)], Y[((ptrdiff_t)incY * 25)], Y[((ptrdiff_t)incY * 24)], Y[((ptrdiff_t)incY * 23)], Y[((ptrdiff_t)incY * 22)], Y[((ptrdiff_t)incY * 21)], Y[((ptrdiff_t)incY * 20)], Y[((ptrdiff_t)incY * 19)], Y[((ptrdiff_t)incY * 18)], Y[((ptrdiff_t)incY * 17)], Y[((ptrdiff_t)incY * 16)]);
+        X_0 = _mm512_abs_ps(_mm512_mul_ps(X_0, Y_0));
+        X_1 = _mm512_abs_ps(_mm512_mul_ps(X_1, Y_1));
+        m_0 = _mm512_max_ps(m_0, X_0);
+        m_0 = _mm512_max_ps(m_0, X_1);
+        i += 32, X += ((ptrdiff_t)incX * 32), Y += ((ptrdiff_t)incY * 32);
+      }
+      if(i + 16 <= N){
+        X_0 = _mm512_set_ps(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)], X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)], X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        Y_0 = _mm512_set_ps(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)], Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)], Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        X_0 = _mm512_abs_ps(_mm512_mul_ps(X_0, Y_0));
+        m_0 = _mm512_max_ps(m_0, X_0);
+        i += 16, X += ((ptrdiff_t)incX * 16), Y += ((ptrdiff_t)incY * 16);
+      }
+      if(i < N){
+        X_0 = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(_mm512_mask_i64gather_ps(_mm256_setzero_ps(), (__mmask8)((__mmask16)((1U << (N - i)) - 1) >> 0), _mm512_set_epi64(((ptrdiff_t)incX * 7), ((ptrdiff_t)incX * 6), ((ptrdiff_t)incX * 5), ((ptrdiff_t)incX * 4), ((ptrdiff_t)incX * 3), ((ptrdiff_t)incX * 2), (ptrdiff_t)incX, 0), X, 4))), _mm256_castps_pd(_mm512_mask_i64gather_ps(_mm256_setzero_ps(), (__mmask8)((__mmask16)((1U << (N - i)) - 1) >> 8), _mm512_set_epi64(((ptrdiff_t)incX * 15), ((ptrdiff_t)incX * 14), ((ptrdiff_t)incX * 13), ((ptrdiff_t)incX * 12), ((ptrdiff_t)incX * 11), ((ptrdiff_t)incX * 10), ((ptrdiff_t)incX * 9), ((ptrdiff_t)incX * 8)), X, 4)), 1));
+        Y_0 = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(_mm512_mask_i64gather_ps(_mm256_setzero_ps(), (__mmask8)((__mmask16)((1U << (N - i)) - 1) >> 0), _mm512_set_epi64(((ptrdiff_t)incY * 7), ((ptrdiff_t)incY * 6), ((ptrdiff_t)incY * 5), ((ptrdiff_t)incY * 4), ((ptrdiff_t)incY * 3), ((ptrdiff_t)incY * 2), (ptrdiff_t)incY, 0), Y, 4))), _mm256_castps_pd(_mm512_mask_i64gather_ps(_mm256_setzero_ps(), (__mmask8)((__mmask16)((1U << (N - i)) - 1) >> 8), _mm512_set_epi64(((ptrdiff_t)incY * 15), ((ptrdiff_t)incY * 14), ((ptrdiff_t)incY * 13), ((ptrdiff_t)incY * 12), ((ptrdiff_t)incY * 11), ((ptrdiff_t)incY * 10), ((ptrdiff_t)incY * 9), ((ptrdiff_t)incY * 8)), Y, 4)), 1));
+        X_0 = _mm512_abs_ps(_mm512_mul_ps(X_0, Y_0));
+        m_0 = _mm512_max_ps(m_0, X_0);
+        X += ((ptrdiff_t)incX * (N - i)), Y += ((ptrdiff_t)incY * (N - i));
+      }
+    }
+    _mm512_store_ps(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[8] ? max_buffer_tmp[0]: max_buffer_tmp[8]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[9] ? max_buffer_tmp[0]: max_buffer_tmp[9]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[10] ? max_buffer_tmp[0]: max_buffer_tmp[10]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[11] ? max_buffer_tmp[0]: max_buffer_tmp[11]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[12] ? max_buffer_tmp[0]: max_buffer_tmp[12]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[13] ? max_buffer_tmp[0]: max_buffer_tmp[13]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[14] ? max_buffer_tmp[0]: max_buffer_tmp[14]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[15] ? max_buffer_tmp[0]: max_buffer_tmp[15]);
+    (&amaxm)[0] = max_buffer_tmp[0];
+
+  #elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+    __m256 abs_mask_tmp;
+    {
+      __m256 tmp;
+      tmp = _mm256_set1_ps(1);
+      abs_mask_tmp = _mm256_set1_ps(-1);
+      abs_mask_tmp = _mm256_xor_ps(abs_mask_tmp, tmp);
+      tmp = _mm256_cmp_ps(tmp, tmp, 0);
+      abs_mask_tmp = _mm256_xor_ps(abs_mask_tmp, tmp);
+    }
+    float max_buffer_tmp[8] __attribute__((aligned(32))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m256 X_0, X_1, X_2, X_3, X_4, X_5, X_6, X_7;
+    __m256 Y_0, Y_1, Y_2, Y_3, Y_4, Y_5, Y_6, Y_7;
+    __m256 m_0;
+    m_0 = _mm256_setzero_ps();
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 64 <= N; i += 64, X += 64, Y += 64){
+        X_0 = _mm256_loadu_ps(X);
+        X_1 = _mm256_loadu_ps(X + 8);
+        X_2 = _mm256_loadu_ps(X + 16);
+        X_3 = _mm256_loadu_ps(X + 24);
+        X_4 = _mm256_loadu_ps(X + 32);
+        X_5 = _mm256_loadu_ps(X + 40);
+        X_6 = _mm256_loadu_ps(X + 48);
+        X_7 = _mm256_loadu_ps(X + 56);
+        Y_0 = _mm256_loadu_ps(Y);
+        Y_1 = _mm256_loadu_ps(Y + 8);
+        Y_2 = _mm256_loadu_ps(Y + 16);
+        Y_3 = _mm256_loadu_ps(Y + 24);
+        Y_4 = _mm256_loadu_ps(Y + 32);
+        Y_5 = _mm256_loadu_ps(Y + 40);
+        Y_6 = _mm256_loadu_ps(Y + 48);
+        Y_7 = _mm256_loadu_ps(Y + 56);
+        X_0 = _mm256_and_ps(_mm256_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_ps(_mm256_mul_ps(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm256_and_ps(_mm256_mul_ps(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm256_and_ps(_mm256_mul_ps(X_3, Y_3), abs_mask_tmp);
+        X_4 = _mm256_and_ps(_mm256_mul_ps(X_4, Y_4), abs_mask_tmp);
+        X_5 = _mm256_and_ps(_mm256_mul_ps(X_5, Y_5), abs_mask_tmp);
+        X_6 = _mm256_and_ps(_mm256_mul_ps(X_6, Y_6), abs_mask_tmp);
+        X_7 = _mm256_and_ps(_mm256_mul_ps(X_7, Y_7), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, X_0);
+        m_0 = _mm256_max_ps(m_0, X_1);
+        m_0 = _mm256_max_ps(m_0, X_2);
+        m_0 = _mm256_max_ps(m_0, X_3);
+        m_0 = _mm256_max_ps(m_0, X_4);
+        m_0 = _mm256_max_ps(m_0, X_5);
+        m_0 = _mm256_max_ps(m_0, X_6);
+        m_0 = _mm256_max_ps(m_0, X_7);
+      }
+      if(i + 32 <= N){
+        X_0 = _mm256_loadu_ps(X);
+        X_1 = _mm256_loadu_ps(X + 8);
+        X_2 = _mm256_loadu_ps(X + 16);
+        X_3 = _mm256_loadu_ps(X + 24);
+        Y_0 = _mm256_loadu_ps(Y);
+        Y_1 = _mm256_loadu_ps(Y + 8);
+        Y_2 = _mm256_loadu_ps(Y + 16);
+        Y_3 = _mm256_loadu_ps(Y + 24);
+        X_0 = _mm256_and_ps(_mm256_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_ps(_mm256_mul_ps(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm256_and_ps(_mm256_mul_ps(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm256_and_ps(_mm256_mul_ps(X_3, Y_3), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, X_0);
+        m_0 = _mm256_max_ps(m_0, X_1);
+        m_0 = _mm256_max_ps(m_0, X_2);
+        m_0 = _mm256_max_ps(m_0, X_3);
+        i += 32, X += 32, Y += 32;
+      }
+      if(i + 16 <= N){
+        X_0 = _mm256_loadu_ps(X);
+        X_1 = _mm256_loadu_ps(X + 8);
+        Y_0 = _mm256_loadu_ps(Y);
+        Y_1 = _mm256_loadu_ps(Y + 8);
+        X_0 = _mm256_and_ps(_mm256_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_ps(_mm256_mul_ps(X_1, Y_1), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, X_0);
+        m_0 = _mm256_max_ps(m_0, X_1);
+        i += 16, X += 16, Y += 16;
+      }
+      if(i + 8 <= N){
+        X_0 = _mm256_loadu_ps(X);
+        Y_0 = _mm256_loadu_ps(Y);
+        X_0 = _mm256_and_ps(_mm256_mul_ps(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, X_0);
+        i += 8, X += 8, Y += 8;
+      }
+      if(i < N){
+        X_0 = _mm256_set_ps(0, (N - i)>6?X[6]:0, (N - i)>5?X[5]:0, (N - i)>4?X[4]:0, (N - i)>3?X[3]:0, (N - i)>2?X[2]:0, (N - i)>1?X[1]:0, X[0]);
+        Y_0 = _mm256_set_ps(0, (N - i)>6?Y[6]:0, (N - i)>5?Y[5]:0, (N - i)>4?Y[4]:0, (N - i)>3?Y[3]:0, (N - i)>2?Y[2]:0, (N - i)>1?Y[1]:0, Y[0]);
+        X_0 = _mm256_and_ps(_mm256_mul_ps(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, X_0);
+        X += (N - i), Y += (N - i);
+      }
+    }else{
+
+      for(i = 0; i + 64 <= N; i += 64, X += ((ptrdiff_t)incX * 64), Y += ((ptrdiff_t)incY * 64)){
+        X_0 = _mm256_set_ps(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm256_set_ps(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)], X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]);
+        X_2 = _mm256_set_ps(X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)], X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]);
+        X_3 = _mm256_set_ps(X[((ptrdiff_t)incX * 31)], X[((ptrdiff_t)incX * 30)], X[((ptrdiff_t)incX * 29)], X[((ptrdiff_t)incX * 28)], X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)], X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)]);
+        X_4 = _mm256_set_ps(X[((ptrdiff_t)incX * 39)], X[((ptrdiff_t)incX * 38)], X[((ptrdiff_t)incX * 37)], X[((ptrdiff_t)incX * 36)], X[((ptrdiff_t)incX * 35)], X[((ptrdiff_t)incX * 34)], X[((ptrdiff_t)incX * 33)], X[((ptrdiff_t)incX * 32)]);
+        X_5 = _mm256_set_ps(X[((ptrdiff_t)incX * 47)], X[((ptrdiff_t)incX * 46)], X[((ptrdiff_t)incX * 45)], X[((ptrdiff_t)incX * 44)], X[((ptrdiff_t)incX * 43)], X[((ptrdiff_t)incX * 42)], X[((ptrdiff_t)incX * 41)], X[((ptrdiff_t)incX * 40)]);
+        X_6 = _mm256_set_ps(X[((ptrdiff_t)incX * 55)], X[((ptrdiff_t)incX * 54)], X[((ptrdiff_t)incX * 53)], X[((ptrdiff_t)incX * 52)], X[((ptrdiff_t)incX * 51)], X[((ptrdiff_t)incX * 50)], X[((ptrdiff_t)incX * 49)], X[((ptrdiff_t)incX * 48)]);
+        X_7 = _mm256_set_ps(X[((ptrdiff_t)incX * 63)], X[((ptrdiff_t)incX * 62)], X[((ptrdiff_t)incX * 61)], X[((ptrdiff_t)incX * 60)], X[((ptrdiff_t)incX * 59)], X[((ptrdiff_t)incX * 58)], X[((ptrdiff_t)incX * 57)], X[((ptrdiff_t)incX * 56)]);
+        Y_0 = _mm256_set_ps(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm256_set_ps(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)], Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)]);
+        Y_2 = _mm256_set_ps(Y[((ptrdiff_t)incY * 23)], Y[((ptrdiff_t)incY * 22)], Y[((ptrdiff_t)incY * 21)], Y[((ptrdiff_t)incY * 20)], Y[((ptrdiff_t)incY * 19)], Y[((ptrdiff_t)incY * 18)], Y[((ptrdiff_t)incY * 17)], Y[((ptrdiff_t)incY * 16)]);
+        Y_3 = _mm256_set_ps(Y[((ptrdiff_t)incY * 31)], Y[((ptrdiff_t)incY * 30)], Y[((ptrdiff_t)incY * 29)], Y[((ptrdiff_t)incY * 28)], Y[((ptrdiff_t)incY * 27)], Y[((ptrdiff_t)incY * 26)], Y[((ptrdiff_t)incY * 25)], Y[((ptrdiff_t)incY * 24)]);
+        Y_4 = _mm256_set_ps(Y[((ptrdiff_t)incY * 39)], Y[((ptrdiff_t)incY * 38)], Y[((ptrdiff_t)incY * 37)], Y[((ptrdiff_t)incY * 36)], Y[((ptrdiff_t)incY * 35)], Y[((ptrdiff_t)incY * 34)], Y[((ptrdiff_t)incY * 33)], Y[((ptrdiff_t)incY * 32)]);
+        Y_5 = _mm256_set_ps(Y[((ptrdiff_t)incY * 47)], Y[((ptrdiff_t)incY * 46)], Y[((ptrdiff_t)incY * 45)], Y[((ptrdiff_t)incY * 44)], Y[((ptrdiff_t)incY * 43)], Y[((ptrdiff_t)incY * 42)], Y[((ptrdiff_t)incY * 41)], Y[((ptrdiff_t)incY * 40)]);
+        Y_6 = _mm256_set_ps(Y[((ptrdiff_t)incY * 55)], Y[((ptrdiff_t)incY * 54)], Y[((ptrdiff_t)incY * 53)], Y[((ptrdiff_t)incY * 52)], Y[((ptrdiff_t)incY * 51)], Y[((ptrdiff_t)incY * 50)], Y[((ptrdiff_t)incY * 49)], Y[((ptrdiff_t)incY * 48)]);
+        Y_7 = _mm256_set_ps(Y[((ptrdiff_t)incY * 63)], Y[((ptrdiff_t)incY * 62)], Y[((ptrdiff_t)incY * 61)], Y[((ptrdiff_t)incY * 60)], Y[((ptrdiff_t)incY * 59)], Y[((ptrdiff_t)incY * 58)], Y[((ptrdiff_t)incY * 57)], Y[((ptrdiff_t)incY * 56)]);
+        X_0 = _mm256_and_ps(_mm256_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_ps(_mm256_mul_ps(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm256_and_ps(_mm256_mul_ps(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm256_and_ps(_mm256_mul_ps(X_3, Y_3), abs_mask_tmp);
+        X_4 = _mm256_and_ps(_mm256_mul_ps(X_4, Y_4), abs_mask_tmp);
+        X_5 = _mm256_and_ps(_mm256_mul_ps(X_5, Y_5), abs_mask_tmp);
+        X_6 = _mm256_and_ps(_mm256_mul_ps(X_6, Y_6), abs_mask_tmp);
+        X_7 = _mm256_and_ps(_mm256_mul_ps(X_7, Y_7), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, X_0);
+        m_0 = _mm256_max_ps(m_0, X_1);
+        m_0 = _mm256_max_ps(m_0, X_2);
+        m_0 = _mm256_max_ps(m_0, X_3);
+        m_0 = _mm256_max_ps(m_0, X_4);
+        m_0 = _mm256_max_ps(m_0, X_5);
+        m_0 = _mm256_max_ps(m_0, X_6);
+        m_0 = _mm256_max_ps(m_0, X_7);
+      }
+      if(i + 32 <= N){
+        X_0 = _mm256_set_ps(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm256_set_ps(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)], X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]);
+        X_2 = _mm256_set_ps(X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)], X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]);
+        X_3 = _mm256_set_ps(X[((ptrdiff_t)incX * 31)], X[((ptrdiff_t)incX * 30)], X[((ptrdiff_t)incX * 29)], X[((ptrdiff_t)incX * 28)], X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)], X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)]);
+        Y_0 = _mm256_set_ps(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm256_set_ps(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)], Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)]);
+        Y_2 = _mm256_set_ps(Y[((ptrdiff_t)incY * 23)], Y[((ptrdiff_t)incY * 22)], Y[((ptrdiff_t)incY * 21)], Y[((ptrdiff_t)incY * 20)], Y[((ptrdiff_t)incY * 19)], Y[((ptrdiff_t)incY * 18)], Y[((ptrdiff_t)incY * 17)], Y[((ptrdiff_t)incY * 16)]);
+        Y_3 = _mm256_set_ps(Y[((ptrdiff_t)incY * 31)], Y[((ptrdiff_t)incY * 30)], Y[((ptrdiff_t)incY * 29)], Y[((ptrdiff_t)incY * 28)], Y[((ptrdiff_t)incY * 27)], Y[((ptrdiff_t)incY * 26)], Y[((ptrdiff_t)incY * 25)], Y[((ptrdiff_t)incY * 24)]);
+        X_0 = _mm256_and_ps(_mm256_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_ps(_mm256_mul_ps(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm256_and_ps(_mm256_mul_ps(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm256_and_ps(_mm256_mul_ps(X_3, Y_3), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, X_0);
+        m_0 = _mm256_max_ps(m_0, X_1);
+        m_0 = _mm256_max_ps(m_0, X_2);
+        m_0 = _mm256_max_ps(m_0, X_3);
+        i += 32, X += ((ptrdiff_t)incX * 32), Y += ((ptrdiff_t)incY * 32);
+      }
+      if(i + 16 <= N){
+        X_0 = _mm256_set_ps(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm256_set_ps(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)], X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]);
+        Y_0 = _mm256_set_ps(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm256_set_ps(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)], Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)]);
+        X_0 = _mm256_and_ps(_mm256_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm256_and_ps(_mm256_mul_ps(X_1, Y_1), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, X_0);
+        m_0 = _mm256_max_ps(m_0, X_1);
+        i += 16, X += ((ptrdiff_t)incX * 16), Y += ((ptrdiff_t)incY * 16);
+      }
+      if(i + 8 <= N){
+        X_0 = _mm256_set_ps(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)], X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        Y_0 = _mm256_set_ps(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)], Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        X_0 = _mm256_and_ps(_mm256_mul_ps(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, X_0);
+        i += 8, X += ((ptrdiff_t)incX * 8), Y += ((ptrdiff_t)incY * 8);
+      }
+      if(i < N){
+        X_0 = _mm256_set_ps(0, (N - i)>6?X[((ptrdiff_t)incX * 6)]:0, (N - i)>5?X[((ptrdiff_t)incX * 5)]:0, (N - i)>4?X[((ptrdiff_t)incX * 4)]:0, (N - i)>3?X[((ptrdiff_t)incX * 3)]:0, (N - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N - i)>1?X[(ptrdiff_t)incX]:0, X[0]);
+        Y_0 = _mm256_set_ps(0, (N - i)>6?Y[((ptrdiff_t)incY * 6)]:0, (N - i)>5?Y[((ptrdiff_t)incY * 5)]:0, (N - i)>4?Y[((ptrdiff_t)incY * 4)]:0, (N - i)>3?Y[((ptrdiff_t)incY * 3)]:0, (N - i)>2?Y[((ptrdiff_t)incY * 2)]:0, (N - i)>1?Y[(ptrdiff_t)incY]:0, Y[0]);
+        X_0 = _mm256_and_ps(_mm256_mul_ps(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm256_max_ps(m_0, X_0);
+        X += ((ptrdiff_t)incX * (N - i)), Y += ((ptrdiff_t)incY * (N - i));
+      }
+    }
+    _mm256_store_ps(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+    (&amaxm)[0] = max_buffer_tmp[0];
+
+  #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+    __m128 abs_mask_tmp;
+    {
+      __m128 tmp;
+      tmp = _mm_set1_ps(1);
+      abs_mask_tmp = _mm_set1_ps(-1);
+      abs_mask_tmp = _mm_xor_ps(abs_mask_tmp, tmp);
+      tmp = _mm_cmpeq_ps(tmp, tmp);
+      abs_mask_tmp = _mm_xor_ps(abs_mask_tmp, tmp);
+    }
+    float max_buffer_tmp[4] __attribute__((aligned(16))); (void)max_buffer_tmp;
+
+    int i;
+
+    __m128 X_0, X_1, X_2, X_3, X_4, X_5, X_6, X_7;
+    __m128 Y_0, Y_1, Y_2, Y_3, Y_4, Y_5, Y_6, Y_7;
+    __m128 m_0;
+    m_0 = _mm_setzero_ps();
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 32 <= N; i += 32, X += 32, Y += 32){
+        X_0 = _mm_loadu_ps(X);
+        X_1 = _mm_loadu_ps(X + 4);
+        X_2 = _mm_loadu_ps(X + 8);
+        X_3 = _mm_loadu_ps(X + 12);
+        X_4 = _mm_loadu_ps(X + 16);
+        X_5 = _mm_loadu_ps(X + 20);
+        X_6 = _mm_loadu_ps(X + 24);
+        X_7 = _mm_loadu_ps(X + 28);
+        Y_0 = _mm_loadu_ps(Y);
+        Y_1 = _mm_loadu_ps(Y + 4);
+        Y_2 = _mm_loadu_ps(Y + 8);
+        Y_3 = _mm_loadu_ps(Y + 12);
+        Y_4 = _mm_loadu_ps(Y + 16);
+        Y_5 = _mm_loadu_ps(Y + 20);
+        Y_6 = _mm_loadu_ps(Y + 24);
+        Y_7 = _mm_loadu_ps(Y + 28);
+        X_0 = _mm_and_ps(_mm_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm_and_ps(_mm_mul_ps(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm_and_ps(_mm_mul_ps(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm_and_ps(_mm_mul_ps(X_3, Y_3), abs_mask_tmp);
+        X_4 = _mm_and_ps(_mm_mul_ps(X_4, Y_4), abs_mask_tmp);
+        X_5 = _mm_and_ps(_mm_mul_ps(X_5, Y_5), abs_mask_tmp);
+        X_6 = _mm_and_ps(_mm_mul_ps(X_6, Y_6), abs_mask_tmp);
+        X_7 = _mm_and_ps(_mm_mul_ps(X_7, Y_7), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, X_0);
+        m_0 = _mm_max_ps(m_0, X_1);
+        m_0 = _mm_max_ps(m_0, X_2);
+        m_0 = _mm_max_ps(m_0, X_3);
+        m_0 = _mm_max_ps(m_0, X_4);
+        m_0 = _mm_max_ps(m_0, X_5);
+        m_0 = _mm_max_ps(m_0, X_6);
+        m_0 = _mm_max_ps(m_0, X_7);
+      }
+      if(i + 16 <= N){
+        X_0 = _mm_loadu_ps(X);
+        X_1 = _mm_loadu_ps(X + 4);
+        X_2 = _mm_loadu_ps(X + 8);
+        X_3 = _mm_loadu_ps(X + 12);
+        Y_0 = _mm_loadu_ps(Y);
+        Y_1 = _mm_loadu_ps(Y + 4);
+        Y_2 = _mm_loadu_ps(Y + 8);
+        Y_3 = _mm_loadu_ps(Y + 12);
+        X_0 = _mm_and_ps(_mm_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm_and_ps(_mm_mul_ps(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm_and_ps(_mm_mul_ps(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm_and_ps(_mm_mul_ps(X_3, Y_3), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, X_0);
+        m_0 = _mm_max_ps(m_0, X_1);
+        m_0 = _mm_max_ps(m_0, X_2);
+        m_0 = _mm_max_ps(m_0, X_3);
+        i += 16, X += 16, Y += 16;
+      }
+      if(i + 8 <= N){
+        X_0 = _mm_loadu_ps(X);
+        X_1 = _mm_loadu_ps(X + 4);
+        Y_0 = _mm_loadu_ps(Y);
+        Y_1 = _mm_loadu_ps(Y + 4);
+        X_0 = _mm_and_ps(_mm_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm_and_ps(_mm_mul_ps(X_1, Y_1), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, X_0);
+        m_0 = _mm_max_ps(m_0, X_1);
+        i += 8, X += 8, Y += 8;
+      }
+      if(i + 4 <= N){
+        X_0 = _mm_loadu_ps(X);
+        Y_0 = _mm_loadu_ps(Y);
+        X_0 = _mm_and_ps(_mm_mul_ps(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, X_0);
+        i += 4, X += 4, Y += 4;
+      }
+      if(i < N){
+        X_0 = _mm_set_ps(0, (N - i)>2?X[2]:0, (N - i)>1?X[1]:0, X[0]);
+        Y_0 = _mm_set_ps(0, (N - i)>2?Y[2]:0, (N - i)>1?Y[1]:0, Y[0]);
+        X_0 = _mm_and_ps(_mm_mul_ps(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, X_0);
+        X += (N - i), Y += (N - i);
+      }
+    }else{
+
+      for(i = 0; i + 32 <= N; i += 32, X += ((ptrdiff_t)incX * 32), Y += ((ptrdiff_t)incY * 32)){
+        X_0 = _mm_set_ps(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm_set_ps(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]);
+        X_2 = _mm_set_ps(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]);
+        X_3 = _mm_set_ps(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]);
+        X_4 = _mm_set_ps(X[((ptrdiff_t)incX * 19)], X[((ptrdiff_t)incX * 18)], X[((ptrdiff_t)incX * 17)], X[((ptrdiff_t)incX * 16)]);
+        X_5 = _mm_set_ps(X[((ptrdiff_t)incX * 23)], X[((ptrdiff_t)incX * 22)], X[((ptrdiff_t)incX * 21)], X[((ptrdiff_t)incX * 20)]);
+        X_6 = _mm_set_ps(X[((ptrdiff_t)incX * 27)], X[((ptrdiff_t)incX * 26)], X[((ptrdiff_t)incX * 25)], X[((ptrdiff_t)incX * 24)]);
+        X_7 = _mm_set_ps(X[((ptrdiff_t)incX * 31)], X[((ptrdiff_t)incX * 30)], X[((ptrdiff_t)incX * 29)], X[((ptrdiff_t)incX * 28)]);
+        Y_0 = _mm_set_ps(Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm_set_ps(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)]);
+        Y_2 = _mm_set_ps(Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)]);
+        Y_3 = _mm_set_ps(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)]);
+        Y_4 = _mm_set_ps(Y[((ptrdiff_t)incY * 19)], Y[((ptrdiff_t)incY * 18)], Y[((ptrdiff_t)incY * 17)], Y[((ptrdiff_t)incY * 16)]);
+        Y_5 = _mm_set_ps(Y[((ptrdiff_t)incY * 23)], Y[((ptrdiff_t)incY * 22)], Y[((ptrdiff_t)incY * 21)], Y[((ptrdiff_t)incY * 20)]);
+        Y_6 = _mm_set_ps(Y[((ptrdiff_t)incY * 27)], Y[((ptrdiff_t)incY * 26)], Y[((ptrdiff_t)incY * 25)], Y[((ptrdiff_t)incY * 24)]);
+        Y_7 = _mm_set_ps(Y[((ptrdiff_t)incY * 31)], Y[((ptrdiff_t)incY * 30)], Y[((ptrdiff_t)incY * 29)], Y[((ptrdiff_t)incY * 28)]);
+        X_0 = _mm_and_ps(_mm_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm_and_ps(_mm_mul_ps(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm_and_ps(_mm_mul_ps(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm_and_ps(_mm_mul_ps(X_3, Y_3), abs_mask_tmp);
+        X_4 = _mm_and_ps(_mm_mul_ps(X_4, Y_4), abs_mask_tmp);
+        X_5 = _mm_and_ps(_mm_mul_ps(X_5, Y_5), abs_mask_tmp);
+        X_6 = _mm_and_ps(_mm_mul_ps(X_6, Y_6), abs_mask_tmp);
+        X_7 = _mm_and_ps(_mm_mul_ps(X_7, Y_7), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, X_0);
+        m_0 = _mm_max_ps(m_0, X_1);
+        m_0 = _mm_max_ps(m_0, X_2);
+        m_0 = _mm_max_ps(m_0, X_3);
+        m_0 = _mm_max_ps(m_0, X_4);
+        m_0 = _mm_max_ps(m_0, X_5);
+        m_0 = _mm_max_ps(m_0, X_6);
+        m_0 = _mm_max_ps(m_0, X_7);
+      }
+      if(i + 16 <= N){
+        X_0 = _mm_set_ps(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm_set_ps(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]);
+        X_2 = _mm_set_ps(X[((ptrdiff_t)incX * 11)], X[((ptrdiff_t)incX * 10)], X[((ptrdiff_t)incX * 9)], X[((ptrdiff_t)incX * 8)]);
+        X_3 = _mm_set_ps(X[((ptrdiff_t)incX * 15)], X[((ptrdiff_t)incX * 14)], X[((ptrdiff_t)incX * 13)], X[((ptrdiff_t)incX * 12)]);
+        Y_0 = _mm_set_ps(Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm_set_ps(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)]);
+        Y_2 = _mm_set_ps(Y[((ptrdiff_t)incY * 11)], Y[((ptrdiff_t)incY * 10)], Y[((ptrdiff_t)incY * 9)], Y[((ptrdiff_t)incY * 8)]);
+        Y_3 = _mm_set_ps(Y[((ptrdiff_t)incY * 15)], Y[((ptrdiff_t)incY * 14)], Y[((ptrdiff_t)incY * 13)], Y[((ptrdiff_t)incY * 12)]);
+        X_0 = _mm_and_ps(_mm_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm_and_ps(_mm_mul_ps(X_1, Y_1), abs_mask_tmp);
+        X_2 = _mm_and_ps(_mm_mul_ps(X_2, Y_2), abs_mask_tmp);
+        X_3 = _mm_and_ps(_mm_mul_ps(X_3, Y_3), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, X_0);
+        m_0 = _mm_max_ps(m_0, X_1);
+        m_0 = _mm_max_ps(m_0, X_2);
+        m_0 = _mm_max_ps(m_0, X_3);
+        i += 16, X += ((ptrdiff_t)incX * 16), Y += ((ptrdiff_t)incY * 16);
+      }
+      if(i + 8 <= N){
+        X_0 = _mm_set_ps(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        X_1 = _mm_set_ps(X[((ptrdiff_t)incX * 7)], X[((ptrdiff_t)incX * 6)], X[((ptrdiff_t)incX * 5)], X[((ptrdiff_t)incX * 4)]);
+        Y_0 = _mm_set_ps(Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        Y_1 = _mm_set_ps(Y[((ptrdiff_t)incY * 7)], Y[((ptrdiff_t)incY * 6)], Y[((ptrdiff_t)incY * 5)], Y[((ptrdiff_t)incY * 4)]);
+        X_0 = _mm_and_ps(_mm_mul_ps(X_0, Y_0), abs_mask_tmp);
+        X_1 = _mm_and_ps(_mm_mul_ps(X_1, Y_1), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, X_0);
+        m_0 = _mm_max_ps(m_0, X_1);
+        i += 8, X += ((ptrdiff_t)incX * 8), Y += ((ptrdiff_t)incY * 8);
+      }
+      if(i + 4 <= N){
+        X_0 = _mm_set_ps(X[((ptrdiff_t)incX * 3)], X[((ptrdiff_t)incX * 2)], X[(ptrdiff_t)incX], X[0]);
+        Y_0 = _mm_set_ps(Y[((ptrdiff_t)incY * 3)], Y[((ptrdiff_t)incY * 2)], Y[(ptrdiff_t)incY], Y[0]);
+        X_0 = _mm_and_ps(_mm_mul_ps(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, X_0);
+        i += 4, X += ((ptrdiff_t)incX * 4), Y += ((ptrdiff_t)incY * 4);
+      }
+      if(i < N){
+        X_0 = _mm_set_ps(0, (N - i)>2?X[((ptrdiff_t)incX * 2)]:0, (N - i)>1?X[(ptrdiff_t)incX]:0, X[0]);
+        Y_0 = _mm_set_ps(0, (N - i)>2?Y[((ptrdiff_t)incY * 2)]:0, (N - i)>1?Y[(ptrdiff_t)incY]:0, Y[0]);
+        X_0 = _mm_and_ps(_mm_mul_ps(X_0, Y_0), abs_mask_tmp);
+        m_0 = _mm_max_ps(m_0, X_0);
+        X += ((ptrdiff_t)incX * (N - i)), Y += ((ptrdiff_t)incY * (N - i));
+      }
+    }
+    _mm_store_ps(max_buffer_tmp, m_0);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+    max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+    (&amaxm)[0] = max_buffer_tmp[0];
+
+  #else
+    int i;
+
+    float X_0;
+    float Y_0;
+    float m_0;
+    m_0 = 0;
+
+    if(incX == 1 && incY == 1){
+
+      for(i = 0; i + 1 <= N; i += 1, X += 1, Y += 1){
+        X_0 = X[0];
+        Y_0 = Y[0];
+        X_0 = fabsf((X_0 * Y_0));
+        m_0 = (m_0 > X_0? m_0: X_0);
+      }
+    }else{
+
+      for(i = 0; i + 1 <= N; i += 1, X += (ptrdiff_t)incX, Y += (ptrdiff_t)incY){
+        X_0 = X[0];
+        Y_0 = Y[0];
+        X_0 = fabsf((X_0 * Y_0));
+        m_0 = (m_0 > X_0? m_0: X_0);
+      }
+    }
+    (&amaxm)[0] = m_0;
+
+  #endif
+  //[[[end]]]
+  return amaxm;
+}
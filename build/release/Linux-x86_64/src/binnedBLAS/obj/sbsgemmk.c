@@ -0,0 +1,1610 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../common/common.h"
+#include "binnedBLAS.h"
+
+/*[[[cog
+import cog
+import generate
+import dataTypes
+import depositGEMM
+import amaxmGEMM
+import vectorizations
+from src.common import blockSize
+from scripts import terminal
+
+code_block = generate.CodeBlock()
+vectorizations.conditionally_include_vectorizations(code_block)
+cog.out(str(code_block))
+
+cog.outl()
+
+cog.out(generate.generate(blockSize.BlockSize("sbsgemmk", "MR", 1, 4, 2, ["bench_rsgemm_AvgTransA_AvgTransB_fold_{}".format(terminal.get_sidefaultfold())]), cog.inFile, args, params, mode))
+cog.out(generate.generate(blockSize.BlockSize("sbsgemmk", "NR", 1, 4, 2, ["bench_rsgemm_AvgTransA_AvgTransB_fold_{}".format(terminal.get_sidefaultfold())]), cog.inFile, args, params, mode))
+cog.out(generate.generate(blockSize.BlockSize("sbsgemmk", "K_BLOCK", 32, terminal.get_siendurance(), 256, ["bench_rsgemm_AvgTransA_AvgTransB_fold_{}".format(terminal.get_sidefaultfold())]), cog.inFile, args, params, mode))
+]]]*/
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  #include <immintrin.h>
+
+#elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+  #include <immintrin.h>
+
+#elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+  #include <emmintrin.h>
+
+#else
+
+
+#endif
+
+#define MR 2
+#define NR 2
+#define K_BLOCK 256
+//[[[end]]]
+
+/**
+ * @internal
+ * @brief Add to a block of binned single precision matrix C the pairwise dot products of the rows of single precision matrix A with the columns of single precision matrix B
+ *
+ * For i < M and j < N, adds to the binned element C[i * incrowC + j * inccolC] the dot product of the row of A starting at A + i * lda and the column of B starting at B + j * ldb (both contiguous and of length K).
+ *
+ * The result is the same as calling #binnedBLAS_sbsdot() for each element of C, but MR by NR blocks of C are accumulated together. Each loaded element of A and B is reused across the block, the binned accumulators of the block are held in registers, and the maximum absolute product of each element of the block is found in a single pass.
+ *
+ * The maximum absolute values of the rows of A and the columns of B are found once per call and stored in @p amax. Their products bound the products of each block, and when these bounds cannot raise the index of any accumulator in the block the exact scan of the products is skipped. The exact maxima are used whenever the index may change, so results are unaffected.
+ *
+ * @param fold the fold of the binned types
+ * @param M number of rows of A and of C
+ * @param N number of columns of B and of C
+ * @param K length of the rows of A and of the columns of B
+ * @param A single precision matrix with contiguous rows
+ * @param lda distance between rows of A
+ * @param B single precision matrix with contiguous columns
+ * @param ldb distance between columns of B
+ * @param C binned single precision matrix
+ * @param incrowC distance (in binned elements) between rows of C
+ * @param inccolC distance (in binned elements) between columns of C
+ * @param amax workspace of at least M + N single precision elements
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedBLAS_sbsgemmk(const int fold, const int M, const int N, const int K, const float *A, const int lda, const float *B, const int ldb, float_binned *C, const int incrowC, const int inccolC, float *amax){
+  float amaxm[MR * NR];
+  float *priC[MR * NR];
+  const float *Ak;
+  const float *Bk;
+  int i, ii;
+  int j, jj;
+  int k;
+  int e;
+  int K_block;
+  int deposits;
+  int simple;
+  int scan;
+  float *amaxA;
+  float *amaxB;
+
+  //the maxima of the rows of A and the columns of B are found once and shared by all blocks
+  amaxA = amax;
+  amaxB = amax + M;
+  for(i = 0; i < M - M % MR; i++){
+    amaxA[i] = binnedBLAS_samax(K, A + i * lda, 1);
+  }
+  for(j = 0; j < N - N % NR; j++){
+    amaxB[j] = binnedBLAS_samax(K, B + j * ldb, 1);
+  }
+
+  for(i = 0; i + MR <= M; i += MR){
+    for(j = 0; j + NR <= N; j += NR){
+      for(ii = 0; ii < MR; ii++){
+        for(jj = 0; jj < NR; jj++){
+          priC[ii * NR + jj] = C + ((i + ii) * incrowC + (j + jj) * inccolC) * binned_sbnum(fold);
+        }
+      }
+      deposits = 0;
+
+      for(k = 0; k < K; k += K_BLOCK){
+        K_block = MIN(K_BLOCK, K - k);
+        Ak = A + i * lda + k;
+        Bk = B + j * ldb + k;
+
+        //the products of the row and column maxima bound the products in the chunk. If the bounds do not raise the index of any element of the block, neither would the exact maxima, and the exact scan is skipped
+        scan = 0;
+        for(ii = 0; ii < MR; ii++){
+          for(jj = 0; jj < NR; jj++){
+            e = ii * NR + jj;
+            amaxm[e] = amaxA[i + ii] * amaxB[j + jj];
+            if(ISNANINFF(amaxm[e]) || ISNANINFF(priC[e][0]) || priC[e][0] == 0.0 || binned_smindex0(priC[e]) || binned_sindex(amaxm[e]) < binned_smindex(priC[e])){
+              scan = 1;
+            }
+          }
+        }
+
+        simple = 1;
+        if(scan){
+          /*[[[cog
+          cog.out(generate.generate(amaxmGEMM.AMaxMGEMM(dataTypes.Float, "K_block", "Ak", "lda", "Bk", "ldb", "amaxm", "sbsgemmk_block_size_MR", "sbsgemmk_block_size_NR"), cog.inFile, args, params, mode))
+          ]]]*/
+          {
+            #if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+              float max_buffer_tmp[16] __attribute__((aligned(64))); (void)max_buffer_tmp;
+
+              int i;
+              const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+              const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+              __m512 Ak_0, Ak_1;
+              __m512 Bk_0, Bk_1;
+              __m512 m_0, m_1, m_2, m_3;
+              m_0 = _mm512_setzero_ps();
+              m_1 = _mm512_setzero_ps();
+              m_2 = _mm512_setzero_ps();
+              m_3 = _mm512_setzero_ps();
+
+              for(i = 0; i + 16 <= K_block; i += 16, Ak_ptr_0 += 16, Ak_ptr_1 += 16, Bk_ptr_0 += 16, Bk_ptr_1 += 16){
+                Ak_0 = _mm512_loadu_ps(Ak_ptr_0);
+                Ak_1 = _mm512_loadu_ps(Ak_ptr_1);
+                Bk_0 = _mm512_loadu_ps(Bk_ptr_0);
+                Bk_1 = _mm512_loadu_ps(Bk_ptr_1);
+                m_0 = _mm512_max_ps(m_0, _mm512_abs_ps(_mm512_mul_ps(Ak_0, Bk_0)));
+                m_1 = _mm512_max_ps(m_1, _mm512_abs_ps(_mm512_mul_ps(Ak_0, Bk_1)));
+                m_2 = _mm512_max_ps(m_2, _mm512_abs_ps(_mm512_mul_ps(Ak_1, Bk_0)));
+                m_3 = _mm512_max_ps(m_3, _mm512_abs_ps(_mm512_mul_ps(Ak_1, Bk_1)));
+              }
+              if(i < K_block){
+                Ak_0 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Ak_ptr_0);
+                Ak_1 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Ak_ptr_1);
+                Bk_0 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Bk_ptr_0);
+                Bk_1 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Bk_ptr_1);
+                m_0 = _mm512_max_ps(m_0, _mm512_abs_ps(_mm512_mul_ps(Ak_0, Bk_0)));
+                m_1 = _mm512_max_ps(m_1, _mm512_abs_ps(_mm512_mul_ps(Ak_0, Bk_1)));
+                m_2 = _mm512_max_ps(m_2, _mm512_abs_ps(_mm512_mul_ps(Ak_1, Bk_0)));
+                m_3 = _mm512_max_ps(m_3, _mm512_abs_ps(_mm512_mul_ps(Ak_1, Bk_1)));
+                Ak_ptr_0 += (K_block - i), Ak_ptr_1 += (K_block - i), Bk_ptr_0 += (K_block - i), Bk_ptr_1 += (K_block - i);
+              }
+
+              _mm512_store_ps(max_buffer_tmp, m_0);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[8] ? max_buffer_tmp[0]: max_buffer_tmp[8]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[9] ? max_buffer_tmp[0]: max_buffer_tmp[9]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[10] ? max_buffer_tmp[0]: max_buffer_tmp[10]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[11] ? max_buffer_tmp[0]: max_buffer_tmp[11]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[12] ? max_buffer_tmp[0]: max_buffer_tmp[12]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[13] ? max_buffer_tmp[0]: max_buffer_tmp[13]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[14] ? max_buffer_tmp[0]: max_buffer_tmp[14]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[15] ? max_buffer_tmp[0]: max_buffer_tmp[15]);
+              amaxm[0] = max_buffer_tmp[0];
+              _mm512_store_ps(max_buffer_tmp, m_1);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[8] ? max_buffer_tmp[0]: max_buffer_tmp[8]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[9] ? max_buffer_tmp[0]: max_buffer_tmp[9]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[10] ? max_buffer_tmp[0]: max_buffer_tmp[10]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[11] ? max_buffer_tmp[0]: max_buffer_tmp[11]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[12] ? max_buffer_tmp[0]: max_buffer_tmp[12]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[13] ? max_buffer_tmp[0]: max_buffer_tmp[13]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[14] ? max_buffer_tmp[0]: max_buffer_tmp[14]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[15] ? max_buffer_tmp[0]: max_buffer_tmp[15]);
+              amaxm[1] = max_buffer_tmp[0];
+              _mm512_store_ps(max_buffer_tmp, m_2);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[8] ? max_buffer_tmp[0]: max_buffer_tmp[8]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[9] ? max_buffer_tmp[0]: max_buffer_tmp[9]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[10] ? max_buffer_tmp[0]: max_buffer_tmp[10]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[11] ? max_buffer_tmp[0]: max_buffer_tmp[11]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[12] ? max_buffer_tmp[0]: max_buffer_tmp[12]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[13] ? max_buffer_tmp[0]: max_buffer_tmp[13]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[14] ? max_buffer_tmp[0]: max_buffer_tmp[14]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[15] ? max_buffer_tmp[0]: max_buffer_tmp[15]);
+              amaxm[2] = max_buffer_tmp[0];
+              _mm512_store_ps(max_buffer_tmp, m_3);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[8] ? max_buffer_tmp[0]: max_buffer_tmp[8]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[9] ? max_buffer_tmp[0]: max_buffer_tmp[9]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[10] ? max_buffer_tmp[0]: max_buffer_tmp[10]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[11] ? max_buffer_tmp[0]: max_buffer_tmp[11]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[12] ? max_buffer_tmp[0]: max_buffer_tmp[12]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[13] ? max_buffer_tmp[0]: max_buffer_tmp[13]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[14] ? max_buffer_tmp[0]: max_buffer_tmp[14]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[15] ? max_buffer_tmp[0]: max_buffer_tmp[15]);
+              amaxm[3] = max_buffer_tmp[0];
+
+            #elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+              __m256 abs_mask_tmp;
+              {
+                __m256 tmp;
+                tmp = _mm256_set1_ps(1);
+                abs_mask_tmp = _mm256_set1_ps(-1);
+                abs_mask_tmp = _mm256_xor_ps(abs_mask_tmp, tmp);
+                tmp = _mm256_cmp_ps(tmp, tmp, 0);
+                abs_mask_tmp = _mm256_xor_ps(abs_mask_tmp, tmp);
+              }
+              float max_buffer_tmp[8] __attribute__((aligned(32))); (void)max_buffer_tmp;
+
+              int i;
+              const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+              const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+              __m256 Ak_0, Ak_1;
+              __m256 Bk_0, Bk_1;
+              __m256 m_0, m_1, m_2, m_3;
+              m_0 = _mm256_setzero_ps();
+              m_1 = _mm256_setzero_ps();
+              m_2 = _mm256_setzero_ps();
+              m_3 = _mm256_setzero_ps();
+
+              for(i = 0; i + 8 <= K_block; i += 8, Ak_ptr_0 += 8, Ak_ptr_1 += 8, Bk_ptr_0 += 8, Bk_ptr_1 += 8){
+                Ak_0 = _mm256_loadu_ps(Ak_ptr_0);
+                Ak_1 = _mm256_loadu_ps(Ak_ptr_1);
+                Bk_0 = _mm256_loadu_ps(Bk_ptr_0);
+                Bk_1 = _mm256_loadu_ps(Bk_ptr_1);
+                m_0 = _mm256_max_ps(m_0, _mm256_and_ps(_mm256_mul_ps(Ak_0, Bk_0), abs_mask_tmp));
+                m_1 = _mm256_max_ps(m_1, _mm256_and_ps(_mm256_mul_ps(Ak_0, Bk_1), abs_mask_tmp));
+                m_2 = _mm256_max_ps(m_2, _mm256_and_ps(_mm256_mul_ps(Ak_1, Bk_0), abs_mask_tmp));
+                m_3 = _mm256_max_ps(m_3, _mm256_and_ps(_mm256_mul_ps(Ak_1, Bk_1), abs_mask_tmp));
+              }
+              if(i < K_block){
+                Ak_0 = _mm256_set_ps(0, (K_block - i)>6?Ak_ptr_0[6]:0, (K_block - i)>5?Ak_ptr_0[5]:0, (K_block - i)>4?Ak_ptr_0[4]:0, (K_block - i)>3?Ak_ptr_0[3]:0, (K_block - i)>2?Ak_ptr_0[2]:0, (K_block - i)>1?Ak_ptr_0[1]:0, Ak_ptr_0[0]);
+                Ak_1 = _mm256_set_ps(0, (K_block - i)>6?Ak_ptr_1[6]:0, (K_block - i)>5?Ak_ptr_1[5]:0, (K_block - i)>4?Ak_ptr_1[4]:0, (K_block - i)>3?Ak_ptr_1[3]:0, (K_block - i)>2?Ak_ptr_1[2]:0, (K_block - i)>1?Ak_ptr_1[1]:0, Ak_ptr_1[0]);
+                Bk_0 = _mm256_set_ps(0, (K_block - i)>6?Bk_ptr_0[6]:0, (K_block - i)>5?Bk_ptr_0[5]:0, (K_block - i)>4?Bk_ptr_0[4]:0, (K_block - i)>3?Bk_ptr_0[3]:0, (K_block - i)>2?Bk_ptr_0[2]:0, (K_block - i)>1?Bk_ptr_0[1]:0, Bk_ptr_0[0]);
+                Bk_1 = _mm256_set_ps(0, (K_block - i)>6?Bk_ptr_1[6]:0, (K_block - i)>5?Bk_ptr_1[5]:0, (K_block - i)>4?Bk_ptr_1[4]:0, (K_block - i)>3?Bk_ptr_1[3]:0, (K_block - i)>2?Bk_ptr_1[2]:0, (K_block - i)>1?Bk_ptr_1[1]:0, Bk_ptr_1[0]);
+                m_0 = _mm256_max_ps(m_0, _mm256_and_ps(_mm256_mul_ps(Ak_0, Bk_0), abs_mask_tmp));
+                m_1 = _mm256_max_ps(m_1, _mm256_and_ps(_mm256_mul_ps(Ak_0, Bk_1), abs_mask_tmp));
+                m_2 = _mm256_max_ps(m_2, _mm256_and_ps(_mm256_mul_ps(Ak_1, Bk_0), abs_mask_tmp));
+                m_3 = _mm256_max_ps(m_3, _mm256_and_ps(_mm256_mul_ps(Ak_1, Bk_1), abs_mask_tmp));
+                Ak_ptr_0 += (K_block - i), Ak_ptr_1 += (K_block - i), Bk_ptr_0 += (K_block - i), Bk_ptr_1 += (K_block - i);
+              }
+
+              _mm256_store_ps(max_buffer_tmp, m_0);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+              amaxm[0] = max_buffer_tmp[0];
+              _mm256_store_ps(max_buffer_tmp, m_1);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+              amaxm[1] = max_buffer_tmp[0];
+              _mm256_store_ps(max_buffer_tmp, m_2);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+              amaxm[2] = max_buffer_tmp[0];
+              _mm256_store_ps(max_buffer_tmp, m_3);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[4] ? max_buffer_tmp[0]: max_buffer_tmp[4]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[5] ? max_buffer_tmp[0]: max_buffer_tmp[5]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[6] ? max_buffer_tmp[0]: max_buffer_tmp[6]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[7] ? max_buffer_tmp[0]: max_buffer_tmp[7]);
+              amaxm[3] = max_buffer_tmp[0];
+
+            #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+              __m128 abs_mask_tmp;
+              {
+                __m128 tmp;
+                tmp = _mm_set1_ps(1);
+                abs_mask_tmp = _mm_set1_ps(-1);
+                abs_mask_tmp = _mm_xor_ps(abs_mask_tmp, tmp);
+                tmp = _mm_cmpeq_ps(tmp, tmp);
+                abs_mask_tmp = _mm_xor_ps(abs_mask_tmp, tmp);
+              }
+              float max_buffer_tmp[4] __attribute__((aligned(16))); (void)max_buffer_tmp;
+
+              int i;
+              const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+              const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+              __m128 Ak_0, Ak_1;
+              __m128 Bk_0, Bk_1;
+              __m128 m_0, m_1, m_2, m_3;
+              m_0 = _mm_setzero_ps();
+              m_1 = _mm_setzero_ps();
+              m_2 = _mm_setzero_ps();
+              m_3 = _mm_setzero_ps();
+
+              for(i = 0; i + 4 <= K_block; i += 4, Ak_ptr_0 += 4, Ak_ptr_1 += 4, Bk_ptr_0 += 4, Bk_ptr_1 += 4){
+                Ak_0 = _mm_loadu_ps(Ak_ptr_0);
+                Ak_1 = _mm_loadu_ps(Ak_ptr_1);
+                Bk_0 = _mm_loadu_ps(Bk_ptr_0);
+                Bk_1 = _mm_loadu_ps(Bk_ptr_1);
+                m_0 = _mm_max_ps(m_0, _mm_and_ps(_mm_mul_ps(Ak_0, Bk_0), abs_mask_tmp));
+                m_1 = _mm_max_ps(m_1, _mm_and_ps(_mm_mul_ps(Ak_0, Bk_1), abs_mask_tmp));
+                m_2 = _mm_max_ps(m_2, _mm_and_ps(_mm_mul_ps(Ak_1, Bk_0), abs_mask_tmp));
+                m_3 = _mm_max_ps(m_3, _mm_and_ps(_mm_mul_ps(Ak_1, Bk_1), abs_mask_tmp));
+              }
+              if(i < K_block){
+                Ak_0 = _mm_set_ps(0, (K_block - i)>2?Ak_ptr_0[2]:0, (K_block - i)>1?Ak_ptr_0[1]:0, Ak_ptr_0[0]);
+                Ak_1 = _mm_set_ps(0, (K_block - i)>2?Ak_ptr_1[2]:0, (K_block - i)>1?Ak_ptr_1[1]:0, Ak_ptr_1[0]);
+                Bk_0 = _mm_set_ps(0, (K_block - i)>2?Bk_ptr_0[2]:0, (K_block - i)>1?Bk_ptr_0[1]:0, Bk_ptr_0[0]);
+                Bk_1 = _mm_set_ps(0, (K_block - i)>2?Bk_ptr_1[2]:0, (K_block - i)>1?Bk_ptr_1[1]:0, Bk_ptr_1[0]);
+                m_0 = _mm_max_ps(m_0, _mm_and_ps(_mm_mul_ps(Ak_0, Bk_0), abs_mask_tmp));
+                m_1 = _mm_max_ps(m_1, _mm_and_ps(_mm_mul_ps(Ak_0, Bk_1), abs_mask_tmp));
+                m_2 = _mm_max_ps(m_2, _mm_and_ps(_mm_mul_ps(Ak_1, Bk_0), abs_mask_tmp));
+                m_3 = _mm_max_ps(m_3, _mm_and_ps(_mm_mul_ps(Ak_1, Bk_1), abs_mask_tmp));
+                Ak_ptr_0 += (K_block - i), Ak_ptr_1 += (K_block - i), Bk_ptr_0 += (K_block - i), Bk_ptr_1 += (K_block - i);
+              }
+
+              _mm_store_ps(max_buffer_tmp, m_0);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              amaxm[0] = max_buffer_tmp[0];
+              _mm_store_ps(max_buffer_tmp, m_1);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              amaxm[1] = max_buffer_tmp[0];
+              _mm_store_ps(max_buffer_tmp, m_2);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              amaxm[2] = max_buffer_tmp[0];
+              _mm_store_ps(max_buffer_tmp, m_3);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[1] ? max_buffer_tmp[0]: max_buffer_tmp[1]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[2] ? max_buffer_tmp[0]: max_buffer_tmp[2]);
+              max_buffer_tmp[0] = (max_buffer_tmp[0] > max_buffer_tmp[3] ? max_buffer_tmp[0]: max_buffer_tmp[3]);
+              amaxm[3] = max_buffer_tmp[0];
+
+            #else
+              int i;
+              const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+              const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+              float Ak_0, Ak_1;
+              float Bk_0, Bk_1;
+              float m_0, m_1, m_2, m_3;
+              m_0 = 0;
+              m_1 = 0;
+              m_2 = 0;
+              m_3 = 0;
+
+              for(i = 0; i + 1 <= K_block; i += 1, Ak_ptr_0 += 1, Ak_ptr_1 += 1, Bk_ptr_0 += 1, Bk_ptr_1 += 1){
+                Ak_0 = Ak_ptr_0[0];
+                Ak_1 = Ak_ptr_1[0];
+                Bk_0 = Bk_ptr_0[0];
+                Bk_1 = Bk_ptr_1[0];
+                m_0 = (m_0 > fabsf((Ak_0 * Bk_0))? m_0: fabsf((Ak_0 * Bk_0)));
+                m_1 = (m_1 > fabsf((Ak_0 * Bk_1))? m_1: fabsf((Ak_0 * Bk_1)));
+                m_2 = (m_2 > fabsf((Ak_1 * Bk_0))? m_2: fabsf((Ak_1 * Bk_0)));
+                m_3 = (m_3 > fabsf((Ak_1 * Bk_1))? m_3: fabsf((Ak_1 * Bk_1)));
+              }
+
+              amaxm[0] = m_0;
+              amaxm[1] = m_1;
+              amaxm[2] = m_2;
+              amaxm[3] = m_3;
+
+            #endif
+
+          }
+          //[[[end]]]
+          for(e = 0; e < MR * NR; e++){
+            if(isinf(amaxm[e]) || isnan(amaxm[e]) || isinf(priC[e][0]) || isnan(priC[e][0])){
+              simple = 0;
+            }
+          }
+        }
+
+        if(simple){
+          if(deposits + K_block > binned_SBENDURANCE){
+            for(e = 0; e < MR * NR; e++){
+              binned_smrenorm(fold, priC[e], 1, priC[e] + fold, 1);
+            }
+            deposits = 0;
+          }
+          if(scan){
+            for(e = 0; e < MR * NR; e++){
+              binned_smsupdate(fold, amaxm[e], priC[e], 1, priC[e] + fold, 1);
+              if(binned_smindex0(priC[e])){
+                simple = 0;
+              }
+            }
+          }
+        }
+
+        if(simple){
+          /*[[[cog
+          cog.out(generate.generate(depositGEMM.DepositGEMM(dataTypes.Float, "fold", "K_block", "Ak", "lda", "Bk", "ldb", "priC", "sbsgemmk_block_size_MR", "sbsgemmk_block_size_NR"), cog.inFile, args, params, mode))
+          ]]]*/
+          {
+            #if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+              __m512i blp_mask_tmp;
+              {
+                __m512i tmp;
+                blp_mask_tmp = _mm512_castps_si512(_mm512_set1_ps(1.0));
+                tmp = _mm512_castps_si512(_mm512_set1_ps(1.0 + (FLT_EPSILON * 1.0001)));
+                blp_mask_tmp = _mm512_xor_si512(blp_mask_tmp, tmp);
+              }
+              __m512 cons_tmp; (void)cons_tmp;
+              float cons_buffer_tmp[16] __attribute__((aligned(64))); (void)cons_buffer_tmp;
+
+
+              switch(fold){
+                case 3:
+                  {
+                    int i;
+                    const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+                    const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+                    __m512 Ak_0, Ak_1;
+                    __m512 Bk_0, Bk_1;
+                    __m512 P_0;
+                    __m512 q_0;
+                    __m512 s_0_0, s_1_0, s_2_0, s_3_0;
+                    __m512 s_0_1, s_1_1, s_2_1, s_3_1;
+                    __m512 s_0_2, s_1_2, s_2_2, s_3_2;
+
+                    s_0_0 = _mm512_set1_ps(*(priC[0]));
+                    s_0_1 = _mm512_set1_ps(*(priC[0] + 1));
+                    s_0_2 = _mm512_set1_ps(*(priC[0] + 2));
+                    s_1_0 = _mm512_set1_ps(*(priC[1]));
+                    s_1_1 = _mm512_set1_ps(*(priC[1] + 1));
+                    s_1_2 = _mm512_set1_ps(*(priC[1] + 2));
+                    s_2_0 = _mm512_set1_ps(*(priC[2]));
+                    s_2_1 = _mm512_set1_ps(*(priC[2] + 1));
+                    s_2_2 = _mm512_set1_ps(*(priC[2] + 2));
+                    s_3_0 = _mm512_set1_ps(*(priC[3]));
+                    s_3_1 = _mm512_set1_ps(*(priC[3] + 1));
+                    s_3_2 = _mm512_set1_ps(*(priC[3] + 2));
+
+                    for(i = 0; i + 16 <= K_block; i += 16, Ak_ptr_0 += 16, Ak_ptr_1 += 16, Bk_ptr_0 += 16, Bk_ptr_1 += 16){
+                      Ak_0 = _mm512_loadu_ps(Ak_ptr_0);
+                      Ak_1 = _mm512_loadu_ps(Ak_ptr_1);
+                      Bk_0 = _mm512_loadu_ps(Bk_ptr_0);
+                      Bk_1 = _mm512_loadu_ps(Bk_ptr_1);
+                      P_0 = _mm512_mul_ps(Ak_0, Bk_0);
+                      q_0 = s_0_0;
+                      s_0_0 = _mm512_add_ps(s_0_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_0_0);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      q_0 = s_0_1;
+                      s_0_1 = _mm512_add_ps(s_0_1, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_0_1);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      s_0_2 = _mm512_add_ps(s_0_2, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_0, Bk_1);
+                      q_0 = s_1_0;
+                      s_1_0 = _mm512_add_ps(s_1_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_1_0);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      q_0 = s_1_1;
+                      s_1_1 = _mm512_add_ps(s_1_1, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_1_1);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      s_1_2 = _mm512_add_ps(s_1_2, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_1, Bk_0);
+                      q_0 = s_2_0;
+                      s_2_0 = _mm512_add_ps(s_2_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_2_0);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      q_0 = s_2_1;
+                      s_2_1 = _mm512_add_ps(s_2_1, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_2_1);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      s_2_2 = _mm512_add_ps(s_2_2, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_1, Bk_1);
+                      q_0 = s_3_0;
+                      s_3_0 = _mm512_add_ps(s_3_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_3_0);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      q_0 = s_3_1;
+                      s_3_1 = _mm512_add_ps(s_3_1, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_3_1);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      s_3_2 = _mm512_add_ps(s_3_2, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                    }
+                    if(i < K_block){
+                      Ak_0 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Ak_ptr_0);
+                      Ak_1 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Ak_ptr_1);
+                      Bk_0 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Bk_ptr_0);
+                      Bk_1 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Bk_ptr_1);
+                      P_0 = _mm512_mul_ps(Ak_0, Bk_0);
+                      q_0 = s_0_0;
+                      s_0_0 = _mm512_add_ps(s_0_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_0_0);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      q_0 = s_0_1;
+                      s_0_1 = _mm512_add_ps(s_0_1, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_0_1);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      s_0_2 = _mm512_add_ps(s_0_2, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_0, Bk_1);
+                      q_0 = s_1_0;
+                      s_1_0 = _mm512_add_ps(s_1_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_1_0);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      q_0 = s_1_1;
+                      s_1_1 = _mm512_add_ps(s_1_1, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_1_1);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      s_1_2 = _mm512_add_ps(s_1_2, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_1, Bk_0);
+                      q_0 = s_2_0;
+                      s_2_0 = _mm512_add_ps(s_2_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_2_0);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      q_0 = s_2_1;
+                      s_2_1 = _mm512_add_ps(s_2_1, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_2_1);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      s_2_2 = _mm512_add_ps(s_2_2, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_1, Bk_1);
+                      q_0 = s_3_0;
+                      s_3_0 = _mm512_add_ps(s_3_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_3_0);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      q_0 = s_3_1;
+                      s_3_1 = _mm512_add_ps(s_3_1, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      q_0 = _mm512_sub_ps(q_0, s_3_1);
+                      P_0 = _mm512_add_ps(P_0, q_0);
+                      s_3_2 = _mm512_add_ps(s_3_2, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      Ak_ptr_0 += (K_block - i), Ak_ptr_1 += (K_block - i), Bk_ptr_0 += (K_block - i), Bk_ptr_1 += (K_block - i);
+                    }
+
+                    s_0_0 = _mm512_sub_ps(s_0_0, _mm512_set_ps(priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_0_0);
+                    priC[0][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_0_1 = _mm512_sub_ps(s_0_1, _mm512_set_ps(priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_0_1);
+                    priC[0][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_0_2 = _mm512_sub_ps(s_0_2, _mm512_set_ps(priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_0_2);
+                    priC[0][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_1_0 = _mm512_sub_ps(s_1_0, _mm512_set_ps(priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_1_0);
+                    priC[1][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_1_1 = _mm512_sub_ps(s_1_1, _mm512_set_ps(priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_1_1);
+                    priC[1][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_1_2 = _mm512_sub_ps(s_1_2, _mm512_set_ps(priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_1_2);
+                    priC[1][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_2_0 = _mm512_sub_ps(s_2_0, _mm512_set_ps(priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_2_0);
+                    priC[2][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_2_1 = _mm512_sub_ps(s_2_1, _mm512_set_ps(priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_2_1);
+                    priC[2][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_2_2 = _mm512_sub_ps(s_2_2, _mm512_set_ps(priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_2_2);
+                    priC[2][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_3_0 = _mm512_sub_ps(s_3_0, _mm512_set_ps(priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_3_0);
+                    priC[3][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_3_1 = _mm512_sub_ps(s_3_1, _mm512_set_ps(priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_3_1);
+                    priC[3][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    s_3_2 = _mm512_sub_ps(s_3_2, _mm512_set_ps(priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], 0));
+                    _mm512_store_ps(cons_buffer_tmp, s_3_2);
+                    priC[3][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                  }
+                  break;
+                default:
+                  {
+                    int i, j;
+                    const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+                    const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+                    __m512 Ak_0, Ak_1;
+                    __m512 Bk_0, Bk_1;
+                    __m512 P_0;
+                    __m512 q_0;
+                    __m512 s_0;
+                    __m512 s_buffer[(binned_SBMAXFOLD * 4)];
+
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[j] = _mm512_set1_ps(*(priC[0] + j));
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm512_set1_ps(*(priC[1] + j));
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm512_set1_ps(*(priC[2] + j));
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm512_set1_ps(*(priC[3] + j));
+                    }
+
+                    for(i = 0; i + 16 <= K_block; i += 16, Ak_ptr_0 += 16, Ak_ptr_1 += 16, Bk_ptr_0 += 16, Bk_ptr_1 += 16){
+                      Ak_0 = _mm512_loadu_ps(Ak_ptr_0);
+                      Ak_1 = _mm512_loadu_ps(Ak_ptr_1);
+                      Bk_0 = _mm512_loadu_ps(Bk_ptr_0);
+                      Bk_1 = _mm512_loadu_ps(Bk_ptr_1);
+                      P_0 = _mm512_mul_ps(Ak_0, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[j];
+                        q_0 = _mm512_add_ps(s_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                        s_buffer[j] = q_0;
+                        q_0 = _mm512_sub_ps(s_0, q_0);
+                        P_0 = _mm512_add_ps(P_0, q_0);
+                      }
+                      s_buffer[j] = _mm512_add_ps(s_buffer[j], _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_0, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[(binned_SBMAXFOLD + j)];
+                        q_0 = _mm512_add_ps(s_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                        s_buffer[(binned_SBMAXFOLD + j)] = q_0;
+                        q_0 = _mm512_sub_ps(s_0, q_0);
+                        P_0 = _mm512_add_ps(P_0, q_0);
+                      }
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm512_add_ps(s_buffer[(binned_SBMAXFOLD + j)], _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_1, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 2) + j)];
+                        q_0 = _mm512_add_ps(s_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                        s_buffer[((binned_SBMAXFOLD * 2) + j)] = q_0;
+                        q_0 = _mm512_sub_ps(s_0, q_0);
+                        P_0 = _mm512_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm512_add_ps(s_buffer[((binned_SBMAXFOLD * 2) + j)], _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_1, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 3) + j)];
+                        q_0 = _mm512_add_ps(s_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                        s_buffer[((binned_SBMAXFOLD * 3) + j)] = q_0;
+                        q_0 = _mm512_sub_ps(s_0, q_0);
+                        P_0 = _mm512_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm512_add_ps(s_buffer[((binned_SBMAXFOLD * 3) + j)], _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                    }
+                    if(i < K_block){
+                      Ak_0 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Ak_ptr_0);
+                      Ak_1 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Ak_ptr_1);
+                      Bk_0 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Bk_ptr_0);
+                      Bk_1 = _mm512_maskz_loadu_ps((__mmask16)((1U << (K_block - i)) - 1), Bk_ptr_1);
+                      P_0 = _mm512_mul_ps(Ak_0, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[j];
+                        q_0 = _mm512_add_ps(s_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                        s_buffer[j] = q_0;
+                        q_0 = _mm512_sub_ps(s_0, q_0);
+                        P_0 = _mm512_add_ps(P_0, q_0);
+                      }
+                      s_buffer[j] = _mm512_add_ps(s_buffer[j], _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_0, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[(binned_SBMAXFOLD + j)];
+                        q_0 = _mm512_add_ps(s_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                        s_buffer[(binned_SBMAXFOLD + j)] = q_0;
+                        q_0 = _mm512_sub_ps(s_0, q_0);
+                        P_0 = _mm512_add_ps(P_0, q_0);
+                      }
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm512_add_ps(s_buffer[(binned_SBMAXFOLD + j)], _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_1, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 2) + j)];
+                        q_0 = _mm512_add_ps(s_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                        s_buffer[((binned_SBMAXFOLD * 2) + j)] = q_0;
+                        q_0 = _mm512_sub_ps(s_0, q_0);
+                        P_0 = _mm512_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm512_add_ps(s_buffer[((binned_SBMAXFOLD * 2) + j)], _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      P_0 = _mm512_mul_ps(Ak_1, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 3) + j)];
+                        q_0 = _mm512_add_ps(s_0, _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                        s_buffer[((binned_SBMAXFOLD * 3) + j)] = q_0;
+                        q_0 = _mm512_sub_ps(s_0, q_0);
+                        P_0 = _mm512_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm512_add_ps(s_buffer[((binned_SBMAXFOLD * 3) + j)], _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(P_0), blp_mask_tmp)));
+                      Ak_ptr_0 += (K_block - i), Ak_ptr_1 += (K_block - i), Bk_ptr_0 += (K_block - i), Bk_ptr_1 += (K_block - i);
+                    }
+
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[j] = _mm512_sub_ps(s_buffer[j], _mm512_set_ps(priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], 0));
+                      _mm512_store_ps(cons_buffer_tmp, s_buffer[j]);
+                      priC[0][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm512_sub_ps(s_buffer[(binned_SBMAXFOLD + j)], _mm512_set_ps(priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], 0));
+                      _mm512_store_ps(cons_buffer_tmp, s_buffer[(binned_SBMAXFOLD + j)]);
+                      priC[1][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm512_sub_ps(s_buffer[((binned_SBMAXFOLD * 2) + j)], _mm512_set_ps(priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], 0));
+                      _mm512_store_ps(cons_buffer_tmp, s_buffer[((binned_SBMAXFOLD * 2) + j)]);
+                      priC[2][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm512_sub_ps(s_buffer[((binned_SBMAXFOLD * 3) + j)], _mm512_set_ps(priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], 0));
+                      _mm512_store_ps(cons_buffer_tmp, s_buffer[((binned_SBMAXFOLD * 3) + j)]);
+                      priC[3][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7] + cons_buffer_tmp[8] + cons_buffer_tmp[9] + cons_buffer_tmp[10] + cons_buffer_tmp[11] + cons_buffer_tmp[12] + cons_buffer_tmp[13] + cons_buffer_tmp[14] + cons_buffer_tmp[15];
+                    }
+                  }
+                  break;
+              }
+
+            #elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+              __m256 blp_mask_tmp;
+              {
+                __m256 tmp;
+                blp_mask_tmp = _mm256_set1_ps(1.0);
+                tmp = _mm256_set1_ps(1.0 + (FLT_EPSILON * 1.0001));
+                blp_mask_tmp = _mm256_xor_ps(blp_mask_tmp, tmp);
+              }
+              __m256 cons_tmp; (void)cons_tmp;
+              float cons_buffer_tmp[8] __attribute__((aligned(32))); (void)cons_buffer_tmp;
+
+
+              switch(fold){
+                case 3:
+                  {
+                    int i;
+                    const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+                    const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+                    __m256 Ak_0, Ak_1;
+                    __m256 Bk_0, Bk_1;
+                    __m256 P_0;
+                    __m256 q_0;
+                    __m256 s_0_0, s_1_0, s_2_0, s_3_0;
+                    __m256 s_0_1, s_1_1, s_2_1, s_3_1;
+                    __m256 s_0_2, s_1_2, s_2_2, s_3_2;
+
+                    s_0_0 = _mm256_broadcast_ss(priC[0]);
+                    s_0_1 = _mm256_broadcast_ss(priC[0] + 1);
+                    s_0_2 = _mm256_broadcast_ss(priC[0] + 2);
+                    s_1_0 = _mm256_broadcast_ss(priC[1]);
+                    s_1_1 = _mm256_broadcast_ss(priC[1] + 1);
+                    s_1_2 = _mm256_broadcast_ss(priC[1] + 2);
+                    s_2_0 = _mm256_broadcast_ss(priC[2]);
+                    s_2_1 = _mm256_broadcast_ss(priC[2] + 1);
+                    s_2_2 = _mm256_broadcast_ss(priC[2] + 2);
+                    s_3_0 = _mm256_broadcast_ss(priC[3]);
+                    s_3_1 = _mm256_broadcast_ss(priC[3] + 1);
+                    s_3_2 = _mm256_broadcast_ss(priC[3] + 2);
+
+                    for(i = 0; i + 8 <= K_block; i += 8, Ak_ptr_0 += 8, Ak_ptr_1 += 8, Bk_ptr_0 += 8, Bk_ptr_1 += 8){
+                      Ak_0 = _mm256_loadu_ps(Ak_ptr_0);
+                      Ak_1 = _mm256_loadu_ps(Ak_ptr_1);
+                      Bk_0 = _mm256_loadu_ps(Bk_ptr_0);
+                      Bk_1 = _mm256_loadu_ps(Bk_ptr_1);
+                      P_0 = _mm256_mul_ps(Ak_0, Bk_0);
+                      q_0 = s_0_0;
+                      s_0_0 = _mm256_add_ps(s_0_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_0_0);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      q_0 = s_0_1;
+                      s_0_1 = _mm256_add_ps(s_0_1, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_0_1);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      s_0_2 = _mm256_add_ps(s_0_2, _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_0, Bk_1);
+                      q_0 = s_1_0;
+                      s_1_0 = _mm256_add_ps(s_1_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_1_0);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      q_0 = s_1_1;
+                      s_1_1 = _mm256_add_ps(s_1_1, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_1_1);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      s_1_2 = _mm256_add_ps(s_1_2, _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_1, Bk_0);
+                      q_0 = s_2_0;
+                      s_2_0 = _mm256_add_ps(s_2_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_2_0);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      q_0 = s_2_1;
+                      s_2_1 = _mm256_add_ps(s_2_1, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_2_1);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      s_2_2 = _mm256_add_ps(s_2_2, _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_1, Bk_1);
+                      q_0 = s_3_0;
+                      s_3_0 = _mm256_add_ps(s_3_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_3_0);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      q_0 = s_3_1;
+                      s_3_1 = _mm256_add_ps(s_3_1, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_3_1);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      s_3_2 = _mm256_add_ps(s_3_2, _mm256_or_ps(P_0, blp_mask_tmp));
+                    }
+                    if(i < K_block){
+                      Ak_0 = _mm256_set_ps(0, (K_block - i)>6?Ak_ptr_0[6]:0, (K_block - i)>5?Ak_ptr_0[5]:0, (K_block - i)>4?Ak_ptr_0[4]:0, (K_block - i)>3?Ak_ptr_0[3]:0, (K_block - i)>2?Ak_ptr_0[2]:0, (K_block - i)>1?Ak_ptr_0[1]:0, Ak_ptr_0[0]);
+                      Ak_1 = _mm256_set_ps(0, (K_block - i)>6?Ak_ptr_1[6]:0, (K_block - i)>5?Ak_ptr_1[5]:0, (K_block - i)>4?Ak_ptr_1[4]:0, (K_block - i)>3?Ak_ptr_1[3]:0, (K_block - i)>2?Ak_ptr_1[2]:0, (K_block - i)>1?Ak_ptr_1[1]:0, Ak_ptr_1[0]);
+                      Bk_0 = _mm256_set_ps(0, (K_block - i)>6?Bk_ptr_0[6]:0, (K_block - i)>5?Bk_ptr_0[5]:0, (K_block - i)>4?Bk_ptr_0[4]:0, (K_block - i)>3?Bk_ptr_0[3]:0, (K_block - i)>2?Bk_ptr_0[2]:0, (K_block - i)>1?Bk_ptr_0[1]:0, Bk_ptr_0[0]);
+                      Bk_1 = _mm256_set_ps(0, (K_block - i)>6?Bk_ptr_1[6]:0, (K_block - i)>5?Bk_ptr_1[5]:0, (K_block - i)>4?Bk_ptr_1[4]:0, (K_block - i)>3?Bk_ptr_1[3]:0, (K_block - i)>2?Bk_ptr_1[2]:0, (K_block - i)>1?Bk_ptr_1[1]:0, Bk_ptr_1[0]);
+                      P_0 = _mm256_mul_ps(Ak_0, Bk_0);
+                      q_0 = s_0_0;
+                      s_0_0 = _mm256_add_ps(s_0_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_0_0);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      q_0 = s_0_1;
+                      s_0_1 = _mm256_add_ps(s_0_1, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_0_1);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      s_0_2 = _mm256_add_ps(s_0_2, _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_0, Bk_1);
+                      q_0 = s_1_0;
+                      s_1_0 = _mm256_add_ps(s_1_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_1_0);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      q_0 = s_1_1;
+                      s_1_1 = _mm256_add_ps(s_1_1, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_1_1);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      s_1_2 = _mm256_add_ps(s_1_2, _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_1, Bk_0);
+                      q_0 = s_2_0;
+                      s_2_0 = _mm256_add_ps(s_2_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_2_0);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      q_0 = s_2_1;
+                      s_2_1 = _mm256_add_ps(s_2_1, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_2_1);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      s_2_2 = _mm256_add_ps(s_2_2, _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_1, Bk_1);
+                      q_0 = s_3_0;
+                      s_3_0 = _mm256_add_ps(s_3_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_3_0);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      q_0 = s_3_1;
+                      s_3_1 = _mm256_add_ps(s_3_1, _mm256_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm256_sub_ps(q_0, s_3_1);
+                      P_0 = _mm256_add_ps(P_0, q_0);
+                      s_3_2 = _mm256_add_ps(s_3_2, _mm256_or_ps(P_0, blp_mask_tmp));
+                      Ak_ptr_0 += (K_block - i), Ak_ptr_1 += (K_block - i), Bk_ptr_0 += (K_block - i), Bk_ptr_1 += (K_block - i);
+                    }
+
+                    s_0_0 = _mm256_sub_ps(s_0_0, _mm256_set_ps(priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], priC[0][0], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_0_0);
+                    priC[0][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_0_1 = _mm256_sub_ps(s_0_1, _mm256_set_ps(priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], priC[0][1], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_0_1);
+                    priC[0][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_0_2 = _mm256_sub_ps(s_0_2, _mm256_set_ps(priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], priC[0][2], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_0_2);
+                    priC[0][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_1_0 = _mm256_sub_ps(s_1_0, _mm256_set_ps(priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], priC[1][0], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_1_0);
+                    priC[1][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_1_1 = _mm256_sub_ps(s_1_1, _mm256_set_ps(priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], priC[1][1], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_1_1);
+                    priC[1][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_1_2 = _mm256_sub_ps(s_1_2, _mm256_set_ps(priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], priC[1][2], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_1_2);
+                    priC[1][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_2_0 = _mm256_sub_ps(s_2_0, _mm256_set_ps(priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], priC[2][0], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_2_0);
+                    priC[2][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_2_1 = _mm256_sub_ps(s_2_1, _mm256_set_ps(priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], priC[2][1], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_2_1);
+                    priC[2][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_2_2 = _mm256_sub_ps(s_2_2, _mm256_set_ps(priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], priC[2][2], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_2_2);
+                    priC[2][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_3_0 = _mm256_sub_ps(s_3_0, _mm256_set_ps(priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], priC[3][0], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_3_0);
+                    priC[3][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_3_1 = _mm256_sub_ps(s_3_1, _mm256_set_ps(priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], priC[3][1], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_3_1);
+                    priC[3][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    s_3_2 = _mm256_sub_ps(s_3_2, _mm256_set_ps(priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], priC[3][2], 0));
+                    _mm256_store_ps(cons_buffer_tmp, s_3_2);
+                    priC[3][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                  }
+                  break;
+                default:
+                  {
+                    int i, j;
+                    const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+                    const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+                    __m256 Ak_0, Ak_1;
+                    __m256 Bk_0, Bk_1;
+                    __m256 P_0;
+                    __m256 q_0;
+                    __m256 s_0;
+                    __m256 s_buffer[(binned_SBMAXFOLD * 4)];
+
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[j] = _mm256_broadcast_ss(priC[0] + j);
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm256_broadcast_ss(priC[1] + j);
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm256_broadcast_ss(priC[2] + j);
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm256_broadcast_ss(priC[3] + j);
+                    }
+
+                    for(i = 0; i + 8 <= K_block; i += 8, Ak_ptr_0 += 8, Ak_ptr_1 += 8, Bk_ptr_0 += 8, Bk_ptr_1 += 8){
+                      Ak_0 = _mm256_loadu_ps(Ak_ptr_0);
+                      Ak_1 = _mm256_loadu_ps(Ak_ptr_1);
+                      Bk_0 = _mm256_loadu_ps(Bk_ptr_0);
+                      Bk_1 = _mm256_loadu_ps(Bk_ptr_1);
+                      P_0 = _mm256_mul_ps(Ak_0, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[j];
+                        q_0 = _mm256_add_ps(s_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[j] = q_0;
+                        q_0 = _mm256_sub_ps(s_0, q_0);
+                        P_0 = _mm256_add_ps(P_0, q_0);
+                      }
+                      s_buffer[j] = _mm256_add_ps(s_buffer[j], _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_0, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[(binned_SBMAXFOLD + j)];
+                        q_0 = _mm256_add_ps(s_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[(binned_SBMAXFOLD + j)] = q_0;
+                        q_0 = _mm256_sub_ps(s_0, q_0);
+                        P_0 = _mm256_add_ps(P_0, q_0);
+                      }
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm256_add_ps(s_buffer[(binned_SBMAXFOLD + j)], _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_1, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 2) + j)];
+                        q_0 = _mm256_add_ps(s_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[((binned_SBMAXFOLD * 2) + j)] = q_0;
+                        q_0 = _mm256_sub_ps(s_0, q_0);
+                        P_0 = _mm256_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm256_add_ps(s_buffer[((binned_SBMAXFOLD * 2) + j)], _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_1, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 3) + j)];
+                        q_0 = _mm256_add_ps(s_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[((binned_SBMAXFOLD * 3) + j)] = q_0;
+                        q_0 = _mm256_sub_ps(s_0, q_0);
+                        P_0 = _mm256_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm256_add_ps(s_buffer[((binned_SBMAXFOLD * 3) + j)], _mm256_or_ps(P_0, blp_mask_tmp));
+                    }
+                    if(i < K_block){
+                      Ak_0 = _mm256_set_ps(0, (K_block - i)>6?Ak_ptr_0[6]:0, (K_block - i)>5?Ak_ptr_0[5]:0, (K_block - i)>4?Ak_ptr_0[4]:0, (K_block - i)>3?Ak_ptr_0[3]:0, (K_block - i)>2?Ak_ptr_0[2]:0, (K_block - i)>1?Ak_ptr_0[1]:0, Ak_ptr_0[0]);
+                      Ak_1 = _mm256_set_ps(0, (K_block - i)>6?Ak_ptr_1[6]:0, (K_block - i)>5?Ak_ptr_1[5]:0, (K_block - i)>4?Ak_ptr_1[4]:0, (K_block - i)>3?Ak_ptr_1[3]:0, (K_block - i)>2?Ak_ptr_1[2]:0, (K_block - i)>1?Ak_ptr_1[1]:0, Ak_ptr_1[0]);
+                      Bk_0 = _mm256_set_ps(0, (K_block - i)>6?Bk_ptr_0[6]:0, (K_block - i)>5?Bk_ptr_0[5]:0, (K_block - i)>4?Bk_ptr_0[4]:0, (K_block - i)>3?Bk_ptr_0[3]:0, (K_block - i)>2?Bk_ptr_0[2]:0, (K_block - i)>1?Bk_ptr_0[1]:0, Bk_ptr_0[0]);
+                      Bk_1 = _mm256_set_ps(0, (K_block - i)>6?Bk_ptr_1[6]:0, (K_block - i)>5?Bk_ptr_1[5]:0, (K_block - i)>4?Bk_ptr_1[4]:0, (K_block - i)>3?Bk_ptr_1[3]:0, (K_block - i)>2?Bk_ptr_1[2]:0, (K_block - i)>1?Bk_ptr_1[1]:0, Bk_ptr_1[0]);
+                      P_0 = _mm256_mul_ps(Ak_0, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[j];
+                        q_0 = _mm256_add_ps(s_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[j] = q_0;
+                        q_0 = _mm256_sub_ps(s_0, q_0);
+                        P_0 = _mm256_add_ps(P_0, q_0);
+                      }
+                      s_buffer[j] = _mm256_add_ps(s_buffer[j], _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_0, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[(binned_SBMAXFOLD + j)];
+                        q_0 = _mm256_add_ps(s_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[(binned_SBMAXFOLD + j)] = q_0;
+                        q_0 = _mm256_sub_ps(s_0, q_0);
+                        P_0 = _mm256_add_ps(P_0, q_0);
+                      }
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm256_add_ps(s_buffer[(binned_SBMAXFOLD + j)], _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_1, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 2) + j)];
+                        q_0 = _mm256_add_ps(s_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[((binned_SBMAXFOLD * 2) + j)] = q_0;
+                        q_0 = _mm256_sub_ps(s_0, q_0);
+                        P_0 = _mm256_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm256_add_ps(s_buffer[((binned_SBMAXFOLD * 2) + j)], _mm256_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm256_mul_ps(Ak_1, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 3) + j)];
+                        q_0 = _mm256_add_ps(s_0, _mm256_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[((binned_SBMAXFOLD * 3) + j)] = q_0;
+                        q_0 = _mm256_sub_ps(s_0, q_0);
+                        P_0 = _mm256_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm256_add_ps(s_buffer[((binned_SBMAXFOLD * 3) + j)], _mm256_or_ps(P_0, blp_mask_tmp));
+                      Ak_ptr_0 += (K_block - i), Ak_ptr_1 += (K_block - i), Bk_ptr_0 += (K_block - i), Bk_ptr_1 += (K_block - i);
+                    }
+
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[j] = _mm256_sub_ps(s_buffer[j], _mm256_set_ps(priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], priC[0][j], 0));
+                      _mm256_store_ps(cons_buffer_tmp, s_buffer[j]);
+                      priC[0][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm256_sub_ps(s_buffer[(binned_SBMAXFOLD + j)], _mm256_set_ps(priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], priC[1][j], 0));
+                      _mm256_store_ps(cons_buffer_tmp, s_buffer[(binned_SBMAXFOLD + j)]);
+                      priC[1][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm256_sub_ps(s_buffer[((binned_SBMAXFOLD * 2) + j)], _mm256_set_ps(priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], priC[2][j], 0));
+                      _mm256_store_ps(cons_buffer_tmp, s_buffer[((binned_SBMAXFOLD * 2) + j)]);
+                      priC[2][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm256_sub_ps(s_buffer[((binned_SBMAXFOLD * 3) + j)], _mm256_set_ps(priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], priC[3][j], 0));
+                      _mm256_store_ps(cons_buffer_tmp, s_buffer[((binned_SBMAXFOLD * 3) + j)]);
+                      priC[3][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3] + cons_buffer_tmp[4] + cons_buffer_tmp[5] + cons_buffer_tmp[6] + cons_buffer_tmp[7];
+                    }
+                  }
+                  break;
+              }
+
+            #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+              __m128 blp_mask_tmp;
+              {
+                __m128 tmp;
+                blp_mask_tmp = _mm_set1_ps(1.0);
+                tmp = _mm_set1_ps(1.0 + (FLT_EPSILON * 1.0001));
+                blp_mask_tmp = _mm_xor_ps(blp_mask_tmp, tmp);
+              }
+              __m128 cons_tmp; (void)cons_tmp;
+              float cons_buffer_tmp[4] __attribute__((aligned(16))); (void)cons_buffer_tmp;
+
+
+              switch(fold){
+                case 3:
+                  {
+                    int i;
+                    const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+                    const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+                    __m128 Ak_0, Ak_1;
+                    __m128 Bk_0, Bk_1;
+                    __m128 P_0;
+                    __m128 q_0;
+                    __m128 s_0_0, s_1_0, s_2_0, s_3_0;
+                    __m128 s_0_1, s_1_1, s_2_1, s_3_1;
+                    __m128 s_0_2, s_1_2, s_2_2, s_3_2;
+
+                    s_0_0 = _mm_load1_ps(priC[0]);
+                    s_0_1 = _mm_load1_ps(priC[0] + 1);
+                    s_0_2 = _mm_load1_ps(priC[0] + 2);
+                    s_1_0 = _mm_load1_ps(priC[1]);
+                    s_1_1 = _mm_load1_ps(priC[1] + 1);
+                    s_1_2 = _mm_load1_ps(priC[1] + 2);
+                    s_2_0 = _mm_load1_ps(priC[2]);
+                    s_2_1 = _mm_load1_ps(priC[2] + 1);
+                    s_2_2 = _mm_load1_ps(priC[2] + 2);
+                    s_3_0 = _mm_load1_ps(priC[3]);
+                    s_3_1 = _mm_load1_ps(priC[3] + 1);
+                    s_3_2 = _mm_load1_ps(priC[3] + 2);
+
+                    for(i = 0; i + 4 <= K_block; i += 4, Ak_ptr_0 += 4, Ak_ptr_1 += 4, Bk_ptr_0 += 4, Bk_ptr_1 += 4){
+                      Ak_0 = _mm_loadu_ps(Ak_ptr_0);
+                      Ak_1 = _mm_loadu_ps(Ak_ptr_1);
+                      Bk_0 = _mm_loadu_ps(Bk_ptr_0);
+                      Bk_1 = _mm_loadu_ps(Bk_ptr_1);
+                      P_0 = _mm_mul_ps(Ak_0, Bk_0);
+                      q_0 = s_0_0;
+                      s_0_0 = _mm_add_ps(s_0_0, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_0_0);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      q_0 = s_0_1;
+                      s_0_1 = _mm_add_ps(s_0_1, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_0_1);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      s_0_2 = _mm_add_ps(s_0_2, _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_0, Bk_1);
+                      q_0 = s_1_0;
+                      s_1_0 = _mm_add_ps(s_1_0, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_1_0);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      q_0 = s_1_1;
+                      s_1_1 = _mm_add_ps(s_1_1, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_1_1);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      s_1_2 = _mm_add_ps(s_1_2, _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_1, Bk_0);
+                      q_0 = s_2_0;
+                      s_2_0 = _mm_add_ps(s_2_0, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_2_0);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      q_0 = s_2_1;
+                      s_2_1 = _mm_add_ps(s_2_1, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_2_1);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      s_2_2 = _mm_add_ps(s_2_2, _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_1, Bk_1);
+                      q_0 = s_3_0;
+                      s_3_0 = _mm_add_ps(s_3_0, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_3_0);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      q_0 = s_3_1;
+                      s_3_1 = _mm_add_ps(s_3_1, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_3_1);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      s_3_2 = _mm_add_ps(s_3_2, _mm_or_ps(P_0, blp_mask_tmp));
+                    }
+                    if(i < K_block){
+                      Ak_0 = _mm_set_ps(0, (K_block - i)>2?Ak_ptr_0[2]:0, (K_block - i)>1?Ak_ptr_0[1]:0, Ak_ptr_0[0]);
+                      Ak_1 = _mm_set_ps(0, (K_block - i)>2?Ak_ptr_1[2]:0, (K_block - i)>1?Ak_ptr_1[1]:0, Ak_ptr_1[0]);
+                      Bk_0 = _mm_set_ps(0, (K_block - i)>2?Bk_ptr_0[2]:0, (K_block - i)>1?Bk_ptr_0[1]:0, Bk_ptr_0[0]);
+                      Bk_1 = _mm_set_ps(0, (K_block - i)>2?Bk_ptr_1[2]:0, (K_block - i)>1?Bk_ptr_1[1]:0, Bk_ptr_1[0]);
+                      P_0 = _mm_mul_ps(Ak_0, Bk_0);
+                      q_0 = s_0_0;
+                      s_0_0 = _mm_add_ps(s_0_0, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_0_0);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      q_0 = s_0_1;
+                      s_0_1 = _mm_add_ps(s_0_1, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_0_1);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      s_0_2 = _mm_add_ps(s_0_2, _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_0, Bk_1);
+                      q_0 = s_1_0;
+                      s_1_0 = _mm_add_ps(s_1_0, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_1_0);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      q_0 = s_1_1;
+                      s_1_1 = _mm_add_ps(s_1_1, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_1_1);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      s_1_2 = _mm_add_ps(s_1_2, _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_1, Bk_0);
+                      q_0 = s_2_0;
+                      s_2_0 = _mm_add_ps(s_2_0, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_2_0);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      q_0 = s_2_1;
+                      s_2_1 = _mm_add_ps(s_2_1, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_2_1);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      s_2_2 = _mm_add_ps(s_2_2, _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_1, Bk_1);
+                      q_0 = s_3_0;
+                      s_3_0 = _mm_add_ps(s_3_0, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_3_0);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      q_0 = s_3_1;
+                      s_3_1 = _mm_add_ps(s_3_1, _mm_or_ps(P_0, blp_mask_tmp));
+                      q_0 = _mm_sub_ps(q_0, s_3_1);
+                      P_0 = _mm_add_ps(P_0, q_0);
+                      s_3_2 = _mm_add_ps(s_3_2, _mm_or_ps(P_0, blp_mask_tmp));
+                      Ak_ptr_0 += (K_block - i), Ak_ptr_1 += (K_block - i), Bk_ptr_0 += (K_block - i), Bk_ptr_1 += (K_block - i);
+                    }
+
+                    s_0_0 = _mm_sub_ps(s_0_0, _mm_set_ps(priC[0][0], priC[0][0], priC[0][0], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_0_0);
+                    priC[0][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_0_1 = _mm_sub_ps(s_0_1, _mm_set_ps(priC[0][1], priC[0][1], priC[0][1], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_0_1);
+                    priC[0][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_0_2 = _mm_sub_ps(s_0_2, _mm_set_ps(priC[0][2], priC[0][2], priC[0][2], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_0_2);
+                    priC[0][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_1_0 = _mm_sub_ps(s_1_0, _mm_set_ps(priC[1][0], priC[1][0], priC[1][0], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_1_0);
+                    priC[1][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_1_1 = _mm_sub_ps(s_1_1, _mm_set_ps(priC[1][1], priC[1][1], priC[1][1], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_1_1);
+                    priC[1][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_1_2 = _mm_sub_ps(s_1_2, _mm_set_ps(priC[1][2], priC[1][2], priC[1][2], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_1_2);
+                    priC[1][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_2_0 = _mm_sub_ps(s_2_0, _mm_set_ps(priC[2][0], priC[2][0], priC[2][0], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_2_0);
+                    priC[2][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_2_1 = _mm_sub_ps(s_2_1, _mm_set_ps(priC[2][1], priC[2][1], priC[2][1], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_2_1);
+                    priC[2][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_2_2 = _mm_sub_ps(s_2_2, _mm_set_ps(priC[2][2], priC[2][2], priC[2][2], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_2_2);
+                    priC[2][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_3_0 = _mm_sub_ps(s_3_0, _mm_set_ps(priC[3][0], priC[3][0], priC[3][0], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_3_0);
+                    priC[3][0] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_3_1 = _mm_sub_ps(s_3_1, _mm_set_ps(priC[3][1], priC[3][1], priC[3][1], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_3_1);
+                    priC[3][1] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    s_3_2 = _mm_sub_ps(s_3_2, _mm_set_ps(priC[3][2], priC[3][2], priC[3][2], 0));
+                    _mm_store_ps(cons_buffer_tmp, s_3_2);
+                    priC[3][2] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                  }
+                  break;
+                default:
+                  {
+                    int i, j;
+                    const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+                    const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+                    __m128 Ak_0, Ak_1;
+                    __m128 Bk_0, Bk_1;
+                    __m128 P_0;
+                    __m128 q_0;
+                    __m128 s_0;
+                    __m128 s_buffer[(binned_SBMAXFOLD * 4)];
+
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[j] = _mm_load1_ps(priC[0] + j);
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm_load1_ps(priC[1] + j);
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm_load1_ps(priC[2] + j);
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm_load1_ps(priC[3] + j);
+                    }
+
+                    for(i = 0; i + 4 <= K_block; i += 4, Ak_ptr_0 += 4, Ak_ptr_1 += 4, Bk_ptr_0 += 4, Bk_ptr_1 += 4){
+                      Ak_0 = _mm_loadu_ps(Ak_ptr_0);
+                      Ak_1 = _mm_loadu_ps(Ak_ptr_1);
+                      Bk_0 = _mm_loadu_ps(Bk_ptr_0);
+                      Bk_1 = _mm_loadu_ps(Bk_ptr_1);
+                      P_0 = _mm_mul_ps(Ak_0, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[j];
+                        q_0 = _mm_add_ps(s_0, _mm_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[j] = q_0;
+                        q_0 = _mm_sub_ps(s_0, q_0);
+                        P_0 = _mm_add_ps(P_0, q_0);
+                      }
+                      s_buffer[j] = _mm_add_ps(s_buffer[j], _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_0, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[(binned_SBMAXFOLD + j)];
+                        q_0 = _mm_add_ps(s_0, _mm_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[(binned_SBMAXFOLD + j)] = q_0;
+                        q_0 = _mm_sub_ps(s_0, q_0);
+                        P_0 = _mm_add_ps(P_0, q_0);
+                      }
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm_add_ps(s_buffer[(binned_SBMAXFOLD + j)], _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_1, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 2) + j)];
+                        q_0 = _mm_add_ps(s_0, _mm_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[((binned_SBMAXFOLD * 2) + j)] = q_0;
+                        q_0 = _mm_sub_ps(s_0, q_0);
+                        P_0 = _mm_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm_add_ps(s_buffer[((binned_SBMAXFOLD * 2) + j)], _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_1, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 3) + j)];
+                        q_0 = _mm_add_ps(s_0, _mm_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[((binned_SBMAXFOLD * 3) + j)] = q_0;
+                        q_0 = _mm_sub_ps(s_0, q_0);
+                        P_0 = _mm_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm_add_ps(s_buffer[((binned_SBMAXFOLD * 3) + j)], _mm_or_ps(P_0, blp_mask_tmp));
+                    }
+                    if(i < K_block){
+                      Ak_0 = _mm_set_ps(0, (K_block - i)>2?Ak_ptr_0[2]:0, (K_block - i)>1?Ak_ptr_0[1]:0, Ak_ptr_0[0]);
+                      Ak_1 = _mm_set_ps(0, (K_block - i)>2?Ak_ptr_1[2]:0, (K_block - i)>1?Ak_ptr_1[1]:0, Ak_ptr_1[0]);
+                      Bk_0 = _mm_set_ps(0, (K_block - i)>2?Bk_ptr_0[2]:0, (K_block - i)>1?Bk_ptr_0[1]:0, Bk_ptr_0[0]);
+                      Bk_1 = _mm_set_ps(0, (K_block - i)>2?Bk_ptr_1[2]:0, (K_block - i)>1?Bk_ptr_1[1]:0, Bk_ptr_1[0]);
+                      P_0 = _mm_mul_ps(Ak_0, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[j];
+                        q_0 = _mm_add_ps(s_0, _mm_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[j] = q_0;
+                        q_0 = _mm_sub_ps(s_0, q_0);
+                        P_0 = _mm_add_ps(P_0, q_0);
+                      }
+                      s_buffer[j] = _mm_add_ps(s_buffer[j], _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_0, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[(binned_SBMAXFOLD + j)];
+                        q_0 = _mm_add_ps(s_0, _mm_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[(binned_SBMAXFOLD + j)] = q_0;
+                        q_0 = _mm_sub_ps(s_0, q_0);
+                        P_0 = _mm_add_ps(P_0, q_0);
+                      }
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm_add_ps(s_buffer[(binned_SBMAXFOLD + j)], _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_1, Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 2) + j)];
+                        q_0 = _mm_add_ps(s_0, _mm_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[((binned_SBMAXFOLD * 2) + j)] = q_0;
+                        q_0 = _mm_sub_ps(s_0, q_0);
+                        P_0 = _mm_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm_add_ps(s_buffer[((binned_SBMAXFOLD * 2) + j)], _mm_or_ps(P_0, blp_mask_tmp));
+                      P_0 = _mm_mul_ps(Ak_1, Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 3) + j)];
+                        q_0 = _mm_add_ps(s_0, _mm_or_ps(P_0, blp_mask_tmp));
+                        s_buffer[((binned_SBMAXFOLD * 3) + j)] = q_0;
+                        q_0 = _mm_sub_ps(s_0, q_0);
+                        P_0 = _mm_add_ps(P_0, q_0);
+                      }
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm_add_ps(s_buffer[((binned_SBMAXFOLD * 3) + j)], _mm_or_ps(P_0, blp_mask_tmp));
+                      Ak_ptr_0 += (K_block - i), Ak_ptr_1 += (K_block - i), Bk_ptr_0 += (K_block - i), Bk_ptr_1 += (K_block - i);
+                    }
+
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[j] = _mm_sub_ps(s_buffer[j], _mm_set_ps(priC[0][j], priC[0][j], priC[0][j], 0));
+                      _mm_store_ps(cons_buffer_tmp, s_buffer[j]);
+                      priC[0][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[(binned_SBMAXFOLD + j)] = _mm_sub_ps(s_buffer[(binned_SBMAXFOLD + j)], _mm_set_ps(priC[1][j], priC[1][j], priC[1][j], 0));
+                      _mm_store_ps(cons_buffer_tmp, s_buffer[(binned_SBMAXFOLD + j)]);
+                      priC[1][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = _mm_sub_ps(s_buffer[((binned_SBMAXFOLD * 2) + j)], _mm_set_ps(priC[2][j], priC[2][j], priC[2][j], 0));
+                      _mm_store_ps(cons_buffer_tmp, s_buffer[((binned_SBMAXFOLD * 2) + j)]);
+                      priC[2][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = _mm_sub_ps(s_buffer[((binned_SBMAXFOLD * 3) + j)], _mm_set_ps(priC[3][j], priC[3][j], priC[3][j], 0));
+                      _mm_store_ps(cons_buffer_tmp, s_buffer[((binned_SBMAXFOLD * 3) + j)]);
+                      priC[3][j] = cons_buffer_tmp[0] + cons_buffer_tmp[1] + cons_buffer_tmp[2] + cons_buffer_tmp[3];
+                    }
+                  }
+                  break;
+              }
+
+            #else
+              int_float blp_tmp; (void)blp_tmp;
+              float cons_tmp; (void)cons_tmp;
+
+
+              switch(fold){
+                case 3:
+                  {
+                    int i;
+                    const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+                    const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+                    float Ak_0, Ak_1;
+                    float Bk_0, Bk_1;
+                    float P_0;
+                    float q_0;
+                    float s_0_0, s_1_0, s_2_0, s_3_0;
+                    float s_0_1, s_1_1, s_2_1, s_3_1;
+                    float s_0_2, s_1_2, s_2_2, s_3_2;
+
+                    s_0_0 = priC[0][0];
+                    s_0_1 = priC[0][1];
+                    s_0_2 = priC[0][2];
+                    s_1_0 = priC[1][0];
+                    s_1_1 = priC[1][1];
+                    s_1_2 = priC[1][2];
+                    s_2_0 = priC[2][0];
+                    s_2_1 = priC[2][1];
+                    s_2_2 = priC[2][2];
+                    s_3_0 = priC[3][0];
+                    s_3_1 = priC[3][1];
+                    s_3_2 = priC[3][2];
+
+                    for(i = 0; i + 1 <= K_block; i += 1, Ak_ptr_0 += 1, Ak_ptr_1 += 1, Bk_ptr_0 += 1, Bk_ptr_1 += 1){
+                      Ak_0 = Ak_ptr_0[0];
+                      Ak_1 = Ak_ptr_1[0];
+                      Bk_0 = Bk_ptr_0[0];
+                      Bk_1 = Bk_ptr_1[0];
+                      P_0 = (Ak_0 * Bk_0);
+                      q_0 = s_0_0;
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_0_0 = s_0_0 + blp_tmp.f;
+                      q_0 = (q_0 - s_0_0);
+                      P_0 = (P_0 + q_0);
+                      q_0 = s_0_1;
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_0_1 = s_0_1 + blp_tmp.f;
+                      q_0 = (q_0 - s_0_1);
+                      P_0 = (P_0 + q_0);
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_0_2 = s_0_2 + blp_tmp.f;
+                      P_0 = (Ak_0 * Bk_1);
+                      q_0 = s_1_0;
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_1_0 = s_1_0 + blp_tmp.f;
+                      q_0 = (q_0 - s_1_0);
+                      P_0 = (P_0 + q_0);
+                      q_0 = s_1_1;
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_1_1 = s_1_1 + blp_tmp.f;
+                      q_0 = (q_0 - s_1_1);
+                      P_0 = (P_0 + q_0);
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_1_2 = s_1_2 + blp_tmp.f;
+                      P_0 = (Ak_1 * Bk_0);
+                      q_0 = s_2_0;
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_2_0 = s_2_0 + blp_tmp.f;
+                      q_0 = (q_0 - s_2_0);
+                      P_0 = (P_0 + q_0);
+                      q_0 = s_2_1;
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_2_1 = s_2_1 + blp_tmp.f;
+                      q_0 = (q_0 - s_2_1);
+                      P_0 = (P_0 + q_0);
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_2_2 = s_2_2 + blp_tmp.f;
+                      P_0 = (Ak_1 * Bk_1);
+                      q_0 = s_3_0;
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_3_0 = s_3_0 + blp_tmp.f;
+                      q_0 = (q_0 - s_3_0);
+                      P_0 = (P_0 + q_0);
+                      q_0 = s_3_1;
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_3_1 = s_3_1 + blp_tmp.f;
+                      q_0 = (q_0 - s_3_1);
+                      P_0 = (P_0 + q_0);
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_3_2 = s_3_2 + blp_tmp.f;
+                    }
+
+                    priC[0][0] = s_0_0;
+                    priC[0][1] = s_0_1;
+                    priC[0][2] = s_0_2;
+                    priC[1][0] = s_1_0;
+                    priC[1][1] = s_1_1;
+                    priC[1][2] = s_1_2;
+                    priC[2][0] = s_2_0;
+                    priC[2][1] = s_2_1;
+                    priC[2][2] = s_2_2;
+                    priC[3][0] = s_3_0;
+                    priC[3][1] = s_3_1;
+                    priC[3][2] = s_3_2;
+                  }
+                  break;
+                default:
+                  {
+                    int i, j;
+                    const float *Ak_ptr_0 = Ak, *Ak_ptr_1 = Ak + lda;
+                    const float *Bk_ptr_0 = Bk, *Bk_ptr_1 = Bk + ldb;
+                    float Ak_0, Ak_1;
+                    float Bk_0, Bk_1;
+                    float P_0;
+                    float q_0;
+                    float s_0;
+                    float s_buffer[(binned_SBMAXFOLD * 4)];
+
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[j] = priC[0][j];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[(binned_SBMAXFOLD + j)] = priC[1][j];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = priC[2][j];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = priC[3][j];
+                    }
+
+                    for(i = 0; i + 1 <= K_block; i += 1, Ak_ptr_0 += 1, Ak_ptr_1 += 1, Bk_ptr_0 += 1, Bk_ptr_1 += 1){
+                      Ak_0 = Ak_ptr_0[0];
+                      Ak_1 = Ak_ptr_1[0];
+                      Bk_0 = Bk_ptr_0[0];
+                      Bk_1 = Bk_ptr_1[0];
+                      P_0 = (Ak_0 * Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[j];
+                        blp_tmp.f = P_0;
+                        blp_tmp.i |= 1;
+                        q_0 = s_0 + blp_tmp.f;
+                        s_buffer[j] = q_0;
+                        q_0 = (s_0 - q_0);
+                        P_0 = (P_0 + q_0);
+                      }
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_buffer[j] = s_buffer[j] + blp_tmp.f;
+                      P_0 = (Ak_0 * Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[(binned_SBMAXFOLD + j)];
+                        blp_tmp.f = P_0;
+                        blp_tmp.i |= 1;
+                        q_0 = s_0 + blp_tmp.f;
+                        s_buffer[(binned_SBMAXFOLD + j)] = q_0;
+                        q_0 = (s_0 - q_0);
+                        P_0 = (P_0 + q_0);
+                      }
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_buffer[(binned_SBMAXFOLD + j)] = s_buffer[(binned_SBMAXFOLD + j)] + blp_tmp.f;
+                      P_0 = (Ak_1 * Bk_0);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 2) + j)];
+                        blp_tmp.f = P_0;
+                        blp_tmp.i |= 1;
+                        q_0 = s_0 + blp_tmp.f;
+                        s_buffer[((binned_SBMAXFOLD * 2) + j)] = q_0;
+                        q_0 = (s_0 - q_0);
+                        P_0 = (P_0 + q_0);
+                      }
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_buffer[((binned_SBMAXFOLD * 2) + j)] = s_buffer[((binned_SBMAXFOLD * 2) + j)] + blp_tmp.f;
+                      P_0 = (Ak_1 * Bk_1);
+                      for(j = 0; j < fold - 1; j++){
+                        s_0 = s_buffer[((binned_SBMAXFOLD * 3) + j)];
+                        blp_tmp.f = P_0;
+                        blp_tmp.i |= 1;
+                        q_0 = s_0 + blp_tmp.f;
+                        s_buffer[((binned_SBMAXFOLD * 3) + j)] = q_0;
+                        q_0 = (s_0 - q_0);
+                        P_0 = (P_0 + q_0);
+                      }
+                      blp_tmp.f = P_0;
+                      blp_tmp.i |= 1;
+                      s_buffer[((binned_SBMAXFOLD * 3) + j)] = s_buffer[((binned_SBMAXFOLD * 3) + j)] + blp_tmp.f;
+                    }
+
+                    for(j = 0; j < fold; j += 1){
+                      priC[0][j] = s_buffer[j];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      priC[1][j] = s_buffer[(binned_SBMAXFOLD + j)];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      priC[2][j] = s_buffer[((binned_SBMAXFOLD * 2) + j)];
+                    }
+                    for(j = 0; j < fold; j += 1){
+                      priC[3][j] = s_buffer[((binned_SBMAXFOLD * 3) + j)];
+                    }
+                  }
+                  break;
+              }
+
+            #endif
+
+          }
+          //[[[end]]]
+          deposits += K_block;
+        }else{
+          //exceptional values and the top bin are handled one element at a time
+          for(ii = 0; ii < MR; ii++){
+            for(jj = 0; jj < NR; jj++){
+              binnedBLAS_smsdot(fold, K_block, Ak + ii * lda, 1, Bk + jj * ldb, 1, priC[ii * NR + jj], 1, priC[ii * NR + jj] + fold, 1);
+            }
+          }
+          deposits = 0;
+        }
+      }
+
+      for(e = 0; e < MR * NR; e++){
+        binned_smrenorm(fold, priC[e], 1, priC[e] + fold, 1);
+      }
+    }
+    for(; j < N; j++){
+      for(ii = i; ii < i + MR; ii++){
+        binnedBLAS_sbsdot(fold, K, A + ii * lda, 1, B + j * ldb, 1, C + (ii * incrowC + j * inccolC) * binned_sbnum(fold));
+      }
+    }
+  }
+  for(; i < M; i++){
+    for(j = 0; j < N; j++){
+      binnedBLAS_sbsdot(fold, K, A + i * lda, 1, B + j * ldb, 1, C + (i * incrowC + j * inccolC) * binned_sbnum(fold));
+    }
+  }
+}
@@ -0,0 +1,992 @@
+#include <stdlib.h>
+#include <limits.h>
+
+#include "../common/common.h"
+#include "binnedBLAS.h"
+
+/*[[[cog
+import cog
+import generate
+import dataTypes
+from src.common import blockSize
+from scripts import terminal
+
+rounded_cache = 2**(int(terminal.get_cache()).bit_length() - 1)
+xy_block = rounded_cache//dataTypes.DoubleComplex.byte_size
+y_block = max(xy_block//256, 1)
+
+cog.out(generate.generate(blockSize.BlockSize("zbzgemm", "Y_BLOCK", 1, y_block, y_block, ["bench_rzgemm_AvgTransA_AvgTransB_fold_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+cog.out(generate.generate(blockSize.BlockSize("zbzgemm", "XY_BLOCK", y_block, xy_block, xy_block, ["bench_rzgemm_AvgTransA_AvgTransB_fold_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+cog.out(generate.generate(blockSize.BlockSize("zbzgemm", "YT_BLOCK", 1, y_block, y_block, ["bench_rzgemm_AvgTransA_AvgTransB_fold_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+cog.out(generate.generate(blockSize.BlockSize("zbzgemm", "XYT_BLOCK", y_block, xy_block, xy_block, ["bench_rzgemm_AvgTransA_AvgTransB_fold_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+]]]*/
+#define Y_BLOCK 32
+#define XY_BLOCK 16384
+#define YT_BLOCK 32
+#define XYT_BLOCK 16384
+//[[[end]]]
+#define X_BLOCK (XY_BLOCK/Y_BLOCK)
+#define XT_BLOCK (XYT_BLOCK/YT_BLOCK)
+
+/**
+ * @internal
+ * @brief Arguments of #binnedBLAS_zbzgemm_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  char Order;
+  char TransA;
+  char TransB;
+  int M;
+  int N;
+  int K;
+  const void *alpha;
+  const void *A;
+  int lda;
+  const void *B;
+  int ldb;
+  double_complex_binned *C;
+  int ldc;
+  int block_M;
+  int block_N;
+  int rowA;
+  int colB;
+  int rowC;
+  int colC;
+} binnedBLAS_zbzgemm_args;
+
+/**
+ * @internal
+ * @brief Compute panel i of C (a task of #binnedBLAS_zbzgemm())
+ *
+ * The panels are of block_M rows of C if block_M is nonzero, and of block_N columns of C otherwise.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void binnedBLAS_zbzgemm_task(void *args, const int i, const int thread){
+  binnedBLAS_zbzgemm_args *a = (binnedBLAS_zbzgemm_args*)args;
+  (void)thread;
+
+  if(a->block_M > 0){
+    binnedBLAS_zbzgemm(a->fold, a->Order, a->TransA, a->TransB, MIN(a->block_M, a->M - i * a->block_M), a->N, a->K, a->alpha, (const double*)a->A + 2 * i * a->block_M * a->rowA, a->lda, a->B, a->ldb, a->C + i * a->block_M * a->rowC * binned_zbnum(a->fold), a->ldc);
+  }else{
+    binnedBLAS_zbzgemm(a->fold, a->Order, a->TransA, a->TransB, a->M, MIN(a->block_N, a->N - i * a->block_N), a->K, a->alpha, a->A, a->lda, (const double*)a->B + 2 * i * a->block_N * a->colB, a->ldb, a->C + i * a->block_N * a->colC * binned_zbnum(a->fold), a->ldc);
+  }
+}
+
+/**
+ * @brief Add to binned complex double precision matrix C the matrix-matrix product of complex double precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + C,
+ *
+ * where op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H,
+ *
+ * alpha is a scalar, A and B are matrices with op(A) an M by K matrix and op(B) a K by N matrix, and C is an binned M by N matrix.
+ *
+ * Large products are computed in parallel, with each thread accumulating a disjoint panel of C. Each element of C is accumulated in the same order regardless of the number of threads, so the result is independent of the number of threads.
+ *
+ * @param fold the fold of the binned types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param A complex double precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B complex double precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C binned complex double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @author Willow Ahrens
+ * @date   18 Jan 2016
+ */
+void binnedBLAS_zbzgemm(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const void *alpha, const void *A, const int lda,
+             const void *B, const int ldb,
+             double_complex_binned *C, const int ldc){
+  int i;
+  int ii;
+  int k;
+  int kk;
+  int j;
+  int jj;
+  double *bufA;
+  int ldbufa;
+  double *bufB;
+  int num_threads;
+  int block_M;
+  int block_N;
+  int rowA;
+  int colB;
+  int rowC;
+  int colC;
+  binnedBLAS_zbzgemm_args args;
+
+  //early returns
+  if(M == 0 || N == 0 || K == 0 || (((double*)alpha)[0] == 0.0 && ((double*)alpha)[1] == 0.0)){
+    return;
+  }
+
+  //split C into panels of whole blocks (and if possible whole cache lines) along its longer dimension, one per thread
+  num_threads = binnedBLAS_nthreads((int)MIN((double)M * N * K, (double)INT_MAX));
+  num_threads = MIN(num_threads, (MAX(M, N) + Y_BLOCK - 1) / Y_BLOCK);
+  if(num_threads > 1){
+    switch(Order){
+      case 'r':
+      case 'R':
+        rowA = (TransA == 'n' || TransA == 'N') ? lda : 1;
+        colB = (TransB == 'n' || TransB == 'N') ? 1 : ldb;
+        rowC = ldc;
+        colC = 1;
+        break;
+      default:
+        rowA = (TransA == 'n' || TransA == 'N') ? 1 : lda;
+        colB = (TransB == 'n' || TransB == 'N') ? ldb : 1;
+        rowC = 1;
+        colC = ldc;
+        break;
+    }
+    args.fold = fold;
+    args.Order = Order;
+    args.TransA = TransA;
+    args.TransB = TransB;
+    args.M = M;
+    args.N = N;
+    args.K = K;
+    args.alpha = alpha;
+    args.A = A;
+    args.lda = lda;
+    args.B = B;
+    args.ldb = ldb;
+    args.C = C;
+    args.ldc = ldc;
+    args.rowA = rowA;
+    args.colB = colB;
+    args.rowC = rowC;
+    args.colC = colC;
+    if(M >= N){
+      block_M = binnedBLAS_partition(M, num_threads, Y_BLOCK, rowC * binned_zbsize(fold));
+      num_threads = (M + block_M - 1) / block_M;
+      args.block_M = block_M;
+      args.block_N = 0;
+    }else{
+      block_N = binnedBLAS_partition(N, num_threads, Y_BLOCK, colC * binned_zbsize(fold));
+      num_threads = (N + block_N - 1) / block_N;
+      args.block_M = 0;
+      args.block_N = block_N;
+    }
+    binnedBLAS_parallel(num_threads, num_threads, &binnedBLAS_zbzgemm_task, &args);
+    return;
+  }
+
+  switch(Order){
+
+    //row major
+    case 'r':
+    case 'R':
+      switch(TransA){
+
+        //row major A not transposed
+        case 'n':
+        case 'N':
+          if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+            bufA = (double*)A;
+            ldbufa = lda;
+          }else{
+            bufA = (double*)malloc(M * K * 2 * sizeof(double));
+            for(i = 0; i < M; i++){
+              for(k = 0; k < K; k++){
+                bufA[2 * (i * K + k)] = ((double*)A)[2 * (i * lda + k)] * ((double*)alpha)[0] - ((double*)A)[2 * (i * lda + k) + 1] * ((double*)alpha)[1];
+                bufA[2 * (i * K + k) + 1] = ((double*)A)[2 * (i * lda + k)] * ((double*)alpha)[1] + ((double*)A)[2 * (i * lda + k) + 1] * ((double*)alpha)[0];
+              }
+            }
+            ldbufa = K;
+          }
+          switch(TransB){
+
+            //row major A not transposed B not transposed
+            case 'n':
+            case 'N':
+              bufB = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              for(i = 0; i < M; i += Y_BLOCK){
+                for(j = 0; j < N; j += YT_BLOCK){
+                  for(k = 0; k < K; k += XT_BLOCK){
+                    for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                        bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                      }
+                    }
+                    for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii * ldbufa + k), 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufB);
+              break;
+
+            //row major A not transposed B transposed
+            case 't':
+            case 'T':
+              for(i = 0; i < M; i += Y_BLOCK){
+                for(j = 0; j < N; j += Y_BLOCK){
+                  for(k = 0; k < K; k += X_BLOCK){
+                    for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                      for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                        binnedBLAS_zbzdotu(fold, MIN(X_BLOCK, K - k), bufA + 2 * (ii * ldbufa + k), 1, (double*)B + 2 * (jj * ldb + k), 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                      }
+                    }
+                  }
+                }
+              }
+              break;
+
+            //row major A not transposed B conjugate transposed
+            default:
+              for(i = 0; i < M; i += Y_BLOCK){
+                for(j = 0; j < N; j += Y_BLOCK){
+                  for(k = 0; k < K; k += X_BLOCK){
+                    for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                      for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                        binnedBLAS_zbzdotc(fold, MIN(X_BLOCK, K - k), (double*)B + 2 * (jj * ldb + k), 1, bufA + 2 * (ii * ldbufa + k), 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                      }
+                    }
+                  }
+                }
+              }
+              break;
+
+          }
+          if(((double*)alpha)[0] != 1.0 || ((double*)alpha)[1] != 0.0){
+            free(bufA);
+          }
+          break;
+
+        //row major A transposed
+        case 't':
+        case 'T':
+          switch(TransB){
+
+            //row major A transposed B not transposed
+            case 'n':
+            case 'N':
+              bufA = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              bufB = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii) + 1];
+                        }
+                      }
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[0] - ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[1];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[1] + ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[0];
+                        }
+                      }
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufA);
+              free(bufB);
+              break;
+
+            //row major A transposed B transposed
+            case 't':
+            case 'T':
+              bufA = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii) + 1];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, ((double*)B) + 2 * (jj * ldb + k), 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[0] - ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[1];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[1] + ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[0];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, ((double*)B) + 2 * (jj * ldb + k), 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufA);
+              break;
+
+            //row major A transposed B conjugate transposed
+            default:
+              bufA = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii) + 1];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), ((double*)B) + 2 * (jj * ldb + k), 1, bufA + 2 * (ii - i) * XT_BLOCK, 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[0] - ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[1];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[1] + ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[0];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), ((double*)B) + 2 * (jj * ldb + k), 1, bufA + 2 * (ii - i) * XT_BLOCK, 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufA);
+              break;
+
+          }
+          break;
+
+        //row major A conjugate transposed
+        default:
+          switch(TransB){
+
+            //row major A conjugate transposed B not transposed
+            case 'n':
+            case 'N':
+              bufA = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              bufB = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii) + 1];
+                        }
+                      }
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[0] + ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[1];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[1] - ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[0];
+                        }
+                      }
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufA);
+              free(bufB);
+              break;
+
+            //row major A conjugate transposed B transposed
+            case 't':
+            case 'T':
+              bufA = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii) + 1];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, ((double*)B) + 2 * (jj * ldb + k), 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[0] + ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[1];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[1] - ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[0];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, ((double*)B) + 2 * (jj * ldb + k), 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufA);
+              break;
+
+            //row major A conjugate transposed B conjugate transposed
+            default:
+              bufA = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = -((double*)A)[2 * (kk * lda + ii) + 1];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), ((double*)B) + 2 * (jj * ldb + k), 1, bufA + 2 * (ii - i) * XT_BLOCK, 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[0] + ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[1];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[1] - ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[0];
+                        }
+                      }
+                      for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                        for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), ((double*)B) + 2 * (jj * ldb + k), 1, bufA + 2 * (ii - i) * XT_BLOCK, 1, C + (ii * ldc + jj) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufA);
+              break;
+          }
+          break;
+      }
+      break;
+
+    //column major
+    default:
+      switch(TransA){
+
+        //column major A not transposed
+        case 'n':
+        case 'N':
+          switch(TransB){
+
+            //column major A not transposed B not transposed
+            case 'n':
+            case 'N':
+              bufA = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii) + 1];
+                        }
+                      }
+                      for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, ((double*)B) + 2 * (jj * ldb + k), 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[0] - ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[1];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[1] + ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[0];
+                        }
+                      }
+                      for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, ((double*)B) + 2 * (jj * ldb + k), 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufA);
+              break;
+
+            //column major A not transposed B transposed
+            case 't':
+            case 'T':
+              bufA = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              bufB = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii) + 1];
+                        }
+                      }
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[0] - ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[1];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[1] + ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[0];
+                        }
+                      }
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii - i) * XT_BLOCK, 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufA);
+              free(bufB);
+              break;
+
+            //column major A not transposed B conjugate transposed
+            default:
+              bufA = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              bufB = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii) + 1];
+                        }
+                      }
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), bufB + 2 * (jj - j) * XT_BLOCK, 1, bufA + 2 * (ii - i) * XT_BLOCK, 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                for(i = 0; i < M; i += YT_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k))] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[0] - ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[1];
+                          bufA[2 * ((ii - i) * XT_BLOCK + (kk - k)) + 1] = ((double*)A)[2 * (kk * lda + ii)] * ((double*)alpha)[1] + ((double*)A)[2 * (kk * lda + ii) + 1] * ((double*)alpha)[0];
+                        }
+                      }
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + YT_BLOCK; ii++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), bufB + 2 * (jj - j) * XT_BLOCK, 1, bufA + 2 * (ii - i) * XT_BLOCK, 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufA);
+              free(bufB);
+              break;
+          }
+          break;
+
+        //column major A transposed
+        case 't':
+        case 'T':
+          if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+            bufA = (double*)A;
+            ldbufa = lda;
+          }else{
+            bufA = (double*)malloc(M * K * 2 * sizeof(double));
+            for(i = 0; i < M; i++){
+              for(k = 0; k < K; k++){
+                bufA[2 * (i * K + k)] = ((double*)A)[2 * (i * lda + k)] * ((double*)alpha)[0] - ((double*)A)[2 * (i * lda + k) + 1] * ((double*)alpha)[1];
+                bufA[2 * (i * K + k) + 1] = ((double*)A)[2 * (i * lda + k)] * ((double*)alpha)[1] + ((double*)A)[2 * (i * lda + k) + 1] * ((double*)alpha)[0];
+              }
+            }
+            ldbufa = K;
+          }
+          switch(TransB){
+
+            //column major A transposed B not transposed
+            case 'n':
+            case 'N':
+              for(i = 0; i < M; i += Y_BLOCK){
+                for(j = 0; j < N; j += Y_BLOCK){
+                  for(k = 0; k < K; k += X_BLOCK){
+                    for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                      for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                        binnedBLAS_zbzdotu(fold, MIN(X_BLOCK, K - k), bufA + 2 * (ii * ldbufa + k), 1, ((double*)B) + 2 * (jj * ldb + k), 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                      }
+                    }
+                  }
+                }
+              }
+              break;
+
+            //column major A transposed B transposed
+            case 't':
+            case 'T':
+              bufB = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              for(i = 0; i < M; i += Y_BLOCK){
+                for(j = 0; j < N; j += YT_BLOCK){
+                  for(k = 0; k < K; k += XT_BLOCK){
+                    for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                        bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                      }
+                    }
+                    for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                      for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                        binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii * ldbufa + k), 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufB);
+              break;
+
+            //column major A transposed B conjugate transposed
+            default:
+              bufB = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              for(i = 0; i < M; i += Y_BLOCK){
+                for(j = 0; j < N; j += YT_BLOCK){
+                  for(k = 0; k < K; k += XT_BLOCK){
+                    for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                        bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                      }
+                    }
+                    for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                      for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                        binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), bufB + 2 * (jj - j) * XT_BLOCK, 1, bufA + 2 * (ii * ldbufa + k), 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                      }
+                    }
+                  }
+                }
+              }
+              free(bufB);
+              break;
+          }
+          if(((double*)alpha)[0] != 1.0 || ((double*)alpha)[1] != 0.0){
+            free(bufA);
+          }
+          break;
+
+        //column major A conjugate transposed
+        default:
+          switch(TransB){
+
+            //column major A conjugate transposed B not transposed
+            case 'n':
+            case 'N':
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += Y_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += X_BLOCK){
+                      for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                          binnedBLAS_zbzdotc(fold, MIN(X_BLOCK, K - k), ((double*)A) + 2 * (ii * lda + k), 1, ((double*)B) + 2 * (jj * ldb + k), 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                bufA = (double*)malloc(M * K * 2 * sizeof(double));
+                for(i = 0; i < M; i++){
+                  for(k = 0; k < K; k++){
+                    bufA[2 * (i * K + k)] = ((double*)A)[2 * (i * lda + k)] * ((double*)alpha)[0] + ((double*)A)[2 * (i * lda + k) + 1] * ((double*)alpha)[1];
+                    bufA[2 * (i * K + k) + 1] = ((double*)A)[2 * (i * lda + k)] * ((double*)alpha)[1] - ((double*)A)[2 * (i * lda + k) + 1] * ((double*)alpha)[0];
+                  }
+                }
+                for(i = 0; i < M; i += Y_BLOCK){
+                  for(j = 0; j < N; j += Y_BLOCK){
+                    for(k = 0; k < K; k += X_BLOCK){
+                      for(jj = j; jj < N && jj < j + Y_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                          binnedBLAS_zbzdotu(fold, MIN(X_BLOCK, K - k), bufA + 2 * (ii * K + k), 1, ((double*)B) + 2 * (jj * ldb + k), 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+                free(bufA);
+              }
+              break;
+
+            //column major A conjugate transposed B transposed
+            case 't':
+            case 'T':
+              bufB = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += Y_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), ((double*)A) + 2 * (ii * lda + k), 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                bufA = (double*)malloc(M * K * 2 * sizeof(double));
+                for(i = 0; i < M; i++){
+                  for(k = 0; k < K; k++){
+                    bufA[2 * (i * K + k)] = ((double*)A)[2 * (i * lda + k)] * ((double*)alpha)[0] + ((double*)A)[2 * (i * lda + k) + 1] * ((double*)alpha)[1];
+                    bufA[2 * (i * K + k) + 1] = ((double*)A)[2 * (i * lda + k)] * ((double*)alpha)[1] - ((double*)A)[2 * (i * lda + k) + 1] * ((double*)alpha)[0];
+                  }
+                }
+                for(i = 0; i < M; i += Y_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                          binnedBLAS_zbzdotu(fold, MIN(XT_BLOCK, K - k), bufA + 2 * (ii * K + k), 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+                free(bufA);
+              }
+              free(bufB);
+              break;
+
+            //column major A conjugate transposed B conjugate transposed
+            default:
+              bufB = (double*)malloc(XT_BLOCK * YT_BLOCK * 2 * sizeof(double));
+              if(((double*)alpha)[0] == 1.0 && ((double*)alpha)[1] == 0.0){
+                for(i = 0; i < M; i += Y_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = -((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), ((double*)A) + 2 * (ii * lda + k), 1, bufB + 2 * (jj - j) * XT_BLOCK, 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+              }else{
+                bufA = (double*)malloc(M * K * 2 * sizeof(double));
+                for(i = 0; i < M; i++){
+                  for(k = 0; k < K; k++){
+                    bufA[2 * (i * K + k)] = ((double*)A)[2 * (i * lda + k)] * ((double*)alpha)[0] + ((double*)A)[2 * (i * lda + k) + 1] * ((double*)alpha)[1];
+                    bufA[2 * (i * K + k) + 1] = ((double*)A)[2 * (i * lda + k)] * ((double*)alpha)[1] - ((double*)A)[2 * (i * lda + k) + 1] * ((double*)alpha)[0];
+                  }
+                }
+                for(i = 0; i < M; i += Y_BLOCK){
+                  for(j = 0; j < N; j += YT_BLOCK){
+                    for(k = 0; k < K; k += XT_BLOCK){
+                      for(kk = k; kk < K && kk < k + XT_BLOCK; kk++){
+                        for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k))] = ((double*)B)[2 * (kk * ldb + jj)];
+                          bufB[2 * ((jj - j) * XT_BLOCK + (kk - k)) + 1] = ((double*)B)[2 * (kk * ldb + jj) + 1];
+                        }
+                      }
+                      for(jj = j; jj < N && jj < j + YT_BLOCK; jj++){
+                        for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                          binnedBLAS_zbzdotc(fold, MIN(XT_BLOCK, K - k), bufB + 2 * (jj - j) * XT_BLOCK, 1, bufA + 2 * (ii * K + k), 1, C + (jj * ldc + ii) * binned_zbnum(fold));
+                        }
+                      }
+                    }
+                  }
+                }
+                free(bufA);
+              }
+              free(bufB);
+              break;
+          }
+          break;
+      }
+      break;
+  }
+}
@@ -0,0 +1,11982 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../config.h"
+#include "../common/common.h"
+#include "binnedBLAS.h"
+
+/*[[[cog
+import cog
+import generate
+import dataTypes
+import depositSum
+import vectorizations
+from src.common import blockSize
+from scripts import terminal
+
+code_block = generate.CodeBlock()
+vectorizations.conditionally_include_vectorizations(code_block)
+cog.out(str(code_block))
+
+cog.outl()
+
+cog.out(generate.generate(blockSize.BlockSize("zmzsum", "N_block_MAX", 32, terminal.get_diendurance(), terminal.get_diendurance(), ["bench_rzsum_fold_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+]]]*/
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  #include <immintrin.h>
+
+#elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+  #include <immintrin.h>
+
+#elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+  #include <emmintrin.h>
+
+#else
+
+
+#endif
+
+#define N_block_MAX 2048
+//[[[end]]]
+
+/**
+ * @internal
+ * @brief Add to manually specified binned complex double precision Y the sum of complex double precision vector X
+ *
+ * Add to Y the binned sum of X.
+ *
+ * @param fold the fold of the binned types
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @author Willow Ahrens
+ * @date   15 Jan 2016
+ */
+void binnedBLAS_zmzsum(const int fold, const int N, const void *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY){
+  double amax[2];
+  int i, j;
+  int N_block = N_block_MAX;
+  int deposits = 0;
+
+  const double *x = (const double*)X;
+
+  for (i = 0; i < N; i += N_block) {
+    N_block = MIN((N - i), N_block);
+
+    binnedBLAS_zamax_sub(N_block, x, incX, amax);
+
+    if (isinf(amax[0]) || isinf(priY[0])){
+      for (j = 0; j < N_block; j++){
+        priY[0] += x[(ptrdiff_t)j * 2 * incX];
+      }
+    }
+    if (isinf(amax[1]) || isinf(priY[1])){
+      for (j = 0; j < N_block; j++){
+        priY[1] += x[(ptrdiff_t)j * 2 * incX + 1];
+      }
+    }
+    if (isnan(priY[0]) && isnan(priY[1])){
+      return;
+    } else if (isinf(priY[0]) && isinf(priY[1])){
+      x += (ptrdiff_t)N_block * 2 * incX;
+      continue;
+    }
+    if (ISNANINF(priY[0])){
+      amax[0] = priY[0];
+    }
+    if (ISNANINF(priY[1])){
+      amax[1] = priY[1];
+    }
+
+    if (deposits + N_block > binned_DBENDURANCE) {
+      binned_zmrenorm(fold, priY, incpriY, carY, inccarY);
+      deposits = 0;
+    }
+
+    binned_zmzupdate(fold, amax, priY, incpriY, carY, inccarY);
+
+    /*[[[cog
+    cog.out(generate.generate(depositSum.DepositSum(dataTypes.DoubleComplex, "fold", "N_block", "x", "incX", "priY", "incpriY"), cog.inFile, args, params, mode))
+    ]]]*/
+    {
+      #if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+        __m512i blp_mask_tmp;
+        {
+          __m512i tmp;
+          blp_mask_tmp = _mm512_castpd_si512(_mm512_set1_pd(1.0));
+          tmp = _mm512_castpd_si512(_mm512_set1_pd(1.0 + (DBL_EPSILON * 1.0001)));
+          blp_mask_tmp = _mm512_xor_si512(blp_mask_tmp, tmp);
+        }
+        __m512d cons_tmp; (void)cons_tmp;
+        double cons_buffer_tmp[8] __attribute__((aligned(64))); (void)cons_buffer_tmp;
+        unsigned int SIMD_daz_ftz_old_tmp = 0;
+        unsigned int SIMD_daz_ftz_new_tmp = 0;
+
+
+        switch(fold){
+          case 2:
+            {
+              int i;
+              __m512d x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7;
+              __m512d compression_0;
+              __m512d expansion_0;
+              __m512d expansion_mask_0;
+              __m512d q_0, q_1, q_2, q_3;
+              __m512d s_0_0, s_0_1, s_0_2, s_0_3;
+              __m512d s_1_0, s_1_1, s_1_2, s_1_3;
+
+              s_0_0 = s_0_1 = s_0_2 = s_0_3 = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)priY))));
+              s_1_0 = s_1_1 = s_1_2 = s_1_3 = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 2))));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm512_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm512_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 32 <= N_block; i += 32, x += 64){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1072), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1080), _MM_HINT_T0);
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_3));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_7));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_3));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += 8;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_maskz_loadu_pd((__mmask8)((1U << ((N_block - i) * 2)) - 1), ((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 32 <= N_block; i += 32, x += 64){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1072), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1080), _MM_HINT_T0);
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    x_2 = _mm512_add_pd(x_2, q_2);
+                    x_3 = _mm512_add_pd(x_3, q_3);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    x_6 = _mm512_add_pd(x_6, q_2);
+                    x_7 = _mm512_add_pd(x_7, q_3);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    x_2 = _mm512_add_pd(x_2, q_2);
+                    x_3 = _mm512_add_pd(x_3, q_3);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += 8;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_maskz_loadu_pd((__mmask8)((1U << ((N_block - i) * 2)) - 1), ((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((N_block - i) * 2);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm512_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm512_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 32 <= N_block; i += 32, x += ((ptrdiff_t)incX * 64)){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_3));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_7));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_3));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << ((N_block - i) * 2)) - 1), _mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 32 <= N_block; i += 32, x += ((ptrdiff_t)incX * 64)){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    x_2 = _mm512_add_pd(x_2, q_2);
+                    x_3 = _mm512_add_pd(x_3, q_3);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    x_6 = _mm512_add_pd(x_6, q_2);
+                    x_7 = _mm512_add_pd(x_7, q_3);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_0_2 = _mm512_add_pd(s_0_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_3 = _mm512_add_pd(s_0_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    q_2 = _mm512_sub_pd(q_2, s_0_2);
+                    q_3 = _mm512_sub_pd(q_3, s_0_3);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    x_2 = _mm512_add_pd(x_2, q_2);
+                    x_3 = _mm512_add_pd(x_3, q_3);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_1_2 = _mm512_add_pd(s_1_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_3 = _mm512_add_pd(s_1_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << ((N_block - i) * 2)) - 1), _mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }
+              }
+
+              s_0_0 = _mm512_sub_pd(s_0_0, _mm512_set_pd(((double*)priY)[1], ((double*)priY)[0], ((double*)priY)[1], ((double*)priY)[0], ((double*)priY)[1], ((double*)priY)[0], 0, 0));
+              cons_tmp = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)))));
+              s_0_0 = _mm512_add_pd(s_0_0, _mm512_sub_pd(s_0_1, cons_tmp));
+              s_0_0 = _mm512_add_pd(s_0_0, _mm512_sub_pd(s_0_2, cons_tmp));
+              s_0_0 = _mm512_add_pd(s_0_0, _mm512_sub_pd(s_0_3, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_0_0);
+              ((double*)priY)[0] = cons_buffer_tmp[0] + cons_buffer_tmp[2] + cons_buffer_tmp[4] + cons_buffer_tmp[6];
+              ((double*)priY)[1] = cons_buffer_tmp[1] + cons_buffer_tmp[3] + cons_buffer_tmp[5] + cons_buffer_tmp[7];
+              s_1_0 = _mm512_sub_pd(s_1_0, _mm512_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], 0, 0));
+              cons_tmp = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 2))));
+              s_1_0 = _mm512_add_pd(s_1_0, _mm512_sub_pd(s_1_1, cons_tmp));
+              s_1_0 = _mm512_add_pd(s_1_0, _mm512_sub_pd(s_1_2, cons_tmp));
+              s_1_0 = _mm512_add_pd(s_1_0, _mm512_sub_pd(s_1_3, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_1_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[2] + cons_buffer_tmp[4] + cons_buffer_tmp[6];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3] + cons_buffer_tmp[5] + cons_buffer_tmp[7];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 3:
+            {
+              int i;
+              __m512d x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7;
+              __m512d compression_0;
+              __m512d expansion_0;
+              __m512d expansion_mask_0;
+              __m512d q_0, q_1;
+              __m512d s_0_0, s_0_1;
+              __m512d s_1_0, s_1_1;
+              __m512d s_2_0, s_2_1;
+
+              s_0_0 = s_0_1 = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)priY))));
+              s_1_0 = s_1_1 = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 2))));
+              s_2_0 = s_2_1 = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 4))));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm512_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm512_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 32 <= N_block; i += 32, x += 64){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1072), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1080), _MM_HINT_T0);
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_3));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_7));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_3));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += 8;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_maskz_loadu_pd((__mmask8)((1U << ((N_block - i) * 2)) - 1), ((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 32 <= N_block; i += 32, x += 64){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1072), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1080), _MM_HINT_T0);
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += 8;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_maskz_loadu_pd((__mmask8)((1U << ((N_block - i) * 2)) - 1), ((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((N_block - i) * 2);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm512_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm512_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 32 <= N_block; i += 32, x += ((ptrdiff_t)incX * 64)){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_3));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_7));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_3));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << ((N_block - i) * 2)) - 1), _mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 32 <= N_block; i += 32, x += ((ptrdiff_t)incX * 64)){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << ((N_block - i) * 2)) - 1), _mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }
+              }
+
+              s_0_0 = _mm512_sub_pd(s_0_0, _mm512_set_pd(((double*)priY)[1], ((double*)priY)[0], ((double*)priY)[1], ((double*)priY)[0], ((double*)priY)[1], ((double*)priY)[0], 0, 0));
+              cons_tmp = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)))));
+              s_0_0 = _mm512_add_pd(s_0_0, _mm512_sub_pd(s_0_1, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_0_0);
+              ((double*)priY)[0] = cons_buffer_tmp[0] + cons_buffer_tmp[2] + cons_buffer_tmp[4] + cons_buffer_tmp[6];
+              ((double*)priY)[1] = cons_buffer_tmp[1] + cons_buffer_tmp[3] + cons_buffer_tmp[5] + cons_buffer_tmp[7];
+              s_1_0 = _mm512_sub_pd(s_1_0, _mm512_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], 0, 0));
+              cons_tmp = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 2))));
+              s_1_0 = _mm512_add_pd(s_1_0, _mm512_sub_pd(s_1_1, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_1_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[2] + cons_buffer_tmp[4] + cons_buffer_tmp[6];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3] + cons_buffer_tmp[5] + cons_buffer_tmp[7];
+              s_2_0 = _mm512_sub_pd(s_2_0, _mm512_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 4)], ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 4)], ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 4)], 0, 0));
+              cons_tmp = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 4))));
+              s_2_0 = _mm512_add_pd(s_2_0, _mm512_sub_pd(s_2_1, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_2_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 4)] = cons_buffer_tmp[0] + cons_buffer_tmp[2] + cons_buffer_tmp[4] + cons_buffer_tmp[6];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3] + cons_buffer_tmp[5] + cons_buffer_tmp[7];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 4:
+            {
+              int i;
+              __m512d x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7, x_8, x_9, x_10, x_11;
+              __m512d compression_0;
+              __m512d expansion_0;
+              __m512d expansion_mask_0;
+              __m512d q_0, q_1;
+              __m512d s_0_0, s_0_1;
+              __m512d s_1_0, s_1_1;
+              __m512d s_2_0, s_2_1;
+              __m512d s_3_0, s_3_1;
+
+              s_0_0 = s_0_1 = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)priY))));
+              s_1_0 = s_1_1 = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 2))));
+              s_2_0 = s_2_1 = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 4))));
+              s_3_0 = s_3_1 = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 6))));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm512_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm512_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 48 <= N_block; i += 48, x += 96){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1072), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1080), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1088), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1096), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1104), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1112), _MM_HINT_T0);
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+                    x_8 = _mm512_loadu_pd(((double*)x) + 64);
+                    x_9 = _mm512_loadu_pd(((double*)x) + 72);
+                    x_10 = _mm512_loadu_pd(((double*)x) + 80);
+                    x_11 = _mm512_loadu_pd(((double*)x) + 88);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_3));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_7));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_8, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_9, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_8 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_8));
+                    x_9 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_9));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_8 = _mm512_add_pd(x_8, q_0);
+                    x_9 = _mm512_add_pd(x_9, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_8 = _mm512_add_pd(x_8, q_0);
+                    x_9 = _mm512_add_pd(x_9, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_10, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_11, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_10 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_10));
+                    x_11 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_11));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_10 = _mm512_add_pd(x_10, q_0);
+                    x_11 = _mm512_add_pd(x_11, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_10 = _mm512_add_pd(x_10, q_0);
+                    x_11 = _mm512_add_pd(x_11, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_3));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_7));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    i += 32, x += 64;
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_3));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += 8;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_maskz_loadu_pd((__mmask8)((1U << ((N_block - i) * 2)) - 1), ((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 48 <= N_block; i += 48, x += 96){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1072), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1080), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1088), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1096), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1104), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1112), _MM_HINT_T0);
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+                    x_8 = _mm512_loadu_pd(((double*)x) + 64);
+                    x_9 = _mm512_loadu_pd(((double*)x) + 72);
+                    x_10 = _mm512_loadu_pd(((double*)x) + 80);
+                    x_11 = _mm512_loadu_pd(((double*)x) + 88);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_8 = _mm512_add_pd(x_8, q_0);
+                    x_9 = _mm512_add_pd(x_9, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_8 = _mm512_add_pd(x_8, q_0);
+                    x_9 = _mm512_add_pd(x_9, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_8 = _mm512_add_pd(x_8, q_0);
+                    x_9 = _mm512_add_pd(x_9, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_10 = _mm512_add_pd(x_10, q_0);
+                    x_11 = _mm512_add_pd(x_11, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_10 = _mm512_add_pd(x_10, q_0);
+                    x_11 = _mm512_add_pd(x_11, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_10 = _mm512_add_pd(x_10, q_0);
+                    x_11 = _mm512_add_pd(x_11, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    i += 32, x += 64;
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += 8;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_maskz_loadu_pd((__mmask8)((1U << ((N_block - i) * 2)) - 1), ((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((N_block - i) * 2);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm512_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm512_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 48 <= N_block; i += 48, x += ((ptrdiff_t)incX * 96)){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+                    x_8 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 64), 8);
+                    x_9 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 72), 8);
+                    x_10 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 80), 8);
+                    x_11 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 88), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_3));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_7));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_8, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_9, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_8 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_8));
+                    x_9 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_9));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_8 = _mm512_add_pd(x_8, q_0);
+                    x_9 = _mm512_add_pd(x_9, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_8 = _mm512_add_pd(x_8, q_0);
+                    x_9 = _mm512_add_pd(x_9, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_10, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_11, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_10 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_10));
+                    x_11 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_11));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_10 = _mm512_add_pd(x_10, q_0);
+                    x_11 = _mm512_add_pd(x_11, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_10 = _mm512_add_pd(x_10, q_0);
+                    x_11 = _mm512_add_pd(x_11, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_3));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_7));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    i += 32, x += ((ptrdiff_t)incX * 64);
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_3));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << ((N_block - i) * 2)) - 1), _mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 48 <= N_block; i += 48, x += ((ptrdiff_t)incX * 96)){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+                    x_8 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 64), 8);
+                    x_9 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 72), 8);
+                    x_10 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 80), 8);
+                    x_11 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 88), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_8 = _mm512_add_pd(x_8, q_0);
+                    x_9 = _mm512_add_pd(x_9, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_8 = _mm512_add_pd(x_8, q_0);
+                    x_9 = _mm512_add_pd(x_9, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_8 = _mm512_add_pd(x_8, q_0);
+                    x_9 = _mm512_add_pd(x_9, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_10 = _mm512_add_pd(x_10, q_0);
+                    x_11 = _mm512_add_pd(x_11, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_10 = _mm512_add_pd(x_10, q_0);
+                    x_11 = _mm512_add_pd(x_11, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_10 = _mm512_add_pd(x_10, q_0);
+                    x_11 = _mm512_add_pd(x_11, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_4 = _mm512_add_pd(x_4, q_0);
+                    x_5 = _mm512_add_pd(x_5, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_6 = _mm512_add_pd(x_6, q_0);
+                    x_7 = _mm512_add_pd(x_7, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    i += 32, x += ((ptrdiff_t)incX * 64);
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_2 = _mm512_add_pd(x_2, q_0);
+                    x_3 = _mm512_add_pd(x_3, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_0_1 = _mm512_add_pd(s_0_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    q_1 = _mm512_sub_pd(q_1, s_0_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_1_1 = _mm512_add_pd(s_1_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    q_1 = _mm512_sub_pd(q_1, s_1_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_2_1 = _mm512_add_pd(s_2_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    q_1 = _mm512_sub_pd(q_1, s_2_1);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    x_1 = _mm512_add_pd(x_1, q_1);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_3_1 = _mm512_add_pd(s_3_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << ((N_block - i) * 2)) - 1), _mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm512_add_pd(s_0_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_0_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm512_add_pd(s_1_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_1_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm512_add_pd(s_2_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    q_0 = _mm512_sub_pd(q_0, s_2_0);
+                    x_0 = _mm512_add_pd(x_0, q_0);
+                    s_3_0 = _mm512_add_pd(s_3_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }
+              }
+
+              s_0_0 = _mm512_sub_pd(s_0_0, _mm512_set_pd(((double*)priY)[1], ((double*)priY)[0], ((double*)priY)[1], ((double*)priY)[0], ((double*)priY)[1], ((double*)priY)[0], 0, 0));
+              cons_tmp = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)))));
+              s_0_0 = _mm512_add_pd(s_0_0, _mm512_sub_pd(s_0_1, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_0_0);
+              ((double*)priY)[0] = cons_buffer_tmp[0] + cons_buffer_tmp[2] + cons_buffer_tmp[4] + cons_buffer_tmp[6];
+              ((double*)priY)[1] = cons_buffer_tmp[1] + cons_buffer_tmp[3] + cons_buffer_tmp[5] + cons_buffer_tmp[7];
+              s_1_0 = _mm512_sub_pd(s_1_0, _mm512_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], 0, 0));
+              cons_tmp = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 2))));
+              s_1_0 = _mm512_add_pd(s_1_0, _mm512_sub_pd(s_1_1, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_1_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[2] + cons_buffer_tmp[4] + cons_buffer_tmp[6];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3] + cons_buffer_tmp[5] + cons_buffer_tmp[7];
+              s_2_0 = _mm512_sub_pd(s_2_0, _mm512_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 4)], ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 4)], ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 4)], 0, 0));
+              cons_tmp = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 4))));
+              s_2_0 = _mm512_add_pd(s_2_0, _mm512_sub_pd(s_2_1, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_2_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 4)] = cons_buffer_tmp[0] + cons_buffer_tmp[2] + cons_buffer_tmp[4] + cons_buffer_tmp[6];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3] + cons_buffer_tmp[5] + cons_buffer_tmp[7];
+              s_3_0 = _mm512_sub_pd(s_3_0, _mm512_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 6) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 6)], ((double*)priY)[(((ptrdiff_t)incpriY * 6) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 6)], ((double*)priY)[(((ptrdiff_t)incpriY * 6) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 6)], 0, 0));
+              cons_tmp = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 6))));
+              s_3_0 = _mm512_add_pd(s_3_0, _mm512_sub_pd(s_3_1, cons_tmp));
+              _mm512_store_pd(cons_buffer_tmp, s_3_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 6)] = cons_buffer_tmp[0] + cons_buffer_tmp[2] + cons_buffer_tmp[4] + cons_buffer_tmp[6];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 6) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3] + cons_buffer_tmp[5] + cons_buffer_tmp[7];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          default:
+            {
+              int i, j;
+              __m512d x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7, x_8, x_9, x_10, x_11;
+              __m512d compression_0;
+              __m512d expansion_0;
+              __m512d expansion_mask_0;
+              __m512d q_0, q_1, q_2, q_3;
+              __m512d s_0, s_1, s_2, s_3;
+              __m512d s_buffer[(binned_DBMAXFOLD * 4)];
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[(j * 4)] = s_buffer[((j * 4) + 1)] = s_buffer[((j * 4) + 2)] = s_buffer[((j * 4) + 3)] = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * j * 2))));
+              }
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm512_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm512_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 48 <= N_block; i += 48, x += 96){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1072), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1080), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1088), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1096), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1104), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1112), _MM_HINT_T0);
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+                    x_8 = _mm512_loadu_pd(((double*)x) + 64);
+                    x_9 = _mm512_loadu_pd(((double*)x) + 72);
+                    x_10 = _mm512_loadu_pd(((double*)x) + 80);
+                    x_11 = _mm512_loadu_pd(((double*)x) + 88);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_3));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_7));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_4 = _mm512_add_pd(x_4, q_0);
+                      x_5 = _mm512_add_pd(x_5, q_1);
+                      x_6 = _mm512_add_pd(x_6, q_2);
+                      x_7 = _mm512_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_8, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_9, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_10, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_11, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_8 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_8));
+                    x_9 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_9));
+                    x_10 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_10));
+                    x_11 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_11));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_8 = _mm512_add_pd(x_8, q_0);
+                      x_9 = _mm512_add_pd(x_9, q_1);
+                      x_10 = _mm512_add_pd(x_10, q_2);
+                      x_11 = _mm512_add_pd(x_11, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_3));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_7));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_4 = _mm512_add_pd(x_4, q_0);
+                      x_5 = _mm512_add_pd(x_5, q_1);
+                      x_6 = _mm512_add_pd(x_6, q_2);
+                      x_7 = _mm512_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    i += 32, x += 64;
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_3));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += 8;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_maskz_loadu_pd((__mmask8)((1U << ((N_block - i) * 2)) - 1), ((double*)x));
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 48 <= N_block; i += 48, x += 96){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1072), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1080), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1088), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1096), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1104), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1112), _MM_HINT_T0);
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+                    x_8 = _mm512_loadu_pd(((double*)x) + 64);
+                    x_9 = _mm512_loadu_pd(((double*)x) + 72);
+                    x_10 = _mm512_loadu_pd(((double*)x) + 80);
+                    x_11 = _mm512_loadu_pd(((double*)x) + 88);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_4 = _mm512_add_pd(x_4, q_0);
+                      x_5 = _mm512_add_pd(x_5, q_1);
+                      x_6 = _mm512_add_pd(x_6, q_2);
+                      x_7 = _mm512_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_8 = _mm512_add_pd(x_8, q_0);
+                      x_9 = _mm512_add_pd(x_9, q_1);
+                      x_10 = _mm512_add_pd(x_10, q_2);
+                      x_11 = _mm512_add_pd(x_11, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+                    x_4 = _mm512_loadu_pd(((double*)x) + 32);
+                    x_5 = _mm512_loadu_pd(((double*)x) + 40);
+                    x_6 = _mm512_loadu_pd(((double*)x) + 48);
+                    x_7 = _mm512_loadu_pd(((double*)x) + 56);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_4 = _mm512_add_pd(x_4, q_0);
+                      x_5 = _mm512_add_pd(x_5, q_1);
+                      x_6 = _mm512_add_pd(x_6, q_2);
+                      x_7 = _mm512_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    i += 32, x += 64;
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+                    x_2 = _mm512_loadu_pd(((double*)x) + 16);
+                    x_3 = _mm512_loadu_pd(((double*)x) + 24);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+                    x_1 = _mm512_loadu_pd(((double*)x) + 8);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_loadu_pd(((double*)x));
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += 8;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_maskz_loadu_pd((__mmask8)((1U << ((N_block - i) * 2)) - 1), ((double*)x));
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((N_block - i) * 2);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm512_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm512_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm512_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm512_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm512_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm512_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 48 <= N_block; i += 48, x += ((ptrdiff_t)incX * 96)){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+                    x_8 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 64), 8);
+                    x_9 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 72), 8);
+                    x_10 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 80), 8);
+                    x_11 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 88), 8);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_3));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_7));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_4 = _mm512_add_pd(x_4, q_0);
+                      x_5 = _mm512_add_pd(x_5, q_1);
+                      x_6 = _mm512_add_pd(x_6, q_2);
+                      x_7 = _mm512_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_8, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_9, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_10, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_11, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_8 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_8));
+                    x_9 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_9));
+                    x_10 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_10));
+                    x_11 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_11));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_8 = _mm512_add_pd(x_8, q_0);
+                      x_9 = _mm512_add_pd(x_9, q_1);
+                      x_10 = _mm512_add_pd(x_10, q_2);
+                      x_11 = _mm512_add_pd(x_11, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_3));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_4, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_5, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_6, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_7, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_4 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_7));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_4 = _mm512_add_pd(x_4, q_0);
+                      x_5 = _mm512_add_pd(x_5, q_1);
+                      x_6 = _mm512_add_pd(x_6, q_2);
+                      x_7 = _mm512_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    i += 32, x += ((ptrdiff_t)incX * 64);
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_2, compression_0)), blp_mask_tmp)));
+                    q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_3, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    q_2 = _mm512_sub_pd(s_2, q_2);
+                    q_3 = _mm512_sub_pd(s_3, q_3);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm512_fmadd_pd(q_2, expansion_mask_0, _mm512_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm512_fmadd_pd(q_3, expansion_mask_0, _mm512_fmadd_pd(q_3, expansion_0, x_3));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_1, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    q_1 = _mm512_sub_pd(s_1, q_1);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm512_fmadd_pd(q_1, expansion_mask_0, _mm512_fmadd_pd(q_1, expansion_0, x_1));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << ((N_block - i) * 2)) - 1), _mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(_mm512_mul_pd(x_0, compression_0)), blp_mask_tmp)));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm512_sub_pd(s_0, q_0);
+                    x_0 = _mm512_fmadd_pd(q_0, expansion_mask_0, _mm512_fmadd_pd(q_0, expansion_0, x_0));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 48 <= N_block; i += 48, x += ((ptrdiff_t)incX * 96)){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+                    x_8 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 64), 8);
+                    x_9 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 72), 8);
+                    x_10 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 80), 8);
+                    x_11 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 88), 8);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_4 = _mm512_add_pd(x_4, q_0);
+                      x_5 = _mm512_add_pd(x_5, q_1);
+                      x_6 = _mm512_add_pd(x_6, q_2);
+                      x_7 = _mm512_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_8 = _mm512_add_pd(x_8, q_0);
+                      x_9 = _mm512_add_pd(x_9, q_1);
+                      x_10 = _mm512_add_pd(x_10, q_2);
+                      x_11 = _mm512_add_pd(x_11, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_8), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_9), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_10), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_11), blp_mask_tmp)));
+                  }
+                  if(i + 32 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+                    x_4 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 32), 8);
+                    x_5 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 40), 8);
+                    x_6 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 48), 8);
+                    x_7 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 56), 8);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_4 = _mm512_add_pd(x_4, q_0);
+                      x_5 = _mm512_add_pd(x_5, q_1);
+                      x_6 = _mm512_add_pd(x_6, q_2);
+                      x_7 = _mm512_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_4), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_5), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_6), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_7), blp_mask_tmp)));
+                    i += 32, x += ((ptrdiff_t)incX * 64);
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+                    x_2 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 16), 8);
+                    x_3 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 24), 8);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      q_2 = _mm512_add_pd(s_2, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                      q_3 = _mm512_add_pd(s_3, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      q_2 = _mm512_sub_pd(s_2, q_2);
+                      q_3 = _mm512_sub_pd(s_3, q_3);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                      x_2 = _mm512_add_pd(x_2, q_2);
+                      x_3 = _mm512_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 2)] = _mm512_add_pd(s_buffer[((j * 4) + 2)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_2), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 3)] = _mm512_add_pd(s_buffer[((j * 4) + 3)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_3), blp_mask_tmp)));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+                    x_1 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x) + ((ptrdiff_t)incX * 8), 8);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      q_1 = _mm512_add_pd(s_1, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      q_1 = _mm512_sub_pd(s_1, q_1);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                      x_1 = _mm512_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    s_buffer[((j * 4) + 1)] = _mm512_add_pd(s_buffer[((j * 4) + 1)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_1), blp_mask_tmp)));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm512_i64gather_pd(_mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << ((N_block - i) * 2)) - 1), _mm512_set_epi64((((ptrdiff_t)incX * 6) + 1), ((ptrdiff_t)incX * 6), (((ptrdiff_t)incX * 4) + 1), ((ptrdiff_t)incX * 4), (((ptrdiff_t)incX * 2) + 1), ((ptrdiff_t)incX * 2), 1, 0), ((double*)x), 8);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm512_add_pd(s_0, _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm512_sub_pd(s_0, q_0);
+                      x_0 = _mm512_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x_0), blp_mask_tmp)));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }
+              }
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[(j * 4)] = _mm512_sub_pd(s_buffer[(j * 4)], _mm512_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * j * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * j * 2)], ((double*)priY)[(((ptrdiff_t)incpriY * j * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * j * 2)], ((double*)priY)[(((ptrdiff_t)incpriY * j * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * j * 2)], 0, 0));
+                cons_tmp = _mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * j * 2))));
+                s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_sub_pd(s_buffer[((j * 4) + 1)], cons_tmp));
+                s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_sub_pd(s_buffer[((j * 4) + 2)], cons_tmp));
+                s_buffer[(j * 4)] = _mm512_add_pd(s_buffer[(j * 4)], _mm512_sub_pd(s_buffer[((j * 4) + 3)], cons_tmp));
+                _mm512_store_pd(cons_buffer_tmp, s_buffer[(j * 4)]);
+                ((double*)priY)[((ptrdiff_t)incpriY * j * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[2] + cons_buffer_tmp[4] + cons_buffer_tmp[6];
+                ((double*)priY)[(((ptrdiff_t)incpriY * j * 2) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3] + cons_buffer_tmp[5] + cons_buffer_tmp[7];
+              }
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+        }
+
+      #elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+        __m256d blp_mask_tmp;
+        {
+          __m256d tmp;
+          blp_mask_tmp = _mm256_set1_pd(1.0);
+          tmp = _mm256_set1_pd(1.0 + (DBL_EPSILON * 1.0001));
+          blp_mask_tmp = _mm256_xor_pd(blp_mask_tmp, tmp);
+        }
+        __m256d cons_tmp; (void)cons_tmp;
+        double cons_buffer_tmp[4] __attribute__((aligned(32))); (void)cons_buffer_tmp;
+        unsigned int SIMD_daz_ftz_old_tmp = 0;
+        unsigned int SIMD_daz_ftz_new_tmp = 0;
+
+
+        switch(fold){
+          case 2:
+            {
+              int i;
+              __m256d x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7;
+              __m256d compression_0;
+              __m256d expansion_0;
+              __m256d expansion_mask_0;
+              __m256d q_0, q_1, q_2, q_3;
+              __m256d s_0_0, s_0_1, s_0_2, s_0_3;
+              __m256d s_1_0, s_1_1, s_1_2, s_1_3;
+
+              s_0_0 = s_0_1 = s_0_2 = s_0_3 = _mm256_broadcast_pd((__m128d *)(((double*)priY)));
+              s_1_0 = s_1_1 = s_1_2 = s_1_3 = _mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 2)));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm256_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm256_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 16 <= N_block; i += 16, x += 32){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_3));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_7));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_3));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 16 <= N_block; i += 16, x += 32){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    x_2 = _mm256_add_pd(x_2, q_2);
+                    x_3 = _mm256_add_pd(x_3, q_3);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    x_6 = _mm256_add_pd(x_6, q_2);
+                    x_7 = _mm256_add_pd(x_7, q_3);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    x_2 = _mm256_add_pd(x_2, q_2);
+                    x_3 = _mm256_add_pd(x_3, q_3);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((N_block - i) * 2);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm256_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm256_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 16 <= N_block; i += 16, x += ((ptrdiff_t)incX * 32)){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_3));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_7));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_3));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 16 <= N_block; i += 16, x += ((ptrdiff_t)incX * 32)){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    x_2 = _mm256_add_pd(x_2, q_2);
+                    x_3 = _mm256_add_pd(x_3, q_3);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    x_6 = _mm256_add_pd(x_6, q_2);
+                    x_7 = _mm256_add_pd(x_7, q_3);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    q_2 = s_0_2;
+                    q_3 = s_0_3;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_0_2 = _mm256_add_pd(s_0_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_3 = _mm256_add_pd(s_0_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    q_2 = _mm256_sub_pd(q_2, s_0_2);
+                    q_3 = _mm256_sub_pd(q_3, s_0_3);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    x_2 = _mm256_add_pd(x_2, q_2);
+                    x_3 = _mm256_add_pd(x_3, q_3);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_1_2 = _mm256_add_pd(s_1_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_3 = _mm256_add_pd(s_1_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }
+              }
+
+              s_0_0 = _mm256_sub_pd(s_0_0, _mm256_set_pd(((double*)priY)[1], ((double*)priY)[0], 0, 0));
+              cons_tmp = _mm256_broadcast_pd((__m128d *)(((double*)((double*)priY))));
+              s_0_0 = _mm256_add_pd(s_0_0, _mm256_sub_pd(s_0_1, cons_tmp));
+              s_0_0 = _mm256_add_pd(s_0_0, _mm256_sub_pd(s_0_2, cons_tmp));
+              s_0_0 = _mm256_add_pd(s_0_0, _mm256_sub_pd(s_0_3, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_0_0);
+              ((double*)priY)[0] = cons_buffer_tmp[0] + cons_buffer_tmp[2];
+              ((double*)priY)[1] = cons_buffer_tmp[1] + cons_buffer_tmp[3];
+              s_1_0 = _mm256_sub_pd(s_1_0, _mm256_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], 0, 0));
+              cons_tmp = _mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 2)));
+              s_1_0 = _mm256_add_pd(s_1_0, _mm256_sub_pd(s_1_1, cons_tmp));
+              s_1_0 = _mm256_add_pd(s_1_0, _mm256_sub_pd(s_1_2, cons_tmp));
+              s_1_0 = _mm256_add_pd(s_1_0, _mm256_sub_pd(s_1_3, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_1_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[2];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 3:
+            {
+              int i;
+              __m256d x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7;
+              __m256d compression_0;
+              __m256d expansion_0;
+              __m256d expansion_mask_0;
+              __m256d q_0, q_1;
+              __m256d s_0_0, s_0_1;
+              __m256d s_1_0, s_1_1;
+              __m256d s_2_0, s_2_1;
+
+              s_0_0 = s_0_1 = _mm256_broadcast_pd((__m128d *)(((double*)priY)));
+              s_1_0 = s_1_1 = _mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 2)));
+              s_2_0 = s_2_1 = _mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 4)));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm256_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm256_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 16 <= N_block; i += 16, x += 32){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_2 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_3));
+                    #else
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_6 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_7));
+                    #else
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_2 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_3));
+                    #else
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 16 <= N_block; i += 16, x += 32){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((N_block - i) * 2);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm256_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm256_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 16 <= N_block; i += 16, x += ((ptrdiff_t)incX * 32)){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_2 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_3));
+                    #else
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_6 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_7));
+                    #else
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_2 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_3));
+                    #else
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 16 <= N_block; i += 16, x += ((ptrdiff_t)incX * 32)){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }
+              }
+
+              s_0_0 = _mm256_sub_pd(s_0_0, _mm256_set_pd(((double*)priY)[1], ((double*)priY)[0], 0, 0));
+              cons_tmp = _mm256_broadcast_pd((__m128d *)(((double*)((double*)priY))));
+              s_0_0 = _mm256_add_pd(s_0_0, _mm256_sub_pd(s_0_1, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_0_0);
+              ((double*)priY)[0] = cons_buffer_tmp[0] + cons_buffer_tmp[2];
+              ((double*)priY)[1] = cons_buffer_tmp[1] + cons_buffer_tmp[3];
+              s_1_0 = _mm256_sub_pd(s_1_0, _mm256_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], 0, 0));
+              cons_tmp = _mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 2)));
+              s_1_0 = _mm256_add_pd(s_1_0, _mm256_sub_pd(s_1_1, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_1_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[2];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3];
+              s_2_0 = _mm256_sub_pd(s_2_0, _mm256_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 4)], 0, 0));
+              cons_tmp = _mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 4)));
+              s_2_0 = _mm256_add_pd(s_2_0, _mm256_sub_pd(s_2_1, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_2_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 4)] = cons_buffer_tmp[0] + cons_buffer_tmp[2];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 4:
+            {
+              int i;
+              __m256d x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7, x_8, x_9, x_10, x_11;
+              __m256d compression_0;
+              __m256d expansion_0;
+              __m256d expansion_mask_0;
+              __m256d q_0, q_1;
+              __m256d s_0_0, s_0_1;
+              __m256d s_1_0, s_1_1;
+              __m256d s_2_0, s_2_1;
+              __m256d s_3_0, s_3_1;
+
+              s_0_0 = s_0_1 = _mm256_broadcast_pd((__m128d *)(((double*)priY)));
+              s_1_0 = s_1_1 = _mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 2)));
+              s_2_0 = s_2_1 = _mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 4)));
+              s_3_0 = s_3_1 = _mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * 6)));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm256_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm256_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 24 <= N_block; i += 24, x += 48){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+                    x_8 = _mm256_loadu_pd(((double*)x) + 32);
+                    x_9 = _mm256_loadu_pd(((double*)x) + 36);
+                    x_10 = _mm256_loadu_pd(((double*)x) + 40);
+                    x_11 = _mm256_loadu_pd(((double*)x) + 44);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_2 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_3));
+                    #else
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_6 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_7));
+                    #else
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_8, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_9, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_8 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_8));
+                    x_9 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_9));
+                    #else
+                    x_8 = _mm256_add_pd(_mm256_add_pd(x_8, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_9 = _mm256_add_pd(_mm256_add_pd(x_9, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_8 = _mm256_add_pd(x_8, q_0);
+                    x_9 = _mm256_add_pd(x_9, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_8 = _mm256_add_pd(x_8, q_0);
+                    x_9 = _mm256_add_pd(x_9, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_10, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_11, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_10 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_10));
+                    x_11 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_11));
+                    #else
+                    x_10 = _mm256_add_pd(_mm256_add_pd(x_10, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_11 = _mm256_add_pd(_mm256_add_pd(x_11, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_10 = _mm256_add_pd(x_10, q_0);
+                    x_11 = _mm256_add_pd(x_11, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_10 = _mm256_add_pd(x_10, q_0);
+                    x_11 = _mm256_add_pd(x_11, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_2 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_3));
+                    #else
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_6 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_7));
+                    #else
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_2 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_3));
+                    #else
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 24 <= N_block; i += 24, x += 48){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+                    x_8 = _mm256_loadu_pd(((double*)x) + 32);
+                    x_9 = _mm256_loadu_pd(((double*)x) + 36);
+                    x_10 = _mm256_loadu_pd(((double*)x) + 40);
+                    x_11 = _mm256_loadu_pd(((double*)x) + 44);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_8 = _mm256_add_pd(x_8, q_0);
+                    x_9 = _mm256_add_pd(x_9, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_8 = _mm256_add_pd(x_8, q_0);
+                    x_9 = _mm256_add_pd(x_9, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_8 = _mm256_add_pd(x_8, q_0);
+                    x_9 = _mm256_add_pd(x_9, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_10 = _mm256_add_pd(x_10, q_0);
+                    x_11 = _mm256_add_pd(x_11, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_10 = _mm256_add_pd(x_10, q_0);
+                    x_11 = _mm256_add_pd(x_11, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_10 = _mm256_add_pd(x_10, q_0);
+                    x_11 = _mm256_add_pd(x_11, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((N_block - i) * 2);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm256_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm256_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 24 <= N_block; i += 24, x += ((ptrdiff_t)incX * 48)){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+                    x_8 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 34) + 1)], ((double*)x)[((ptrdiff_t)incX * 34)], ((double*)x)[(((ptrdiff_t)incX * 32) + 1)], ((double*)x)[((ptrdiff_t)incX * 32)]);
+                    x_9 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 38) + 1)], ((double*)x)[((ptrdiff_t)incX * 38)], ((double*)x)[(((ptrdiff_t)incX * 36) + 1)], ((double*)x)[((ptrdiff_t)incX * 36)]);
+                    x_10 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 42) + 1)], ((double*)x)[((ptrdiff_t)incX * 42)], ((double*)x)[(((ptrdiff_t)incX * 40) + 1)], ((double*)x)[((ptrdiff_t)incX * 40)]);
+                    x_11 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 46) + 1)], ((double*)x)[((ptrdiff_t)incX * 46)], ((double*)x)[(((ptrdiff_t)incX * 44) + 1)], ((double*)x)[((ptrdiff_t)incX * 44)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_2 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_3));
+                    #else
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_6 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_7));
+                    #else
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_8, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_9, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_8 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_8));
+                    x_9 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_9));
+                    #else
+                    x_8 = _mm256_add_pd(_mm256_add_pd(x_8, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_9 = _mm256_add_pd(_mm256_add_pd(x_9, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_8 = _mm256_add_pd(x_8, q_0);
+                    x_9 = _mm256_add_pd(x_9, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_8 = _mm256_add_pd(x_8, q_0);
+                    x_9 = _mm256_add_pd(x_9, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_10, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_11, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_10 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_10));
+                    x_11 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_11));
+                    #else
+                    x_10 = _mm256_add_pd(_mm256_add_pd(x_10, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_11 = _mm256_add_pd(_mm256_add_pd(x_11, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_10 = _mm256_add_pd(x_10, q_0);
+                    x_11 = _mm256_add_pd(x_11, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_10 = _mm256_add_pd(x_10, q_0);
+                    x_11 = _mm256_add_pd(x_11, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_2 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_3));
+                    #else
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_6 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_7));
+                    #else
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_2 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_3));
+                    #else
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 24 <= N_block; i += 24, x += ((ptrdiff_t)incX * 48)){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+                    x_8 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 34) + 1)], ((double*)x)[((ptrdiff_t)incX * 34)], ((double*)x)[(((ptrdiff_t)incX * 32) + 1)], ((double*)x)[((ptrdiff_t)incX * 32)]);
+                    x_9 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 38) + 1)], ((double*)x)[((ptrdiff_t)incX * 38)], ((double*)x)[(((ptrdiff_t)incX * 36) + 1)], ((double*)x)[((ptrdiff_t)incX * 36)]);
+                    x_10 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 42) + 1)], ((double*)x)[((ptrdiff_t)incX * 42)], ((double*)x)[(((ptrdiff_t)incX * 40) + 1)], ((double*)x)[((ptrdiff_t)incX * 40)]);
+                    x_11 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 46) + 1)], ((double*)x)[((ptrdiff_t)incX * 46)], ((double*)x)[(((ptrdiff_t)incX * 44) + 1)], ((double*)x)[((ptrdiff_t)incX * 44)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_8 = _mm256_add_pd(x_8, q_0);
+                    x_9 = _mm256_add_pd(x_9, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_8 = _mm256_add_pd(x_8, q_0);
+                    x_9 = _mm256_add_pd(x_9, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_8 = _mm256_add_pd(x_8, q_0);
+                    x_9 = _mm256_add_pd(x_9, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_10 = _mm256_add_pd(x_10, q_0);
+                    x_11 = _mm256_add_pd(x_11, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_10 = _mm256_add_pd(x_10, q_0);
+                    x_11 = _mm256_add_pd(x_11, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_10 = _mm256_add_pd(x_10, q_0);
+                    x_11 = _mm256_add_pd(x_11, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_11, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_4 = _mm256_add_pd(x_4, q_0);
+                    x_5 = _mm256_add_pd(x_5, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_6 = _mm256_add_pd(x_6, q_0);
+                    x_7 = _mm256_add_pd(x_7, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_7, blp_mask_tmp));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_2 = _mm256_add_pd(x_2, q_0);
+                    x_3 = _mm256_add_pd(x_3, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm256_add_pd(s_0_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    q_1 = _mm256_sub_pd(q_1, s_0_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm256_add_pd(s_1_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    q_1 = _mm256_sub_pd(q_1, s_1_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm256_add_pd(s_2_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    q_1 = _mm256_sub_pd(q_1, s_2_1);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    x_1 = _mm256_add_pd(x_1, q_1);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm256_add_pd(s_3_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm256_add_pd(s_0_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_0_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm256_add_pd(s_1_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_1_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm256_add_pd(s_2_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm256_sub_pd(q_0, s_2_0);
+                    x_0 = _mm256_add_pd(x_0, q_0);
+                    s_3_0 = _mm256_add_pd(s_3_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }
+              }
+
+              s_0_0 = _mm256_sub_pd(s_0_0, _mm256_set_pd(((double*)priY)[1], ((double*)priY)[0], 0, 0));
+              cons_tmp = _mm256_broadcast_pd((__m128d *)(((double*)((double*)priY))));
+              s_0_0 = _mm256_add_pd(s_0_0, _mm256_sub_pd(s_0_1, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_0_0);
+              ((double*)priY)[0] = cons_buffer_tmp[0] + cons_buffer_tmp[2];
+              ((double*)priY)[1] = cons_buffer_tmp[1] + cons_buffer_tmp[3];
+              s_1_0 = _mm256_sub_pd(s_1_0, _mm256_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 2)], 0, 0));
+              cons_tmp = _mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 2)));
+              s_1_0 = _mm256_add_pd(s_1_0, _mm256_sub_pd(s_1_1, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_1_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[2];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3];
+              s_2_0 = _mm256_sub_pd(s_2_0, _mm256_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 4)], 0, 0));
+              cons_tmp = _mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 4)));
+              s_2_0 = _mm256_add_pd(s_2_0, _mm256_sub_pd(s_2_1, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_2_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 4)] = cons_buffer_tmp[0] + cons_buffer_tmp[2];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3];
+              s_3_0 = _mm256_sub_pd(s_3_0, _mm256_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * 6) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * 6)], 0, 0));
+              cons_tmp = _mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 6)));
+              s_3_0 = _mm256_add_pd(s_3_0, _mm256_sub_pd(s_3_1, cons_tmp));
+              _mm256_store_pd(cons_buffer_tmp, s_3_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 6)] = cons_buffer_tmp[0] + cons_buffer_tmp[2];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 6) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          default:
+            {
+              int i, j;
+              __m256d x_0, x_1, x_2, x_3, x_4, x_5, x_6, x_7, x_8, x_9, x_10, x_11;
+              __m256d compression_0;
+              __m256d expansion_0;
+              __m256d expansion_mask_0;
+              __m256d q_0, q_1, q_2, q_3;
+              __m256d s_0, s_1, s_2, s_3;
+              __m256d s_buffer[(binned_DBMAXFOLD * 4)];
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[(j * 4)] = s_buffer[((j * 4) + 1)] = s_buffer[((j * 4) + 2)] = s_buffer[((j * 4) + 3)] = _mm256_broadcast_pd((__m128d *)(((double*)priY) + ((ptrdiff_t)incpriY * j * 2)));
+              }
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm256_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm256_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 24 <= N_block; i += 24, x += 48){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+                    x_8 = _mm256_loadu_pd(((double*)x) + 32);
+                    x_9 = _mm256_loadu_pd(((double*)x) + 36);
+                    x_10 = _mm256_loadu_pd(((double*)x) + 40);
+                    x_11 = _mm256_loadu_pd(((double*)x) + 44);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_3));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_7));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_4 = _mm256_add_pd(x_4, q_0);
+                      x_5 = _mm256_add_pd(x_5, q_1);
+                      x_6 = _mm256_add_pd(x_6, q_2);
+                      x_7 = _mm256_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_7, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_8, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_9, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_10, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_11, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_8 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_8));
+                    x_9 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_9));
+                    x_10 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_10));
+                    x_11 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_11));
+                    #else
+                    x_8 = _mm256_add_pd(_mm256_add_pd(x_8, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_9 = _mm256_add_pd(_mm256_add_pd(x_9, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_10 = _mm256_add_pd(_mm256_add_pd(x_10, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_11 = _mm256_add_pd(_mm256_add_pd(x_11, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_10, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_11, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_8 = _mm256_add_pd(x_8, q_0);
+                      x_9 = _mm256_add_pd(x_9, q_1);
+                      x_10 = _mm256_add_pd(x_10, q_2);
+                      x_11 = _mm256_add_pd(x_11, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_9, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_11, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_3));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_7));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_4 = _mm256_add_pd(x_4, q_0);
+                      x_5 = _mm256_add_pd(x_5, q_1);
+                      x_6 = _mm256_add_pd(x_6, q_2);
+                      x_7 = _mm256_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_7, blp_mask_tmp));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_3));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 24 <= N_block; i += 24, x += 48){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1040), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1048), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1056), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1064), _MM_HINT_T0);
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+                    x_8 = _mm256_loadu_pd(((double*)x) + 32);
+                    x_9 = _mm256_loadu_pd(((double*)x) + 36);
+                    x_10 = _mm256_loadu_pd(((double*)x) + 40);
+                    x_11 = _mm256_loadu_pd(((double*)x) + 44);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_4 = _mm256_add_pd(x_4, q_0);
+                      x_5 = _mm256_add_pd(x_5, q_1);
+                      x_6 = _mm256_add_pd(x_6, q_2);
+                      x_7 = _mm256_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_7, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_10, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_11, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_8 = _mm256_add_pd(x_8, q_0);
+                      x_9 = _mm256_add_pd(x_9, q_1);
+                      x_10 = _mm256_add_pd(x_10, q_2);
+                      x_11 = _mm256_add_pd(x_11, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_9, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_11, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+                    x_4 = _mm256_loadu_pd(((double*)x) + 16);
+                    x_5 = _mm256_loadu_pd(((double*)x) + 20);
+                    x_6 = _mm256_loadu_pd(((double*)x) + 24);
+                    x_7 = _mm256_loadu_pd(((double*)x) + 28);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_4 = _mm256_add_pd(x_4, q_0);
+                      x_5 = _mm256_add_pd(x_5, q_1);
+                      x_6 = _mm256_add_pd(x_6, q_2);
+                      x_7 = _mm256_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_7, blp_mask_tmp));
+                    i += 16, x += 32;
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+                    x_2 = _mm256_loadu_pd(((double*)x) + 8);
+                    x_3 = _mm256_loadu_pd(((double*)x) + 12);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += 16;
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+                    x_1 = _mm256_loadu_pd(((double*)x) + 4);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_loadu_pd(((double*)x));
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((N_block - i) * 2);
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm256_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm256_set_pd(1.0, binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm256_set_pd(1.0, binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm256_set_pd(0.0, binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm256_set_pd(binned_DMCOMPRESSION, 1.0, binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 1.0, binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm256_set_pd(binned_DMEXPANSION * 0.5, 0.0, binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 24 <= N_block; i += 24, x += ((ptrdiff_t)incX * 48)){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+                    x_8 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 34) + 1)], ((double*)x)[((ptrdiff_t)incX * 34)], ((double*)x)[(((ptrdiff_t)incX * 32) + 1)], ((double*)x)[((ptrdiff_t)incX * 32)]);
+                    x_9 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 38) + 1)], ((double*)x)[((ptrdiff_t)incX * 38)], ((double*)x)[(((ptrdiff_t)incX * 36) + 1)], ((double*)x)[((ptrdiff_t)incX * 36)]);
+                    x_10 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 42) + 1)], ((double*)x)[((ptrdiff_t)incX * 42)], ((double*)x)[(((ptrdiff_t)incX * 40) + 1)], ((double*)x)[((ptrdiff_t)incX * 40)]);
+                    x_11 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 46) + 1)], ((double*)x)[((ptrdiff_t)incX * 46)], ((double*)x)[(((ptrdiff_t)incX * 44) + 1)], ((double*)x)[((ptrdiff_t)incX * 44)]);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_3));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_7));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_4 = _mm256_add_pd(x_4, q_0);
+                      x_5 = _mm256_add_pd(x_5, q_1);
+                      x_6 = _mm256_add_pd(x_6, q_2);
+                      x_7 = _mm256_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_7, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_8, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_9, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_10, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_11, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_8 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_8));
+                    x_9 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_9));
+                    x_10 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_10));
+                    x_11 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_11));
+                    #else
+                    x_8 = _mm256_add_pd(_mm256_add_pd(x_8, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_9 = _mm256_add_pd(_mm256_add_pd(x_9, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_10 = _mm256_add_pd(_mm256_add_pd(x_10, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_11 = _mm256_add_pd(_mm256_add_pd(x_11, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_10, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_11, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_8 = _mm256_add_pd(x_8, q_0);
+                      x_9 = _mm256_add_pd(x_9, q_1);
+                      x_10 = _mm256_add_pd(x_10, q_2);
+                      x_11 = _mm256_add_pd(x_11, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_9, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_11, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_3));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_6, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_7, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_4 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_4));
+                    x_5 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_5));
+                    x_6 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_6));
+                    x_7 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_7));
+                    #else
+                    x_4 = _mm256_add_pd(_mm256_add_pd(x_4, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm256_add_pd(_mm256_add_pd(x_5, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_6 = _mm256_add_pd(_mm256_add_pd(x_6, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_7 = _mm256_add_pd(_mm256_add_pd(x_7, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_4 = _mm256_add_pd(x_4, q_0);
+                      x_5 = _mm256_add_pd(x_5, q_1);
+                      x_6 = _mm256_add_pd(x_6, q_2);
+                      x_7 = _mm256_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_7, blp_mask_tmp));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    s_2 = s_buffer[2];
+                    s_3 = s_buffer[3];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_2 = _mm256_add_pd(s_2, _mm256_or_pd(_mm256_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    q_3 = _mm256_add_pd(s_3, _mm256_or_pd(_mm256_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    s_buffer[2] = q_2;
+                    s_buffer[3] = q_3;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    q_2 = _mm256_sub_pd(s_2, q_2);
+                    q_3 = _mm256_sub_pd(s_3, q_3);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    x_2 = _mm256_fmadd_pd(q_2, expansion_mask_0, _mm256_fmadd_pd(q_2, expansion_0, x_2));
+                    x_3 = _mm256_fmadd_pd(q_3, expansion_mask_0, _mm256_fmadd_pd(q_3, expansion_0, x_3));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    x_2 = _mm256_add_pd(_mm256_add_pd(x_2, _mm256_mul_pd(q_2, expansion_0)), _mm256_mul_pd(q_2, expansion_mask_0));
+                    x_3 = _mm256_add_pd(_mm256_add_pd(x_3, _mm256_mul_pd(q_3, expansion_0)), _mm256_mul_pd(q_3, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm256_add_pd(s_1, _mm256_or_pd(_mm256_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    q_1 = _mm256_sub_pd(s_1, q_1);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    x_1 = _mm256_fmadd_pd(q_1, expansion_mask_0, _mm256_fmadd_pd(q_1, expansion_0, x_1));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm256_add_pd(_mm256_add_pd(x_1, _mm256_mul_pd(q_1, expansion_0)), _mm256_mul_pd(q_1, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm256_add_pd(s_0, _mm256_or_pd(_mm256_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm256_sub_pd(s_0, q_0);
+                    #if defined(__FMA__)
+                    x_0 = _mm256_fmadd_pd(q_0, expansion_mask_0, _mm256_fmadd_pd(q_0, expansion_0, x_0));
+                    #else
+                    x_0 = _mm256_add_pd(_mm256_add_pd(x_0, _mm256_mul_pd(q_0, expansion_0)), _mm256_mul_pd(q_0, expansion_mask_0));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }else{
+                  for(i = 0; i + 24 <= N_block; i += 24, x += ((ptrdiff_t)incX * 48)){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+                    x_8 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 34) + 1)], ((double*)x)[((ptrdiff_t)incX * 34)], ((double*)x)[(((ptrdiff_t)incX * 32) + 1)], ((double*)x)[((ptrdiff_t)incX * 32)]);
+                    x_9 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 38) + 1)], ((double*)x)[((ptrdiff_t)incX * 38)], ((double*)x)[(((ptrdiff_t)incX * 36) + 1)], ((double*)x)[((ptrdiff_t)incX * 36)]);
+                    x_10 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 42) + 1)], ((double*)x)[((ptrdiff_t)incX * 42)], ((double*)x)[(((ptrdiff_t)incX * 40) + 1)], ((double*)x)[((ptrdiff_t)incX * 40)]);
+                    x_11 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 46) + 1)], ((double*)x)[((ptrdiff_t)incX * 46)], ((double*)x)[(((ptrdiff_t)incX * 44) + 1)], ((double*)x)[((ptrdiff_t)incX * 44)]);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_4 = _mm256_add_pd(x_4, q_0);
+                      x_5 = _mm256_add_pd(x_5, q_1);
+                      x_6 = _mm256_add_pd(x_6, q_2);
+                      x_7 = _mm256_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_7, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_8, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_9, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_10, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_11, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_8 = _mm256_add_pd(x_8, q_0);
+                      x_9 = _mm256_add_pd(x_9, q_1);
+                      x_10 = _mm256_add_pd(x_10, q_2);
+                      x_11 = _mm256_add_pd(x_11, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_8, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_9, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_10, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_11, blp_mask_tmp));
+                  }
+                  if(i + 16 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+                    x_4 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 18) + 1)], ((double*)x)[((ptrdiff_t)incX * 18)], ((double*)x)[(((ptrdiff_t)incX * 16) + 1)], ((double*)x)[((ptrdiff_t)incX * 16)]);
+                    x_5 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 22) + 1)], ((double*)x)[((ptrdiff_t)incX * 22)], ((double*)x)[(((ptrdiff_t)incX * 20) + 1)], ((double*)x)[((ptrdiff_t)incX * 20)]);
+                    x_6 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 26) + 1)], ((double*)x)[((ptrdiff_t)incX * 26)], ((double*)x)[(((ptrdiff_t)incX * 24) + 1)], ((double*)x)[((ptrdiff_t)incX * 24)]);
+                    x_7 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 30) + 1)], ((double*)x)[((ptrdiff_t)incX * 30)], ((double*)x)[(((ptrdiff_t)incX * 28) + 1)], ((double*)x)[((ptrdiff_t)incX * 28)]);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_4, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_5, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_6, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_7, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_4 = _mm256_add_pd(x_4, q_0);
+                      x_5 = _mm256_add_pd(x_5, q_1);
+                      x_6 = _mm256_add_pd(x_6, q_2);
+                      x_7 = _mm256_add_pd(x_7, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_4, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_5, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_6, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_7, blp_mask_tmp));
+                    i += 16, x += ((ptrdiff_t)incX * 32);
+                  }
+                  if(i + 8 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+                    x_2 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 10) + 1)], ((double*)x)[((ptrdiff_t)incX * 10)], ((double*)x)[(((ptrdiff_t)incX * 8) + 1)], ((double*)x)[((ptrdiff_t)incX * 8)]);
+                    x_3 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 14) + 1)], ((double*)x)[((ptrdiff_t)incX * 14)], ((double*)x)[(((ptrdiff_t)incX * 12) + 1)], ((double*)x)[((ptrdiff_t)incX * 12)]);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      s_2 = s_buffer[((j * 4) + 2)];
+                      s_3 = s_buffer[((j * 4) + 3)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      q_2 = _mm256_add_pd(s_2, _mm256_or_pd(x_2, blp_mask_tmp));
+                      q_3 = _mm256_add_pd(s_3, _mm256_or_pd(x_3, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      s_buffer[((j * 4) + 2)] = q_2;
+                      s_buffer[((j * 4) + 3)] = q_3;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      q_2 = _mm256_sub_pd(s_2, q_2);
+                      q_3 = _mm256_sub_pd(s_3, q_3);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                      x_2 = _mm256_add_pd(x_2, q_2);
+                      x_3 = _mm256_add_pd(x_3, q_3);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    s_buffer[((j * 4) + 2)] = _mm256_add_pd(s_buffer[((j * 4) + 2)], _mm256_or_pd(x_2, blp_mask_tmp));
+                    s_buffer[((j * 4) + 3)] = _mm256_add_pd(s_buffer[((j * 4) + 3)], _mm256_or_pd(x_3, blp_mask_tmp));
+                    i += 8, x += ((ptrdiff_t)incX * 16);
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+                    x_1 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 6) + 1)], ((double*)x)[((ptrdiff_t)incX * 6)], ((double*)x)[(((ptrdiff_t)incX * 4) + 1)], ((double*)x)[((ptrdiff_t)incX * 4)]);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      s_1 = s_buffer[((j * 4) + 1)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm256_add_pd(s_1, _mm256_or_pd(x_1, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      s_buffer[((j * 4) + 1)] = q_1;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      q_1 = _mm256_sub_pd(s_1, q_1);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                      x_1 = _mm256_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 4) + 1)] = _mm256_add_pd(s_buffer[((j * 4) + 1)], _mm256_or_pd(x_1, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm256_set_pd(((double*)x)[(((ptrdiff_t)incX * 2) + 1)], ((double*)x)[((ptrdiff_t)incX * 2)], ((double*)x)[1], ((double*)x)[0]);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i < N_block){
+                    x_0 = _mm256_set_pd(0, 0, ((double*)x)[1], ((double*)x)[0]);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 4)];
+                      q_0 = _mm256_add_pd(s_0, _mm256_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 4)] = q_0;
+                      q_0 = _mm256_sub_pd(s_0, q_0);
+                      x_0 = _mm256_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_or_pd(x_0, blp_mask_tmp));
+                    x += ((ptrdiff_t)incX * (N_block - i) * 2);
+                  }
+                }
+              }
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[(j * 4)] = _mm256_sub_pd(s_buffer[(j * 4)], _mm256_set_pd(((double*)priY)[(((ptrdiff_t)incpriY * j * 2) + 1)], ((double*)priY)[((ptrdiff_t)incpriY * j * 2)], 0, 0));
+                cons_tmp = _mm256_broadcast_pd((__m128d *)(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * j * 2)));
+                s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_sub_pd(s_buffer[((j * 4) + 1)], cons_tmp));
+                s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_sub_pd(s_buffer[((j * 4) + 2)], cons_tmp));
+                s_buffer[(j * 4)] = _mm256_add_pd(s_buffer[(j * 4)], _mm256_sub_pd(s_buffer[((j * 4) + 3)], cons_tmp));
+                _mm256_store_pd(cons_buffer_tmp, s_buffer[(j * 4)]);
+                ((double*)priY)[((ptrdiff_t)incpriY * j * 2)] = cons_buffer_tmp[0] + cons_buffer_tmp[2];
+                ((double*)priY)[(((ptrdiff_t)incpriY * j * 2) + 1)] = cons_buffer_tmp[1] + cons_buffer_tmp[3];
+              }
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+        }
+
+      #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+        __m128d blp_mask_tmp;
+        {
+          __m128d tmp;
+          blp_mask_tmp = _mm_set1_pd(1.0);
+          tmp = _mm_set1_pd(1.0 + (DBL_EPSILON * 1.0001));
+          blp_mask_tmp = _mm_xor_pd(blp_mask_tmp, tmp);
+        }
+        __m128d cons_tmp; (void)cons_tmp;
+        double cons_buffer_tmp[2] __attribute__((aligned(16))); (void)cons_buffer_tmp;
+        unsigned int SIMD_daz_ftz_old_tmp = 0;
+        unsigned int SIMD_daz_ftz_new_tmp = 0;
+
+
+        switch(fold){
+          case 2:
+            {
+              int i;
+              __m128d x_0, x_1, x_2, x_3;
+              __m128d compression_0;
+              __m128d expansion_0;
+              __m128d expansion_mask_0;
+              __m128d q_0, q_1;
+              __m128d s_0_0, s_0_1;
+              __m128d s_1_0, s_1_1;
+
+              s_0_0 = s_0_1 = _mm_loadu_pd(((double*)priY));
+              s_1_0 = s_1_1 = _mm_loadu_pd(((double*)priY) + ((ptrdiff_t)incpriY * 2));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm_set_pd(1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set_pd(1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set_pd(0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm_set_pd(binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 4 <= N_block; i += 4, x += 8){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+                    x_2 = _mm_loadu_pd(((double*)x) + 4);
+                    x_3 = _mm_loadu_pd(((double*)x) + 6);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(_mm_add_pd(x_2, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm_add_pd(_mm_add_pd(x_3, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += 2;
+                  }
+                }else{
+                  for(i = 0; i + 4 <= N_block; i += 4, x += 8){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+                    x_2 = _mm_loadu_pd(((double*)x) + 4);
+                    x_3 = _mm_loadu_pd(((double*)x) + 6);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += 2;
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm_set_pd(1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set_pd(1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set_pd(0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm_set_pd(binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 4 <= N_block; i += 4, x += ((ptrdiff_t)incX * 8)){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+                    x_2 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 4));
+                    x_3 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 6));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(_mm_add_pd(x_2, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm_add_pd(_mm_add_pd(x_3, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += ((ptrdiff_t)incX * 2);
+                  }
+                }else{
+                  for(i = 0; i + 4 <= N_block; i += 4, x += ((ptrdiff_t)incX * 8)){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+                    x_2 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 4));
+                    x_3 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 6));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += ((ptrdiff_t)incX * 2);
+                  }
+                }
+              }
+
+              cons_tmp = _mm_loadu_pd(((double*)((double*)priY)));
+              s_0_0 = _mm_add_pd(s_0_0, _mm_sub_pd(s_0_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_0_0);
+              ((double*)priY)[0] = cons_buffer_tmp[0];
+              ((double*)priY)[1] = cons_buffer_tmp[1];
+              cons_tmp = _mm_loadu_pd(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 2));
+              s_1_0 = _mm_add_pd(s_1_0, _mm_sub_pd(s_1_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_1_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)] = cons_buffer_tmp[1];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 3:
+            {
+              int i;
+              __m128d x_0, x_1, x_2, x_3, x_4, x_5;
+              __m128d compression_0;
+              __m128d expansion_0;
+              __m128d expansion_mask_0;
+              __m128d q_0, q_1;
+              __m128d s_0_0, s_0_1;
+              __m128d s_1_0, s_1_1;
+              __m128d s_2_0, s_2_1;
+
+              s_0_0 = s_0_1 = _mm_loadu_pd(((double*)priY));
+              s_1_0 = s_1_1 = _mm_loadu_pd(((double*)priY) + ((ptrdiff_t)incpriY * 2));
+              s_2_0 = s_2_1 = _mm_loadu_pd(((double*)priY) + ((ptrdiff_t)incpriY * 4));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm_set_pd(1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set_pd(1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set_pd(0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm_set_pd(binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 6 <= N_block; i += 6, x += 12){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+                    x_2 = _mm_loadu_pd(((double*)x) + 4);
+                    x_3 = _mm_loadu_pd(((double*)x) + 6);
+                    x_4 = _mm_loadu_pd(((double*)x) + 8);
+                    x_5 = _mm_loadu_pd(((double*)x) + 10);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(_mm_add_pd(x_2, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm_add_pd(_mm_add_pd(x_3, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_4 = _mm_add_pd(_mm_add_pd(x_4, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm_add_pd(_mm_add_pd(x_5, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_5, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+                    x_2 = _mm_loadu_pd(((double*)x) + 4);
+                    x_3 = _mm_loadu_pd(((double*)x) + 6);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(_mm_add_pd(x_2, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm_add_pd(_mm_add_pd(x_3, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += 2;
+                  }
+                }else{
+                  for(i = 0; i + 6 <= N_block; i += 6, x += 12){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+                    x_2 = _mm_loadu_pd(((double*)x) + 4);
+                    x_3 = _mm_loadu_pd(((double*)x) + 6);
+                    x_4 = _mm_loadu_pd(((double*)x) + 8);
+                    x_5 = _mm_loadu_pd(((double*)x) + 10);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_5, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+                    x_2 = _mm_loadu_pd(((double*)x) + 4);
+                    x_3 = _mm_loadu_pd(((double*)x) + 6);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += 2;
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm_set_pd(1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set_pd(1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set_pd(0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm_set_pd(binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 6 <= N_block; i += 6, x += ((ptrdiff_t)incX * 12)){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+                    x_2 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 4));
+                    x_3 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 6));
+                    x_4 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 8));
+                    x_5 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 10));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(_mm_add_pd(x_2, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm_add_pd(_mm_add_pd(x_3, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_4 = _mm_add_pd(_mm_add_pd(x_4, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm_add_pd(_mm_add_pd(x_5, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_5, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+                    x_2 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 4));
+                    x_3 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 6));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(_mm_add_pd(x_2, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm_add_pd(_mm_add_pd(x_3, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += ((ptrdiff_t)incX * 2);
+                  }
+                }else{
+                  for(i = 0; i + 6 <= N_block; i += 6, x += ((ptrdiff_t)incX * 12)){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+                    x_2 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 4));
+                    x_3 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 6));
+                    x_4 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 8));
+                    x_5 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 10));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_5, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+                    x_2 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 4));
+                    x_3 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 6));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += ((ptrdiff_t)incX * 2);
+                  }
+                }
+              }
+
+              cons_tmp = _mm_loadu_pd(((double*)((double*)priY)));
+              s_0_0 = _mm_add_pd(s_0_0, _mm_sub_pd(s_0_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_0_0);
+              ((double*)priY)[0] = cons_buffer_tmp[0];
+              ((double*)priY)[1] = cons_buffer_tmp[1];
+              cons_tmp = _mm_loadu_pd(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 2));
+              s_1_0 = _mm_add_pd(s_1_0, _mm_sub_pd(s_1_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_1_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)] = cons_buffer_tmp[1];
+              cons_tmp = _mm_loadu_pd(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 4));
+              s_2_0 = _mm_add_pd(s_2_0, _mm_sub_pd(s_2_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_2_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 4)] = cons_buffer_tmp[0];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)] = cons_buffer_tmp[1];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          case 4:
+            {
+              int i;
+              __m128d x_0, x_1, x_2, x_3, x_4, x_5;
+              __m128d compression_0;
+              __m128d expansion_0;
+              __m128d expansion_mask_0;
+              __m128d q_0, q_1;
+              __m128d s_0_0, s_0_1;
+              __m128d s_1_0, s_1_1;
+              __m128d s_2_0, s_2_1;
+              __m128d s_3_0, s_3_1;
+
+              s_0_0 = s_0_1 = _mm_loadu_pd(((double*)priY));
+              s_1_0 = s_1_1 = _mm_loadu_pd(((double*)priY) + ((ptrdiff_t)incpriY * 2));
+              s_2_0 = s_2_1 = _mm_loadu_pd(((double*)priY) + ((ptrdiff_t)incpriY * 4));
+              s_3_0 = s_3_1 = _mm_loadu_pd(((double*)priY) + ((ptrdiff_t)incpriY * 6));
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm_set_pd(1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set_pd(1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set_pd(0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm_set_pd(binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 6 <= N_block; i += 6, x += 12){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+                    x_2 = _mm_loadu_pd(((double*)x) + 4);
+                    x_3 = _mm_loadu_pd(((double*)x) + 6);
+                    x_4 = _mm_loadu_pd(((double*)x) + 8);
+                    x_5 = _mm_loadu_pd(((double*)x) + 10);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(_mm_add_pd(x_2, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm_add_pd(_mm_add_pd(x_3, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_4 = _mm_add_pd(_mm_add_pd(x_4, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm_add_pd(_mm_add_pd(x_5, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_5, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+                    x_2 = _mm_loadu_pd(((double*)x) + 4);
+                    x_3 = _mm_loadu_pd(((double*)x) + 6);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(_mm_add_pd(x_2, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm_add_pd(_mm_add_pd(x_3, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += 2;
+                  }
+                }else{
+                  for(i = 0; i + 6 <= N_block; i += 6, x += 12){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    _mm_prefetch((const char*)(((double*)x) + 1032), _MM_HINT_T0);
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+                    x_2 = _mm_loadu_pd(((double*)x) + 4);
+                    x_3 = _mm_loadu_pd(((double*)x) + 6);
+                    x_4 = _mm_loadu_pd(((double*)x) + 8);
+                    x_5 = _mm_loadu_pd(((double*)x) + 10);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_5, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+                    x_2 = _mm_loadu_pd(((double*)x) + 4);
+                    x_3 = _mm_loadu_pd(((double*)x) + 6);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    i += 4, x += 8;
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += 4;
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += 2;
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm_set_pd(1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set_pd(1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set_pd(0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm_set_pd(binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 6 <= N_block; i += 6, x += ((ptrdiff_t)incX * 12)){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+                    x_2 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 4));
+                    x_3 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 6));
+                    x_4 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 8));
+                    x_5 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 10));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(_mm_add_pd(x_2, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm_add_pd(_mm_add_pd(x_3, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_4, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_5, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_4 = _mm_add_pd(_mm_add_pd(x_4, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_5 = _mm_add_pd(_mm_add_pd(x_5, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_5, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+                    x_2 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 4));
+                    x_3 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 6));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_2, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_3, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(_mm_add_pd(x_2, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_3 = _mm_add_pd(_mm_add_pd(x_3, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += ((ptrdiff_t)incX * 2);
+                  }
+                }else{
+                  for(i = 0; i + 6 <= N_block; i += 6, x += ((ptrdiff_t)incX * 12)){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+                    x_2 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 4));
+                    x_3 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 6));
+                    x_4 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 8));
+                    x_5 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 10));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_5, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_4 = _mm_add_pd(x_4, q_0);
+                    x_5 = _mm_add_pd(x_5, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_4, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_5, blp_mask_tmp));
+                  }
+                  if(i + 4 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+                    x_2 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 4));
+                    x_3 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 6));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_2 = _mm_add_pd(x_2, q_0);
+                    x_3 = _mm_add_pd(x_3, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_2, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_3, blp_mask_tmp));
+                    i += 4, x += ((ptrdiff_t)incX * 8);
+                  }
+                  if(i + 2 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_0_1 = _mm_add_pd(s_0_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    q_1 = _mm_sub_pd(q_1, s_0_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_1_1 = _mm_add_pd(s_1_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    q_1 = _mm_sub_pd(q_1, s_1_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    q_0 = s_2_0;
+                    q_1 = s_2_1;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_2_1 = _mm_add_pd(s_2_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    q_1 = _mm_sub_pd(q_1, s_2_1);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    x_1 = _mm_add_pd(x_1, q_1);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    s_3_1 = _mm_add_pd(s_3_1, _mm_or_pd(x_1, blp_mask_tmp));
+                    i += 2, x += ((ptrdiff_t)incX * 4);
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    q_0 = s_0_0;
+                    s_0_0 = _mm_add_pd(s_0_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_0_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    q_0 = s_1_0;
+                    s_1_0 = _mm_add_pd(s_1_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_1_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    q_0 = s_2_0;
+                    s_2_0 = _mm_add_pd(s_2_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    q_0 = _mm_sub_pd(q_0, s_2_0);
+                    x_0 = _mm_add_pd(x_0, q_0);
+                    s_3_0 = _mm_add_pd(s_3_0, _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += ((ptrdiff_t)incX * 2);
+                  }
+                }
+              }
+
+              cons_tmp = _mm_loadu_pd(((double*)((double*)priY)));
+              s_0_0 = _mm_add_pd(s_0_0, _mm_sub_pd(s_0_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_0_0);
+              ((double*)priY)[0] = cons_buffer_tmp[0];
+              ((double*)priY)[1] = cons_buffer_tmp[1];
+              cons_tmp = _mm_loadu_pd(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 2));
+              s_1_0 = _mm_add_pd(s_1_0, _mm_sub_pd(s_1_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_1_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 2)] = cons_buffer_tmp[0];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)] = cons_buffer_tmp[1];
+              cons_tmp = _mm_loadu_pd(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 4));
+              s_2_0 = _mm_add_pd(s_2_0, _mm_sub_pd(s_2_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_2_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 4)] = cons_buffer_tmp[0];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)] = cons_buffer_tmp[1];
+              cons_tmp = _mm_loadu_pd(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * 6));
+              s_3_0 = _mm_add_pd(s_3_0, _mm_sub_pd(s_3_1, cons_tmp));
+              _mm_store_pd(cons_buffer_tmp, s_3_0);
+              ((double*)priY)[((ptrdiff_t)incpriY * 6)] = cons_buffer_tmp[0];
+              ((double*)priY)[(((ptrdiff_t)incpriY * 6) + 1)] = cons_buffer_tmp[1];
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+          default:
+            {
+              int i, j;
+              __m128d x_0, x_1;
+              __m128d compression_0;
+              __m128d expansion_0;
+              __m128d expansion_mask_0;
+              __m128d q_0, q_1;
+              __m128d s_0, s_1;
+              __m128d s_buffer[(binned_DBMAXFOLD * 2)];
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[(j * 2)] = s_buffer[((j * 2) + 1)] = _mm_loadu_pd(((double*)priY) + ((ptrdiff_t)incpriY * j * 2));
+              }
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm_set_pd(1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set_pd(1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set_pd(0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm_set_pd(binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 2 <= N_block; i += 2, x += 4){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(x_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      x_0 = _mm_add_pd(x_0, q_0);
+                      x_1 = _mm_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(x_1, blp_mask_tmp));
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      x_0 = _mm_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += 2;
+                  }
+                }else{
+                  for(i = 0; i + 2 <= N_block; i += 2, x += 4){
+                    _mm_prefetch((const char*)(((double*)x) + 1024), _MM_HINT_T0);
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + 2);
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(x_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      x_0 = _mm_add_pd(x_0, q_0);
+                      x_1 = _mm_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(x_1, blp_mask_tmp));
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      x_0 = _mm_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += 2;
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = _mm_set1_pd(binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set1_pd(binned_DMEXPANSION * 0.5);
+                    }else{
+                      compression_0 = _mm_set_pd(1.0, binned_DMCOMPRESSION);
+                      expansion_0 = _mm_set_pd(1.0, binned_DMEXPANSION * 0.5);
+                      expansion_mask_0 = _mm_set_pd(0.0, binned_DMEXPANSION * 0.5);
+                    }
+                  }else{
+                    compression_0 = _mm_set_pd(binned_DMCOMPRESSION, 1.0);
+                    expansion_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 1.0);
+                    expansion_mask_0 = _mm_set_pd(binned_DMEXPANSION * 0.5, 0.0);
+                  }
+                  for(i = 0; i + 2 <= N_block; i += 2, x += ((ptrdiff_t)incX * 4)){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    q_1 = _mm_add_pd(s_1, _mm_or_pd(_mm_mul_pd(x_1, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    q_1 = _mm_sub_pd(s_1, q_1);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    x_1 = _mm_add_pd(_mm_add_pd(x_1, _mm_mul_pd(q_1, expansion_0)), _mm_mul_pd(q_1, expansion_mask_0));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(x_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      x_0 = _mm_add_pd(x_0, q_0);
+                      x_1 = _mm_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(x_1, blp_mask_tmp));
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    s_0 = s_buffer[0];
+                    q_0 = _mm_add_pd(s_0, _mm_or_pd(_mm_mul_pd(x_0, compression_0), blp_mask_tmp));
+                    s_buffer[0] = q_0;
+                    q_0 = _mm_sub_pd(s_0, q_0);
+                    x_0 = _mm_add_pd(_mm_add_pd(x_0, _mm_mul_pd(q_0, expansion_0)), _mm_mul_pd(q_0, expansion_mask_0));
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      x_0 = _mm_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += ((ptrdiff_t)incX * 2);
+                  }
+                }else{
+                  for(i = 0; i + 2 <= N_block; i += 2, x += ((ptrdiff_t)incX * 4)){
+                    x_0 = _mm_loadu_pd(((double*)x));
+                    x_1 = _mm_loadu_pd(((double*)x) + ((ptrdiff_t)incX * 2));
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(x_0, blp_mask_tmp));
+                      q_1 = _mm_add_pd(s_1, _mm_or_pd(x_1, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      q_1 = _mm_sub_pd(s_1, q_1);
+                      x_0 = _mm_add_pd(x_0, q_0);
+                      x_1 = _mm_add_pd(x_1, q_1);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(x_0, blp_mask_tmp));
+                    s_buffer[((j * 2) + 1)] = _mm_add_pd(s_buffer[((j * 2) + 1)], _mm_or_pd(x_1, blp_mask_tmp));
+                  }
+                  if(i + 1 <= N_block){
+                    x_0 = _mm_loadu_pd(((double*)x));
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      q_0 = _mm_add_pd(s_0, _mm_or_pd(x_0, blp_mask_tmp));
+                      s_buffer[(j * 2)] = q_0;
+                      q_0 = _mm_sub_pd(s_0, q_0);
+                      x_0 = _mm_add_pd(x_0, q_0);
+                    }
+                    s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_or_pd(x_0, blp_mask_tmp));
+                    i += 1, x += ((ptrdiff_t)incX * 2);
+                  }
+                }
+              }
+
+              for(j = 0; j < fold; j += 1){
+                cons_tmp = _mm_loadu_pd(((double*)((double*)priY)) + ((ptrdiff_t)incpriY * j * 2));
+                s_buffer[(j * 2)] = _mm_add_pd(s_buffer[(j * 2)], _mm_sub_pd(s_buffer[((j * 2) + 1)], cons_tmp));
+                _mm_store_pd(cons_buffer_tmp, s_buffer[(j * 2)]);
+                ((double*)priY)[((ptrdiff_t)incpriY * j * 2)] = cons_buffer_tmp[0];
+                ((double*)priY)[(((ptrdiff_t)incpriY * j * 2) + 1)] = cons_buffer_tmp[1];
+              }
+
+              if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){
+                _mm_setcsr(SIMD_daz_ftz_old_tmp);
+              }
+            }
+            break;
+        }
+
+      #else
+        long_double blp_tmp; (void)blp_tmp;
+        double cons_tmp; (void)cons_tmp;
+
+
+        switch(fold){
+          case 3:
+            {
+              int i;
+              double x_0, x_1;
+              double compression_0, compression_1;
+              double expansion_0, expansion_1;
+              double expansion_mask_0, expansion_mask_1;
+              double q_0, q_1;
+              double s_0_0, s_0_1;
+              double s_1_0, s_1_1;
+              double s_2_0, s_2_1;
+
+              s_0_0 = ((double*)priY)[0];
+              s_0_1 = ((double*)priY)[1];
+              s_1_0 = ((double*)priY)[((ptrdiff_t)incpriY * 2)];
+              s_1_1 = ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)];
+              s_2_0 = ((double*)priY)[((ptrdiff_t)incpriY * 4)];
+              s_2_1 = ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)];
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = binned_DMCOMPRESSION;
+                      compression_1 = binned_DMCOMPRESSION;
+                      expansion_0 = binned_DMEXPANSION * 0.5;
+                      expansion_1 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_0 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_1 = binned_DMEXPANSION * 0.5;
+                    }else{
+                      compression_0 = binned_DMCOMPRESSION;
+                      compression_1 = 1.0;
+                      expansion_0 = binned_DMEXPANSION * 0.5;
+                      expansion_1 = 1.0;
+                      expansion_mask_0 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_1 = 0.0;
+                    }
+                  }else{
+                    compression_0 = 1.0;
+                    compression_1 = binned_DMCOMPRESSION;
+                    expansion_0 = 1.0;
+                    expansion_1 = binned_DMEXPANSION * 0.5;
+                    expansion_mask_0 = 0.0;
+                    expansion_mask_1 = binned_DMEXPANSION * 0.5;
+                  }
+                  for(i = 0; i + 1 <= N_block; i += 1, x += 2){
+                    x_0 = ((double*)x)[0];
+                    x_1 = ((double*)x)[1];
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    blp_tmp.d = (x_0 * compression_0);
+                    blp_tmp.l |= 1;
+                    s_0_0 = s_0_0 + blp_tmp.d;
+                    blp_tmp.d = (x_1 * compression_1);
+                    blp_tmp.l |= 1;
+                    s_0_1 = s_0_1 + blp_tmp.d;
+                    q_0 = (q_0 - s_0_0);
+                    q_1 = (q_1 - s_0_1);
+                    #if defined(FP_FAST_FMA)
+                    x_0 = fma(q_0, expansion_mask_0, fma(q_0, expansion_0, x_0));
+                    x_1 = fma(q_1, expansion_mask_1, fma(q_1, expansion_1, x_1));
+                    #else
+                    x_0 = ((x_0 + (q_0 * expansion_0)) + (q_0 * expansion_mask_0));
+                    x_1 = ((x_1 + (q_1 * expansion_1)) + (q_1 * expansion_mask_1));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_1_0 = s_1_0 + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_1_1 = s_1_1 + blp_tmp.d;
+                    q_0 = (q_0 - s_1_0);
+                    q_1 = (q_1 - s_1_1);
+                    x_0 = (x_0 + q_0);
+                    x_1 = (x_1 + q_1);
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_2_0 = s_2_0 + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_2_1 = s_2_1 + blp_tmp.d;
+                  }
+                }else{
+                  for(i = 0; i + 1 <= N_block; i += 1, x += 2){
+                    x_0 = ((double*)x)[0];
+                    x_1 = ((double*)x)[1];
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_0_0 = s_0_0 + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_0_1 = s_0_1 + blp_tmp.d;
+                    q_0 = (q_0 - s_0_0);
+                    q_1 = (q_1 - s_0_1);
+                    x_0 = (x_0 + q_0);
+                    x_1 = (x_1 + q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_1_0 = s_1_0 + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_1_1 = s_1_1 + blp_tmp.d;
+                    q_0 = (q_0 - s_1_0);
+                    q_1 = (q_1 - s_1_1);
+                    x_0 = (x_0 + q_0);
+                    x_1 = (x_1 + q_1);
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_2_0 = s_2_0 + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_2_1 = s_2_1 + blp_tmp.d;
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = binned_DMCOMPRESSION;
+                      compression_1 = binned_DMCOMPRESSION;
+                      expansion_0 = binned_DMEXPANSION * 0.5;
+                      expansion_1 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_0 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_1 = binned_DMEXPANSION * 0.5;
+                    }else{
+                      compression_0 = binned_DMCOMPRESSION;
+                      compression_1 = 1.0;
+                      expansion_0 = binned_DMEXPANSION * 0.5;
+                      expansion_1 = 1.0;
+                      expansion_mask_0 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_1 = 0.0;
+                    }
+                  }else{
+                    compression_0 = 1.0;
+                    compression_1 = binned_DMCOMPRESSION;
+                    expansion_0 = 1.0;
+                    expansion_1 = binned_DMEXPANSION * 0.5;
+                    expansion_mask_0 = 0.0;
+                    expansion_mask_1 = binned_DMEXPANSION * 0.5;
+                  }
+                  for(i = 0; i + 1 <= N_block; i += 1, x += ((ptrdiff_t)incX * 2)){
+                    x_0 = ((double*)x)[0];
+                    x_1 = ((double*)x)[1];
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    blp_tmp.d = (x_0 * compression_0);
+                    blp_tmp.l |= 1;
+                    s_0_0 = s_0_0 + blp_tmp.d;
+                    blp_tmp.d = (x_1 * compression_1);
+                    blp_tmp.l |= 1;
+                    s_0_1 = s_0_1 + blp_tmp.d;
+                    q_0 = (q_0 - s_0_0);
+                    q_1 = (q_1 - s_0_1);
+                    #if defined(FP_FAST_FMA)
+                    x_0 = fma(q_0, expansion_mask_0, fma(q_0, expansion_0, x_0));
+                    x_1 = fma(q_1, expansion_mask_1, fma(q_1, expansion_1, x_1));
+                    #else
+                    x_0 = ((x_0 + (q_0 * expansion_0)) + (q_0 * expansion_mask_0));
+                    x_1 = ((x_1 + (q_1 * expansion_1)) + (q_1 * expansion_mask_1));
+                    #endif
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_1_0 = s_1_0 + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_1_1 = s_1_1 + blp_tmp.d;
+                    q_0 = (q_0 - s_1_0);
+                    q_1 = (q_1 - s_1_1);
+                    x_0 = (x_0 + q_0);
+                    x_1 = (x_1 + q_1);
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_2_0 = s_2_0 + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_2_1 = s_2_1 + blp_tmp.d;
+                  }
+                }else{
+                  for(i = 0; i + 1 <= N_block; i += 1, x += ((ptrdiff_t)incX * 2)){
+                    x_0 = ((double*)x)[0];
+                    x_1 = ((double*)x)[1];
+
+                    q_0 = s_0_0;
+                    q_1 = s_0_1;
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_0_0 = s_0_0 + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_0_1 = s_0_1 + blp_tmp.d;
+                    q_0 = (q_0 - s_0_0);
+                    q_1 = (q_1 - s_0_1);
+                    x_0 = (x_0 + q_0);
+                    x_1 = (x_1 + q_1);
+                    q_0 = s_1_0;
+                    q_1 = s_1_1;
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_1_0 = s_1_0 + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_1_1 = s_1_1 + blp_tmp.d;
+                    q_0 = (q_0 - s_1_0);
+                    q_1 = (q_1 - s_1_1);
+                    x_0 = (x_0 + q_0);
+                    x_1 = (x_1 + q_1);
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_2_0 = s_2_0 + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_2_1 = s_2_1 + blp_tmp.d;
+                  }
+                }
+              }
+
+              ((double*)priY)[0] = s_0_0;
+              ((double*)priY)[1] = s_0_1;
+              ((double*)priY)[((ptrdiff_t)incpriY * 2)] = s_1_0;
+              ((double*)priY)[(((ptrdiff_t)incpriY * 2) + 1)] = s_1_1;
+              ((double*)priY)[((ptrdiff_t)incpriY * 4)] = s_2_0;
+              ((double*)priY)[(((ptrdiff_t)incpriY * 4) + 1)] = s_2_1;
+
+            }
+            break;
+          default:
+            {
+              int i, j;
+              double x_0, x_1;
+              double compression_0, compression_1;
+              double expansion_0, expansion_1;
+              double expansion_mask_0, expansion_mask_1;
+              double q_0, q_1;
+              double s_0, s_1;
+              double s_buffer[(binned_DBMAXFOLD * 2)];
+
+              for(j = 0; j < fold; j += 1){
+                s_buffer[(j * 2)] = ((double*)priY)[((ptrdiff_t)incpriY * j * 2)];
+                s_buffer[((j * 2) + 1)] = ((double*)priY)[(((ptrdiff_t)incpriY * j * 2) + 1)];
+              }
+
+              if(incX == 1){
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = binned_DMCOMPRESSION;
+                      compression_1 = binned_DMCOMPRESSION;
+                      expansion_0 = binned_DMEXPANSION * 0.5;
+                      expansion_1 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_0 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_1 = binned_DMEXPANSION * 0.5;
+                    }else{
+                      compression_0 = binned_DMCOMPRESSION;
+                      compression_1 = 1.0;
+                      expansion_0 = binned_DMEXPANSION * 0.5;
+                      expansion_1 = 1.0;
+                      expansion_mask_0 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_1 = 0.0;
+                    }
+                  }else{
+                    compression_0 = 1.0;
+                    compression_1 = binned_DMCOMPRESSION;
+                    expansion_0 = 1.0;
+                    expansion_1 = binned_DMEXPANSION * 0.5;
+                    expansion_mask_0 = 0.0;
+                    expansion_mask_1 = binned_DMEXPANSION * 0.5;
+                  }
+                  for(i = 0; i + 1 <= N_block; i += 1, x += 2){
+                    x_0 = ((double*)x)[0];
+                    x_1 = ((double*)x)[1];
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    blp_tmp.d = (x_0 * compression_0);
+                    blp_tmp.l |= 1;
+                    q_0 = s_0 + blp_tmp.d;
+                    blp_tmp.d = (x_1 * compression_1);
+                    blp_tmp.l |= 1;
+                    q_1 = s_1 + blp_tmp.d;
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = (s_0 - q_0);
+                    q_1 = (s_1 - q_1);
+                    #if defined(FP_FAST_FMA)
+                    x_0 = fma(q_0, expansion_mask_0, fma(q_0, expansion_0, x_0));
+                    x_1 = fma(q_1, expansion_mask_1, fma(q_1, expansion_1, x_1));
+                    #else
+                    x_0 = ((x_0 + (q_0 * expansion_0)) + (q_0 * expansion_mask_0));
+                    x_1 = ((x_1 + (q_1 * expansion_1)) + (q_1 * expansion_mask_1));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      blp_tmp.d = x_0;
+                      blp_tmp.l |= 1;
+                      q_0 = s_0 + blp_tmp.d;
+                      blp_tmp.d = x_1;
+                      blp_tmp.l |= 1;
+                      q_1 = s_1 + blp_tmp.d;
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = (s_0 - q_0);
+                      q_1 = (s_1 - q_1);
+                      x_0 = (x_0 + q_0);
+                      x_1 = (x_1 + q_1);
+                    }
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_buffer[(j * 2)] = s_buffer[(j * 2)] + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_buffer[((j * 2) + 1)] = s_buffer[((j * 2) + 1)] + blp_tmp.d;
+                  }
+                }else{
+                  for(i = 0; i + 1 <= N_block; i += 1, x += 2){
+                    x_0 = ((double*)x)[0];
+                    x_1 = ((double*)x)[1];
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      blp_tmp.d = x_0;
+                      blp_tmp.l |= 1;
+                      q_0 = s_0 + blp_tmp.d;
+                      blp_tmp.d = x_1;
+                      blp_tmp.l |= 1;
+                      q_1 = s_1 + blp_tmp.d;
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = (s_0 - q_0);
+                      q_1 = (s_1 - q_1);
+                      x_0 = (x_0 + q_0);
+                      x_1 = (x_1 + q_1);
+                    }
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_buffer[(j * 2)] = s_buffer[(j * 2)] + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_buffer[((j * 2) + 1)] = s_buffer[((j * 2) + 1)] + blp_tmp.d;
+                  }
+                }
+              }else{
+                if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
+                  if(binned_dmindex0(priY)){
+                    if(binned_dmindex0(priY + 1)){
+                      compression_0 = binned_DMCOMPRESSION;
+                      compression_1 = binned_DMCOMPRESSION;
+                      expansion_0 = binned_DMEXPANSION * 0.5;
+                      expansion_1 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_0 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_1 = binned_DMEXPANSION * 0.5;
+                    }else{
+                      compression_0 = binned_DMCOMPRESSION;
+                      compression_1 = 1.0;
+                      expansion_0 = binned_DMEXPANSION * 0.5;
+                      expansion_1 = 1.0;
+                      expansion_mask_0 = binned_DMEXPANSION * 0.5;
+                      expansion_mask_1 = 0.0;
+                    }
+                  }else{
+                    compression_0 = 1.0;
+                    compression_1 = binned_DMCOMPRESSION;
+                    expansion_0 = 1.0;
+                    expansion_1 = binned_DMEXPANSION * 0.5;
+                    expansion_mask_0 = 0.0;
+                    expansion_mask_1 = binned_DMEXPANSION * 0.5;
+                  }
+                  for(i = 0; i + 1 <= N_block; i += 1, x += ((ptrdiff_t)incX * 2)){
+                    x_0 = ((double*)x)[0];
+                    x_1 = ((double*)x)[1];
+
+                    s_0 = s_buffer[0];
+                    s_1 = s_buffer[1];
+                    blp_tmp.d = (x_0 * compression_0);
+                    blp_tmp.l |= 1;
+                    q_0 = s_0 + blp_tmp.d;
+                    blp_tmp.d = (x_1 * compression_1);
+                    blp_tmp.l |= 1;
+                    q_1 = s_1 + blp_tmp.d;
+                    s_buffer[0] = q_0;
+                    s_buffer[1] = q_1;
+                    q_0 = (s_0 - q_0);
+                    q_1 = (s_1 - q_1);
+                    #if defined(FP_FAST_FMA)
+                    x_0 = fma(q_0, expansion_mask_0, fma(q_0, expansion_0, x_0));
+                    x_1 = fma(q_1, expansion_mask_1, fma(q_1, expansion_1, x_1));
+                    #else
+                    x_0 = ((x_0 + (q_0 * expansion_0)) + (q_0 * expansion_mask_0));
+                    x_1 = ((x_1 + (q_1 * expansion_1)) + (q_1 * expansion_mask_1));
+                    #endif
+                    for(j = 1; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      blp_tmp.d = x_0;
+                      blp_tmp.l |= 1;
+                      q_0 = s_0 + blp_tmp.d;
+                      blp_tmp.d = x_1;
+                      blp_tmp.l |= 1;
+                      q_1 = s_1 + blp_tmp.d;
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = (s_0 - q_0);
+                      q_1 = (s_1 - q_1);
+                      x_0 = (x_0 + q_0);
+                      x_1 = (x_1 + q_1);
+                    }
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_buffer[(j * 2)] = s_buffer[(j * 2)] + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_buffer[((j * 2) + 1)] = s_buffer[((j * 2) + 1)] + blp_tmp.d;
+                  }
+                }else{
+                  for(i = 0; i + 1 <= N_block; i += 1, x += ((ptrdiff_t)incX * 2)){
+                    x_0 = ((double*)x)[0];
+                    x_1 = ((double*)x)[1];
+
+                    for(j = 0; j < fold - 1; j++){
+                      s_0 = s_buffer[(j * 2)];
+                      s_1 = s_buffer[((j * 2) + 1)];
+                      blp_tmp.d = x_0;
+                      blp_tmp.l |= 1;
+                      q_0 = s_0 + blp_tmp.d;
+                      blp_tmp.d = x_1;
+                      blp_tmp.l |= 1;
+                      q_1 = s_1 + blp_tmp.d;
+                      s_buffer[(j * 2)] = q_0;
+                      s_buffer[((j * 2) + 1)] = q_1;
+                      q_0 = (s_0 - q_0);
+                      q_1 = (s_1 - q_1);
+                      x_0 = (x_0 + q_0);
+                      x_1 = (x_1 + q_1);
+                    }
+                    blp_tmp.d = x_0;
+                    blp_tmp.l |= 1;
+                    s_buffer[(j * 2)] = s_buffer[(j * 2)] + blp_tmp.d;
+                    blp_tmp.d = x_1;
+                    blp_tmp.l |= 1;
+                    s_buffer[((j * 2) + 1)] = s_buffer[((j * 2) + 1)] + blp_tmp.d;
+                  }
+                }
+              }
+
+              for(j = 0; j < fold; j += 1){
+                ((double*)priY)[((ptrdiff_t)incpriY * j * 2)] = s_buffer[(j * 2)];
+                ((double*)priY)[(((ptrdiff_t)incpriY * j * 2) + 1)] = s_buffer[((j * 2) + 1)];
+              }
+
+            }
+            break;
+        }
+
+      #endif
+
+        }
+    //[[[end]]]
+
+    if (isinf(amax[0])){
+      priY[0] = amax[0];
+    }
+    if (isinf(amax[1])){
+      priY[1] = amax[1];
+    }
+
+    deposits += N_block;
+  }
+
+  binned_zmrenorm(fold, priY, incpriY, carY, inccarY);
+}
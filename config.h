@@ -20,3 +20,43 @@
  * @date   26 May 2015
  */
 #define SIDEFAULTFOLD 3
+
+/**
+ * @brief The default minimum number of elements a thread is given in threaded reductions.
+ *
+ * Reductions over fewer than twice this many elements run on the calling thread. The grain can be changed at runtime with binnedBLAS_set_thread_grain() or the REPROBLAS_THREAD_GRAIN environment variable.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define THREADGRAIN 16384
+
+/**
+ * @brief The size (in bytes) of a cache line.
+ *
+ * Threaded routines split binned arrays between threads at multiples of CACHELINE bytes (when they can) so that no cache line is written by two threads.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define CACHELINE 64
+
+/**
+ * @brief The number of rows and columns of C that the reproBLAS matrix-matrix products convert to binned form at a time.
+ *
+ * The binned copy of each tile takes GEMMTILE * GEMMTILE binned elements per thread.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define GEMMTILE 128
+
+/**
+ * @brief The maximum number of columns of A (and rows of B) that the distributed matrix-matrix products broadcast at a time.
+ *
+ * Each process receives panels of at most SUMMAPANEL columns of A and SUMMAPANEL rows of B per step.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define SUMMAPANEL 256
@@ -30,6 +30,14 @@ LDFLAGS +=
 # select whether or not to build mpi (if BUILD_MPI is not defined or set to value other that "true" MPI will not be used and corresponding parts of ReproBLAS won't build)
 BUILD_MPI = false
 
+# select whether or not to build with OpenMP (if BUILD_OPENMP is not defined or set to value other that "true" OpenMP will not be used and all ReproBLAS routines will run on the calling thread)
+BUILD_OPENMP = true
+
+# select OpenMP compiler flags (comment all for auto)
+#OMPFLAGS = -fopenmp
+#OMPFLAGS = -qopenmp
+#OMPFLAGS = -mp
+
 # select MPI compiler flags (comment all for auto)
 #MPICFLAGS = $(shell mpicc --showme:compile)
 #MPICFLAGS = $(shell mpicc --showme compile)
@@ -49,6 +57,10 @@ BUILD_MPI = false
 # optionally disable vectorization (comment all for best available)
 #SSE2 := false
 #AVX := false
+#AVX512 := false
+
+# select whether or not to build every vectorized kernel for all instruction sets and choose between them at runtime (if BUILD_DISPATCH is not defined or set to value other that "true" kernels are only built for the instruction sets of the target architecture). Runtime dispatch requires an x86 target and a GCC compatible compiler. The backend can be forced with the REPROBLAS_VECTORIZATION environment variable.
+#BUILD_DISPATCH := true
 
 # select optimization flags (comment for auto)
 OPTFLAGS := -O3
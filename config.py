@@ -179,6 +179,7 @@ def flop_count(data):
 #                cache - size of l2 (or equivalent) cache (bytes)
 #                freq  - frequency of cpu (Hz)
 #                fma   - is fma available (True, False)
+#                vectorizations - instruction sets available to runtime dispatch (a list of "SISD", "SSE", "AVX", "AVX2", "AVX512")
 #
 #  @author Willow Ahrens
 #  @date   8 Oct 2015
@@ -210,3 +211,13 @@ version = "2.1.0"
 #  @date   28 May 2015
 #
 max_expand_fold = 4
+
+##
+#  @brief size (in bytes) of a cache line
+#
+#  Generated kernels space out their prefetches of contiguous inputs by this many bytes. Keep it equal to CACHELINE in config.h
+#
+#  @author Willow Ahrens
+#  @date   17 Oct 2026
+#
+cache_line_size = 64
@@ -6,6 +6,7 @@
 #include <binnedBLAS.h>
 #include <reproBLAS.h>
 #include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
 #include <mpi.h>
 
 static struct timeval start;
@@ -152,6 +153,18 @@ int main(int argc, char** argv){
     printf("%15s : %-8g : |%.17e - %.17e| = %g\n", "binnedMPI_DBDBADD", elapsed_time, sum, sum_shuffled, fabs(sum - sum_shuffled));
   }
 
+  // Finally, we let prdsum do the local summation and the reduction
+  tic();
+  sum = prdsum(MPI_COMM_WORLD, 0, local_n, local_x, 1);
+  elapsed_time = toc();
+
+  // Next, we sum the shuffled x
+  sum_shuffled = prdsum(MPI_COMM_WORLD, 0, local_n, local_x_shuffled, 1);
+
+  if(rank == 0){
+    printf("%15s : %-8g : |%.17e - %.17e| = %g\n", "prdsum", elapsed_time, sum, sum_shuffled, fabs(sum - sum_shuffled));
+  }
+
   if(rank == 0){
     free(x);
     free(x_shuffled);
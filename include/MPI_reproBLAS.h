@@ -1,152 +1,186 @@
-#ifndef _REPRODUCIBLE_PAR_BLAS__H_
-#define _REPRODUCIBLE_PAR_BLAS__H_
-#include "binned.h"
-#include "binnedBLAS.h"
+/**
+ * @file  MPI_reproBLAS.h
+ * @brief MPI_reproBLAS.h defines reproducible BLAS Methods on vectors distributed across MPI processes.
+ *
+ * This header is modeled after reproBLAS.h, and as such functions are prefixed with character sets describing the data types they operate upon. All functions are additionally prefixed with "pr" (parallel reproducible). For example, the function @c prdfoo would perform the function @c foo on a distributed @c double vector possibly returning a @c double.
+ *
+ * If two character sets are prefixed, the first set of characters describes the output and the second the input type. For example, the function @c prdzbar would perform the function @c bar on @c double @c complex and return a @c double.
+ *
+ * Such character sets are listed as follows:
+ * - d - double (@c double)
+ * - z - complex double (@c *void)
+ * - s - float (@c float)
+ * - c - complex float (@c *void)
+ *
+ * Each process computes a binned partial result over its own portion of the vectors with binnedBLAS, and the partial results are combined with a single MPI collective using the binned datatypes and operations of binnedMPI.h. Because binned summation does not depend on the order of its operands, the result does not depend on the number of processes or the way the vectors are distributed among them.
+ *
+ * Every function takes an MPI communicator @c comm and the rank @c root of the process that should receive the result. If @c root is #PR_ALL, the result is returned on every process.
+ *
+ * Each function also has a nonblocking counterpart suffixed by @c _start, which computes the local partial result, starts the reduction with @c MPI_Iallreduce() or @c MPI_Ireduce(), and returns a #pr_request. The caller may then overlap computation with the reduction, and obtains the result with #prdwait(), #prswait(), #przwait_sub(), or #prcwait_sub().
+ *
+ * The matrix-vector functions (e.g. #prdgemv()) operate on a matrix distributed over the dimension that is summed over. The partial products of the processes are combined with @c MPI_Reduce_scatter(), and each process receives its own slice of the result vector.
+ *
+ * The matrix-matrix functions (e.g. #prdgemm()) operate on matrices distributed in blocks over a two-dimensional Cartesian process grid. The product is computed with the SUMMA algorithm, broadcasting panels of A along the grid rows and panels of B along the grid columns, and each process accumulates its own block of the result.
+ *
+ * As in reproBLAS.h, two copies of each function are provided. The functions prefixed by "pr" use the default fold value specified in config.h. The functions prefixed by "prr" allow the user to specify their own fold for the underlying binned types.
+ */
+#ifndef MPI_REPROBLAS_H_
+#define MPI_REPROBLAS_H_
 #include <mpi.h>
+#include "binned.h"
+#include "reproBLAS.h"
+
+/**
+ * @brief Pass as @c root to return the result on every process
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define PR_ALL (-1)
+
+/**
+ * @brief A pending reproducible reduction
+ *
+ * A reduction is started by one of the @c _start functions (e.g. #prddot_start()) and completed by the wait function matching the return type of the corresponding blocking function (#prdwait(), #prswait(), #przwait_sub(), or #prcwait_sub()). The fields are for internal use only.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct pr_request{
+  MPI_Request request;
+  int fold;
+  int scaled;
+  void *local;
+  void *result;
+} pr_request;
+
+double prrdsum(const int fold, MPI_Comm comm, const int root, const int N, const double* X, const int incX);
+double prrdasum(const int fold, MPI_Comm comm, const int root, const int N, const double* X, const int incX);
+double prrdnrm2(const int fold, MPI_Comm comm, const int root, const int N, const double* X, const int incX);
+double prrddot(const int fold, MPI_Comm comm, const int root, const int N, const double* X, const int incX, const double* Y, const int incY);
+
+float prrssum(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX);
+float prrsasum(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX);
+float prrsnrm2(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX);
+float prrsdot(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX, const float* Y, const int incY);
+
+void prrzsum_sub(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, void *sum);
+double prrdzasum(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX);
+double prrdznrm2(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX);
+void prrzdotc_sub(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc);
+void prrzdotu_sub(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu);
+
+void prrcsum_sub(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, void *sum);
+float prrscasum(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX);
+float prrscnrm2(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX);
+void prrcdotc_sub(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc);
+void prrcdotu_sub(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu);
+
+double prdsum(MPI_Comm comm, const int root, const int N, const double* X, const int incX);
+double prdasum(MPI_Comm comm, const int root, const int N, const double* X, const int incX);
+double prdnrm2(MPI_Comm comm, const int root, const int N, const double* X, const int incX);
+double prddot(MPI_Comm comm, const int root, const int N, const double* X, const int incX, const double* Y, const int incY);
+
+float prssum(MPI_Comm comm, const int root, const int N, const float* X, const int incX);
+float prsasum(MPI_Comm comm, const int root, const int N, const float* X, const int incX);
+float prsnrm2(MPI_Comm comm, const int root, const int N, const float* X, const int incX);
+float prsdot(MPI_Comm comm, const int root, const int N, const float* X, const int incX, const float* Y, const int incY);
+
+void przsum_sub(MPI_Comm comm, const int root, const int N, const void* X, const int incX, void *sum);
+double prdzasum(MPI_Comm comm, const int root, const int N, const void* X, const int incX);
+double prdznrm2(MPI_Comm comm, const int root, const int N, const void* X, const int incX);
+void przdotc_sub(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc);
+void przdotu_sub(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu);
+
+void prcsum_sub(MPI_Comm comm, const int root, const int N, const void* X, const int incX, void *sum);
+float prscasum(MPI_Comm comm, const int root, const int N, const void* X, const int incX);
+float prscnrm2(MPI_Comm comm, const int root, const int N, const void* X, const int incX);
+void prcdotc_sub(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc);
+void prcdotu_sub(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu);
+
+void prrdsum_start(const int fold, MPI_Comm comm, const int root, const int N, const double* X, const int incX, pr_request *request);
+void prrdasum_start(const int fold, MPI_Comm comm, const int root, const int N, const double* X, const int incX, pr_request *request);
+void prrdnrm2_start(const int fold, MPI_Comm comm, const int root, const int N, const double* X, const int incX, pr_request *request);
+void prrddot_start(const int fold, MPI_Comm comm, const int root, const int N, const double* X, const int incX, const double* Y, const int incY, pr_request *request);
+
+void prrssum_start(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX, pr_request *request);
+void prrsasum_start(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX, pr_request *request);
+void prrsnrm2_start(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX, pr_request *request);
+void prrsdot_start(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX, const float* Y, const int incY, pr_request *request);
+
+void prrzsum_sub_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prrdzasum_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prrdznrm2_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prrzdotc_sub_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, pr_request *request);
+void prrzdotu_sub_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, pr_request *request);
+
+void prrcsum_sub_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prrscasum_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prrscnrm2_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prrcdotc_sub_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, pr_request *request);
+void prrcdotu_sub_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, pr_request *request);
+
+void prdsum_start(MPI_Comm comm, const int root, const int N, const double* X, const int incX, pr_request *request);
+void prdasum_start(MPI_Comm comm, const int root, const int N, const double* X, const int incX, pr_request *request);
+void prdnrm2_start(MPI_Comm comm, const int root, const int N, const double* X, const int incX, pr_request *request);
+void prddot_start(MPI_Comm comm, const int root, const int N, const double* X, const int incX, const double* Y, const int incY, pr_request *request);
+
+void prssum_start(MPI_Comm comm, const int root, const int N, const float* X, const int incX, pr_request *request);
+void prsasum_start(MPI_Comm comm, const int root, const int N, const float* X, const int incX, pr_request *request);
+void prsnrm2_start(MPI_Comm comm, const int root, const int N, const float* X, const int incX, pr_request *request);
+void prsdot_start(MPI_Comm comm, const int root, const int N, const float* X, const int incX, const float* Y, const int incY, pr_request *request);
+
+void przsum_sub_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prdzasum_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prdznrm2_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void przdotc_sub_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, pr_request *request);
+void przdotu_sub_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, pr_request *request);
+
+void prcsum_sub_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prscasum_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prscnrm2_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request);
+void prcdotc_sub_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, pr_request *request);
+void prcdotu_sub_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, pr_request *request);
+
+int prtest(pr_request *request);
+double prdwait(pr_request *request);
+float prswait(pr_request *request);
+void przwait_sub(pr_request *request, void *result);
+void prcwait_sub(pr_request *request, void *result);
+
+void prbdgemv(const int fold, MPI_Comm comm, const char Order, const char TransA,
+              const int M, const int N,
+              const double alpha, const double *A, const int lda,
+              const double *X, const int incX,
+              double_binned *Y, const int incY, const int *recvcounts);
+void prrdgemv(const int fold, MPI_Comm comm, const char Order, const char TransA,
+              const int M, const int N,
+              const double alpha, const double *A, const int lda,
+              const double *X, const int incX,
+              const double beta, double *Y, const int incY, const int *recvcounts);
+void prdgemv(MPI_Comm comm, const char Order, const char TransA,
+             const int M, const int N,
+             const double alpha, const double *A, const int lda,
+             const double *X, const int incX,
+             const double beta, double *Y, const int incY, const int *recvcounts);
+
+void prbdgemm(const int fold, MPI_Comm comm, const char Order,
+              const char TransA, const char TransB,
+              const int M, const int N, const int KA, const int KB,
+              const double alpha, const double *A, const int lda,
+              const double *B, const int ldb,
+              double_binned *C, const int ldc);
+void prrdgemm(const int fold, MPI_Comm comm, const char Order,
+              const char TransA, const char TransB,
+              const int M, const int N, const int KA, const int KB,
+              const double alpha, const double *A, const int lda,
+              const double *B, const int ldb,
+              const double beta, double *C, const int ldc);
+void prdgemm(MPI_Comm comm, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int KA, const int KB,
+             const double alpha, const double *A, const int lda,
+             const double *B, const int ldb,
+             const double beta, double *C, const int ldc);
 
-//---- double precision
-extern void   prdsumI (MPI_Comm comm, int root, int N, double* x, int incx, I_double* s);
-extern void   prdasumI(MPI_Comm comm, int root, int N, double* x, int incx, I_double* s);
-extern void   prdnrm2I(MPI_Comm comm, int root, int N, double* x, int incx, double* s);
-extern void   prddotI (MPI_Comm comm, int root, int N, double* x, int incx,
-                double* y, int incy, I_double* s);
-
-extern double prdsum (MPI_Comm comm, int root, int N, double* x, int incx);
-extern double prdasum(MPI_Comm comm, int root, int N, double* x, int incx);
-extern double prdnrm2(MPI_Comm comm, int root, int N, double* x, int incx);
-extern double prddot (MPI_Comm comm, int root, int N, double* x, int incx,
-               double* y, int incy);
-//---- single precision
-extern void prsasumI(MPI_Comm comm, int root, int N, float* x, int incx, I_float* s);
-extern void prssumI (MPI_Comm comm, int root, int N, float* x, int incx, I_float* s);
-extern void prsnrm2I(MPI_Comm comm, int root, int N, float* x, int incx, void* s);
-extern void prsdotI (MPI_Comm comm, int root, int N, float* x, int incx,
-              float* y, int incy, I_float* s);
-
-extern float prsasum(MPI_Comm comm, int root, int N, float* x, int incx);
-extern float prssum (MPI_Comm comm, int root, int N, float* x, int incx);
-extern float prsnrm2(MPI_Comm comm, int root, int N, float* x, int incx);
-extern float prsdot (MPI_Comm comm, int root, int N, float* x, int incx, float* y, int incy);
-//====
-// Complex
-extern void prcsumI  (MPI_Comm comm, int root, int N, float complex* x, int incx, I_float_Complex* sum);
-extern void prscasumI(MPI_Comm comm, int root, int N, float complex* x, int incx, I_float* sum);
-extern void prscnrm2I(MPI_Comm comm, int root, int N, float complex* x, int incx, float* sum);
-extern void prcdotuI (MPI_Comm comm, int root, int N, float complex* x, int incx,
-                      float complex* y, int incy, I_float_Complex* sum);
-extern void prcdotcI (MPI_Comm comm, int root, int N, float complex* x, int incx,
-                      float complex* y, int incy, I_float_Complex* sum);
-
-extern float complex prcsum(MPI_Comm comm, int root, int N, float complex* x, int incx);
-extern float prscasum(MPI_Comm comm, int root, int N, float complex* x, int incx);
-extern float prscnrm2(MPI_Comm comm, int root, int N, float complex* x, int incx);
-extern float complex prcdotu(MPI_Comm comm, int root, int N, float complex* x, int incx,
-                     float complex* y, int incy);
-extern float complex prcdotc(MPI_Comm comm, int root, int N, float complex* x, int incx,
-                     float complex* y, int incy);
-
-//---- double complex
-extern void przsumI  (MPI_Comm comm, int root, int N, double complex* x, int incx, I_double_Complex* sum);
-extern void prdzasumI(MPI_Comm comm, int root, int N, double complex* x, int incx, I_double* sum);
-extern void prdznrm2I(MPI_Comm comm, int root, int N, double complex* x, int incx, double* sum);
-extern void przdotuI (MPI_Comm comm, int root, int N, double complex* x, int incx,
-                      double complex* y, int incy, I_double_Complex* sum);
-extern void przdotcI (MPI_Comm comm, int root, int N, double complex* x, int incx,
-                      double complex* y, int incy, I_double_Complex* sum);
-
-extern double complex przsum(MPI_Comm comm, int root, int N, double complex* x, int incx);
-extern double prdzasum(MPI_Comm comm, int root, int N, double complex* x, int incx);
-extern double prdznrm2(MPI_Comm comm, int root, int N, double complex* x, int incx);
-extern double complex przdotu(MPI_Comm comm, int root, int N, double complex* x, int incx,
-                     double complex* y, int incy);
-extern double complex przdotc(MPI_Comm comm, int root, int N, double complex* x, int incx,
-                     double complex* y, int incy);
-
-extern void prddotI2(
-	MPI_Comm comm, int root,
-	int N,
-	double* x, int incx,
-	double* y, int incy,
-	int fold, double* sum,
-	double* local_sum	// WORKING BUFFER TO STORE LOCAL SUM
-);
-extern void prdsumI2(
-	MPI_Comm comm, int root,
-	int N,
-	double* x, int incx,
-	int fold, double* sum,
-	double* local_sum	// WORKING BUFFER TO STORE LOCAL SUM
-);
-extern void prdasumI2(
-	MPI_Comm comm, int root,
-	int N,
-	double* x, int incx,
-	int fold, double* sum,
-	double* local_sum	// WORKING BUFFER TO STORE LOCAL SUM
-);
-extern void prdnrm2I2(
-	MPI_Comm comm, int root,
-	int N,
-	double* x, int incx,
-	int fold, double* sum,
-	double* local_sum	// WORKING BUFFER TO STORE LOCAL SUM
-);
-//--- single precision ---
-extern void prsdotI2(
-	MPI_Comm comm, int root,
-	int N,
-	float* x, int incx,
-	float* y, int incy,
-	int fold, 
-	void* sum,
-	void* local_sum	// WORKING BUFFER TO STORE LOCAL SUM
-);
-extern void prsasumI2(
-	MPI_Comm comm, int root,
-	int N,
-	float* x, int incx,
-	int fold, 
-	void* sum,
-	void* local_sum	// WORKING BUFFER TO STORE LOCAL SUM
-);
-extern void prssumI2(
-	MPI_Comm comm, int root,
-	int N,
-	float* x, int incx,
-	int fold, 
-	void* sum,
-	void* local_sum	// WORKING BUFFER TO STORE LOCAL SUM
-);
-extern void prsnrm2I2(
-	MPI_Comm comm, int root,
-	int N,
-	float* x, int incx,
-	int fold, 
-	void* sum,
-	void* local_sum	// WORKING BUFFER TO STORE LOCAL SUM
-);
-//====
-extern double prdasum2(MPI_Comm comm, int root, int N, double* x, int incx,
-                int fold);
-extern double prdsum2 (MPI_Comm comm, int root, int N, double* x, int incx,
-                int fold);
-extern double prdnrm22(MPI_Comm comm, int root, int N, double* x, int incx,
-                int fold);
-extern double prddot2 (MPI_Comm comm, int root, int N,
-                double* x, int incx, double* y, int incy,
-                int fold);
-//--- single precision ---
-extern float prsasum2(MPI_Comm comm, int root,
-                int N, float* x, int incx, int fold);
-extern float prssum2 (MPI_Comm comm, int root,
-                int N, float* x, int incx, int fold);
-extern float prsnrm22(MPI_Comm comm, int root, int N, float* x, int incx,
-                int fold);
-extern float prsdot2 (MPI_Comm comm, int root, int N,
-                float* x, int incx, float* y, int incy,
-                int fold);
-//====
-
-void prdgemv(int rank, int nprocs, rblas_order_t Order, rblas_transpose_t TransA, int M, int N, double *myA, int lda, double *myX, int incX, double *myY, int incY);
-void prbdgemv(int rank, int nprocs, rblas_order_t Order, rblas_transpose_t TransA, int M, int N, double *myA, int lda, double *myX, int incX, double *myY, int incY);
 #endif
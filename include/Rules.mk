@@ -1,4 +1,4 @@
 TARGETS :=
 SUBDIRS :=
 
-INSTALL_INC += binned.h binnedBLAS.h binnedMPI.h reproBLAS.h
+INSTALL_INC += binned.h binnedBLAS.h binnedInline.h binnedMPI.h binnedOMP.h reproBLAS.h MPI_reproBLAS.h
@@ -72,6 +72,30 @@ typedef float float_binned;
  */
 typedef float float_complex_binned;
 
+/**
+ * @brief A thread's handle to a #double_binned_shared
+ *
+ * To get a #double_binned_producer, call binned_dbshared_join(). Its fields are private to the library.
+ */
+typedef struct double_binned_producer_{
+  struct double_binned_producer_ *next;
+  int fold;
+  unsigned long version;
+  double_binned *pending;
+  double_binned *total;
+  double_binned *published;
+} double_binned_producer;
+
+/**
+ * @brief A binned double that many threads can add to concurrently
+ *
+ * To allocate a #double_binned_shared, call binned_dbshared_alloc(). Threads add values through producers (see binned_dbshared_join()), which buffer them and publish them without locks. Any thread may read the sum of the published values with binned_dbshared_snapshot() or binned_dbshared_conv(), and the result does not depend on how the threads interleave.
+ */
+typedef struct{
+  int fold;
+  double_binned_producer *producers;
+} double_binned_shared;
+
 /**
  * @brief Binned double precision bin width
  *
@@ -240,6 +264,8 @@ const float *binned_smbins(const int X);
 int binned_dindex(const double X);
 int binned_dmindex(const double *priX);
 int binned_dmindex0(const double *priX);
+void binned_dindexv(const int N, const double *X, const int incX, int *idx);
+void binned_dbindexv(const int fold, const int N, const double_binned *X, const int incX, int *idx);
 
 int binned_sindex(const float X);
 int binned_smindex(const float *priX);
@@ -295,6 +321,15 @@ void binned_zbzbaddv(const int fold, const int N, const double_complex_binned *X
 void binned_sbsbaddv(const int fold, const int N, const float_binned *X, const int incX, float_binned *Y, const int incY);
 void binned_cbcbaddv(const int fold, const int N, const float_complex_binned *X, const int incX, float_complex_binned *Y, const int incY);
 
+double_binned_shared *binned_dbshared_alloc(const int fold);
+void binned_dbshared_free(double_binned_shared *S);
+double_binned_producer *binned_dbshared_join(double_binned_shared *S);
+void binned_dbshared_dadd(double_binned_producer *P, const double X);
+void binned_dbshared_dbadd(double_binned_producer *P, const double_binned *X);
+void binned_dbshared_publish(double_binned_producer *P);
+void binned_dbshared_snapshot(const double_binned_shared *S, double_binned *Y);
+double binned_dbshared_conv(const double_binned_shared *S);
+
 void binned_dbdadd(const int fold, const double X, double_binned *Y);
 void binned_dmdadd(const int fold, const double X, double *priY, const int incpriY, double *carY, const int inccarY);
 void binned_zbzadd(const int fold, const void *X, double_complex_binned *Y);
@@ -334,6 +369,7 @@ void binned_sbrenorm(const int fold, float_binned *X);
 void binned_smrenorm(const int fold, float* priX, const int incpriX, float* carX, const int inccarX);
 void binned_cbrenorm(const int fold, float_complex_binned *X);
 void binned_cmrenorm(const int fold, float* priX, const int incpriX, float* carX, const int inccarX);
+void binned_dbrenormv(const int fold, const int N, double_binned *X, const int incX);
 
 void binned_dbdconv(const int fold, const double X, double_binned *Y);
 void binned_dmdconv(const int fold, const double X, double* priY, const int incpriY, double* carY, const int inccarY);
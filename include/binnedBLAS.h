@@ -34,6 +34,17 @@
 #include "binned.h"
 #include "reproBLAS.h"
 
+int binnedBLAS_get_num_threads(void);
+void binnedBLAS_set_num_threads(const int N);
+int binnedBLAS_get_thread_grain(void);
+void binnedBLAS_set_thread_grain(const int N);
+void binnedBLAS_set_thread_affinity(const int N, const int *cpus);
+int binnedBLAS_nthreads(const int N);
+int binnedBLAS_partition(const int N, const int num_threads, const int block, const size_t stride);
+void binnedBLAS_parallel(const int num_threads, const int num_tasks, void (*task)(void *args, const int i, const int thread), void *args);
+int binnedBLAS_get_vectorization(void);
+void binnedBLAS_set_vectorization(const int V);
+
 float binnedBLAS_samax(const int N, const float *X, const int incX);
 double binnedBLAS_damax(const int N, const double *X, const int incX);
 void binnedBLAS_camax_sub(const int N, const void *X, const int incX, void *amax);
@@ -95,6 +106,27 @@ void binnedBLAS_dbdgemm(const int fold, const char Order,
              const double alpha, const double *A, const int lda,
              const double *B, const int ldb,
              double_binned *C, const int ldc);
+void binnedBLAS_dbdgemmk(const int fold, const int M, const int N, const int K, const double *A, const int lda, const double *B, const int ldb, double_binned *C, const int incrowC, const int inccolC, double *amax);
+void binnedBLAS_dbdgemm_small(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const double alpha, const double *A, const int lda,
+             const double *B, const int ldb,
+             double_binned *C, const int ldc, double *work);
+void binnedBLAS_dbdgemm_batch(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const double alpha, const double *const *A, const int lda,
+             const double *const *B, const int ldb,
+             double_binned *const *C, const int ldc,
+             const int batch_count);
+void binnedBLAS_dbdgemm_batch_strided(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const double alpha, const double *A, const int lda, const int strideA,
+             const double *B, const int ldb, const int strideB,
+             double_binned *C, const int ldc, const int strideC,
+             const int batch_count);
 
 void binnedBLAS_sbsgemv(const int fold, const char Order, const char TransA,
              const int M, const int N,
@@ -107,6 +139,27 @@ void binnedBLAS_sbsgemm(const int fold, const char Order,
              const float alpha, const float *A, const int lda,
              const float *B, const int ldb,
              float_binned *C, const int ldc);
+void binnedBLAS_sbsgemmk(const int fold, const int M, const int N, const int K, const float *A, const int lda, const float *B, const int ldb, float_binned *C, const int incrowC, const int inccolC, float *amax);
+void binnedBLAS_sbsgemm_small(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const float alpha, const float *A, const int lda,
+             const float *B, const int ldb,
+             float_binned *C, const int ldc, float *work);
+void binnedBLAS_sbsgemm_batch(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const float alpha, const float *const *A, const int lda,
+             const float *const *B, const int ldb,
+             float_binned *const *C, const int ldc,
+             const int batch_count);
+void binnedBLAS_sbsgemm_batch_strided(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const float alpha, const float *A, const int lda, const int strideA,
+             const float *B, const int ldb, const int strideB,
+             float_binned *C, const int ldc, const int strideC,
+             const int batch_count);
 
 void binnedBLAS_zbzgemv(const int fold, const char Order, const char TransA,
              const int M, const int N,
@@ -119,6 +172,26 @@ void binnedBLAS_zbzgemm(const int fold, const char Order,
              const void *alpha, const void *A, const int lda,
              const void *B, const int ldb,
              double_complex_binned *C, const int ldc);
+void binnedBLAS_zbzgemm_small(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const void *alpha, const void *A, const int lda,
+             const void *B, const int ldb,
+             double_complex_binned *C, const int ldc, double *work);
+void binnedBLAS_zbzgemm_batch(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const void *alpha, const void *const *A, const int lda,
+             const void *const *B, const int ldb,
+             double_complex_binned *const *C, const int ldc,
+             const int batch_count);
+void binnedBLAS_zbzgemm_batch_strided(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const void *alpha, const void *A, const int lda, const int strideA,
+             const void *B, const int ldb, const int strideB,
+             double_complex_binned *C, const int ldc, const int strideC,
+             const int batch_count);
 
 void binnedBLAS_cbcgemv(const int fold, const char Order, const char TransA,
              const int M, const int N,
@@ -131,5 +204,25 @@ void binnedBLAS_cbcgemm(const int fold, const char Order,
              const void *alpha, const void *A, const int lda,
              const void *B, const int ldb,
              float_complex_binned *C, const int ldc);
+void binnedBLAS_cbcgemm_small(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const void *alpha, const void *A, const int lda,
+             const void *B, const int ldb,
+             float_complex_binned *C, const int ldc, float *work);
+void binnedBLAS_cbcgemm_batch(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const void *alpha, const void *const *A, const int lda,
+             const void *const *B, const int ldb,
+             float_complex_binned *const *C, const int ldc,
+             const int batch_count);
+void binnedBLAS_cbcgemm_batch_strided(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const void *alpha, const void *A, const int lda, const int strideA,
+             const void *B, const int ldb, const int strideB,
+             float_complex_binned *C, const int ldc, const int strideC,
+             const int batch_count);
 
 #endif
@@ -0,0 +1,1077 @@
+/**
+ * @file  binnedInline.h
+ * @brief binnedInline.h defines inline versions of the scalar binned operations, for use in inner loops.
+ *
+ * Adding one value to a binned type with binned_dbdadd() takes several calls into the library (to update, deposit, and renormalize). When values are added one at a time in a user loop, the cost of these calls can exceed the cost of the additions. This header defines the same operations as @c static @c inline functions, which the compiler may inline into the loop (and, for example, hoist the computation of the index of the accumulator out of it).
+ *
+ * Each function @c binnedInline_foo() behaves exactly like the function @c binned_foo() of binned.h and gives bitwise identical results (the library functions are implemented with this header). The functions are named with the same character sets as binned.h. The following operations are defined for each of the prefixes dm, zm, sm, cm (manually specified binned types) and db, zb, sb, cb (binned types):
+ * - update (such as binnedInline_dbdupdate())
+ * - deposit (such as binnedInline_dbddeposit())
+ * - renorm (such as binnedInline_dbrenorm())
+ * - add (such as binnedInline_dbdadd())
+ * - conv (such as binnedInline_ddbconv())
+ *
+ * For example:
+ *
+ * @code
+ * double_binned *acc = binned_dballoc(3);
+ * binned_dbsetzero(3, acc);
+ * for(i = 0; i < N; i++){
+ *   binnedInline_dbdadd(3, X[i], acc);
+ * }
+ * sum = binnedInline_ddbconv(3, acc);
+ * @endcode
+ *
+ * Programs that include this header must still be linked with the binned library.
+ */
+#ifndef BINNEDINLINE_H_
+#define BINNEDINLINE_H_
+
+#include <math.h>
+#include <stdint.h>
+
+#include "binned.h"
+
+/**
+ * @internal
+ * @brief The bits of a double precision number
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef union{
+  double d;
+  uint64_t l;
+} binnedInline_double_bits;
+
+/**
+ * @internal
+ * @brief The bits of a single precision number
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef union{
+  float f;
+  uint32_t i;
+} binnedInline_float_bits;
+
+/**
+ * @internal
+ * @brief Get the biased exponent of double precision
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline int binnedInline_dexp(const double X){
+  binnedInline_double_bits bits;
+  bits.d = X;
+  return (bits.l >> (DBL_MANT_DIG - 1)) & (2 * DBL_MAX_EXP - 1);
+}
+
+/**
+ * @internal
+ * @brief Get the biased exponent of single precision
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline int binnedInline_sexp(const float X){
+  binnedInline_float_bits bits;
+  bits.f = X;
+  return (bits.i >> (FLT_MANT_DIG - 1)) & (2 * FLT_MAX_EXP - 1);
+}
+
+/**
+ * @internal
+ * @brief Check if double precision is NaN or Inf
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline int binnedInline_disnaninf(const double X){
+  return binnedInline_dexp(X) == 2 * DBL_MAX_EXP - 1;
+}
+
+/**
+ * @internal
+ * @brief Check if single precision is NaN or Inf
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline int binnedInline_sisnaninf(const float X){
+  return binnedInline_sexp(X) == 2 * FLT_MAX_EXP - 1;
+}
+
+/**
+ * @brief Inline version of binned_dindex()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline int binnedInline_dindex(const double X){
+  /*
+  //reference version
+  int exp;
+
+  if(X == 0.0){
+    return (DBL_MAX_EXP - DBL_MIN_EXP)/DBWIDTH;
+  }else{
+    frexp(X, &exp);
+    return (DBL_MAX_EXP - exp)/DBWIDTH;
+  }
+  */
+  int exp = binnedInline_dexp(X);
+  if(exp == 0){
+    if(X == 0.0){
+      return binned_DBMAXINDEX;
+    }else{
+      frexp(X, &exp);
+      exp = (DBL_MAX_EXP - exp)/DBWIDTH;
+      return exp < binned_DBMAXINDEX ? exp : binned_DBMAXINDEX;
+    }
+  }
+  return ((DBL_MAX_EXP + (DBL_MAX_EXP - 2)) - exp)/DBWIDTH;
+}
+
+/**
+ * @brief Inline version of binned_dmindex()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline int binnedInline_dmindex(const double *priX){
+  /*
+  //reference version
+  int exp;
+
+  if(priX[0] == 0.0){
+    return (DBL_MAX_EXP - DBL_MIN_EXP)/DBWIDTH + binned_DBMAXFOLD;
+  }else{
+    frexp(priX[0], &exp);
+    if(exp == DBL_MAX_EXP){
+      return 0;
+    }
+    return (DBL_MAX_EXP + DBL_MANT_DIG - DBWIDTH + 1 - exp)/DBWIDTH;
+  }
+  */
+  return ((DBL_MAX_EXP + DBL_MANT_DIG - DBWIDTH + 1 + (DBL_MAX_EXP - 2)) - binnedInline_dexp(priX[0]))/DBWIDTH;
+}
+
+/**
+ * @brief Inline version of binned_dmindex0()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline int binnedInline_dmindex0(const double *priX){
+  /*
+  //reference version
+  int exp;
+
+  frexp(priX[0], &exp);
+  if(exp == DBL_MAX_EXP){
+    return 1;
+  }
+  return 0;
+  */
+  return binnedInline_dexp(priX[0]) == DBL_MAX_EXP + (DBL_MAX_EXP - 2);
+}
+
+/**
+ * @brief Inline version of binned_sindex()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline int binnedInline_sindex(const float X){
+  /*
+  //reference version
+  int exp;
+
+  if(X == 0.0){
+    return (FLT_MAX_EXP - FLT_MIN_EXP)/SBWIDTH;
+  }else{
+    frexpf(X, &exp);
+    return (FLT_MAX_EXP - exp)/SBWIDTH;
+  }
+  */
+  int exp = binnedInline_sexp(X);
+  if(exp == 0){
+    if(X == 0.0){
+      return binned_SBMAXINDEX;
+    }else{
+      frexpf(X, &exp);
+      exp = (FLT_MAX_EXP - exp)/SBWIDTH;
+      return exp < binned_SBMAXINDEX ? exp : binned_SBMAXINDEX;
+    }
+  }
+  return ((FLT_MAX_EXP + (FLT_MAX_EXP - 2)) - exp)/SBWIDTH;
+}
+
+/**
+ * @brief Inline version of binned_smindex()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline int binnedInline_smindex(const float *priX){
+  /*
+  //reference version
+  int exp;
+
+  if(priX[0] == 0.0){
+    return (FLT_MAX_EXP - FLT_MIN_EXP)/SBWIDTH + binned_SBMAXFOLD;
+  }else{
+    frexpf(priX[0], &exp);
+    if(exp == FLT_MAX_EXP){
+      return 0;
+    }
+    return (FLT_MAX_EXP + FLT_MANT_DIG - SBWIDTH + 1 - exp)/SBWIDTH;
+  }
+  */
+  return ((FLT_MAX_EXP + FLT_MANT_DIG - SBWIDTH + 1 + (FLT_MAX_EXP - 2)) - binnedInline_sexp(priX[0]))/SBWIDTH;
+}
+
+/**
+ * @brief Inline version of binned_smindex0()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline int binnedInline_smindex0(const float *priX){
+  /*
+  //reference version
+  int exp;
+
+  frexpf(priX[0], &exp);
+  if(exp == FLT_MAX_EXP){
+    return 1;
+  }
+  return 0;
+  */
+  return binnedInline_sexp(priX[0]) == FLT_MAX_EXP + (FLT_MAX_EXP - 2);
+}
+
+/**
+ * @brief Inline version of binned_dmdupdate()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_dmdupdate(const int fold, const double X, double* priY, const int incpriY, double* carY, const int inccarY){
+  int i;
+  int j;
+  int X_index;
+  int shift;
+  const double *bins;
+
+  if (binnedInline_disnaninf(priY[0])){
+    return;
+  }
+
+  X_index = binnedInline_dindex(X);
+  if(priY[0] == 0.0){
+    bins = binned_dmbins(X_index);
+    for(i = 0; i < fold; i++){
+      priY[i * incpriY] = bins[i];
+      carY[i * inccarY] = 0.0;
+    }
+  }else{
+    shift = binnedInline_dmindex(priY) - X_index;
+    if(shift > 0){
+      for(i = fold - 1; i >= shift; i--){
+        priY[i * incpriY] = priY[(i - shift) * incpriY];
+        carY[i * inccarY] = carY[(i - shift) * inccarY];
+      }
+      bins = binned_dmbins(X_index);
+      for(j = 0; j < i + 1; j++){
+        priY[j * incpriY] = bins[j];
+        carY[j * inccarY] = 0.0;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Inline version of binned_dmddeposit()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_dmddeposit(const int fold, const double X, double *priY, const int incpriY){
+  double M;
+  binnedInline_double_bits q;
+  int i;
+  double x = X;
+
+  if(binnedInline_disnaninf(x) || binnedInline_disnaninf(priY[0])){
+    priY[0] += x;
+    return;
+  }
+
+  if(binnedInline_dmindex0(priY)){
+    M = priY[0];
+    q.d = x * binned_DMCOMPRESSION;
+    q.l |= 1;
+    q.d += M;
+    priY[0] = q.d;
+    M -= q.d;
+    M *= binned_DMEXPANSION * 0.5;
+    x += M;
+    x += M;
+    for (i = 1; i < fold - 1; i++) {
+      M = priY[i * incpriY];
+      q.d = x;
+      q.l |= 1;
+      q.d += M;
+      priY[i * incpriY] = q.d;
+      M -= q.d;
+      x += M;
+    }
+    q.d = x;
+    q.l |= 1;
+    priY[i * incpriY] += q.d;
+  }else{
+    for (i = 0; i < fold - 1; i++) {
+      M = priY[i * incpriY];
+      q.d = x;
+      q.l |= 1;
+      q.d += M;
+      priY[i * incpriY] = q.d;
+      M -= q.d;
+      x += M;
+    }
+    q.d = x;
+    q.l |= 1;
+    priY[i * incpriY] += q.d;
+  }
+}
+
+/**
+ * @brief Inline version of binned_dmrenorm()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_dmrenorm(const int fold, double* priX, const int incpriX, double* carX, const int inccarX){
+  /*
+  //reference version
+  int i;
+  double M;
+  double priX0 = priX[0];
+
+  if(priX0 == 0.0 || ISNANINF(priX0)){
+    return;
+  }
+
+  for (i = 0; i < fold; i++, priX += incpriX, carX += inccarX) {
+    priX0 = priX[0];
+
+    M = UFP(priX0);
+
+    if (priX0 >= (M * 1.75)) {
+      priX[0] -= M * 0.25;
+      carX[0] += 1;
+    }
+    else if (priX0 < (M * 1.5)) {
+      priX[0] += M * 0.25;
+      carX[0] -= 1;
+    }
+  }
+  */
+  int i;
+  binnedInline_double_bits tmp_renorm;
+
+  if(priX[0] == 0.0 || binnedInline_disnaninf(priX[0])){
+    return;
+  }
+
+  for (i = 0; i < fold; i++, priX += incpriX, carX += inccarX) {
+    tmp_renorm.d = priX[0];
+
+    carX[0] += (int)((tmp_renorm.l >> (DBL_MANT_DIG - 3)) & 3) - 2;
+
+    tmp_renorm.l &= ~(1ull << (DBL_MANT_DIG - 3));
+    tmp_renorm.l |= 1ull << (DBL_MANT_DIG - 2);
+    priX[0] = tmp_renorm.d;
+  }
+}
+
+/**
+ * @brief Inline version of binned_dmdadd()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_dmdadd(const int fold, const double X, double *priY, const int incpriY, double *carY, const int inccarY){
+  binnedInline_dmdupdate(fold, X, priY, incpriY, carY, inccarY);
+  binnedInline_dmddeposit(fold, X, priY, incpriY);
+  binnedInline_dmrenorm(fold, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @brief Inline version of binned_ddmconv()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline double binnedInline_ddmconv(const int fold, const double* priX, const int incpriX, const double* carX, const int inccarX){
+  int i = 0;
+  int X_index;
+  const double *bins;
+  double Y = 0.0;
+  double scale_down;
+  double scale_up;
+  int scaled;
+
+  if (binnedInline_disnaninf(priX[0])){
+    return priX[0];
+  }
+
+  if (priX[0] == 0.0) {
+    return 0.0;
+  }
+
+  X_index = binnedInline_dmindex(priX);
+  bins = binned_dmbins(X_index);
+  if(X_index <= (3 * DBL_MANT_DIG)/DBWIDTH){
+    scale_down = ldexp(0.5, 1 - (2 * DBL_MANT_DIG - DBWIDTH));
+    scale_up = ldexp(0.5, 1 + (2 * DBL_MANT_DIG - DBWIDTH));
+    scaled = (3 * DBL_MANT_DIG)/DBWIDTH - X_index;
+    scaled = scaled < fold ? scaled : fold;
+    scaled = scaled > 0 ? scaled : 0;
+    if(X_index == 0){
+      Y += carX[0] * ((bins[0]/6.0) * scale_down * binned_DMEXPANSION);
+      Y += carX[inccarX] * ((bins[1]/6.0) * scale_down);
+      Y += (priX[0] - bins[0]) * scale_down * binned_DMEXPANSION;
+      i = 2;
+    }else{
+      Y += carX[0] * ((bins[0]/6.0) * scale_down);
+      i = 1;
+    }
+    for(; i < scaled; i++){
+      Y += carX[i * inccarX] * ((bins[i]/6.0) * scale_down);
+      Y += (priX[(i - 1) * incpriX] - bins[i - 1]) * scale_down;
+    }
+    if(i == fold){
+      Y += (priX[(fold - 1) * incpriX] - bins[fold - 1]) * scale_down;
+      return Y * scale_up;
+    }
+    if(isinf(Y * scale_up)){
+      return Y * scale_up;
+    }
+    Y *= scale_up;
+    for(; i < fold; i++){
+      Y += carX[i * inccarX] * (bins[i]/6.0);
+      Y += priX[(i - 1) * incpriX] - bins[i - 1];
+    }
+    Y += priX[(fold - 1) * incpriX] - bins[fold - 1];
+  }else{
+    Y += carX[0] * (bins[0]/6.0);
+    for(i = 1; i < fold; i++){
+      Y += carX[i * inccarX] * (bins[i]/6.0);
+      Y += (priX[(i - 1) * incpriX] - bins[i - 1]);
+    }
+    Y += (priX[(fold - 1) * incpriX] - bins[fold - 1]);
+  }
+  return Y;
+}
+
+/**
+ * @brief Inline version of binned_zmzupdate()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_zmzupdate(const int fold, const void *X, double* priY, const int incpriY, double* carY, const int inccarY){
+  binnedInline_dmdupdate(fold, ((const double*)X)[0], priY, 2 * incpriY, carY, 2 * inccarY);
+  binnedInline_dmdupdate(fold, ((const double*)X)[1], priY + 1, 2 * incpriY, carY + 1, 2 * inccarY);
+}
+
+/**
+ * @brief Inline version of binned_zmzdeposit()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_zmzdeposit(const int fold, const void *X, double *priY, const int incpriY){
+  double MR, MI;
+  binnedInline_double_bits qR, qI;
+  int i;
+  double xR = ((const double*)X)[0];
+  double xI = ((const double*)X)[1];
+
+  if (binnedInline_disnaninf(xR) || binnedInline_disnaninf(priY[0])) {
+    priY[0] += xR;
+    binnedInline_dmddeposit(fold, xI, priY + 1, 2 * incpriY);
+    return;
+  }
+  if (binnedInline_disnaninf(xI) || binnedInline_disnaninf(priY[1])) {
+    priY[1] += xI;
+    binnedInline_dmddeposit(fold, xR, priY, 2 * incpriY);
+    return;
+  }
+
+  if(binnedInline_dmindex0(priY) || binnedInline_dmindex0(priY + 1)){
+    binnedInline_dmddeposit(fold, xR, priY, 2 * incpriY);
+    binnedInline_dmddeposit(fold, xI, priY + 1, 2 * incpriY);
+    return;
+  }
+
+  for (i = 0; i < fold - 1; i++) {
+    MR = priY[i * 2 * incpriY];
+    MI = priY[i * 2 * incpriY + 1];
+    qR.d = xR;
+    qI.d = xI;
+    qR.l |= 1;
+    qI.l |= 1;
+    qR.d += MR;
+    qI.d += MI;
+    priY[i * 2 * incpriY] = qR.d;
+    priY[i * 2 * incpriY + 1] = qI.d;
+    MR -= qR.d;
+    MI -= qI.d;
+    xR += MR;
+    xI += MI;
+  }
+  qR.d = xR;
+  qI.d = xI;
+  qR.l |= 1;
+  qI.l |= 1;
+  priY[i * 2 * incpriY] += qR.d;
+  priY[i * 2 * incpriY + 1] += qI.d;
+}
+
+/**
+ * @brief Inline version of binned_zmrenorm()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_zmrenorm(const int fold, double* priX, const int incpriX, double* carX, const int inccarX){
+  binnedInline_dmrenorm(fold, priX, 2 * incpriX, carX, 2 * inccarX);
+  binnedInline_dmrenorm(fold, priX + 1, 2 * incpriX, carX + 1, 2 * inccarX);
+}
+
+/**
+ * @brief Inline version of binned_zmzadd()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_zmzadd(const int fold, const void *X, double *priY, const int incpriY, double *carY, const int inccarY){
+  binnedInline_zmzupdate(fold, X, priY, incpriY, carY, inccarY);
+  binnedInline_zmzdeposit(fold, X, priY, incpriY);
+  binnedInline_zmrenorm(fold, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @brief Inline version of binned_zzmconv_sub()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_zzmconv_sub(const int fold, const double *priX, const int incpriX, const double *carX, const int inccarX, void *conv){
+  ((double*)conv)[0] = binnedInline_ddmconv(fold, priX, 2 * incpriX, carX, 2 * inccarX);
+  ((double*)conv)[1] = binnedInline_ddmconv(fold, priX + 1, 2 * incpriX, carX + 1, 2 * inccarX);
+}
+
+/**
+ * @brief Inline version of binned_smsupdate()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_smsupdate(const int fold, const float X, float* priY, const int incpriY, float* carY, const int inccarY){
+  int i;
+  int j;
+  int X_index;
+  int shift;
+  const float *bins;
+
+  if (binnedInline_sisnaninf(priY[0])){
+    return;
+  }
+
+  X_index = binnedInline_sindex(X);
+  if(priY[0] == 0.0){
+    bins = binned_smbins(X_index);
+    for(i = 0; i < fold; i++){
+      priY[i * incpriY] = bins[i];
+      carY[i * inccarY] = 0.0;
+    }
+  }else{
+    shift = binnedInline_smindex(priY) - X_index;
+    if(shift > 0){
+      for(i = fold - 1; i >= shift; i--){
+        priY[i * incpriY] = priY[(i - shift) * incpriY];
+        carY[i * inccarY] = carY[(i - shift) * inccarY];
+      }
+      bins = binned_smbins(X_index);
+      for(j = 0; j < i + 1; j++){
+        priY[j * incpriY] = bins[j];
+        carY[j * inccarY] = 0.0;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Inline version of binned_smsdeposit()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_smsdeposit(const int fold, const float X, float *priY, const int incpriY){
+  float M;
+  binnedInline_float_bits q;
+  int i;
+  float x = X;
+
+  if (binnedInline_sisnaninf(x) || binnedInline_sisnaninf(priY[0])) {
+    priY[0] += x;
+    return;
+  }
+
+  if(binnedInline_smindex0(priY)){
+    M = priY[0];
+    q.f = x * binned_SMCOMPRESSION;
+    q.i |= 1;
+    q.f += M;
+    priY[0] = q.f;
+    M -= q.f;
+    M *= (binned_SMEXPANSION * 0.5);
+    x += M;
+    x += M;
+    for (i = 1; i < fold - 1; i++) {
+      M = priY[i * incpriY];
+      q.f = x;
+      q.i |= 1;
+      q.f += M;
+      priY[i * incpriY] = q.f;
+      M -= q.f;
+      x += M;
+    }
+    q.f = x;
+    q.i |= 1;
+    priY[i * incpriY] += q.f;
+  }else{
+    for (i = 0; i < fold - 1; i++) {
+      M = priY[i * incpriY];
+      q.f = x;
+      q.i |= 1;
+      q.f += M;
+      priY[i * incpriY] = q.f;
+      M -= q.f;
+      x += M;
+    }
+    q.f = x;
+    q.i |= 1;
+    priY[i * incpriY] += q.f;
+  }
+}
+
+/**
+ * @brief Inline version of binned_smrenorm()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_smrenorm(const int fold, float* priX, const int incpriX, float* carX, const int inccarX){
+  /*
+  //reference version
+  int i;
+  float M;
+  float priX0 = priX[0];
+
+  if(priX0 == 0.0 || ISNANINFF(priX0)){
+    return;
+  }
+
+  for (i = 0; i < fold; i++, priX += incpriX, carX += inccarX) {
+    priX0 = priX[0];
+
+    M = UFPF(priX0);
+
+    if (priX0 >= (M * 1.75)) {
+      priX[0] -= M * 0.25;
+      carX[0] += 1;
+    }
+    else if (priX0 < (M * 1.5)) {
+      priX[0] += M * 0.25;
+      carX[0] -= 1;
+    }
+  }
+  */
+  int i;
+  binnedInline_float_bits tmp_renorm;
+
+  if(priX[0] == 0.0 || binnedInline_sisnaninf(priX[0])){
+    return;
+  }
+
+  for (i = 0; i < fold; i++, priX += incpriX, carX += inccarX) {
+    tmp_renorm.f = priX[0];
+
+    carX[0] += (int)((tmp_renorm.i >> (FLT_MANT_DIG - 3)) & 3) - 2;
+
+    tmp_renorm.i &= ~(1ul << (FLT_MANT_DIG - 3));
+    tmp_renorm.i |= 1ul << (FLT_MANT_DIG - 2);
+    priX[0] = tmp_renorm.f;
+  }
+}
+
+/**
+ * @brief Inline version of binned_smsadd()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_smsadd(const int fold, const float X, float *priY, const int incpriY, float *carY, const int inccarY){
+  binnedInline_smsupdate(fold, X, priY, incpriY, carY, inccarY);
+  binnedInline_smsdeposit(fold, X, priY, incpriY);
+  binnedInline_smrenorm(fold, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @brief Inline version of binned_ssmconv()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline float binnedInline_ssmconv(const int fold, const float* priX, const int incpriX, const float* carX, const int inccarX){
+  int i = 0;
+  double Y = 0.0;
+  int X_index;
+  const float *bins;
+
+  if (binnedInline_sisnaninf(priX[0])){
+    return priX[0];
+  }
+
+  if (priX[0] == 0.0) {
+    return 0.0;
+  }
+
+  X_index = binnedInline_smindex(priX);
+  bins = binned_smbins(X_index);
+  if(X_index == 0){
+    Y += (double)carX[0] * (double)(bins[0]/6.0) * (double)binned_SMEXPANSION;
+    Y += (double)carX[inccarX] * (double)(bins[1]/6.0);
+    Y += (double)(priX[0] - bins[0]) * (double)binned_SMEXPANSION;
+    i = 2;
+  }else{
+    Y += (double)carX[0] * (double)(bins[0]/6.0);
+    i = 1;
+  }
+  for(; i < fold; i++){
+    Y += (double)carX[i * inccarX] * (double)(bins[i]/6.0);
+    Y += (double)(priX[(i - 1) * incpriX] - bins[i - 1]);
+  }
+  Y += (double)(priX[(fold - 1) * incpriX] - bins[fold - 1]);
+
+  return (float)Y;
+}
+
+/**
+ * @brief Inline version of binned_cmcupdate()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_cmcupdate(const int fold, const void *X, float* priY, const int incpriY, float* carY, const int inccarY){
+  binnedInline_smsupdate(fold, ((const float*)X)[0], priY, 2 * incpriY, carY, 2 * inccarY);
+  binnedInline_smsupdate(fold, ((const float*)X)[1], priY + 1, 2 * incpriY, carY + 1, 2 * inccarY);
+}
+
+/**
+ * @brief Inline version of binned_cmcdeposit()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_cmcdeposit(const int fold, const void *X, float *priY, const int incpriY){
+  float MR, MI;
+  binnedInline_float_bits qR, qI;
+  int i;
+  float xR = ((const float*)X)[0];
+  float xI = ((const float*)X)[1];
+
+  if (binnedInline_sisnaninf(xR) || binnedInline_sisnaninf(priY[0])){
+    priY[0] += xR;
+    binnedInline_smsdeposit(fold, xI, priY + 1, 2 * incpriY);
+    return;
+  }
+  if (binnedInline_sisnaninf(xI) || binnedInline_sisnaninf(priY[1])){
+    priY[1] += xI;
+    binnedInline_smsdeposit(fold, xR, priY, 2 * incpriY);
+    return;
+  }
+
+  if(binnedInline_smindex0(priY) || binnedInline_smindex0(priY + 1)){
+    binnedInline_smsdeposit(fold, xR, priY, 2 * incpriY);
+    binnedInline_smsdeposit(fold, xI, priY + 1, 2 * incpriY);
+    return;
+  }
+
+  for (i = 0; i < fold - 1; i++) {
+    MR = priY[i * 2 * incpriY];
+    MI = priY[i * 2 * incpriY + 1];
+    qR.f = xR;
+    qI.f = xI;
+    qR.i |= 1;
+    qI.i |= 1;
+    qR.f += MR;
+    qI.f += MI;
+    priY[i * 2 * incpriY] = qR.f;
+    priY[i * 2 * incpriY + 1] = qI.f;
+    MR -= qR.f;
+    MI -= qI.f;
+    xR += MR;
+    xI += MI;
+  }
+  qR.f = xR;
+  qI.f = xI;
+  qR.i |= 1;
+  qI.i |= 1;
+  priY[i * 2 * incpriY] += qR.f;
+  priY[i * 2 * incpriY + 1] += qI.f;
+}
+
+/**
+ * @brief Inline version of binned_cmrenorm()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_cmrenorm(const int fold, float* priX, const int incpriX, float* carX, const int inccarX){
+  binnedInline_smrenorm(fold, priX, 2 * incpriX, carX, 2 * inccarX);
+  binnedInline_smrenorm(fold, priX + 1, 2 * incpriX, carX + 1, 2 * inccarX);
+}
+
+/**
+ * @brief Inline version of binned_cmcadd()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_cmcadd(const int fold, const void *X, float *priY, const int incpriY, float *carY, const int inccarY){
+  binnedInline_cmcupdate(fold, X, priY, incpriY, carY, inccarY);
+  binnedInline_cmcdeposit(fold, X, priY, incpriY);
+  binnedInline_cmrenorm(fold, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @brief Inline version of binned_ccmconv_sub()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_ccmconv_sub(const int fold, const float *priX, const int incpriX, const float *carX, const int inccarX, void *conv){
+  ((float*)conv)[0] = binnedInline_ssmconv(fold, priX, 2 * incpriX, carX, 2 * inccarX);
+  ((float*)conv)[1] = binnedInline_ssmconv(fold, priX + 1, 2 * incpriX, carX + 1, 2 * inccarX);
+}
+
+/**
+ * @brief Inline version of binned_dbdupdate()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_dbdupdate(const int fold, const double X, double_binned *Y){
+  binnedInline_dmdupdate(fold, X, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_dbddeposit()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_dbddeposit(const int fold, const double X, double_binned *Y){
+  binnedInline_dmddeposit(fold, X, Y, 1);
+}
+
+/**
+ * @brief Inline version of binned_dbrenorm()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_dbrenorm(const int fold, double_binned *X){
+  binnedInline_dmrenorm(fold, X, 1, X + fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_dbdadd()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_dbdadd(const int fold, const double X, double_binned *Y){
+  binnedInline_dmdadd(fold, X, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_ddbconv()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline double binnedInline_ddbconv(const int fold, const double_binned *X){
+  return binnedInline_ddmconv(fold, X, 1, X + fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_zbzupdate()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_zbzupdate(const int fold, const void *X, double_complex_binned *Y){
+  binnedInline_zmzupdate(fold, X, Y, 1, Y + 2 * fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_zbzdeposit()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_zbzdeposit(const int fold, const void *X, double_complex_binned *Y){
+  binnedInline_zmzdeposit(fold, X, Y, 1);
+}
+
+/**
+ * @brief Inline version of binned_zbrenorm()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_zbrenorm(const int fold, double_complex_binned *X){
+  binnedInline_zmrenorm(fold, X, 1, X + 2 * fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_zbzadd()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_zbzadd(const int fold, const void *X, double_complex_binned *Y){
+  binnedInline_zmzadd(fold, X, Y, 1, Y + 2 * fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_zzbconv_sub()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_zzbconv_sub(const int fold, const double_complex_binned *X, void *conv){
+  binnedInline_zzmconv_sub(fold, X, 1, X + 2 * fold, 1, conv);
+}
+
+/**
+ * @brief Inline version of binned_sbsupdate()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_sbsupdate(const int fold, const float X, float_binned *Y){
+  binnedInline_smsupdate(fold, X, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_sbsdeposit()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_sbsdeposit(const int fold, const float X, float_binned *Y){
+  binnedInline_smsdeposit(fold, X, Y, 1);
+}
+
+/**
+ * @brief Inline version of binned_sbrenorm()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_sbrenorm(const int fold, float_binned *X){
+  binnedInline_smrenorm(fold, X, 1, X + fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_sbsadd()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_sbsadd(const int fold, const float X, float_binned *Y){
+  binnedInline_smsadd(fold, X, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_ssbconv()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline float binnedInline_ssbconv(const int fold, const float_binned *X){
+  return binnedInline_ssmconv(fold, X, 1, X + fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_cbcupdate()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_cbcupdate(const int fold, const void *X, float_complex_binned *Y){
+  binnedInline_cmcupdate(fold, X, Y, 1, Y + 2 * fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_cbcdeposit()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_cbcdeposit(const int fold, const void *X, float_complex_binned *Y){
+  binnedInline_cmcdeposit(fold, X, Y, 1);
+}
+
+/**
+ * @brief Inline version of binned_cbrenorm()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_cbrenorm(const int fold, float_complex_binned *X){
+  binnedInline_cmrenorm(fold, X, 1, X + 2 * fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_cbcadd()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_cbcadd(const int fold, const void *X, float_complex_binned *Y){
+  binnedInline_cmcadd(fold, X, Y, 1, Y + 2 * fold, 1);
+}
+
+/**
+ * @brief Inline version of binned_ccbconv_sub()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static inline void binnedInline_ccbconv_sub(const int fold, const float_complex_binned *X, void *conv){
+  binnedInline_ccmconv_sub(fold, X, 1, X + 2 * fold, 1, conv);
+}
+
+#endif
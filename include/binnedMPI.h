@@ -18,6 +18,12 @@
  *
  * The goal of using binned types is to obtain either more accurate or reproducible summation of floating point numbers. In reproducible summation, floating point numbers are split into several slices along predefined boundaries in the exponent range. The space between two boundaries is called a bin. Binned types are composed of several accumulators, each accumulating the slices in a particular bin. The accumulators correspond to the largest consecutive nonzero bins seen so far.
  *
+ * Binned types are sent as arrays of @c double or @c float. Binned double precision may also be sent in a smaller packed encoding (see #binnedMPI_dbpack()) using #binnedMPI_DOUBLE_BINNED_COMPACT and #binnedMPI_DBDBADD_COMPACT, which give the same results with 25% less communication.
+ *
+ * Binned reductions may use #binnedMPI_allreduce(), which reduces within each node through shared memory before reducing across nodes, in place of @c MPI_Allreduce().
+ *
+ * The datatypes and operations of each fold are created the first time they are requested and reused afterwards. They may be requested from several threads at once.
+ *
  * The parameter @c fold describes how many accumulators are used in the binned types supplied to a subroutine (an binned type with @c k accumulators  is @c k-fold). The default value for this parameter can be set in config.h. If you are unsure of what value to use for @c fold, we recommend 3. Note that the @c fold of binned types must be the same for all binned types that interact with each other. Operations on more than one binned type assume all binned types being operated upon have the same @c fold. Note that the @c fold of an binned type may not be changed once the type has been allocated. A common use case would be to set the value of @c fold as a global macro in your code and supply it to all binned functions that you use.
  *
  */
@@ -25,8 +31,26 @@
 #define BINNEDMPI_H_
 
 #include <mpi.h>
+#include <stddef.h>
+#include <stdint.h>
 #include "binned.h"
 
+/**
+ * @brief Index bits of a packed binned double precision zero
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define binnedMPI_DBPACKZERO ((1 << (64 - (DBL_MANT_DIG - 3))) - 1)
+
+/**
+ * @brief Index bits of a packed binned double precision @c NaN or @c Inf
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define binnedMPI_DBPACKNANINF ((1 << (64 - (DBL_MANT_DIG - 3))) - 2)
+
 MPI_Op binnedMPI_DBDBADD(const int fold);
 MPI_Op binnedMPI_ZBZBADD(const int fold);
 MPI_Op binnedMPI_SBSBADD(const int fold);
@@ -43,4 +67,13 @@ MPI_Datatype binnedMPI_FLOAT_COMPLEX_BINNED(const int fold);
 MPI_Datatype binnedMPI_DOUBLE_BINNED_SCALED(const int fold);
 MPI_Datatype binnedMPI_FLOAT_BINNED_SCALED(const int fold);
 
+size_t binnedMPI_dbpacksize(const int fold);
+void binnedMPI_dbpack(const int fold, const int N, const double_binned *X, const int incX, void *C);
+void binnedMPI_dbunpack(const int fold, const int N, const void *C, double_binned *X, const int incX);
+
+MPI_Op binnedMPI_DBDBADD_COMPACT(const int fold);
+MPI_Datatype binnedMPI_DOUBLE_BINNED_COMPACT(const int fold);
+
+int binnedMPI_allreduce(const void *sendbuf, void *recvbuf, const int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
+
 #endif
@@ -0,0 +1,139 @@
+/**
+ * @file  binnedOMP.h
+ * @brief binnedOMP.h defines OpenMP reductions on binned types, so that loops may compute reproducible sums with a reduction clause.
+ *
+ * For each fold @c k supported by a binned type, this header defines a struct holding a @c k-fold binned value and an OpenMP reduction identifier for it:
+ * - @c double_binned{k} (such as @c double_binned3), with the reduction @c rdsum{k}, for #double_binned
+ * - @c double_complex_binned{k}, with the reduction @c rzsum{k}, for #double_complex_binned
+ * - @c float_binned{k}, with the reduction @c rssum{k}, for #float_binned
+ * - @c float_complex_binned{k}, with the reduction @c rcsum{k}, for #float_complex_binned
+ *
+ * Folds range from 2 to #binned_DBMAXFOLD for double precision and from 2 to #binned_SBMAXFOLD for single precision. The binned value is the member @c value of the struct, and may be passed to any function of binned.h with the same fold. Each thread's private copy is set to zero (by @c double_binned{k}_setzero() and so on, which call binned_dbsetzero() and so on), and the copies are combined with binned_dbdbadd() (and so on). Since binned addition gives the same result in any order, the result does not depend on the number of threads or on the loop schedule. For example:
+ *
+ * @code
+ * double_binned3 acc;
+ * binned_dbsetzero(3, acc.value);
+ * #pragma omp parallel for reduction(rdsum3:acc)
+ * for(i = 0; i < N; i++){
+ *   binned_dbdadd(3, X[i], acc.value);
+ * }
+ * sum = binned_ddbconv(3, acc.value);
+ * @endcode
+ *
+ * The reductions require OpenMP 4.0 or later. Without OpenMP, only the structs are defined.
+ */
+#ifndef BINNEDOMP_H_
+#define BINNEDOMP_H_
+
+#include "binned.h"
+
+#ifdef _OPENMP
+#define binnedOMP_PRAGMA(x) _Pragma(#x)
+#else
+#define binnedOMP_PRAGMA(x)
+#endif
+
+/**
+ * @brief Define the binned structs of one fold and their reductions (for the real and complex types of one precision)
+ *
+ * @param rtype the real binned type (#double_binned or #float_binned)
+ * @param ctype the complex binned type (#double_complex_binned or #float_complex_binned)
+ * @param rprefix the prefix of binned.h functions on rtype (db or sb)
+ * @param cprefix the prefix of binned.h functions on ctype (zb or cb)
+ * @param rsum the name of the reduction on rtype (rdsum or rssum)
+ * @param csum the name of the reduction on ctype (rzsum or rcsum)
+ * @param fold the fold
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define binnedOMP_DECLARE(rtype, ctype, rprefix, cprefix, rsum, csum, fold)\
+  typedef struct{\
+    rtype value[2 * (fold)];\
+  } rtype##fold;\
+  typedef struct{\
+    ctype value[4 * (fold)];\
+  } ctype##fold;\
+  static inline void rtype##fold##_setzero(rtype##fold *X){\
+    binned_##rprefix##setzero(fold, X->value);\
+  }\
+  static inline void ctype##fold##_setzero(ctype##fold *X){\
+    binned_##cprefix##setzero(fold, X->value);\
+  }\
+  binnedOMP_PRAGMA(omp declare reduction(rsum##fold : rtype##fold : binned_##rprefix##rprefix##add(fold, omp_in.value, omp_out.value)) initializer(rtype##fold##_setzero(&omp_priv)))\
+  binnedOMP_PRAGMA(omp declare reduction(csum##fold : ctype##fold : binned_##cprefix##cprefix##add(fold, omp_in.value, omp_out.value)) initializer(ctype##fold##_setzero(&omp_priv)))
+
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 2)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 3)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 4)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 5)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 6)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 7)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 8)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 9)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 10)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 11)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 12)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 13)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 14)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 15)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 16)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 17)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 18)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 19)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 20)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 21)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 22)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 23)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 24)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 25)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 26)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 27)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 28)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 29)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 30)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 31)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 32)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 33)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 34)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 35)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 36)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 37)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 38)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 39)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 40)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 41)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 42)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 43)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 44)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 45)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 46)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 47)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 48)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 49)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 50)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 51)
+binnedOMP_DECLARE(double_binned, double_complex_binned, db, zb, rdsum, rzsum, 52)
+
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 2)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 3)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 4)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 5)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 6)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 7)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 8)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 9)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 10)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 11)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 12)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 13)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 14)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 15)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 16)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 17)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 18)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 19)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 20)
+binnedOMP_DECLARE(float_binned, float_complex_binned, sb, cb, rssum, rcsum, 21)
+
+#endif
@@ -19,11 +19,65 @@
  * The parameter @c fold describes how many accumulators are used in the binned types supplied to a subroutine (an binned type with @c k accumulators  is @c k-fold). The default value for this parameter can be set in config.h. If you are unsure of what value to use for @c fold, we recommend 3. Note that the @c fold of binned types must be the same for all binned types that interact with each other. Operations on more than one binned type assume all binned types being operated upon have the same @c fold. Note that the @c fold of an binned type may not be changed once the type has been allocated. A common use case would be to set the value of @c fold as a global macro in your code and supply it to all binned functions that you use.
  *
  * In reproBLAS, two copies of the BLAS are provided. The functions that share the same name as their BLAS counterparts perform reproducible versions of their corresponding operations using the default fold value specified in config.h. The functions that are prefixed by the character 'r' allow the user to specify their own fold for the underlying binned types.
+ *
+ * When ReproBLAS is built with OpenMP, large reductions are split across threads. The number of threads can be set with #reproBLAS_set_num_threads() or the @c REPROBLAS_NUM_THREADS environment variable. Because binned summation does not depend on the order of its operands, results are identical for any number of threads.
+ *
+ * Threaded routines share a persistent pool of worker threads, started on first use, so that repeated calls on mid-sized vectors do not pay to create threads. Operations on fewer than twice #reproBLAS_get_thread_grain() elements stay on the calling thread; the grain can be set with #reproBLAS_set_thread_grain() or the @c REPROBLAS_THREAD_GRAIN environment variable. Workers can be pinned to CPUs with #reproBLAS_set_thread_affinity() or the @c REPROBLAS_AFFINITY environment variable (a list such as @c 0,2,4-7). Each thread allocates and first writes the binned copies of C and the packed copies of A and B that it works on, so on NUMA machines with pinned workers these buffers are placed on the memory node of the thread that uses them. Threads are given parts of binned arrays that begin and end on cache line boundaries when possible.
+ *
+ * When ReproBLAS is built with runtime dispatch (@c BUILD_DISPATCH in config.mk), the vectorized kernels are compiled for every supported instruction set and the best one available on the running processor is chosen at first use. The instruction set can be forced with #reproBLAS_set_vectorization() or the @c REPROBLAS_VECTORIZATION environment variable (one of @c SISD, @c SSE, @c AVX, @c AVX2, or @c AVX512). Results are identical for every instruction set.
  */
 #ifndef REPROBLAS_H_
 #define REPROBLAS_H_
 #include <complex.h>
 
+/**
+ * @brief Scalar (no vectorization) kernels
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define reproBLAS_SISD 0
+
+/**
+ * @brief SSE2 kernels
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define reproBLAS_SSE 1
+
+/**
+ * @brief AVX kernels
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define reproBLAS_AVX 2
+
+/**
+ * @brief AVX kernels compiled with AVX2 and FMA (fused multiply-adds and gathers)
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define reproBLAS_AVX2 3
+
+/**
+ * @brief AVX-512 kernels
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define reproBLAS_AVX512 4
+
+int reproBLAS_get_num_threads(void);
+void reproBLAS_set_num_threads(const int N);
+int reproBLAS_get_thread_grain(void);
+void reproBLAS_set_thread_grain(const int N);
+void reproBLAS_set_thread_affinity(const int N, const int *cpus);
+int reproBLAS_get_vectorization(void);
+void reproBLAS_set_vectorization(const int V);
+
 double reproBLAS_rdsum(const int fold, const int N, const double* X, const int incX);
 double reproBLAS_rdasum(const int fold, const int N, const double* X, const int incX);
 double reproBLAS_rdnrm2(const int fold, const int N, const double* X, const int incX);
@@ -57,6 +111,20 @@ void reproBLAS_rdgemm(const int fold, const char Order,
             const double alpha, const double *A, const int lda,
             const double *B, const int ldb,
             const double beta, double *C, const int ldc);
+void reproBLAS_rdgemm_batch(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const double alpha, const double *const *A, const int lda,
+            const double *const *B, const int ldb,
+            const double beta, double *const *C, const int ldc,
+            const int batch_count);
+void reproBLAS_rdgemm_batch_strided(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const double alpha, const double *A, const int lda, const int strideA,
+            const double *B, const int ldb, const int strideB,
+            const double beta, double *C, const int ldc, const int strideC,
+            const int batch_count);
 
 void reproBLAS_rsgemv(const int fold, const char Order, const char TransA,
             const int M, const int N,
@@ -69,6 +137,20 @@ void reproBLAS_rsgemm(const int fold, const char Order,
             const float alpha, const float *A, const int lda,
             const float *B, const int ldb,
             const float beta, float *C, const int ldc);
+void reproBLAS_rsgemm_batch(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const float alpha, const float *const *A, const int lda,
+            const float *const *B, const int ldb,
+            const float beta, float *const *C, const int ldc,
+            const int batch_count);
+void reproBLAS_rsgemm_batch_strided(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const float alpha, const float *A, const int lda, const int strideA,
+            const float *B, const int ldb, const int strideB,
+            const float beta, float *C, const int ldc, const int strideC,
+            const int batch_count);
 
 void reproBLAS_rzgemv(const int fold, const char Order, const char TransA,
             const int M, const int N,
@@ -81,6 +163,20 @@ void reproBLAS_rzgemm(const int fold, const char Order,
             const void *alpha, const void *A, const int lda,
             const void *B, const int ldb,
             const void *beta, void *C, const int ldc);
+void reproBLAS_rzgemm_batch(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const void *alpha, const void *const *A, const int lda,
+            const void *const *B, const int ldb,
+            const void *beta, void *const *C, const int ldc,
+            const int batch_count);
+void reproBLAS_rzgemm_batch_strided(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const void *alpha, const void *A, const int lda, const int strideA,
+            const void *B, const int ldb, const int strideB,
+            const void *beta, void *C, const int ldc, const int strideC,
+            const int batch_count);
 
 void reproBLAS_rcgemv(const int fold, const char Order, const char TransA,
             const int M, const int N,
@@ -93,6 +189,20 @@ void reproBLAS_rcgemm(const int fold, const char Order,
             const void *alpha, const void *A, const int lda,
             const void *B, const int ldb,
             const void *beta, void *C, const int ldc);
+void reproBLAS_rcgemm_batch(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const void *alpha, const void *const *A, const int lda,
+            const void *const *B, const int ldb,
+            const void *beta, void *const *C, const int ldc,
+            const int batch_count);
+void reproBLAS_rcgemm_batch_strided(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const void *alpha, const void *A, const int lda, const int strideA,
+            const void *B, const int ldb, const int strideB,
+            const void *beta, void *C, const int ldc, const int strideC,
+            const int batch_count);
 
 double reproBLAS_dsum(const int N, const double* X, const int incX);
 double reproBLAS_dasum(const int N, const double* X, const int incX);
@@ -126,6 +236,18 @@ void reproBLAS_dgemm(const char Order, const char TransA, const char TransB,
             const double alpha, const double *A, const int lda,
             const double *B, const int ldb,
             const double beta, double *C, const int ldc);
+void reproBLAS_dgemm_batch(const char Order, const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const double alpha, const double *const *A, const int lda,
+            const double *const *B, const int ldb,
+            const double beta, double *const *C, const int ldc,
+            const int batch_count);
+void reproBLAS_dgemm_batch_strided(const char Order, const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const double alpha, const double *A, const int lda, const int strideA,
+            const double *B, const int ldb, const int strideB,
+            const double beta, double *C, const int ldc, const int strideC,
+            const int batch_count);
 
 void reproBLAS_sgemv(const char Order, const char TransA,
             const int M, const int N,
@@ -137,6 +259,18 @@ void reproBLAS_sgemm(const char Order, const char TransA, const char TransB,
             const float alpha, const float *A, const int lda,
             const float *B, const int ldb,
             const float beta, float *C, const int ldc);
+void reproBLAS_sgemm_batch(const char Order, const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const float alpha, const float *const *A, const int lda,
+            const float *const *B, const int ldb,
+            const float beta, float *const *C, const int ldc,
+            const int batch_count);
+void reproBLAS_sgemm_batch_strided(const char Order, const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const float alpha, const float *A, const int lda, const int strideA,
+            const float *B, const int ldb, const int strideB,
+            const float beta, float *C, const int ldc, const int strideC,
+            const int batch_count);
 
 void reproBLAS_zgemv(const char Order, const char TransA,
             const int M, const int N,
@@ -148,6 +282,18 @@ void reproBLAS_zgemm(const char Order, const char TransA, const char TransB,
             const void *alpha, const void *A, const int lda,
             const void *B, const int ldb,
             const void *beta, void *C, const int ldc);
+void reproBLAS_zgemm_batch(const char Order, const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const void *alpha, const void *const *A, const int lda,
+            const void *const *B, const int ldb,
+            const void *beta, void *const *C, const int ldc,
+            const int batch_count);
+void reproBLAS_zgemm_batch_strided(const char Order, const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const void *alpha, const void *A, const int lda, const int strideA,
+            const void *B, const int ldb, const int strideB,
+            const void *beta, void *C, const int ldc, const int strideC,
+            const int batch_count);
 
 void reproBLAS_cgemv(const char Order, const char TransA,
             const int M, const int N,
@@ -159,5 +305,17 @@ void reproBLAS_cgemm(const char Order, const char TransA, const char TransB,
             const void *alpha, const void *A, const int lda,
             const void *B, const int ldb,
             const void *beta, void *C, const int ldc);
+void reproBLAS_cgemm_batch(const char Order, const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const void *alpha, const void *const *A, const int lda,
+            const void *const *B, const int ldb,
+            const void *beta, void *const *C, const int ldc,
+            const int batch_count);
+void reproBLAS_cgemm_batch_strided(const char Order, const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const void *alpha, const void *A, const int lda, const int strideA,
+            const void *B, const int ldb, const int strideB,
+            const void *beta, void *C, const int ldc, const int strideC,
+            const int batch_count);
 
 #endif
@@ -71,9 +71,9 @@ endif
 # Detect MPI C compiler flags in the following order if MPICFLAGS hasn't been set
 ifeq ($(MPICFLAGS),)
   ifeq ($(MPICC), mpicc)
-    ifeq ("$(shell mpicc --showme:compile &>$(DEVNULL); echo $$?)", 0)
+    ifeq ($(shell mpicc --showme:compile >$(DEVNULL) 2>&1; echo $$?), 0)
       MPICFLAGS := $(shell $(MPICC) --showme:compile)
-    else ifeq ("$(shell mpicc -compile_info &>$(DEVNULL); echo $$?)", 0)
+    else ifeq ($(shell mpicc -compile_info >$(DEVNULL) 2>&1; echo $$?), 0)
       MPICFLAGS := $(shell $(MPICC) -compile_info)
     endif
   endif
@@ -82,14 +82,23 @@ endif
 # Detect MPI C linker flags in the following order if MPILDFLAGS hasn't been set
 ifeq ($(MPILDFLAGS),)
   ifeq ($(MPICC), mpicc)
-    ifeq ("$(shell mpicc --showme:link &>$(DEVNULL); echo $$?)", 0)
+    ifeq ($(shell mpicc --showme:link >$(DEVNULL) 2>&1; echo $$?), 0)
       MPILDFLAGS := $(shell $(MPICC) --showme:link)
-    else ifeq ("$(shell mpicc -link_info &>$(DEVNULL); echo $$?)", 0)
+    else ifeq ($(shell mpicc -link_info >$(DEVNULL) 2>&1; echo $$?), 0)
       MPILDFLAGS := $(shell $(MPICC) -link_info)
     endif
   endif
 endif
 
+# Use OpenMP compiler flags (they are needed both to compile and to link) if OpenMP is enabled
+ifeq ($(strip $(BUILD_OPENMP)),true)
+  ifeq ($(OMPFLAGS),)
+    OMPFLAGS := -fopenmp
+  endif
+  CFLAGS += $(OMPFLAGS)
+  LDLIBS += $(OMPFLAGS)
+endif
+
 # Detect python in the following order if PYTHON hasn't been set
 ifeq ($(PYTHON),)
   ifeq ($(shell test -x "$(shell which python3 2>$(DEVNULL))"; echo $$?), 0)
@@ -109,8 +118,24 @@ endif
 ifeq ($(strip $(AVX)),false)
   CFLAGS += -DreproBLAS_no__AVX__
 endif
+ifeq ($(strip $(AVX512)),false)
+  CFLAGS += -DreproBLAS_no__AVX512F__
+endif
 
-ifeq ($(MTARGET_ARCH),)
+# When dispatching at runtime, the library must run on any x86 machine, so we
+# only build for the native architecture if asked. Each vectorized kernel is
+# compiled once for every instruction set with the flags below.
+ifeq ($(strip $(BUILD_DISPATCH)),true)
+  CFLAGS += -DreproBLAS_DISPATCH
+  ifneq ($(MTARGET_ARCH),)
+    CFLAGS += -march=$(strip $(MTARGET_ARCH))
+  endif
+  DISPATCH_FLAGS_SISD := -DreproBLAS_no__SSE2__ -DreproBLAS_no__AVX__ -DreproBLAS_no__AVX512F__
+  DISPATCH_FLAGS_SSE := -msse2 -DreproBLAS_no__AVX__ -DreproBLAS_no__AVX512F__
+  DISPATCH_FLAGS_AVX := -mavx -DreproBLAS_no__AVX512F__
+  DISPATCH_FLAGS_AVX2 := -mavx2 -mfma -DreproBLAS_no__AVX512F__
+  DISPATCH_FLAGS_AVX512 := -mavx512f
+else ifeq ($(MTARGET_ARCH),)
   CFLAGS += -march=native
 else
   CFLAGS += -march=$(strip $(MTARGET_ARCH))
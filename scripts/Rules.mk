@@ -6,3 +6,10 @@ GETTER := $(OBJPATH)/getter$(EXE)
 COGGED = getter.ccog
 
 getter$(EXE)_DEPS = getter.o
+
+getter$(EXE)_LIBS = -lm
+
+# the scripts run the MPI checks only if the MPI libraries were built
+ifeq ($(BUILD_MPI),true)
+CFLAGS += -DreproBLAS_MPI
+endif
@@ -111,6 +111,34 @@ def get_vectorization(verbose="false"):
   return get_vectorization.vectorization
 get_vectorization.vectorization = None
 
+def get_dispatch(verbose="false"):
+  if get_dispatch.dispatch is None:
+    try:
+      getter_file = open(os.path.join(top, "scripts/getter.json"), "r")
+    except (IOError, FileNotFoundError):
+      print("Error: {} not found.".format(os.path.join(top, "scripts/getter.json")))
+      print('Hint: Did you forget to run "make update"?')
+      raise
+    getter = json.load(getter_file)
+    getter_file.close()
+    get_dispatch.dispatch = getter["dispatch"]
+  return get_dispatch.dispatch
+get_dispatch.dispatch = None
+
+def get_mpi(verbose="false"):
+  if get_mpi.mpi is None:
+    try:
+      getter_file = open(os.path.join(top, "scripts/getter.json"), "r")
+    except (IOError, FileNotFoundError):
+      print("Error: {} not found.".format(os.path.join(top, "scripts/getter.json")))
+      print('Hint: Did you forget to run "make update"?')
+      raise
+    getter = json.load(getter_file)
+    getter_file.close()
+    get_mpi.mpi = getter["mpi"]
+  return get_mpi.mpi
+get_mpi.mpi = None
+
 def get_dimaxindex(verbose="false"):
   if not get_dimaxindex.dimaxindex:
     try:
@@ -223,6 +251,34 @@ def get_siendurance(verbose="false"):
   return get_siendurance.siendurance
 get_siendurance.siendurance = None
 
+def get_dibins(verbose="false"):
+  if not get_dibins.dibins:
+    try:
+      getter_file = open(os.path.join(top, "scripts/getter.json"), "r")
+    except (IOError, FileNotFoundError):
+      print("Error: {} not found.".format(os.path.join(top, "scripts/getter.json")))
+      print('Hint: Did you forget to run "make update"?')
+      raise
+    getter = json.load(getter_file)
+    getter_file.close()
+    get_dibins.dibins = getter["dibins"]
+  return get_dibins.dibins
+get_dibins.dibins = None
+
+def get_sibins(verbose="false"):
+  if not get_sibins.sibins:
+    try:
+      getter_file = open(os.path.join(top, "scripts/getter.json"), "r")
+    except (IOError, FileNotFoundError):
+      print("Error: {} not found.".format(os.path.join(top, "scripts/getter.json")))
+      print('Hint: Did you forget to run "make update"?')
+      raise
+    getter = json.load(getter_file)
+    getter_file.close()
+    get_sibins.sibins = getter["sibins"]
+  return get_sibins.sibins
+get_sibins.sibins = None
+
 def my_get_cpu_info():
   try:
     return cpuinfo.get_cpu_info()
@@ -245,6 +301,23 @@ def get_fma(verbose="false"):
     assert "fma" in config.cpu_info(verbose=verbose), "ReproBLAS error: fma status not found. Clarify in cpu_info() in config.py"
     return config.cpu_info()["fma"]
 
+def get_vectorizations(verbose="false"):
+  info = my_get_cpu_info()
+  if info and "vectorizations" not in config.cpu_info(verbose="false"):
+    vectorizations = ["SISD"]
+    if "sse2" in info["flags"]:
+      vectorizations.append("SSE")
+    if "avx" in info["flags"]:
+      vectorizations.append("AVX")
+    if "avx2" in info["flags"] and "fma" in info["flags"]:
+      vectorizations.append("AVX2")
+    if "avx512f" in info["flags"]:
+      vectorizations.append("AVX512")
+    return vectorizations
+  else:
+    assert "vectorizations" in config.cpu_info(verbose=verbose), "ReproBLAS error: supported instruction sets not found. Clarify in cpu_info() in config.py"
+    return config.cpu_info()["vectorizations"]
+
 def get_cache(verbose="false"):
   info = my_get_cpu_info()
   if info and "cache" not in config.cpu_info(verbose="false"):
@@ -0,0 +1,47 @@
+TARGETS :=
+ifeq ($(BUILD_MPI),true)
+TARGETS += libmpi_reproblas.a
+endif
+SUBDIRS :=
+
+INSTALL_LIB := $(TARGETS)
+
+LIBMPIREPROBLAS := $(OBJPATH)/libmpi_reproblas.a
+
+libmpi_reproblas.a_DEPS = $$(LIBBINNEDMPI) $$(LIBBINNEDBLAS)                        \
+                          prdsum.o prdasum.o prdnrm2.o prddot.o                 \
+                          przsum_sub.o prdzasum.o prdznrm2.o przdotc_sub.o      \
+                            przdotu_sub.o                                       \
+                          prssum.o prsasum.o prsnrm2.o prsdot.o                 \
+                          prcsum_sub.o prscasum.o prscnrm2.o prcdotc_sub.o      \
+                            prcdotu_sub.o                                       \
+                          prrdsum.o prrdasum.o prrdnrm2.o prrddot.o             \
+                          prrzsum_sub.o prrdzasum.o prrdznrm2.o prrzdotc_sub.o  \
+                            prrzdotu_sub.o                                      \
+                          prrssum.o prrsasum.o prrsnrm2.o prrsdot.o             \
+                          prrcsum_sub.o prrscasum.o prrscnrm2.o prrcdotc_sub.o  \
+                            prrcdotu_sub.o                                      \
+                          prdsum_start.o prdasum_start.o prdnrm2_start.o        \
+                            prddot_start.o                                      \
+                          przsum_sub_start.o prdzasum_start.o                   \
+                            prdznrm2_start.o przdotc_sub_start.o                \
+                            przdotu_sub_start.o                                 \
+                          prssum_start.o prsasum_start.o prsnrm2_start.o        \
+                            prsdot_start.o                                      \
+                          prcsum_sub_start.o prscasum_start.o                   \
+                            prscnrm2_start.o prcdotc_sub_start.o                \
+                            prcdotu_sub_start.o                                 \
+                          prrdsum_start.o prrdasum_start.o prrdnrm2_start.o     \
+                            prrddot_start.o                                     \
+                          prrzsum_sub_start.o prrdzasum_start.o                 \
+                            prrdznrm2_start.o prrzdotc_sub_start.o              \
+                            prrzdotu_sub_start.o                                \
+                          prrssum_start.o prrsasum_start.o prrsnrm2_start.o     \
+                            prrsdot_start.o                                     \
+                          prrcsum_sub_start.o prrscasum_start.o                 \
+                            prrscnrm2_start.o prrcdotc_sub_start.o              \
+                            prrcdotu_sub_start.o                                \
+                          prtest.o prdwait.o prswait.o przwait_sub.o            \
+                            prcwait_sub.o                                       \
+                          prbdgemv.o prrdgemv.o prdgemv.o                       \
+                          prbdgemm.o prrdgemm.o prdgemm.o
@@ -0,0 +1,173 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <MPI_reproBLAS.h>
+
+#include "../common/common.h"
+#include "../../config.h"
+
+/**
+ * @brief Add to binned double precision matrix C the block of the distributed matrix-matrix product of double precision matrices A and B owned by this process
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + C,
+ *
+ * where op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T,
+ *
+ * alpha is a scalar, and op(A), op(B), and C are distributed in blocks over the two-dimensional Cartesian process grid @p comm. The process at grid coordinates (i, j) holds the block C_ij, the block op(A)_ik of op(A) with the rows of C_ij, and the block op(B)_kj of op(B) with the columns of C_ij. The columns of op(A) are divided in rank order among the processes of each grid row, and the rows of op(B) are divided in rank order among the processes of each grid column, possibly in different ways.
+ *
+ * The product is computed with the SUMMA algorithm. At each step, panels of at most #SUMMAPANEL columns of op(A) and rows of op(B) are broadcast along the grid rows and columns, and each process adds the product of its panels to C_ij with #binnedBLAS_dbdgemm(). Because binned summation does not depend on the order of its operands, the result does not depend on the shape of the process grid or the way the matrices are distributed.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator with a two-dimensional Cartesian topology (see @c MPI_Cart_create())
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of the local blocks of C and op(A)
+ * @param N number of columns of the local blocks of C and op(B)
+ * @param KA number of columns of the local block of op(A)
+ * @param KB number of rows of the local block of op(B)
+ * @param alpha scalar alpha
+ * @param A the local block of A, a double precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, KA) if A is not transposed and (KA, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B the local block of B, a double precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (KB, N) if B is not transposed and (N, KB) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C the local block of C, a binned double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prbdgemm(const int fold, MPI_Comm comm, const char Order,
+              const char TransA, const char TransB,
+              const int M, const int N, const int KA, const int KB,
+              const double alpha, const double *A, const int lda,
+              const double *B, const int ldb,
+              double_binned *C, const int ldc){
+  MPI_Comm row_comm;
+  MPI_Comm col_comm;
+  int dims[2];
+  int periods[2];
+  int coords[2];
+  int remain[2];
+  int *KAs;
+  int *KBs;
+  double *panelA;
+  double *panelB;
+  int rowA;
+  int colA;
+  int rowB;
+  int colB;
+  int rowPA;
+  int colPA;
+  int rowPB;
+  int colPB;
+  int rootA;
+  int rootB;
+  int startA;
+  int startB;
+  int k;
+  int K;
+  int width;
+  int i;
+  int j;
+
+  MPI_Cart_get(comm, 2, dims, periods, coords);
+  remain[0] = 0;
+  remain[1] = 1;
+  MPI_Cart_sub(comm, remain, &row_comm);
+  remain[0] = 1;
+  remain[1] = 0;
+  MPI_Cart_sub(comm, remain, &col_comm);
+
+  KAs = (int*)malloc(dims[1] * sizeof(int));
+  KBs = (int*)malloc(dims[0] * sizeof(int));
+  MPI_Allgather(&KA, 1, MPI_INT, KAs, 1, MPI_INT, row_comm);
+  MPI_Allgather(&KB, 1, MPI_INT, KBs, 1, MPI_INT, col_comm);
+  K = 0;
+  for(i = 0; i < dims[1]; i++){
+    K += KAs[i];
+  }
+
+  switch(Order){
+    case 'r':
+    case 'R':
+      rowA = (TransA == 'n' || TransA == 'N') ? lda : 1;
+      colA = (TransA == 'n' || TransA == 'N') ? 1 : lda;
+      rowB = (TransB == 'n' || TransB == 'N') ? ldb : 1;
+      colB = (TransB == 'n' || TransB == 'N') ? 1 : ldb;
+      break;
+    default:
+      rowA = (TransA == 'n' || TransA == 'N') ? 1 : lda;
+      colA = (TransA == 'n' || TransA == 'N') ? lda : 1;
+      rowB = (TransB == 'n' || TransB == 'N') ? 1 : ldb;
+      colB = (TransB == 'n' || TransB == 'N') ? ldb : 1;
+      break;
+  }
+
+  panelA = (double*)malloc(M * MIN(K, SUMMAPANEL) * sizeof(double));
+  panelB = (double*)malloc(MIN(K, SUMMAPANEL) * N * sizeof(double));
+
+  rootA = 0;
+  rootB = 0;
+  startA = 0;
+  startB = 0;
+  for(k = 0; k < K; k += width){
+    while(k >= startA + KAs[rootA]){
+      startA += KAs[rootA];
+      rootA++;
+    }
+    while(k >= startB + KBs[rootB]){
+      startB += KBs[rootB];
+      rootB++;
+    }
+    width = MIN(MIN(startA + KAs[rootA], startB + KBs[rootB]), k + SUMMAPANEL) - k;
+
+    //the panels are stored untransposed in the order of C
+    switch(Order){
+      case 'r':
+      case 'R':
+        rowPA = width;
+        colPA = 1;
+        rowPB = N;
+        colPB = 1;
+        break;
+      default:
+        rowPA = 1;
+        colPA = M;
+        rowPB = 1;
+        colPB = width;
+        break;
+    }
+    if(coords[1] == rootA){
+      for(i = 0; i < M; i++){
+        for(j = 0; j < width; j++){
+          panelA[i * rowPA + j * colPA] = A[i * rowA + (k - startA + j) * colA];
+        }
+      }
+    }
+    if(coords[0] == rootB){
+      for(i = 0; i < width; i++){
+        for(j = 0; j < N; j++){
+          panelB[i * rowPB + j * colPB] = B[(k - startB + i) * rowB + j * colB];
+        }
+      }
+    }
+    MPI_Bcast(panelA, M * width, MPI_DOUBLE, rootA, row_comm);
+    MPI_Bcast(panelB, width * N, MPI_DOUBLE, rootB, col_comm);
+
+    binnedBLAS_dbdgemm(fold, Order, 'n', 'n', M, N, width, alpha, panelA, MAX(rowPA, colPA), panelB, MAX(rowPB, colPB), C, ldc);
+  }
+
+  free(panelA);
+  free(panelB);
+  free(KAs);
+  free(KBs);
+  MPI_Comm_free(&row_comm);
+  MPI_Comm_free(&col_comm);
+}
@@ -0,0 +1,72 @@
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Add to binned double precision vector Y the slice of the distributed matrix-vector product of double precision matrix A and double precision vector X owned by this process
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y,
+ *
+ * where A = [A_0, A_1, ...] is distributed among the processes of @p comm so that each process holds a block A_p of the dimension of A that is summed over (the columns if not transposed, the rows otherwise) and the matching block x_p of x. The result vector alpha*A*x (or alpha*A**T*x) is distributed in contiguous slices of recvcounts[p] elements, in rank order, and each process adds its own slice to its portion Y of y.
+ *
+ * Each process computes its partial product alpha*A_p*x_p (or alpha*A_p**T*x_p) over the whole result vector with #binnedBLAS_dbdgemv(), and the partial products are summed and scattered with a single @c MPI_Reduce_scatter() using #binnedMPI_DBDBADD(), so the result does not depend on the number of processes or the way A is distributed.
+ *
+ * If the other dimension of A is distributed instead, no communication is necessary and each process may call #binnedBLAS_dbdgemv() on its own block.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of the local block of A
+ * @param N number of columns of the local block of A
+ * @param alpha scalar alpha
+ * @param A the local block of A, a double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X the local block of x, a double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y the local slice of y, a binned double precision vector of at least size recvcounts[rank]
+ * @param incY Y vector stride (use every incY'th element)
+ * @param recvcounts the number of elements of the result owned by each process (summing to M if not transposed or N otherwise)
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prbdgemv(const int fold, MPI_Comm comm, const char Order, const char TransA,
+              const int M, const int N,
+              const double alpha, const double *A, const int lda,
+              const double *X, const int incX,
+              double_binned *Y, const int incY, const int *recvcounts){
+  double_binned *YP;
+  double_binned *YR;
+  int rank;
+  int length;
+
+  MPI_Comm_rank(comm, &rank);
+  switch(TransA){
+    case 'n':
+    case 'N':
+      length = M;
+      break;
+    default:
+      length = N;
+      break;
+  }
+
+  YP = (double_binned*)malloc(length * binned_dbsize(fold));
+  YR = (double_binned*)malloc(recvcounts[rank] * binned_dbsize(fold));
+  memset(YP, 0, length * binned_dbsize(fold));
+  binnedBLAS_dbdgemv(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YP, 1);
+
+  MPI_Reduce_scatter(YP, YR, recvcounts, binnedMPI_DOUBLE_BINNED(fold), binnedMPI_DBDBADD(fold), comm);
+
+  binned_dbdbaddv(fold, recvcounts[rank], YR, 1, Y, incY);
+  free(YP);
+  free(YR);
+}
@@ -0,0 +1,28 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible unconjugated dot product of distributed complex single precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible unconjugated dot product is computed with binned types of default fold using #prrcdotu_sub()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotu scalar return
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prcdotu_sub(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu){
+  prrcdotu_sub(SIDEFAULTFOLD, comm, root, N, X, incX, Y, incY, dotu);
+}
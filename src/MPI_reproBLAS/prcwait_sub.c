@@ -0,0 +1,24 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Complete a reproducible reduction with a complex single precision result
+ *
+ * Waits for a reduction started by one of #prcsum_sub_start(), #prcdotc_sub_start(), #prcdotu_sub_start() (or their "prr" counterparts) to complete and returns its result. The result is the same as that of the corresponding blocking function.
+ *
+ * @param request the pending reduction
+ * @param result scalar return (0 on processes that do not receive the result)
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prcwait_sub(pr_request *request, void *result){
+  MPI_Wait(&request->request, MPI_STATUS_IGNORE);
+
+  binned_ccbconv_sub(request->fold, (float_complex_binned*)request->result, result);
+  free(request->local);
+  free(request->result);
+}
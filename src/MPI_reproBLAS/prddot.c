@@ -0,0 +1,28 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible dot product of distributed double precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with binned types of default fold using #prrddot()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+double prddot(MPI_Comm comm, const int root, const int N, const double* X, const int incX, const double* Y, const int incY){
+  return prrddot(DIDEFAULTFOLD, comm, root, N, X, incX, Y, incY);
+}
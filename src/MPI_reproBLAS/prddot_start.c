@@ -0,0 +1,28 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Start computing the reproducible dot product of distributed double precision vectors X and Y
+ *
+ * The result is the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with binned types of default fold using #prrddot_start()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param request the pending reduction (complete with #prdwait())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prddot_start(MPI_Comm comm, const int root, const int N, const double* X, const int incX, const double* Y, const int incY, pr_request *request){
+  prrddot_start(DIDEFAULTFOLD, comm, root, N, X, incX, Y, incY, request);
+}
@@ -0,0 +1,49 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Add to double precision matrix C the block of the reproducible distributed matrix-matrix product of double precision matrices A and B owned by this process
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + beta*C,
+ *
+ * where op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T,
+ *
+ * alpha and beta are scalars, and op(A), op(B), and C are distributed in blocks over the two-dimensional Cartesian process grid @p comm as described in #prbdgemm().
+ *
+ * The matrix-matrix product is computed with binned types of default fold using #prrdgemm()
+ *
+ * @param comm MPI communicator with a two-dimensional Cartesian topology (see @c MPI_Cart_create())
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of the local blocks of C and op(A)
+ * @param N number of columns of the local blocks of C and op(B)
+ * @param KA number of columns of the local block of op(A)
+ * @param KB number of rows of the local block of op(B)
+ * @param alpha scalar alpha
+ * @param A the local block of A, a double precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, KA) if A is not transposed and (KA, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B the local block of B, a double precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (KB, N) if B is not transposed and (N, KB) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param beta scalar beta
+ * @param C the local block of C, a double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prdgemm(MPI_Comm comm, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int KA, const int KB,
+             const double alpha, const double *A, const int lda,
+             const double *B, const int ldb,
+             const double beta, double *C, const int ldc){
+  prrdgemm(DIDEFAULTFOLD, comm, Order, TransA, TransB, M, N, KA, KB, alpha, A, lda, B, ldb, beta, C, ldc);
+}
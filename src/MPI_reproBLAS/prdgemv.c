@@ -0,0 +1,42 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Add to double precision vector Y the slice of the reproducible distributed matrix-vector product of double precision matrix A and double precision vector X owned by this process
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where A is distributed among the processes of @p comm as described in #prrdgemv().
+ *
+ * The matrix-vector product is computed with binned types of default fold using #prrdgemv()
+ *
+ * @param comm MPI communicator
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of the local block of A
+ * @param N number of columns of the local block of A
+ * @param alpha scalar alpha
+ * @param A the local block of A, a double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X the local block of x, a double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y the local slice of y, a double precision vector of at least size recvcounts[rank]
+ * @param incY Y vector stride (use every incY'th element)
+ * @param recvcounts the number of elements of y owned by each process (summing to M if not transposed or N otherwise)
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prdgemv(MPI_Comm comm, const char Order, const char TransA,
+             const int M, const int N,
+             const double alpha, const double *A, const int lda,
+             const double *X, const int incX,
+             const double beta, double *Y, const int incY, const int *recvcounts){
+  prrdgemv(DIDEFAULTFOLD, comm, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY, recvcounts);
+}
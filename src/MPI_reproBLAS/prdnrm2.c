@@ -0,0 +1,26 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible Euclidian norm of distributed double precision vector X
+ *
+ * Return the square root of the sum of the squared elements of X.
+ *
+ * The reproducible Euclidian norm is computed with binned types of default fold using #prrdnrm2()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return Euclidian norm of X
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+double prdnrm2(MPI_Comm comm, const int root, const int N, const double* X, const int incX){
+  return prrdnrm2(DIDEFAULTFOLD, comm, root, N, X, incX);
+}
@@ -0,0 +1,26 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible absolute sum of distributed complex double precision vector X
+ *
+ * Return the sum of the absolute values of the real and imaginary parts of elements of X.
+ *
+ * The reproducible absolute sum is computed with binned types of default fold using #prrdzasum()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of absolute values of real and imaginary parts of X
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+double prdzasum(MPI_Comm comm, const int root, const int N, const void* X, const int incX){
+  return prrdzasum(DIDEFAULTFOLD, comm, root, N, X, incX);
+}
@@ -0,0 +1,26 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Start computing the reproducible Euclidian norm of distributed complex double precision vector X
+ *
+ * The result is the square root of the sum of the squared elements of X.
+ *
+ * The reproducible Euclidian norm is computed with binned types of default fold using #prrdznrm2_start()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param request the pending reduction (complete with #prdwait())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prdznrm2_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request){
+  prrdznrm2_start(DIDEFAULTFOLD, comm, root, N, X, incX, request);
+}
@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Start computing the reproducible conjugated dot product of distributed complex single precision vectors X and Y
+ *
+ * The result is the sum of the pairwise products of X and conjugated Y.
+ *
+ * Each process holds a portion of X and Y. The local dot products are computed with binned types using #binnedBLAS_cbcdotc() and combined with #binnedMPI_CBCBADD() in a single nonblocking collective operation, so the result does not depend on the number of processes or the way X and Y are distributed.
+ *
+ * This function returns once the local binned partial result has been computed and the reduction of the partial results has been started with @c MPI_Iallreduce() (if @p root is #PR_ALL) or @c MPI_Ireduce(). The caller may compute while the reduction proceeds and must complete it with #prcwait_sub(), which returns the same result as #prrcdotc_sub(). X and Y may be modified once this function returns.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param request the pending reduction (complete with #prcwait_sub())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prrcdotc_sub_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, pr_request *request){
+  float_complex_binned *dotci = binned_cballoc(fold);
+  float_complex_binned *dotcr = binned_cballoc(fold);
+
+  binned_cbsetzero(fold, dotci);
+  binned_cbsetzero(fold, dotcr);
+  binnedBLAS_cbcdotc(fold, N, X, incX, Y, incY, dotci);
+
+  request->fold = fold;
+  request->scaled = 0;
+  request->local = dotci;
+  request->result = dotcr;
+  if(root == PR_ALL){
+    MPI_Iallreduce(dotci, dotcr, 1, binnedMPI_FLOAT_COMPLEX_BINNED(fold), binnedMPI_CBCBADD(fold), comm, &request->request);
+  }else{
+    MPI_Ireduce(dotci, dotcr, 1, binnedMPI_FLOAT_COMPLEX_BINNED(fold), binnedMPI_CBCBADD(fold), root, comm, &request->request);
+  }
+}
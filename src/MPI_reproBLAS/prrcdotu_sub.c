@@ -0,0 +1,49 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Compute the reproducible unconjugated dot product of distributed complex single precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * Each process holds a portion of X and Y. The local dot products are computed with binned types using #binnedBLAS_cbcdotu() and combined with #binnedMPI_CBCBADD() in a single collective operation, so the result does not depend on the number of processes or the way X and Y are distributed.
+ *
+ * If @p root is #PR_ALL, the result is returned on every process (as with @c MPI_Allreduce()). Otherwise, the result is returned on @p root and other processes return 0.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotu scalar return
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prrcdotu_sub(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu){
+  float_complex_binned *dotui = binned_cballoc(fold);
+  float_complex_binned *dotur = binned_cballoc(fold);
+
+  binned_cbsetzero(fold, dotui);
+  binned_cbsetzero(fold, dotur);
+  binnedBLAS_cbcdotu(fold, N, X, incX, Y, incY, dotui);
+
+  if(root == PR_ALL){
+    MPI_Allreduce(dotui, dotur, 1, binnedMPI_FLOAT_COMPLEX_BINNED(fold), binnedMPI_CBCBADD(fold), comm);
+  }else{
+    MPI_Reduce(dotui, dotur, 1, binnedMPI_FLOAT_COMPLEX_BINNED(fold), binnedMPI_CBCBADD(fold), root, comm);
+  }
+
+  binned_ccbconv_sub(fold, dotur, dotu);
+  free(dotui);
+  free(dotur);
+  return;
+}
@@ -0,0 +1,46 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Start computing the reproducible absolute sum of distributed double precision vector X
+ *
+ * The result is the sum of the absolute values of elements of X.
+ *
+ * Each process holds a portion of X. The local absolute sums are computed with binned types using #binnedBLAS_dbdasum() and combined with #binnedMPI_DBDBADD() in a single nonblocking collective operation, so the result does not depend on the number of processes or the way X is distributed.
+ *
+ * This function returns once the local binned partial result has been computed and the reduction of the partial results has been started with @c MPI_Iallreduce() (if @p root is #PR_ALL) or @c MPI_Ireduce(). The caller may compute while the reduction proceeds and must complete it with #prdwait(), which returns the same result as #prrdasum(). X may be modified once this function returns.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param request the pending reduction (complete with #prdwait())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prrdasum_start(const int fold, MPI_Comm comm, const int root, const int N, const double* X, const int incX, pr_request *request){
+  double_binned *asumi = binned_dballoc(fold);
+  double_binned *asumr = binned_dballoc(fold);
+
+  binned_dbsetzero(fold, asumi);
+  binned_dbsetzero(fold, asumr);
+  binnedBLAS_dbdasum(fold, N, X, incX, asumi);
+
+  request->fold = fold;
+  request->scaled = 0;
+  request->local = asumi;
+  request->result = asumr;
+  if(root == PR_ALL){
+    MPI_Iallreduce(asumi, asumr, 1, binnedMPI_DOUBLE_BINNED(fold), binnedMPI_DBDBADD(fold), comm, &request->request);
+  }else{
+    MPI_Ireduce(asumi, asumr, 1, binnedMPI_DOUBLE_BINNED(fold), binnedMPI_DBDBADD(fold), root, comm, &request->request);
+  }
+}
@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Start computing the reproducible dot product of distributed double precision vectors X and Y
+ *
+ * The result is the sum of the pairwise products of X and Y.
+ *
+ * Each process holds a portion of X and Y. The local dot products are computed with binned types using #binnedBLAS_dbddot() and combined with #binnedMPI_DBDBADD() in a single nonblocking collective operation, so the result does not depend on the number of processes or the way X and Y are distributed.
+ *
+ * This function returns once the local binned partial result has been computed and the reduction of the partial results has been started with @c MPI_Iallreduce() (if @p root is #PR_ALL) or @c MPI_Ireduce(). The caller may compute while the reduction proceeds and must complete it with #prdwait(), which returns the same result as #prrddot(). X and Y may be modified once this function returns.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param request the pending reduction (complete with #prdwait())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prrddot_start(const int fold, MPI_Comm comm, const int root, const int N, const double* X, const int incX, const double* Y, const int incY, pr_request *request){
+  double_binned *doti = binned_dballoc(fold);
+  double_binned *dotr = binned_dballoc(fold);
+
+  binned_dbsetzero(fold, doti);
+  binned_dbsetzero(fold, dotr);
+  binnedBLAS_dbddot(fold, N, X, incX, Y, incY, doti);
+
+  request->fold = fold;
+  request->scaled = 0;
+  request->local = doti;
+  request->result = dotr;
+  if(root == PR_ALL){
+    MPI_Iallreduce(doti, dotr, 1, binnedMPI_DOUBLE_BINNED(fold), binnedMPI_DBDBADD(fold), comm, &request->request);
+  }else{
+    MPI_Ireduce(doti, dotr, 1, binnedMPI_DOUBLE_BINNED(fold), binnedMPI_DBDBADD(fold), root, comm, &request->request);
+  }
+}
@@ -0,0 +1,68 @@
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Add to double precision vector Y the slice of the reproducible distributed matrix-vector product of double precision matrix A and double precision vector X owned by this process
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where A = [A_0, A_1, ...] is distributed among the processes of @p comm so that each process holds a block A_p of the dimension of A that is summed over (the columns if not transposed, the rows otherwise) and the matching block x_p of x. The vector y is distributed in contiguous slices of recvcounts[p] elements, in rank order, and each process holds its own slice Y.
+ *
+ * The matrix-vector product is computed using binned types with #prbdgemv(), so the result does not depend on the number of processes or the way A is distributed.
+ *
+ * If the other dimension of A is distributed instead, no communication is necessary and each process may call #reproBLAS_rdgemv() on its own block.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of the local block of A
+ * @param N number of columns of the local block of A
+ * @param alpha scalar alpha
+ * @param A the local block of A, a double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X the local block of x, a double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y the local slice of y, a double precision vector of at least size recvcounts[rank]
+ * @param incY Y vector stride (use every incY'th element)
+ * @param recvcounts the number of elements of y owned by each process (summing to M if not transposed or N otherwise)
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prrdgemv(const int fold, MPI_Comm comm, const char Order, const char TransA,
+              const int M, const int N,
+              const double alpha, const double *A, const int lda,
+              const double *X, const int incX,
+              const double beta, double *Y, const int incY, const int *recvcounts){
+  double_binned *YI;
+  int rank;
+  int i;
+
+  MPI_Comm_rank(comm, &rank);
+
+  YI = (double_binned*)malloc(recvcounts[rank] * binned_dbsize(fold));
+  if(beta == 0.0){
+    memset(YI, 0, recvcounts[rank] * binned_dbsize(fold));
+  }else if(beta == 1.0){
+    for(i = 0; i < recvcounts[rank]; i++){
+      binned_dbdconv(fold, Y[i * incY], YI + i * binned_dbnum(fold));
+    }
+  }else{
+    for(i = 0; i < recvcounts[rank]; i++){
+      binned_dbdconv(fold, Y[i * incY] * beta, YI + i * binned_dbnum(fold));
+    }
+  }
+  prbdgemv(fold, comm, Order, TransA, M, N, alpha, A, lda, X, incX, YI, 1, recvcounts);
+  for(i = 0; i < recvcounts[rank]; i++){
+    Y[i * incY] = binned_ddbconv(fold, YI + i * binned_dbnum(fold));
+  }
+  free(YI);
+}
@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Compute the reproducible absolute sum of distributed complex double precision vector X
+ *
+ * Return the sum of the absolute values of the real and imaginary parts of elements of X.
+ *
+ * Each process holds a portion of X. The local absolute sums are computed with binned types using #binnedBLAS_dbzasum() and combined with #binnedMPI_DBDBADD() in a single collective operation, so the result does not depend on the number of processes or the way X is distributed.
+ *
+ * If @p root is #PR_ALL, the result is returned on every process (as with @c MPI_Allreduce()). Otherwise, the result is returned on @p root and other processes return 0.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of absolute values of real and imaginary parts of X
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+double prrdzasum(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX){
+  double_binned *asumi = binned_dballoc(fold);
+  double_binned *asumr = binned_dballoc(fold);
+  double asum;
+
+  binned_dbsetzero(fold, asumi);
+  binned_dbsetzero(fold, asumr);
+  binnedBLAS_dbzasum(fold, N, X, incX, asumi);
+
+  if(root == PR_ALL){
+    MPI_Allreduce(asumi, asumr, 1, binnedMPI_DOUBLE_BINNED(fold), binnedMPI_DBDBADD(fold), comm);
+  }else{
+    MPI_Reduce(asumi, asumr, 1, binnedMPI_DOUBLE_BINNED(fold), binnedMPI_DBDBADD(fold), root, comm);
+  }
+
+  asum = binned_ddbconv(fold, asumr);
+  free(asumi);
+  free(asumr);
+  return asum;
+}
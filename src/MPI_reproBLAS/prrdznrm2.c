@@ -0,0 +1,50 @@
+#include <stdlib.h>
+#include <math.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Compute the reproducible Euclidian norm of distributed complex double precision vector X
+ *
+ * Return the square root of the sum of the squared elements of X.
+ *
+ * Each process holds a portion of X. The local sums of squares are computed with scaled binned types using #binnedBLAS_dbzssq() and combined with #binnedMPI_DBDBADDSQ() in a single collective operation, so the result does not depend on the number of processes or the way X is distributed.
+ *
+ * If @p root is #PR_ALL, the result is returned on every process (as with @c MPI_Allreduce()). Otherwise, the result is returned on @p root and other processes return 0.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return Euclidian norm of X
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+double prrdznrm2(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX){
+  double *ssqi = (double*)malloc(binned_dbsize(fold) + sizeof(double));
+  double *ssqr = (double*)malloc(binned_dbsize(fold) + sizeof(double));
+  double nrm2;
+
+  binned_dbsetzero(fold, (double_binned*)(ssqi + 1));
+  binned_dbsetzero(fold, (double_binned*)(ssqr + 1));
+  ssqr[0] = 0.0;
+  ssqi[0] = binnedBLAS_dbzssq(fold, N, X, incX, 0.0, (double_binned*)(ssqi + 1));
+
+  if(root == PR_ALL){
+    MPI_Allreduce(ssqi, ssqr, 1, binnedMPI_DOUBLE_BINNED_SCALED(fold), binnedMPI_DBDBADDSQ(fold), comm);
+  }else{
+    MPI_Reduce(ssqi, ssqr, 1, binnedMPI_DOUBLE_BINNED_SCALED(fold), binnedMPI_DBDBADDSQ(fold), root, comm);
+  }
+
+  nrm2 = ssqr[0] * sqrt(binned_ddbconv(fold, (double_binned*)(ssqr + 1)));
+  free(ssqi);
+  free(ssqr);
+  return nrm2;
+}
@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Start computing the reproducible Euclidian norm of distributed complex double precision vector X
+ *
+ * The result is the square root of the sum of the squared elements of X.
+ *
+ * Each process holds a portion of X. The local sums of squares are computed with scaled binned types using #binnedBLAS_dbzssq() and combined with #binnedMPI_DBDBADDSQ() in a single nonblocking collective operation, so the result does not depend on the number of processes or the way X is distributed.
+ *
+ * This function returns once the local binned partial result has been computed and the reduction of the partial results has been started with @c MPI_Iallreduce() (if @p root is #PR_ALL) or @c MPI_Ireduce(). The caller may compute while the reduction proceeds and must complete it with #prdwait(), which returns the same result as #prrdznrm2(). X may be modified once this function returns.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param request the pending reduction (complete with #prdwait())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prrdznrm2_start(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request){
+  double *ssqi = (double*)malloc(binned_dbsize(fold) + sizeof(double));
+  double *ssqr = (double*)malloc(binned_dbsize(fold) + sizeof(double));
+
+  binned_dbsetzero(fold, (double_binned*)(ssqi + 1));
+  binned_dbsetzero(fold, (double_binned*)(ssqr + 1));
+  ssqr[0] = 0.0;
+  ssqi[0] = binnedBLAS_dbzssq(fold, N, X, incX, 0.0, (double_binned*)(ssqi + 1));
+
+  request->fold = fold;
+  request->scaled = 1;
+  request->local = ssqi;
+  request->result = ssqr;
+  if(root == PR_ALL){
+    MPI_Iallreduce(ssqi, ssqr, 1, binnedMPI_DOUBLE_BINNED_SCALED(fold), binnedMPI_DBDBADDSQ(fold), comm, &request->request);
+  }else{
+    MPI_Ireduce(ssqi, ssqr, 1, binnedMPI_DOUBLE_BINNED_SCALED(fold), binnedMPI_DBDBADDSQ(fold), root, comm, &request->request);
+  }
+}
@@ -0,0 +1,50 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Compute the reproducible dot product of distributed single precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * Each process holds a portion of X and Y. The local dot products are computed with binned types using #binnedBLAS_sbsdot() and combined with #binnedMPI_SBSBADD() in a single collective operation, so the result does not depend on the number of processes or the way X and Y are distributed.
+ *
+ * If @p root is #PR_ALL, the result is returned on every process (as with @c MPI_Allreduce()). Otherwise, the result is returned on @p root and other processes return 0.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+float prrsdot(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX, const float* Y, const int incY){
+  float_binned *doti = binned_sballoc(fold);
+  float_binned *dotr = binned_sballoc(fold);
+  float dot;
+
+  binned_sbsetzero(fold, doti);
+  binned_sbsetzero(fold, dotr);
+  binnedBLAS_sbsdot(fold, N, X, incX, Y, incY, doti);
+
+  if(root == PR_ALL){
+    MPI_Allreduce(doti, dotr, 1, binnedMPI_FLOAT_BINNED(fold), binnedMPI_SBSBADD(fold), comm);
+  }else{
+    MPI_Reduce(doti, dotr, 1, binnedMPI_FLOAT_BINNED(fold), binnedMPI_SBSBADD(fold), root, comm);
+  }
+
+  dot = binned_ssbconv(fold, dotr);
+  free(doti);
+  free(dotr);
+  return dot;
+}
@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Compute the reproducible sum of distributed single precision vector X
+ *
+ * Return the sum of X.
+ *
+ * Each process holds a portion of X. The local sums are computed with binned types using #binnedBLAS_sbssum() and combined with #binnedMPI_SBSBADD() in a single collective operation, so the result does not depend on the number of processes or the way X is distributed.
+ *
+ * If @p root is #PR_ALL, the result is returned on every process (as with @c MPI_Allreduce()). Otherwise, the result is returned on @p root and other processes return 0.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of X
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+float prrssum(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX){
+  float_binned *sumi = binned_sballoc(fold);
+  float_binned *sumr = binned_sballoc(fold);
+  float sum;
+
+  binned_sbsetzero(fold, sumi);
+  binned_sbsetzero(fold, sumr);
+  binnedBLAS_sbssum(fold, N, X, incX, sumi);
+
+  if(root == PR_ALL){
+    MPI_Allreduce(sumi, sumr, 1, binnedMPI_FLOAT_BINNED(fold), binnedMPI_SBSBADD(fold), comm);
+  }else{
+    MPI_Reduce(sumi, sumr, 1, binnedMPI_FLOAT_BINNED(fold), binnedMPI_SBSBADD(fold), root, comm);
+  }
+
+  sum = binned_ssbconv(fold, sumr);
+  free(sumi);
+  free(sumr);
+  return sum;
+}
@@ -0,0 +1,46 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Start computing the reproducible sum of distributed single precision vector X
+ *
+ * The result is the sum of X.
+ *
+ * Each process holds a portion of X. The local sums are computed with binned types using #binnedBLAS_sbssum() and combined with #binnedMPI_SBSBADD() in a single nonblocking collective operation, so the result does not depend on the number of processes or the way X is distributed.
+ *
+ * This function returns once the local binned partial result has been computed and the reduction of the partial results has been started with @c MPI_Iallreduce() (if @p root is #PR_ALL) or @c MPI_Ireduce(). The caller may compute while the reduction proceeds and must complete it with #prswait(), which returns the same result as #prrssum(). X may be modified once this function returns.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param request the pending reduction (complete with #prswait())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prrssum_start(const int fold, MPI_Comm comm, const int root, const int N, const float* X, const int incX, pr_request *request){
+  float_binned *sumi = binned_sballoc(fold);
+  float_binned *sumr = binned_sballoc(fold);
+
+  binned_sbsetzero(fold, sumi);
+  binned_sbsetzero(fold, sumr);
+  binnedBLAS_sbssum(fold, N, X, incX, sumi);
+
+  request->fold = fold;
+  request->scaled = 0;
+  request->local = sumi;
+  request->result = sumr;
+  if(root == PR_ALL){
+    MPI_Iallreduce(sumi, sumr, 1, binnedMPI_FLOAT_BINNED(fold), binnedMPI_SBSBADD(fold), comm, &request->request);
+  }else{
+    MPI_Ireduce(sumi, sumr, 1, binnedMPI_FLOAT_BINNED(fold), binnedMPI_SBSBADD(fold), root, comm, &request->request);
+  }
+}
@@ -0,0 +1,49 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Compute the reproducible conjugated dot product of distributed complex double precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and conjugated Y.
+ *
+ * Each process holds a portion of X and Y. The local dot products are computed with binned types using #binnedBLAS_zbzdotc() and combined with #binnedMPI_ZBZBADD() in a single collective operation, so the result does not depend on the number of processes or the way X and Y are distributed.
+ *
+ * If @p root is #PR_ALL, the result is returned on every process (as with @c MPI_Allreduce()). Otherwise, the result is returned on @p root and other processes return 0.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotc scalar return
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prrzdotc_sub(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc){
+  double_complex_binned *dotci = binned_zballoc(fold);
+  double_complex_binned *dotcr = binned_zballoc(fold);
+
+  binned_zbsetzero(fold, dotci);
+  binned_zbsetzero(fold, dotcr);
+  binnedBLAS_zbzdotc(fold, N, X, incX, Y, incY, dotci);
+
+  if(root == PR_ALL){
+    MPI_Allreduce(dotci, dotcr, 1, binnedMPI_DOUBLE_COMPLEX_BINNED(fold), binnedMPI_ZBZBADD(fold), comm);
+  }else{
+    MPI_Reduce(dotci, dotcr, 1, binnedMPI_DOUBLE_COMPLEX_BINNED(fold), binnedMPI_ZBZBADD(fold), root, comm);
+  }
+
+  binned_zzbconv_sub(fold, dotcr, dotc);
+  free(dotci);
+  free(dotcr);
+  return;
+}
@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Compute the reproducible sum of distributed complex double precision vector X
+ *
+ * Return the sum of X.
+ *
+ * Each process holds a portion of X. The local sums are computed with binned types using #binnedBLAS_zbzsum() and combined with #binnedMPI_ZBZBADD() in a single collective operation, so the result does not depend on the number of processes or the way X is distributed.
+ *
+ * If @p root is #PR_ALL, the result is returned on every process (as with @c MPI_Allreduce()). Otherwise, the result is returned on @p root and other processes return 0.
+ *
+ * @param fold the fold of the binned types
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param sum scalar return
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prrzsum_sub(const int fold, MPI_Comm comm, const int root, const int N, const void* X, const int incX, void *sum){
+  double_complex_binned *sumi = binned_zballoc(fold);
+  double_complex_binned *sumr = binned_zballoc(fold);
+
+  binned_zbsetzero(fold, sumi);
+  binned_zbsetzero(fold, sumr);
+  binnedBLAS_zbzsum(fold, N, X, incX, sumi);
+
+  if(root == PR_ALL){
+    MPI_Allreduce(sumi, sumr, 1, binnedMPI_DOUBLE_COMPLEX_BINNED(fold), binnedMPI_ZBZBADD(fold), comm);
+  }else{
+    MPI_Reduce(sumi, sumr, 1, binnedMPI_DOUBLE_COMPLEX_BINNED(fold), binnedMPI_ZBZBADD(fold), root, comm);
+  }
+
+  binned_zzbconv_sub(fold, sumr, sum);
+  free(sumi);
+  free(sumr);
+  return;
+}
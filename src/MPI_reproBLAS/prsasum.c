@@ -0,0 +1,26 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible absolute sum of distributed single precision vector X
+ *
+ * Return the sum of the absolute values of elements of X.
+ *
+ * The reproducible absolute sum is computed with binned types of default fold using #prrsasum()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of absolute values of X
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+float prsasum(MPI_Comm comm, const int root, const int N, const float* X, const int incX){
+  return prrsasum(SIDEFAULTFOLD, comm, root, N, X, incX);
+}
@@ -0,0 +1,26 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Start computing the reproducible absolute sum of distributed complex single precision vector X
+ *
+ * The result is the sum of the absolute values of the real and imaginary parts of elements of X.
+ *
+ * The reproducible absolute sum is computed with binned types of default fold using #prrscasum_start()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param request the pending reduction (complete with #prswait())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prscasum_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, pr_request *request){
+  prrscasum_start(SIDEFAULTFOLD, comm, root, N, X, incX, request);
+}
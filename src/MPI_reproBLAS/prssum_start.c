@@ -0,0 +1,26 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Start computing the reproducible sum of distributed single precision vector X
+ *
+ * The result is the sum of X.
+ *
+ * The reproducible sum is computed with binned types of default fold using #prrssum_start()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param request the pending reduction (complete with #prswait())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void prssum_start(MPI_Comm comm, const int root, const int N, const float* X, const int incX, pr_request *request){
+  prrssum_start(SIDEFAULTFOLD, comm, root, N, X, incX, request);
+}
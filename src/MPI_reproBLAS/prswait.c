@@ -0,0 +1,33 @@
+#include <stdlib.h>
+#include <math.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Complete a reproducible reduction with a single precision result
+ *
+ * Waits for a reduction started by one of #prssum_start(), #prsasum_start(), #prsnrm2_start(), #prsdot_start(), #prscasum_start(), #prscnrm2_start() (or their "prr" counterparts) to complete and returns its result. The result is the same as that of the corresponding blocking function.
+ *
+ * @param request the pending reduction
+ * @return the result of the reduction on the processes that receive it, 0 otherwise
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+float prswait(pr_request *request){
+  float *res = (float*)request->result;
+  float result;
+
+  MPI_Wait(&request->request, MPI_STATUS_IGNORE);
+
+  if(request->scaled){
+    result = res[0] * sqrtf(binned_ssbconv(request->fold, (float_binned*)(res + 1)));
+  }else{
+    result = binned_ssbconv(request->fold, (float_binned*)res);
+  }
+  free(request->local);
+  free(request->result);
+  return result;
+}
@@ -0,0 +1,21 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+/**
+ * @brief Test whether a reproducible reduction has completed
+ *
+ * Calls @c MPI_Test() on the pending reduction, which also lets the MPI library make progress on it. Callers overlapping a reduction with long computations may call this periodically. Whether or not it has completed, the reduction must still be completed with the wait function matching its start function (e.g. #prdwait()).
+ *
+ * @param request the pending reduction
+ * @return 1 if the reduction has completed, 0 otherwise
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+int prtest(pr_request *request){
+  int flag;
+
+  MPI_Test(&request->request, &flag, MPI_STATUS_IGNORE);
+  return flag;
+}
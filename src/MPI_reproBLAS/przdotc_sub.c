@@ -0,0 +1,28 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible conjugated dot product of distributed complex double precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and conjugated Y.
+ *
+ * The reproducible conjugated dot product is computed with binned types of default fold using #prrzdotc_sub()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotc scalar return
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void przdotc_sub(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc){
+  prrzdotc_sub(DIDEFAULTFOLD, comm, root, N, X, incX, Y, incY, dotc);
+}
@@ -0,0 +1,28 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Start computing the reproducible unconjugated dot product of distributed complex double precision vectors X and Y
+ *
+ * The result is the sum of the pairwise products of X and Y.
+ *
+ * The reproducible unconjugated dot product is computed with binned types of default fold using #prrzdotu_sub_start()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param request the pending reduction (complete with #przwait_sub())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void przdotu_sub_start(MPI_Comm comm, const int root, const int N, const void* X, const int incX, const void* Y, const int incY, pr_request *request){
+  prrzdotu_sub_start(DIDEFAULTFOLD, comm, root, N, X, incX, Y, incY, request);
+}
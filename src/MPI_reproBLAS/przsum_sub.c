@@ -0,0 +1,26 @@
+#include <mpi.h>
+
+#include <MPI_reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible sum of distributed complex double precision vector X
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with binned types of default fold using #prrzsum_sub()
+ *
+ * @param comm MPI communicator
+ * @param root rank of the process to return the result on (or #PR_ALL)
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param sum scalar return
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void przsum_sub(MPI_Comm comm, const int root, const int N, const void* X, const int incX, void *sum){
+  prrzsum_sub(DIDEFAULTFOLD, comm, root, N, X, incX, sum);
+}
@@ -1,4 +1,4 @@
 TARGETS :=
-SUBDIRS := binned binnedBLAS reproBLAS binnedMPI
+SUBDIRS := binned binnedBLAS reproBLAS binnedMPI MPI_reproBLAS
 
 INCLUDES += $(d)/gen
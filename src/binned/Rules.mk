@@ -5,6 +5,9 @@ INSTALL_LIB := $(TARGETS)
 
 LIBBINNED := $(OBJPATH)/libbinned.a
 
+COGGED = dmbins.ccog \
+         smbins.ccog
+
 libbinned.a_DEPS = ccbconv_sub.o \
                  ccmconv_sub.o \
                  cballoc.o \
@@ -49,12 +52,23 @@ libbinned.a_DEPS = ccbconv_sub.o \
                  dbdbaddv.o \
                  dbdbset.o \
                  dbdupdate.o \
+                 dbindexv.o \
                  dindex.o \
+                 dindexv.o \
                  dbnegate.o \
                  dbnum.o \
                  dbprint.o \
                  dbrenorm.o \
+                 dbrenormv.o \
                  dbsetzero.o \
+                 dbshared_alloc.o \
+                 dbshared_conv.o \
+                 dbshared_dadd.o \
+                 dbshared_dbadd.o \
+                 dbshared_free.o \
+                 dbshared_join.o \
+                 dbshared_publish.o \
+                 dbshared_snapshot.o \
                  dbsize.o \
                  dmbins.o \
                  dmdadd.o \
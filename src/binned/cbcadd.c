@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief  Add complex single precision to binned complex single precision (Y += X)
@@ -14,5 +15,5 @@
  * @date   27 Apr 2015
  */
 void binned_cbcadd(const int fold, const void *X, float_complex_binned *Y){
-  binned_cmcadd(fold, X, Y, 1, Y + 2 * fold, 1);
+  binnedInline_cbcadd(fold, X, Y);
 }
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief  Add complex single precision to suitably binned binned complex single precision (Y += X)
@@ -16,5 +17,5 @@
  * @date   10 Jun 2015
  */
 void binned_cbcdeposit(const int fold, const void *X, float_complex_binned *Y){
-  binned_cmcdeposit(fold, X, Y, 1);
+  binnedInline_cbcdeposit(fold, X, Y);
 }
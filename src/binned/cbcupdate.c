@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Update binned complex single precision with complex single precision (X -> Y)
@@ -14,5 +15,5 @@
  * @date   27 Apr 2015
  */
 void binned_cbcupdate(const int fold, const void *X, float_complex_binned *Y) {
-  binned_cmcupdate(fold, X, Y, 1, Y + 2 * fold, 1);
+  binnedInline_cbcupdate(fold, X, Y);
 }
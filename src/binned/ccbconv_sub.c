@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Convert binned complex single precision to complex single precision (X -> Y)
@@ -12,5 +13,5 @@
  * @date   27 Apr 2015
  */
 void binned_ccbconv_sub(const int fold, const float_complex_binned *X, void *conv) {
-  binned_ccmconv_sub(fold, X, 1, X + 2 * fold, 1, conv);
+  binnedInline_ccbconv_sub(fold, X, conv);
 }
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -18,7 +19,5 @@
  * @date   27 Apr 2015
  */
 void binned_cmcadd(const int fold, const void *X, float *priY, const int incpriY, float *carY, const int inccarY){
-  binned_cmcupdate(fold, X, priY, incpriY, carY, inccarY);
-  binned_cmcdeposit(fold, X, priY, incpriY);
-  binned_cmrenorm(fold, priY, incpriY, carY, inccarY);
+  binnedInline_cmcadd(fold, X, priY, incpriY, carY, inccarY);
 }
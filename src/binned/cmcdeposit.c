@@ -1,8 +1,5 @@
-#include <math.h>
-
 #include <binned.h>
-
-#include "../common/common.h"
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -22,49 +19,5 @@
  * @date   10 Jun 2015
  */
 void binned_cmcdeposit(const int fold, const void *X, float *priY, const int incpriY){
-  float MR, MI;
-  int_float qR, qI;
-  int i;
-  float xR = ((float*)X)[0];
-  float xI = ((float*)X)[1];
-
-  if (ISNANINFF(xR) || ISNANINFF(priY[0])){
-    priY[0] += xR;
-    binned_smsdeposit(fold, xI, priY + 1, 2 * incpriY);
-    return;
-  }
-  if (ISNANINFF(xI) || ISNANINFF(priY[1])){
-    priY[1] += xI;
-    binned_smsdeposit(fold, xR, priY, 2 * incpriY);
-    return;
-  }
-
-  if(binned_smindex0(priY) || binned_smindex0(priY + 1)){
-    binned_smsdeposit(fold, xR, priY, 2 * incpriY);
-    binned_smsdeposit(fold, xI, priY + 1, 2 * incpriY);
-    return;
-  }
-
-  for (i = 0; i < fold - 1; i++) {
-    MR = priY[i * 2 * incpriY];
-    MI = priY[i * 2 * incpriY + 1];
-    qR.f = xR;
-    qI.f = xI;
-    qR.i |= 1;
-    qI.i |= 1;
-    qR.f += MR;
-    qI.f += MI;
-    priY[i * 2 * incpriY] = qR.f;
-    priY[i * 2 * incpriY + 1] = qI.f;
-    MR -= qR.f;
-    MI -= qI.f;
-    xR += MR;
-    xI += MI;
-  }
-  qR.f = xR;
-  qI.f = xI;
-  qR.i |= 1;
-  qI.i |= 1;
-  priY[i * 2 * incpriY] += qR.f;
-  priY[i * 2 * incpriY + 1] += qI.f;
+  binnedInline_cmcdeposit(fold, X, priY, incpriY);
 }
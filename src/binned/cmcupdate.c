@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -18,6 +19,5 @@
  * @date   27 Apr 2015
  */
 void binned_cmcupdate(const int fold, const void *X, float* priY, const int incpriY, float* carY, const int inccarY) {
-  binned_smsupdate(fold, ((float*)X)[0], priY, 2 * incpriY, carY, 2 * inccarY);
-  binned_smsupdate(fold, ((float*)X)[1], priY + 1, 2 * incpriY, carY + 1, 2 * inccarY);
+  binnedInline_cmcupdate(fold, X, priY, incpriY, carY, inccarY);
 }
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -17,6 +18,5 @@
  * @date   27 Apr 2015
  */
 void binned_cmrenorm(const int fold, float* priX, const int incpriX, float* carX, const int inccarX) {
-  binned_smrenorm(fold, priX, 2 * incpriX, carX, 2 * inccarX);
-  binned_smrenorm(fold, priX + 1, 2 * incpriX, carX + 1, 2 * inccarX);
+  binnedInline_cmrenorm(fold, priX, incpriX, carX, inccarX);
 }
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief  Add double precision to binned double precision (Y += X)
@@ -14,5 +15,5 @@
  * @date   27 Apr 2015
  */
 void binned_dbdadd(const int fold, const double X, double_binned *Y){
-  binned_dmdadd(fold, X, Y, 1, Y + fold, 1);
+  binnedInline_dbdadd(fold, X, Y);
 }
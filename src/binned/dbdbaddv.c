@@ -1,10 +1,19 @@
 #include <binned.h>
+#include <binnedInline.h>
+
+#include "../common/common.h"
+
+#define N_block_MAX 256
 
 /**
  * @brief  Add binned double precision vectors (Y += X)
  *
  * Performs the operation Y += X
  *
+ * The indices of X and Y and the renormalization of Y are computed a block at a time with binned_dbindexv() and binned_dbrenormv().
+ *
+ * Every element of Y is renormalized, including those copied from X or left alone because X is zero. If X and Y are renormalized (the results of binned functions always are), this stores exactly what a loop over binned_dbdbadd() would. Otherwise the values are the same but the stored representation of those elements may differ.
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X binned vector X
@@ -13,11 +22,70 @@
  * @param incY Y vector stride (use every incY'th element)
  *
  * @author Willow Ahrens
- * @date   25 Jun 2015
+ * @date   17 Oct 2026
  */
 void binned_dbdbaddv(const int fold, const int N, const double_binned *X, const int incX, double_binned *Y, const int incY){
-  int i;
-  for(i = 0; i < N; i++, X += incX * binned_dbnum(fold), Y += incY * binned_dbnum(fold)){
-    binned_dmdmadd(fold, X, 1, X + fold, 1, Y, 1, Y + fold, 1);
+  int X_index[N_block_MAX];
+  int Y_index[N_block_MAX];
+  const double *priX;
+  double *priY;
+  const double *bins;
+  int shift;
+  int i, j, k;
+  int N_block;
+
+  for(i = 0; i < N; i += N_block){
+    N_block = MIN(N - i, N_block_MAX);
+
+    binned_dbindexv(fold, N_block, X, incX, X_index);
+    binned_dbindexv(fold, N_block, Y, incY, Y_index);
+
+    //add each element of X to Y as binned_dmdmadd() would, leaving the renormalization for later
+    for(k = 0; k < N_block; k++){
+      priX = X + k * incX * binned_dbnum(fold);
+      priY = Y + k * incY * binned_dbnum(fold);
+
+      if (priX[0] == 0.0)
+        continue;
+
+      if (priY[0] == 0.0) {
+        for (j = 0; j < 2 * fold; j++) {
+          priY[j] = priX[j];
+        }
+        continue;
+      }
+
+      if (binnedInline_disnaninf(priX[0]) || binnedInline_disnaninf(priY[0])){
+        priY[0] += priX[0];
+        continue;
+      }
+
+      shift = Y_index[k] - X_index[k];
+      if(shift > 0){
+        bins = binned_dmbins(Y_index[k]);
+        //shift Y upwards and add X to Y
+        for (j = fold - 1; j >= shift; j--) {
+          priY[j] = priX[j] + (priY[j - shift] - bins[j - shift]);
+          priY[fold + j] = priX[fold + j] + priY[fold + j - shift];
+        }
+        for (j = 0; j < shift && j < fold; j++) {
+          priY[j] = priX[j];
+          priY[fold + j] = priX[fold + j];
+        }
+      }else{
+        bins = binned_dmbins(X_index[k]);
+        //shift X upwards and add X to Y
+        for (j = 0 - shift; j < fold; j++) {
+          priY[j] += priX[j + shift] - bins[j + shift];
+          priY[fold + j] += priX[fold + j + shift];
+        }
+      }
+    }
+
+    //renormalization leaves the elements that were copied or left alone unchanged as long as X and Y were renormalized
+    binned_dbrenormv(fold, N_block, Y, incY);
+
+    X += N_block * incX * binned_dbnum(fold);
+    Y += N_block * incY * binned_dbnum(fold);
   }
 }
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief  Add double precision to suitably binned binned double precision (Y += X)
@@ -16,5 +17,5 @@
  * @date   10 Jun 2015
  */
 void binned_dbddeposit(const int fold, const double X, double_binned *Y){
-  binned_dmddeposit(fold, X, Y, 1);
+  binnedInline_dbddeposit(fold, X, Y);
 }
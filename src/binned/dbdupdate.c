@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Update binned double precision with double precision (X -> Y)
@@ -14,5 +15,5 @@
  * @date   27 Apr 2015
  */
 void binned_dbdupdate(const int fold, const double X, double_binned *Y) {
-  binned_dmdupdate(fold, X, Y, 1, Y + fold, 1);
+  binnedInline_dbdupdate(fold, X, Y);
 }
@@ -0,0 +1,57 @@
+#include <binned.h>
+#include <binnedInline.h>
+
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__)) || (defined(__AVX2__) && !defined(reproBLAS_no__AVX2__))
+  #include <immintrin.h>
+#endif
+
+/**
+ * @brief Get indices of a vector of binned double precision
+ *
+ * Set idx[i] to the index of the i'th element of X, as binned_dmindex() would compute it. The exponents of 8 (AVX-512) or 4 (AVX2) binned elements are extracted at once in 64-bit integer lanes.
+ *
+ * @param fold the fold of the binned types
+ * @param N vector length
+ * @param X binned vector X
+ * @param incX X vector stride (use every incX'th binned element)
+ * @param idx integer vector of length N to hold the indices
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binned_dbindexv(const int fold, const int N, const double_binned *X, const int incX, int *idx){
+  const long long stride = (long long)incX * binned_dbnum(fold);
+  int i = 0;
+
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  const __m512i offsets = _mm512_set_epi64(7 * stride, 6 * stride, 5 * stride, 4 * stride, 3 * stride, 2 * stride, stride, 0);
+  const __m512i exp_mask = _mm512_set1_epi64(2 * DBL_MAX_EXP - 1);
+  const __m512i magic = _mm512_castpd_si512(_mm512_set1_pd(1ull << (DBL_MANT_DIG - 1)));
+  const __m512d top = _mm512_set1_pd((1ull << (DBL_MANT_DIG - 1)) + (DBL_MAX_EXP + DBL_MANT_DIG - DBWIDTH + 1 + (DBL_MAX_EXP - 2)));
+  const __m512d width = _mm512_set1_pd(DBWIDTH);
+  __m512i exp;
+
+  for(; i + 8 <= N; i += 8, X += 8 * stride){
+    exp = _mm512_and_si512(_mm512_srli_epi64(_mm512_castpd_si512(_mm512_i64gather_pd(offsets, X, 8)), DBL_MANT_DIG - 1), exp_mask);
+    //the quotient of two small integers is never rounded up to the next integer, so truncation matches integer division
+    _mm256_storeu_si256((__m256i*)(idx + i), _mm512_cvttpd_epi32(_mm512_div_pd(_mm512_sub_pd(top, _mm512_castsi512_pd(_mm512_or_si512(exp, magic))), width)));
+  }
+#elif (defined(__AVX2__) && !defined(reproBLAS_no__AVX2__))
+  const __m256i offsets = _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+  const __m256i exp_mask = _mm256_set1_epi64x(2 * DBL_MAX_EXP - 1);
+  const __m256i magic = _mm256_castpd_si256(_mm256_set1_pd(1ull << (DBL_MANT_DIG - 1)));
+  const __m256d top = _mm256_set1_pd((1ull << (DBL_MANT_DIG - 1)) + (DBL_MAX_EXP + DBL_MANT_DIG - DBWIDTH + 1 + (DBL_MAX_EXP - 2)));
+  const __m256d width = _mm256_set1_pd(DBWIDTH);
+  __m256i exp;
+
+  for(; i + 4 <= N; i += 4, X += 4 * stride){
+    exp = _mm256_and_si256(_mm256_srli_epi64(_mm256_castpd_si256(_mm256_i64gather_pd(X, offsets, 8)), DBL_MANT_DIG - 1), exp_mask);
+    //the quotient of two small integers is never rounded up to the next integer, so truncation matches integer division
+    _mm_storeu_si128((__m128i*)(idx + i), _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_sub_pd(top, _mm256_castsi256_pd(_mm256_or_si256(exp, magic))), width)));
+  }
+#endif
+
+  for(; i < N; i++, X += stride){
+    idx[i] = binnedInline_dmindex(X);
+  }
+}
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Renormalize binned double precision
@@ -13,5 +14,5 @@
  * @date   27 Apr 2015
  */
 void binned_dbrenorm(const int fold, double_binned *X) {
-  binned_dmrenorm(fold, X, 1, X + fold, 1);
+  binnedInline_dbrenorm(fold, X);
 }
@@ -0,0 +1,103 @@
+#include <binned.h>
+#include <binnedInline.h>
+
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__)) || (defined(__AVX2__) && !defined(reproBLAS_no__AVX2__))
+  #include <immintrin.h>
+#endif
+
+/**
+ * @brief Renormalize a vector of binned double precision
+ *
+ * Renormalization keeps the primary vector within the necessary bins by shifting over to the carry vector. Each element of X is renormalized as it would be by binned_dbrenorm(), but the carries and primary bits of 8 (AVX-512) or 4 (AVX2) binned elements are handled at once in 64-bit integer lanes.
+ *
+ * @param fold the fold of the binned types
+ * @param N vector length
+ * @param X binned vector X
+ * @param incX X vector stride (use every incX'th binned element)
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binned_dbrenormv(const int fold, const int N, double_binned *X, const int incX){
+  const long long stride = (long long)incX * binned_dbnum(fold);
+  int i = 0;
+
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  const __m512i offsets = _mm512_set_epi64(7 * stride, 6 * stride, 5 * stride, 4 * stride, 3 * stride, 2 * stride, stride, 0);
+  const __m512i exp_mask = _mm512_set1_epi64((2ll * DBL_MAX_EXP - 1) << (DBL_MANT_DIG - 1));
+  const __m512i abs_mask = _mm512_set1_epi64(~(1ull << 63));
+  const __m512i low_bit = _mm512_set1_epi64(1ll << (DBL_MANT_DIG - 3));
+  const __m512i high_bit = _mm512_set1_epi64(1ll << (DBL_MANT_DIG - 2));
+  const __m512i carry_mask = _mm512_set1_epi64(3);
+  const __m512i magic = _mm512_castpd_si512(_mm512_set1_pd(1ull << (DBL_MANT_DIG - 1)));
+  const __m512d magic_2 = _mm512_set1_pd((1ull << (DBL_MANT_DIG - 1)) + 2);
+  __m512i pri;
+  __m512d car;
+  __mmask8 live;
+  int j;
+
+  for(; i + 8 <= N; i += 8, X += 8 * stride){
+    //zero and exceptional elements are left alone
+    pri = _mm512_castpd_si512(_mm512_i64gather_pd(offsets, X, 8));
+    live = _mm512_test_epi64_mask(pri, abs_mask) & _mm512_cmpneq_epi64_mask(_mm512_and_si512(pri, exp_mask), exp_mask);
+    if(live == 0){
+      continue;
+    }
+    for(j = 0; j < fold; j++){
+      pri = _mm512_castpd_si512(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), live, offsets, X + j, 8));
+      car = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), live, offsets, X + fold + j, 8);
+      //the two bits below the leading bit of the primary are the carry (plus 2), converted to double with the 2^52 trick
+      car = _mm512_add_pd(car, _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(_mm512_srli_epi64(pri, DBL_MANT_DIG - 3), carry_mask), magic)), magic_2));
+      pri = _mm512_or_si512(_mm512_andnot_si512(low_bit, pri), high_bit);
+      _mm512_mask_i64scatter_pd(X + j, live, offsets, _mm512_castsi512_pd(pri), 8);
+      _mm512_mask_i64scatter_pd(X + fold + j, live, offsets, car, 8);
+    }
+  }
+#elif (defined(__AVX2__) && !defined(reproBLAS_no__AVX2__))
+  const __m256i offsets = _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+  const __m256i exp_mask = _mm256_set1_epi64x((2ll * DBL_MAX_EXP - 1) << (DBL_MANT_DIG - 1));
+  const __m256i abs_mask = _mm256_set1_epi64x(~(1ull << 63));
+  const __m256i low_bit = _mm256_set1_epi64x(1ll << (DBL_MANT_DIG - 3));
+  const __m256i high_bit = _mm256_set1_epi64x(1ll << (DBL_MANT_DIG - 2));
+  const __m256i carry_mask = _mm256_set1_epi64x(3);
+  const __m256i magic = _mm256_castpd_si256(_mm256_set1_pd(1ull << (DBL_MANT_DIG - 1)));
+  const __m256d magic_2 = _mm256_set1_pd((1ull << (DBL_MANT_DIG - 1)) + 2);
+  double pri_buffer[4] __attribute__((aligned(32)));
+  double car_buffer[4] __attribute__((aligned(32)));
+  __m256i pri;
+  __m256d car;
+  __m256i dead;
+  int live;
+  int j;
+  int k;
+
+  for(; i + 4 <= N; i += 4, X += 4 * stride){
+    //zero and exceptional elements are left alone
+    pri = _mm256_castpd_si256(_mm256_i64gather_pd(X, offsets, 8));
+    dead = _mm256_or_si256(_mm256_cmpeq_epi64(_mm256_and_si256(pri, abs_mask), _mm256_setzero_si256()), _mm256_cmpeq_epi64(_mm256_and_si256(pri, exp_mask), exp_mask));
+    live = ~_mm256_movemask_pd(_mm256_castsi256_pd(dead)) & 15;
+    if(live == 0){
+      continue;
+    }
+    for(j = 0; j < fold; j++){
+      pri = _mm256_castpd_si256(_mm256_i64gather_pd(X + j, offsets, 8));
+      car = _mm256_i64gather_pd(X + fold + j, offsets, 8);
+      //the two bits below the leading bit of the primary are the carry (plus 2), converted to double with the 2^52 trick
+      car = _mm256_add_pd(car, _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi64(pri, DBL_MANT_DIG - 3), carry_mask), magic)), magic_2));
+      pri = _mm256_or_si256(_mm256_andnot_si256(low_bit, pri), high_bit);
+      _mm256_store_pd(pri_buffer, _mm256_castsi256_pd(pri));
+      _mm256_store_pd(car_buffer, car);
+      for(k = 0; k < 4; k++){
+        if(live & (1 << k)){
+          X[k * stride + j] = pri_buffer[k];
+          X[k * stride + fold + j] = car_buffer[k];
+        }
+      }
+    }
+  }
+#endif
+
+  for(; i < N; i++, X += stride){
+    binnedInline_dbrenorm(fold, X);
+  }
+}
@@ -0,0 +1,19 @@
+#include <binned.h>
+
+/**
+ * @brief Allocate a shared binned double precision accumulator
+ *
+ * The accumulator is initially zero. Threads add to it through producers obtained with binned_dbshared_join().
+ *
+ * @param fold the fold of the binned types
+ * @return a freshly allocated shared accumulator (free with binned_dbshared_free())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+double_binned_shared *binned_dbshared_alloc(const int fold){
+  double_binned_shared *S = (double_binned_shared*)malloc(sizeof(double_binned_shared));
+  S->fold = fold;
+  S->producers = NULL;
+  return S;
+}
@@ -0,0 +1,22 @@
+#include <binned.h>
+
+/**
+ * @brief Convert a shared binned double precision accumulator to double precision (S -> Y)
+ *
+ * Converts the sum of everything published to S (see binned_dbshared_snapshot()).
+ *
+ * @param S shared accumulator
+ * @return scalar Y
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+double binned_dbshared_conv(const double_binned_shared *S){
+  double_binned *Y = binned_dballoc(S->fold);
+  double res;
+
+  binned_dbshared_snapshot(S, Y);
+  res = binned_ddbconv(S->fold, Y);
+  free(Y);
+  return res;
+}
@@ -0,0 +1,16 @@
+#include <binned.h>
+
+/**
+ * @brief Add double precision to a shared binned double precision accumulator (S += X)
+ *
+ * X is added to the buffer of the producer P. It becomes part of the accumulator the next time P calls binned_dbshared_publish().
+ *
+ * @param P producer (see binned_dbshared_join())
+ * @param X scalar X
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binned_dbshared_dadd(double_binned_producer *P, const double X){
+  binned_dbdadd(P->fold, X, P->pending);
+}
@@ -0,0 +1,16 @@
+#include <binned.h>
+
+/**
+ * @brief Add binned double precision to a shared binned double precision accumulator (S += X)
+ *
+ * X (such as a partial sum computed by the calling thread) is added to the buffer of the producer P. It becomes part of the accumulator the next time P calls binned_dbshared_publish().
+ *
+ * @param P producer (see binned_dbshared_join())
+ * @param X binned scalar X
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binned_dbshared_dbadd(double_binned_producer *P, const double_binned *X){
+  binned_dbdbadd(P->fold, X, P->pending);
+}
@@ -0,0 +1,24 @@
+#include <binned.h>
+
+/**
+ * @brief Free a shared binned double precision accumulator and all of its producers
+ *
+ * No thread may use the accumulator or any of its producers during or after this call.
+ *
+ * @param S shared accumulator
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binned_dbshared_free(double_binned_shared *S){
+  double_binned_producer *P = S->producers;
+  double_binned_producer *next;
+
+  while(P != NULL){
+    next = P->next;
+    free(P->pending);
+    free(P);
+    P = next;
+  }
+  free(S);
+}
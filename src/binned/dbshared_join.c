@@ -0,0 +1,32 @@
+#include <binned.h>
+
+/**
+ * @brief Add a producer to a shared binned double precision accumulator
+ *
+ * Returns a producer through which one thread at a time may add to S with binned_dbshared_dadd() and binned_dbshared_dbadd(). Values added to the producer are buffered in the producer and become part of S when the producer calls binned_dbshared_publish(). Typically each thread joins once and keeps its producer.
+ *
+ * The producer is added to S without locking, so any number of threads may join concurrently. It is freed with S.
+ *
+ * @param S shared accumulator
+ * @return a new producer of S
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+double_binned_producer *binned_dbshared_join(double_binned_shared *S){
+  int fold = S->fold;
+  double_binned_producer *P = (double_binned_producer*)malloc(sizeof(double_binned_producer));
+
+  P->fold = fold;
+  P->version = 0;
+  P->pending = (double_binned*)malloc(3 * binned_dbsize(fold));
+  P->total = P->pending + binned_dbnum(fold);
+  P->published = P->total + binned_dbnum(fold);
+  binned_dbsetzero(fold, P->pending);
+  binned_dbsetzero(fold, P->total);
+  binned_dbsetzero(fold, P->published);
+
+  P->next = __atomic_load_n(&S->producers, __ATOMIC_RELAXED);
+  while(!__atomic_compare_exchange_n(&S->producers, &P->next, P, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+  return P;
+}
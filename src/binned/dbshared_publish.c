@@ -0,0 +1,29 @@
+#include <binned.h>
+
+/**
+ * @brief Publish the values buffered by a producer to its shared binned double precision accumulator
+ *
+ * Makes everything added to P so far visible to binned_dbshared_snapshot() and binned_dbshared_conv(). Publishing never waits for other threads: each producer keeps its own published total, which only it writes, and readers sum the published totals of all producers.
+ *
+ * @param P producer (see binned_dbshared_join())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binned_dbshared_publish(double_binned_producer *P){
+  int fold = P->fold;
+  int num = binned_dbnum(fold);
+  unsigned long version = P->version;
+  int i;
+
+  binned_dbdbadd(fold, P->pending, P->total);
+  binned_dbsetzero(fold, P->pending);
+
+  //an odd version tells readers that the published total is being written
+  __atomic_store_n(&P->version, version + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  for(i = 0; i < num; i++){
+    __atomic_store(P->published + i, P->total + i, __ATOMIC_RELAXED);
+  }
+  __atomic_store_n(&P->version, version + 2, __ATOMIC_RELEASE);
+}
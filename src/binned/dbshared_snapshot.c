@@ -0,0 +1,34 @@
+#include <binned.h>
+
+/**
+ * @brief Get the value of a shared binned double precision accumulator (Y = S)
+ *
+ * Sets Y to the sum of everything published to S. May be called by any thread at any time, concurrently with producers. Each producer's published total is read as a whole (the read is retried if the producer publishes during it), and because binned addition is independent of order, Y depends only on what has been published, not on how the threads interleave.
+ *
+ * @param S shared accumulator
+ * @param Y binned scalar Y
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binned_dbshared_snapshot(const double_binned_shared *S, double_binned *Y){
+  int fold = S->fold;
+  int num = binned_dbnum(fold);
+  double_binned *copy = binned_dballoc(fold);
+  double_binned_producer *P;
+  unsigned long version;
+  int i;
+
+  binned_dbsetzero(fold, Y);
+  for(P = __atomic_load_n(&S->producers, __ATOMIC_ACQUIRE); P != NULL; P = P->next){
+    do{
+      version = __atomic_load_n(&P->version, __ATOMIC_ACQUIRE);
+      for(i = 0; i < num; i++){
+        __atomic_load(P->published + i, copy + i, __ATOMIC_RELAXED);
+      }
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    }while((version & 1) || version != __atomic_load_n(&P->version, __ATOMIC_RELAXED));
+    binned_dbdbadd(fold, copy, Y);
+  }
+  free(copy);
+}
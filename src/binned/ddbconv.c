@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Convert binned double precision to double precision (X -> Y)
@@ -12,5 +13,5 @@
  * @date   27 Apr 2015
  */
 double binned_ddbconv(const int fold, const double_binned *X) {
-  return binned_ddmconv(fold, X, 1, X + fold, 1);
+  return binnedInline_ddbconv(fold, X);
 }
@@ -12,8 +12,9 @@ import itertools
   #PIPE_WIDTH = number of independently loaded input elements processed per binned sum
   #REG_WIDTH = number of variables needed to hold the independently loaded elements
   #UNROLL_WIDTH = number of times PIPE_WIDTH elements per binned sum are to be processed in the inner loop
+  #AMAX_NAME = if given, a pointer to store the maximum absolute value of the deposited elements (so that no separate amax pass is needed)
 class Deposit(Target):
-  def __init__(self, data_type_class, fold_name, N_name, X_name, incX_name, priY_name, incpriY_name):
+  def __init__(self, data_type_class, fold_name, N_name, X_name, incX_name, priY_name, incpriY_name, amax_name=None):
     super(Deposit, self).__init__()
     if data_type_class.base_type.name == "double":
       self.default_fold = terminal.get_didefaultfold()
@@ -27,6 +28,7 @@ class Deposit(Target):
     self.incX_name = incX_name
     self.priY_name = priY_name
     self.incpriY_name = incpriY_name
+    self.amax_name = amax_name
 
   def get_arguments(self):
     arguments = []
@@ -37,6 +39,14 @@ class Deposit(Target):
             arguments.append("{}_expand_{}_fold_{}".format(self.name, vectorization.name, i))
           arguments.append("{}_max_pipe_width_{}_fold_{}".format(self.name, vectorization.name, i))
           arguments.append("{}_max_unroll_width_{}_fold_{}".format(self.name, vectorization.name, i))
+          if vectorization.fma_macro is not None:
+            arguments.append("{}_fma_{}_fold_{}".format(self.name, vectorization.name, i))
+          if vectorization.gather_macro is not None:
+            arguments.append("{}_gather_{}_fold_{}".format(self.name, vectorization.name, i))
+          if issubclass(vectorization, SIMD):
+            arguments.append("{}_strided_prefetch_{}_fold_{}".format(self.name, vectorization.name, i))
+            arguments.append("{}_prefetch_{}_fold_{}".format(self.name, vectorization.name, i))
+            arguments.append("{}_stream_{}_fold_{}".format(self.name, vectorization.name, i))
     return arguments
 
   def get_metrics(self):
@@ -48,6 +58,14 @@ class Deposit(Target):
             metrics["{}_expand_{}_fold_{}".format(self.name, vectorization.name, i)] = ["bench_{}_fold_{}".format(self.metric_name, i)]
           metrics["{}_max_pipe_width_{}_fold_{}".format(self.name, vectorization.name, i)] = ["bench_{}_fold_{}".format(self.metric_name, i)]
           metrics["{}_max_unroll_width_{}_fold_{}".format(self.name, vectorization.name, i)] = ["bench_{}_fold_{}".format(self.metric_name, i)]
+          if vectorization.fma_macro is not None:
+            metrics["{}_fma_{}_fold_{}".format(self.name, vectorization.name, i)] = ["bench_{}_fold_{}".format(self.metric_name, i)]
+          if vectorization.gather_macro is not None:
+            metrics["{}_gather_{}_fold_{}".format(self.name, vectorization.name, i)] = ["bench_{}_incX_fold_{}".format(self.metric_name, i)]
+          if issubclass(vectorization, SIMD):
+            metrics["{}_strided_prefetch_{}_fold_{}".format(self.name, vectorization.name, i)] = ["bench_{}_incX_fold_{}".format(self.metric_name, i)]
+            metrics["{}_prefetch_{}_fold_{}".format(self.name, vectorization.name, i)] = ["bench_{}_large_fold_{}".format(self.metric_name, i)]
+            metrics["{}_stream_{}_fold_{}".format(self.name, vectorization.name, i)] = ["bench_{}_incX_fold_{}".format(self.metric_name, i), "bench_{}_large_fold_{}".format(self.metric_name, i)]
     return metrics
 
   def get_parameters(self):
@@ -64,6 +82,19 @@ class Deposit(Target):
           maximum = minimum * 8
           default = minimum
           parameters.append(PowerOfTwoParameter(name, {"vectorization":vec.name}, minimum, maximum, default))
+          if vec.fma_macro is not None:
+            parameters.append(BooleanParameter("{}_fma_{}_fold_{}".format(self.name, vec.name, i), {"vectorization":vec.name}, True))
+          #AVX gathers need AVX2 (a -mavx2 build or the AVX2 dispatch level) and lose to scalar loads on the machines we measured, so they start off
+          if vec.gather_macro is not None:
+            parameters.append(BooleanParameter("{}_gather_{}_fold_{}".format(self.name, vec.name, i), {"vectorization":vec.name}, vec.gather_macro == ""))
+          #hardware prefetchers usually follow a constant stride, so software prefetch starts off
+          if isinstance(vec, SIMD):
+            parameters.append(IntegerParameter("{}_strided_prefetch_{}_fold_{}".format(self.name, vec.name, i), {"vectorization":vec.name}, 0, 64, 8, 0))
+          #out of cache, contiguous loads outrun the hardware prefetchers, so software prefetch starts a few kilobytes ahead
+          if isinstance(vec, SIMD):
+            parameters.append(IntegerParameter("{}_prefetch_{}_fold_{}".format(self.name, vec.name, i), {"vectorization":vec.name}, 0, 2048, 128, 512))
+            #non-temporal hints skip the outer caches but also the L2 streamer, so streaming starts off
+            parameters.append(BooleanParameter("{}_stream_{}_fold_{}".format(self.name, vec.name, i), {"vectorization":vec.name}, False))
     return parameters
 
   def write(self, code_block):
@@ -122,6 +153,10 @@ class Deposit(Target):
     if self.data_type.is_complex:
       self.expansion_mask_vars = ["expansion_mask_" + str(i) for i in range(self.vec.suf_width)]
       code_block.define_vars(self.vec.type_name, self.expansion_mask_vars)
+    if self.amax_name is not None:
+      self.m_vars = ["m_" + str(i) for i in range(self.vec.suf_width)]
+      code_block.define_vars(self.vec.type_name, self.m_vars)
+      code_block.set_equal(self.m_vars, itertools.repeat(self.vec.zero))
     if fold == 0:
       #define q variables
       self.q_vars = ["q_" + str(i) for i in range(max_reg_width)]
@@ -173,6 +208,9 @@ class Deposit(Target):
       for j in range(fold):
         self.vec.consolidate_into(self.priY_name, j, self.incpriY_name, self.s_vars[j], self.priY_name, j, self.incpriY_name)
 
+    if self.amax_name is not None:
+      self.vec.max_into(self.amax_name, 0, 1, self.m_vars)
+
   def write_increments(self, code_block, fold, max_pipe_width, max_unroll_width):
     code_block.write("if({} == 1){{".format(self.incX_name))
     code_block.indent()
@@ -184,18 +222,58 @@ class Deposit(Target):
     code_block.dedent()
     code_block.write("}")
 
+  #strided loads are gathered where the vectorization allows it
   def write_core(self, code_block, fold, max_pipe_width, max_unroll_width, incs):
+    if all(inc == 1 for inc in incs) or self.vec.gather_macro is None or not self.arguments["{}_gather_{}_fold_{}".format(self.name, self.vec.name, fold)]:
+      self.write_loop(code_block, fold, max_pipe_width, max_unroll_width, incs)
+    elif self.vec.gather_macro == "":
+      self.write_gather_loop(code_block, fold, max_pipe_width, max_unroll_width, incs)
+    else:
+      code_block.write("#if (defined({0}) && !defined(reproBLAS_no{0}))".format(self.vec.gather_macro))
+      self.write_gather_loop(code_block, fold, max_pipe_width, max_unroll_width, incs)
+      code_block.write("#else")
+      self.write_loop(code_block, fold, max_pipe_width, max_unroll_width, incs)
+      code_block.write("#endif")
+
+  #float gathers take 32 bit offsets, so strides too long for them to reach every lane of a vector are loaded without gathers
+  def write_gather_loop(self, code_block, fold, max_pipe_width, max_unroll_width, incs):
+    if self.data_type.base_type.name == "float":
+      code_block.write("if({}){{".format(" && ".join(["{} <= INT_MAX / {}".format(inc, self.vec.base_size) for inc in incs if inc != 1])))
+      code_block.indent()
+    self.vec.gather = True
+    self.write_loop(code_block, fold, max_pipe_width, max_unroll_width, incs)
+    self.vec.gather = False
+    if self.data_type.base_type.name == "float":
+      code_block.dedent()
+      code_block.write("}else{")
+      code_block.indent()
+      self.write_loop(code_block, fold, max_pipe_width, max_unroll_width, incs)
+      code_block.dedent()
+      code_block.write("}")
+
+  def write_loop(self, code_block, fold, max_pipe_width, max_unroll_width, incs):
     max_reg_width = self.compute_reg_width(max_pipe_width);
+    prefetch = 0
+    if isinstance(self.vec, SIMD):
+      if all(inc == 1 for inc in incs):
+        prefetch = self.arguments["{}_prefetch_{}_fold_{}".format(self.name, self.vec.name, fold)]
+      else:
+        prefetch = self.arguments["{}_strided_prefetch_{}_fold_{}".format(self.name, self.vec.name, fold)]
+      self.stream = self.arguments["{}_stream_{}_fold_{}".format(self.name, self.vec.name, fold)]
+    self.max_block_width = max_pipe_width * max_unroll_width
 
     def body(n, align = False):
       if type(n) == str:
         reg_width = self.compute_reg_width(self.vec.type_size)
         self.preprocess(code_block, self.vec.type_size, incs, partial=n, align=align)
+        self.track_amax(code_block, reg_width)
         code_block.new_line()
         self.process(code_block, fold, reg_width, 1)
       else:
         reg_width = self.compute_reg_width(min(n, max_pipe_width))
+        self.prefetch(code_block, prefetch, n, incs)
         self.preprocess(code_block, n, incs, align=align)
+        self.track_amax(code_block, self.compute_reg_width(n))
         code_block.new_line()
         self.process(code_block, fold, reg_width, n // max_pipe_width)
 
@@ -203,11 +281,14 @@ class Deposit(Target):
       if type(n) == str:
         reg_width = self.compute_reg_width(self.vec.type_size)
         self.preprocess(code_block, self.vec.type_size, incs, partial=n, align=align)
+        self.track_amax(code_block, reg_width)
         code_block.new_line()
         self.process0(code_block, fold, reg_width, 1)
       else:
         reg_width = self.compute_reg_width(min(n, max_pipe_width))
+        self.prefetch(code_block, prefetch, n, incs)
         self.preprocess(code_block, n, incs, align=align)
+        self.track_amax(code_block, self.compute_reg_width(n))
         code_block.new_line()
         self.process0(code_block, fold, reg_width, n // max_pipe_width)
 
@@ -264,6 +345,18 @@ class Deposit(Target):
     else:
       code_block.set_equal(self.load_vars[0], self.vec.load_partial(self.load_ptrs[0], 0, incs[0], partial))
 
+  #touch the lines holding the elements that will be loaded distance elements from now (streaming them past the cache if asked)
+  def prefetch(self, code_block, distance, n, incs):
+    if distance and n == self.max_block_width:
+      for (load_ptr, inc) in zip(self.load_ptrs, incs):
+        if inc != 1 or all(inc == 1 for inc in incs):
+          self.vec.prefetch(load_ptr, distance, inc, n, self.stream)
+
+  #fold the absolute values of the preprocessed elements into the running maximum
+  def track_amax(self, code_block, reg_width):
+    if self.amax_name is not None:
+      code_block.set_equal(itertools.cycle(self.m_vars), self.vec.max(itertools.cycle(self.m_vars), self.vec.abs(self.load_vars[0][:reg_width])))
+
   def process(self, code_block, fold, reg_width, unroll_width):
     if(fold == 0):
       for i in range(max(unroll_width, 1)):
@@ -292,12 +385,8 @@ class Deposit(Target):
         code_block.set_equal(self.s_vars[0], self.buffer0_vars[:reg_width])
         self.vec.add_blp_into(self.q_vars, self.s_vars[0], self.vec.mul(self.load_vars[0][i * reg_width:], itertools.cycle(self.compression_vars)), reg_width)
         code_block.set_equal(self.buffer0_vars, self.q_vars[:reg_width])
-        if self.data_type.is_complex:
-          code_block.set_equal(self.q_vars, self.vec.sub(self.s_vars[0], self.q_vars[:reg_width]))
-          code_block.set_equal(self.load_vars[0][i * reg_width:], self.vec.add(self.vec.add(self.load_vars[0][i * reg_width:], self.vec.mul(self.q_vars, itertools.cycle(self.expansion_vars))), self.vec.mul(self.q_vars, itertools.cycle(self.expansion_mask_vars))))
-        else:
-          code_block.set_equal(self.q_vars, self.vec.mul(self.vec.sub(self.s_vars[0], self.q_vars[:reg_width]), itertools.cycle(self.expansion_vars)))
-          code_block.set_equal(self.load_vars[0][i * reg_width:], self.vec.add(self.vec.add(self.load_vars[0][i * reg_width:], self.q_vars[:reg_width]), self.q_vars[:reg_width]))
+        code_block.set_equal(self.q_vars, self.vec.sub(self.s_vars[0], self.q_vars[:reg_width]))
+        self.expand_into(code_block, fold, self.load_vars[0][i * reg_width:], reg_width)
         code_block.write("for(j = 1; j < {} - 1; j++){{".format(self.fold_name))
         code_block.indent()
         code_block.set_equal(self.s_vars[0], self.buffer_vars[:reg_width])
@@ -312,12 +401,8 @@ class Deposit(Target):
       for i in range(max(unroll_width, 1)):
           code_block.set_equal(self.q_vars, self.s_vars[0][:reg_width])
           self.vec.add_blp_into(self.s_vars[0], self.s_vars[0], self.vec.mul(self.load_vars[0][i * reg_width:], itertools.cycle(self.compression_vars)), reg_width)
-          if self.data_type.is_complex:
-            code_block.set_equal(self.q_vars, self.vec.sub(self.q_vars, self.s_vars[0][:reg_width]))
-            code_block.set_equal(self.load_vars[0][i * reg_width:], self.vec.add(self.vec.add(self.load_vars[0][i * reg_width:], self.vec.mul(self.q_vars[:reg_width], itertools.cycle(self.expansion_vars))), self.vec.mul(self.q_vars[:reg_width], itertools.cycle(self.expansion_mask_vars))))
-          else:
-            code_block.set_equal(self.q_vars, self.vec.mul(self.vec.sub(self.q_vars, self.s_vars[0][:reg_width]), itertools.cycle(self.expansion_vars)))
-            code_block.set_equal(self.load_vars[0][i * reg_width:], self.vec.add(self.vec.add(self.load_vars[0][i * reg_width:], self.q_vars[:reg_width]), self.q_vars[:reg_width]))
+          code_block.set_equal(self.q_vars, self.vec.sub(self.q_vars, self.s_vars[0][:reg_width]))
+          self.expand_into(code_block, fold, self.load_vars[0][i * reg_width:], reg_width)
           for j in range(1, fold - 1):
             code_block.set_equal(self.q_vars, self.s_vars[j][:reg_width])
             self.vec.add_blp_into(self.s_vars[j], self.s_vars[j], self.load_vars[0][i * reg_width:], reg_width)
@@ -325,6 +410,33 @@ class Deposit(Target):
             code_block.set_equal(self.load_vars[0][i * reg_width:], self.vec.add(self.load_vars[0][i * reg_width:], self.q_vars[:reg_width]))
           self.vec.add_blp_into(self.s_vars[fold - 1], self.s_vars[fold - 1], self.load_vars[0][i * reg_width:], reg_width)
 
+  #add the compressed difference in q (scaled back up by the expansion) to the elements. The expansion is a power of two (and the mask is a power of two or zero), so the products are exact and fusing them with the additions does not change the result.
+  def expand_into(self, code_block, fold, dst_vars, reg_width):
+    def unfused():
+      if self.data_type.is_complex:
+        code_block.set_equal(dst_vars, self.vec.add(self.vec.add(dst_vars, self.vec.mul(self.q_vars[:reg_width], itertools.cycle(self.expansion_vars))), self.vec.mul(self.q_vars[:reg_width], itertools.cycle(self.expansion_mask_vars))))
+      else:
+        code_block.set_equal(self.q_vars, self.vec.mul(self.q_vars[:reg_width], itertools.cycle(self.expansion_vars)))
+        code_block.set_equal(dst_vars, self.vec.add(self.vec.add(dst_vars, self.q_vars[:reg_width]), self.q_vars[:reg_width]))
+
+    def fused():
+      if self.data_type.is_complex:
+        code_block.set_equal(dst_vars, self.vec.fma(self.q_vars[:reg_width], itertools.cycle(self.expansion_mask_vars), self.vec.fma(self.q_vars[:reg_width], itertools.cycle(self.expansion_vars), dst_vars)))
+      else:
+        code_block.set_equal(dst_vars, self.vec.fma(self.q_vars[:reg_width], itertools.cycle(self.expansion_vars), dst_vars))
+        code_block.set_equal(dst_vars, self.vec.fma(self.q_vars[:reg_width], itertools.cycle(self.expansion_vars), dst_vars))
+
+    if self.vec.fma_macro is None or not self.arguments["{}_fma_{}_fold_{}".format(self.name, self.vec.name, fold)]:
+      unfused()
+    elif self.vec.fma_macro == "":
+      fused()
+    else:
+      code_block.write("#if defined({})".format(self.vec.fma_macro))
+      fused()
+      code_block.write("#else")
+      unfused()
+      code_block.write("#endif")
+
   def set_daz_ftz(self, code_block):
     code_block.write("if(!binned_{}mdenorm({}, {})){{".format(self.data_type.name_char, self.fold_name, self.priY_name))
     code_block.indent()
@@ -1,8 +1,5 @@
-#include <math.h>
-
 #include <binned.h>
-
-#include "../common/common.h"
+#include <binnedInline.h>
 
 /**
  * @brief Get index of double precision
@@ -17,25 +14,5 @@
  * @date   19 Jun 2015
  */
 int binned_dindex(const double X){
-  /*
-  //reference version
-  int exp;
-
-  if(X == 0.0){
-    return (DBL_MAX_EXP - DBL_MIN_EXP)/DBWIDTH;
-  }else{
-    frexp(X, &exp);
-    return (DBL_MAX_EXP - exp)/DBWIDTH;
-  }
-  */
-  int exp = EXP(X);
-  if(exp == 0){
-    if(X == 0.0){
-      return binned_DBMAXINDEX;
-    }else{
-      frexp(X, &exp);
-      return MIN((DBL_MAX_EXP - exp)/DBWIDTH, binned_DBMAXINDEX);
-    }
-  }
-  return ((DBL_MAX_EXP + EXP_BIAS) - exp)/DBWIDTH;
+  return binnedInline_dindex(X);
 }
@@ -0,0 +1,83 @@
+#include <binned.h>
+#include <binnedInline.h>
+
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__)) || (defined(__AVX2__) && !defined(reproBLAS_no__AVX2__))
+  #include <immintrin.h>
+#endif
+
+/**
+ * @brief Get indices of a double precision vector
+ *
+ * Set idx[i] to the index of the i'th element of X, as binned_dindex() would compute it. The exponents of 8 (AVX-512) or 4 (AVX2) elements are extracted at once in 64-bit integer lanes, and only zero and denormal elements are handled one at a time.
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param idx integer vector of length N to hold the indices
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binned_dindexv(const int N, const double *X, const int incX, int *idx){
+  int i = 0;
+
+#if (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  const long long inc = incX;
+  const __m512i offsets = _mm512_set_epi64(7 * inc, 6 * inc, 5 * inc, 4 * inc, 3 * inc, 2 * inc, inc, 0);
+  const __m512i exp_mask = _mm512_set1_epi64(2 * DBL_MAX_EXP - 1);
+  const __m512i magic = _mm512_castpd_si512(_mm512_set1_pd(1ull << (DBL_MANT_DIG - 1)));
+  const __m512d top = _mm512_set1_pd((1ull << (DBL_MANT_DIG - 1)) + (DBL_MAX_EXP + (DBL_MAX_EXP - 2)));
+  const __m512d width = _mm512_set1_pd(DBWIDTH);
+  __m512i exp;
+  __mmask8 small;
+  int k;
+
+  for(; i + 8 <= N; i += 8, X += 8 * incX){
+    if(incX == 1){
+      exp = _mm512_castpd_si512(_mm512_loadu_pd(X));
+    }else{
+      exp = _mm512_castpd_si512(_mm512_i64gather_pd(offsets, X, 8));
+    }
+    exp = _mm512_and_si512(_mm512_srli_epi64(exp, DBL_MANT_DIG - 1), exp_mask);
+    //the quotient of two small integers is never rounded up to the next integer, so truncation matches integer division
+    _mm256_storeu_si256((__m256i*)(idx + i), _mm512_cvttpd_epi32(_mm512_div_pd(_mm512_sub_pd(top, _mm512_castsi512_pd(_mm512_or_si512(exp, magic))), width)));
+    small = _mm512_cmpeq_epi64_mask(exp, _mm512_setzero_si512());
+    for(k = 0; small != 0; k++, small >>= 1){
+      if(small & 1){
+        idx[i + k] = binnedInline_dindex(X[k * incX]);
+      }
+    }
+  }
+#elif (defined(__AVX2__) && !defined(reproBLAS_no__AVX2__))
+  const long long inc = incX;
+  const __m256i offsets = _mm256_set_epi64x(3 * inc, 2 * inc, inc, 0);
+  const __m256i exp_mask = _mm256_set1_epi64x(2 * DBL_MAX_EXP - 1);
+  const __m256i magic = _mm256_castpd_si256(_mm256_set1_pd(1ull << (DBL_MANT_DIG - 1)));
+  const __m256d top = _mm256_set1_pd((1ull << (DBL_MANT_DIG - 1)) + (DBL_MAX_EXP + (DBL_MAX_EXP - 2)));
+  const __m256d width = _mm256_set1_pd(DBWIDTH);
+  __m256i exp;
+  int small;
+  int k;
+
+  for(; i + 4 <= N; i += 4, X += 4 * incX){
+    if(incX == 1){
+      exp = _mm256_castpd_si256(_mm256_loadu_pd(X));
+    }else{
+      exp = _mm256_castpd_si256(_mm256_i64gather_pd(X, offsets, 8));
+    }
+    exp = _mm256_and_si256(_mm256_srli_epi64(exp, DBL_MANT_DIG - 1), exp_mask);
+    //the quotient of two small integers is never rounded up to the next integer, so truncation matches integer division
+    _mm_storeu_si128((__m128i*)(idx + i), _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_sub_pd(top, _mm256_castsi256_pd(_mm256_or_si256(exp, magic))), width)));
+    small = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(exp, _mm256_setzero_si256())));
+    for(k = 0; small != 0; k++, small >>= 1){
+      if(small & 1){
+        idx[i + k] = binnedInline_dindex(X[k * incX]);
+      }
+    }
+  }
+#endif
+
+  for(; i < N; i++, X += incX){
+    idx[i] = binnedInline_dindex(X[0]);
+  }
+}
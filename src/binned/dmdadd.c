@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -18,7 +19,5 @@
  * @date   27 Apr 2015
  */
 void binned_dmdadd(const int fold, const double X, double *priY, const int incpriY, double *carY, const int inccarY){
-  binned_dmdupdate(fold, X, priY, incpriY, carY, inccarY);
-  binned_dmddeposit(fold, X, priY, incpriY);
-  binned_dmrenorm(fold, priY, incpriY, carY, inccarY);
+  binnedInline_dmdadd(fold, X, priY, incpriY, carY, inccarY);
 }
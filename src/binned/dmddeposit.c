@@ -1,8 +1,5 @@
-#include <math.h>
-
 #include <binned.h>
-
-#include "../common/common.h"
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -22,50 +19,5 @@
  * @date   10 Jun 2015
  */
 void binned_dmddeposit(const int fold, const double X, double *priY, const int incpriY){
-  double M;
-  long_double q;
-  int i;
-  double x = X;
-
-  if(ISNANINF(x) || ISNANINF(priY[0])){
-    priY[0] += x;
-    return;
-  }
-
-  if(binned_dmindex0(priY)){
-    M = priY[0];
-    q.d = x * binned_DMCOMPRESSION;
-    q.l |= 1;
-    q.d += M;
-    priY[0] = q.d;
-    M -= q.d;
-    M *= binned_DMEXPANSION * 0.5;
-    x += M;
-    x += M;
-    for (i = 1; i < fold - 1; i++) {
-      M = priY[i * incpriY];
-      q.d = x;
-      q.l |= 1;
-      q.d += M;
-      priY[i * incpriY] = q.d;
-      M -= q.d;
-      x += M;
-    }
-    q.d = x;
-    q.l |= 1;
-    priY[i * incpriY] += q.d;
-  }else{
-    for (i = 0; i < fold - 1; i++) {
-      M = priY[i * incpriY];
-      q.d = x;
-      q.l |= 1;
-      q.d += M;
-      priY[i * incpriY] = q.d;
-      M -= q.d;
-      x += M;
-    }
-    q.d = x;
-    q.l |= 1;
-    priY[i * incpriY] += q.d;
-  }
+  binnedInline_dmddeposit(fold, X, priY, incpriY);
 }
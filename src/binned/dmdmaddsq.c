@@ -32,7 +32,7 @@ double binned_dmdmaddsq(const int fold, const double scaleX, const double *priX,
     binned_dmdmadd(fold, priX, incpriX, carX, inccarX, priY, incpriY, carY, inccarY);
     return scaleX;
   }else{
-    double_binned *tmp_X = binned_dballoc(fold);
+    double_binned tmp_X[2 * binned_DBMAXFOLD];
     binned_dmdmset(fold, priX, incpriX, carX, inccarX, tmp_X, 1, tmp_X + fold, 1);
     binned_dmdrescale(fold, scaleY, scaleX, tmp_X, 1, tmp_X + fold, 1);
     binned_dmdmadd(fold, tmp_X, 1, tmp_X + fold, 1, priY, incpriY, carY, inccarY);
@@ -1,8 +1,5 @@
-#include <math.h>
-
 #include <binned.h>
-
-#include "../common/common.h"
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -17,15 +14,5 @@
  * @date   19 May 2015
  */
 int binned_dmindex0(const double *priX){
-  /*
-  //reference version
-  int exp;
-
-  frexp(priX[0], &exp);
-  if(exp == DBL_MAX_EXP){
-    return 1;
-  }
-  return 0;
-  */
-  return EXP(priX[0]) == DBL_MAX_EXP + EXP_BIAS;
+  return binnedInline_dmindex0(priX);
 }
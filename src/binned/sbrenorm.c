@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Renormalize binned single precision
@@ -13,5 +14,5 @@
  * @date   27 Apr 2015
  */
 void binned_sbrenorm(const int fold, float_binned *X) {
-  binned_smrenorm(fold, X, 1, X + fold, 1);
+  binnedInline_sbrenorm(fold, X);
 }
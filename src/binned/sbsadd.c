@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief  Add single precision to binned single precision (Y += X)
@@ -14,5 +15,5 @@
  * @date   27 Apr 2015
  */
 void binned_sbsadd(const int fold, const float X, float_binned *Y){
-  binned_smsadd(fold, X, Y, 1, Y + fold, 1);
+  binnedInline_sbsadd(fold, X, Y);
 }
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief  Add single precision to suitably binned binned single precision (Y += X)
@@ -16,5 +17,5 @@
  * @date   10 Jun 2015
  */
 void binned_sbsdeposit(const int fold, const float X, float_binned *Y){
-  binned_smsdeposit(fold, X, Y, 1);
+  binnedInline_sbsdeposit(fold, X, Y);
 }
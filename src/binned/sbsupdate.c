@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Update binned single precision with single precision (X -> Y)
@@ -14,5 +15,5 @@
  * @date   27 Apr 2015
  */
 void binned_sbsupdate(const int fold, const float X, float_binned *Y) {
-  binned_smsupdate(fold, X, Y, 1, Y + fold, 1);
+  binnedInline_sbsupdate(fold, X, Y);
 }
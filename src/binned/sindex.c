@@ -1,8 +1,5 @@
-#include <math.h>
-
 #include <binned.h>
-
-#include "../common/common.h"
+#include <binnedInline.h>
 
 /**
  * @brief Get index of single precision
@@ -17,25 +14,5 @@
  * @date   19 Jun 2015
  */
 int binned_sindex(const float X){
-  /*
-  //reference version
-  int exp;
-
-  if(X == 0.0){
-    return (FLT_MAX_EXP - FLT_MIN_EXP)/SBWIDTH;
-  }else{
-    frexpf(X, &exp);
-    return (FLT_MAX_EXP - exp)/SBWIDTH;
-  }
-  */
-  int exp = EXPF(X);
-  if(exp == 0){
-    if(X == 0.0){
-      return binned_SBMAXINDEX;
-    }else{
-      frexpf(X, &exp);
-      return MIN((FLT_MAX_EXP - exp)/SBWIDTH, binned_SBMAXINDEX);
-    }
-  }
-  return ((FLT_MAX_EXP + EXPF_BIAS) - exp)/SBWIDTH;
+  return binnedInline_sindex(X);
 }
@@ -1,10 +1,5 @@
-#include <math.h>
-
 #include <binned.h>
-
-#include "../common/common.h"
-
-#include "../../config.h"
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -20,19 +15,5 @@
  * @date   23 Sep 2015
  */
 int binned_smindex(const float *priX){
-  /*
-  //reference version
-  int exp;
-
-  if(priX[0] == 0.0){
-    return (FLT_MAX_EXP - FLT_MIN_EXP)/SBWIDTH + binned_SBMAXFOLD;
-  }else{
-    frexpf(priX[0], &exp);
-    if(exp == FLT_MAX_EXP){
-      return 0;
-    }
-    return (FLT_MAX_EXP + FLT_MANT_DIG - SBWIDTH + 1 - exp)/SBWIDTH;
-  }
-  */
-  return ((FLT_MAX_EXP + FLT_MANT_DIG - SBWIDTH + 1 + EXPF_BIAS) - EXPF(priX[0]))/SBWIDTH;
+  return binnedInline_smindex(priX);
 }
@@ -1,8 +1,5 @@
-#include <math.h>
-
 #include <binned.h>
-
-#include "../common/common.h"
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -17,15 +14,5 @@
  * @date   19 May 2015
  */
 int binned_smindex0(const float *priX){
-  /*
-  //reference version
-  int exp;
-
-  frexpf(priX[0], &exp);
-  if(exp == FLT_MAX_EXP){
-    return 1;
-  }
-  return 0;
-  */
-  return EXPF(priX[0]) == FLT_MAX_EXP + EXPF_BIAS;
+  return binnedInline_smindex0(priX);
 }
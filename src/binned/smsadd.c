@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -18,7 +19,5 @@
  * @date   27 Apr 2015
  */
 void binned_smsadd(const int fold, const float X, float *priY, const int incpriY, float *carY, const int inccarY){
-  binned_smsupdate(fold, X, priY, incpriY, carY, inccarY);
-  binned_smsdeposit(fold, X, priY, incpriY);
-  binned_smrenorm(fold, priY, incpriY, carY, inccarY);
+  binnedInline_smsadd(fold, X, priY, incpriY, carY, inccarY);
 }
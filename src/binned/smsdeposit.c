@@ -1,8 +1,5 @@
-#include <math.h>
-
 #include <binned.h>
-
-#include "../common/common.h"
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -22,50 +19,5 @@
  * @date   10 Jun 2015
  */
 void binned_smsdeposit(const int fold, const float X, float *priY, const int incpriY){
-  float M;
-  int_float q;
-  int i;
-  float x = X;
-
-  if (ISNANINFF(x) || ISNANINFF(priY[0])) {
-    priY[0] += x;
-    return;
-  }
-
-  if(binned_smindex0(priY)){
-    M = priY[0];
-    q.f = x * binned_SMCOMPRESSION;
-    q.i |= 1;
-    q.f += M;
-    priY[0] = q.f;
-    M -= q.f;
-    M *= (binned_SMEXPANSION * 0.5);
-    x += M;
-    x += M;
-    for (i = 1; i < fold - 1; i++) {
-      M = priY[i * incpriY];
-      q.f = x;
-      q.i |= 1;
-      q.f += M;
-      priY[i * incpriY] = q.f;
-      M -= q.f;
-      x += M;
-    }
-    q.f = x;
-    q.i |= 1;
-    priY[i * incpriY] += q.f;
-  }else{
-    for (i = 0; i < fold - 1; i++) {
-      M = priY[i * incpriY];
-      q.f = x;
-      q.i |= 1;
-      q.f += M;
-      priY[i * incpriY] = q.f;
-      M -= q.f;
-      x += M;
-    }
-    q.f = x;
-    q.i |= 1;
-    priY[i * incpriY] += q.f;
-  }
+  binnedInline_smsdeposit(fold, X, priY, incpriY);
 }
@@ -33,7 +33,7 @@ float binned_smsmaddsq(const int fold, const float scaleX, const float *priX, co
     binned_smsmadd(fold, priX, incpriX, carX, inccarX, priY, incpriY, carY, inccarY);
     return scaleX;
   }else{
-    float_binned *tmp_X = binned_sballoc(fold);
+    float_binned tmp_X[2 * binned_SBMAXFOLD];
     binned_smsmset(fold, priX, incpriX, carX, inccarX, tmp_X, 1, tmp_X + fold, 1);
     binned_smsrescale(fold, scaleY, scaleX, tmp_X, 1, tmp_X + fold, 1);
     binned_smsmadd(fold, tmp_X, 1, tmp_X + fold, 1, priY, incpriY, carY, inccarY);
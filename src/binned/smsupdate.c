@@ -1,8 +1,5 @@
-#include <math.h>
-
 #include <binned.h>
-
-#include "../common/common.h"
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -22,35 +19,5 @@
  * @date   5 May 2015
  */
 void binned_smsupdate(const int fold, const float X, float* priY, const int incpriY, float* carY, const int inccarY) {
-  int i;
-  int j;
-  int X_index;
-  int shift;
-  const float *bins;
-
-  if (ISNANINFF(priY[0])){
-    return;
-  }
-
-  X_index = binned_sindex(X);
-  if(priY[0] == 0.0){
-    bins = binned_smbins(X_index);
-    for(i = 0; i < fold; i++){
-      priY[i * incpriY] = bins[i];
-      carY[i * inccarY] = 0.0;
-    }
-  }else{
-    shift = binned_smindex(priY) - X_index;
-    if(shift > 0){
-      for(i = fold - 1; i >= shift; i--){
-        priY[i * incpriY] = priY[(i - shift) * incpriY];
-        carY[i * inccarY] = carY[(i - shift) * inccarY];
-      }
-      bins = binned_smbins(X_index);
-      for(j = 0; j < i + 1; j++){
-        priY[j * incpriY] = bins[j];
-        carY[j * inccarY] = 0.0;
-      }
-    }
-  }
+  binnedInline_smsupdate(fold, X, priY, incpriY, carY, inccarY);
 }
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Convert binned single precision to single precision (X -> Y)
@@ -12,5 +13,5 @@
  * @date   27 Apr 2015
  */
 float binned_ssbconv(const int fold, const float_binned *X) {
-  return binned_ssmconv(fold, X, 1, X + fold, 1);
+  return binnedInline_ssbconv(fold, X);
 }
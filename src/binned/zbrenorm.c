@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Renormalize binned complex double precision
@@ -13,5 +14,5 @@
  * @date   27 Apr 2015
  */
 void binned_zbrenorm(const int fold, double_complex_binned *X) {
-  binned_zmrenorm(fold, X, 1, X + 2 * fold, 1);
+  binnedInline_zbrenorm(fold, X);
 }
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief  Add complex double precision to binned complex double precision (Y += X)
@@ -14,5 +15,5 @@
  * @date   27 Apr 2015
  */
 void binned_zbzadd(const int fold, const void *X, double_complex_binned *Y){
-  binned_zmzadd(fold, X, Y, 1, Y + 2 * fold, 1);
+  binnedInline_zbzadd(fold, X, Y);
 }
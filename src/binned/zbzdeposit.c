@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief  Add complex double precision to suitably binned binned complex double precision (Y += X)
@@ -16,5 +17,5 @@
  * @date   10 Jun 2015
  */
 void binned_zbzdeposit(const int fold, const void *X, double_complex_binned *Y){
-  binned_zmzdeposit(fold, X, Y, 1);
+  binnedInline_zbzdeposit(fold, X, Y);
 }
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Update binned complex double precision with complex double precision (X -> Y)
@@ -14,5 +15,5 @@
  * @date   27 Apr 2015
  */
 void binned_zbzupdate(const int fold, const void *X, double_complex_binned *Y) {
-  binned_zmzupdate(fold, X, Y, 1, Y + 2 * fold, 1);
+  binnedInline_zbzupdate(fold, X, Y);
 }
@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -17,6 +18,5 @@
  * @date   27 Apr 2015
  */
 void binned_zmrenorm(const int fold, double* priX, const int incpriX, double* carX, const int inccarX) {
-  binned_dmrenorm(fold, priX, 2 * incpriX, carX, 2 * inccarX);
-  binned_dmrenorm(fold, priX + 1, 2 * incpriX, carX + 1, 2 * inccarX);
+  binnedInline_zmrenorm(fold, priX, incpriX, carX, inccarX);
 }
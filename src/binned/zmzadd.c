@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -18,7 +19,5 @@
  * @date   27 Apr 2015
  */
 void binned_zmzadd(const int fold, const void *X, double *priY, const int incpriY, double *carY, const int inccarY){
-  binned_zmzupdate(fold, X, priY, incpriY, carY, inccarY);
-  binned_zmzdeposit(fold, X, priY, incpriY);
-  binned_zmrenorm(fold, priY, incpriY, carY, inccarY);
+  binnedInline_zmzadd(fold, X, priY, incpriY, carY, inccarY);
 }
@@ -1,8 +1,5 @@
-#include <math.h>
-
 #include <binned.h>
-
-#include "../common/common.h"
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -22,49 +19,5 @@
  * @date   10 Jun 2015
  */
 void binned_zmzdeposit(const int fold, const void *X, double *priY, const int incpriY){
-  double MR, MI;
-  long_double qR, qI;
-  int i;
-  double xR = ((double*)X)[0];
-  double xI = ((double*)X)[1];
-
-  if (ISNANINF(xR) || ISNANINF(priY[0])) {
-    priY[0] += xR;
-    binned_dmddeposit(fold, xI, priY + 1, 2 * incpriY);
-    return;
-  }
-  if (ISNANINF(xI) || ISNANINF(priY[1])) {
-    priY[1] += xI;
-    binned_dmddeposit(fold, xR, priY, 2 * incpriY);
-    return;
-  }
-
-  if(binned_dmindex0(priY) || binned_dmindex0(priY + 1)){
-    binned_dmddeposit(fold, xR, priY, 2 * incpriY);
-    binned_dmddeposit(fold, xI, priY + 1, 2 * incpriY);
-    return;
-  }
-
-  for (i = 0; i < fold - 1; i++) {
-    MR = priY[i * 2 * incpriY];
-    MI = priY[i * 2 * incpriY + 1];
-    qR.d = xR;
-    qI.d = xI;
-    qR.l |= 1;
-    qI.l |= 1;
-    qR.d += MR;
-    qI.d += MI;
-    priY[i * 2 * incpriY] = qR.d;
-    priY[i * 2 * incpriY + 1] = qI.d;
-    MR -= qR.d;
-    MI -= qI.d;
-    xR += MR;
-    xI += MI;
-  }
-  qR.d = xR;
-  qI.d = xI;
-  qR.l |= 1;
-  qI.l |= 1;
-  priY[i * 2 * incpriY] += qR.d;
-  priY[i * 2 * incpriY + 1] += qI.d;
+  binnedInline_zmzdeposit(fold, X, priY, incpriY);
 }
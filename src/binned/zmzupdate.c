@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @internal
@@ -18,6 +19,5 @@
  * @date   27 Apr 2015
  */
 void binned_zmzupdate(const int fold, const void *X, double* priY, const int incpriY, double* carY, const int inccarY) {
-  binned_dmdupdate(fold, ((double*)X)[0], priY, 2 * incpriY, carY, 2 * inccarY);
-  binned_dmdupdate(fold, ((double*)X)[1], priY + 1, 2 * incpriY, carY + 1, 2 * inccarY);
+  binnedInline_zmzupdate(fold, X, priY, incpriY, carY, inccarY);
 }
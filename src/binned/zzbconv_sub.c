@@ -1,4 +1,5 @@
 #include <binned.h>
+#include <binnedInline.h>
 
 /**
  * @brief Convert binned complex double precision to complex double precision (X -> Y)
@@ -12,5 +13,5 @@
  * @date   27 Apr 2015
  */
 void binned_zzbconv_sub(const int fold, const double_complex_binned *X, void *conv) {
-  binned_zzmconv_sub(fold, X, 1, X + 2 * fold, 1, conv);
+  binnedInline_zzbconv_sub(fold, X, conv);
 }
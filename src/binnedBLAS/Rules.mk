@@ -11,8 +11,8 @@ COGGED = damax.ccog damaxm.ccog                                         \
          smssum.ccog smsasum.ccog smsssq.ccog smsdot.ccog               \
          cmcsum.ccog smcasum.ccog smcssq.ccog cmcdotu.ccog cmcdotc.ccog \
          zmzsum.ccog dmzasum.ccog dmzssq.ccog zmzdotu.ccog zmzdotc.ccog \
-         dbdgemv.ccog dbdgemm.ccog                                      \
-         sbsgemv.ccog sbsgemm.ccog                                      \
+         dbdgemv.ccog dbdgemm.ccog dbdgemmk.ccog                        \
+         sbsgemv.ccog sbsgemm.ccog sbsgemmk.ccog                        \
          cbcgemv.ccog cbcgemm.ccog                                      \
          zbzgemv.ccog zbzgemm.ccog                                      \
 
@@ -24,30 +24,62 @@ PRECIOUS = damax.c damaxm.c                                \
            smssum.c smsasum.c smsssq.c smsdot.c            \
            zmzsum.c dmzasum.c dmzssq.c zmzdotu.c zmzdotc.c \
            cmcsum.c smcasum.c smcssq.c cmcdotu.c cmcdotc.c \
-           dbdgemv.c dbdgemm.c                             \
-           sbsgemv.c sbsgemm.c                             \
+           dbdgemv.c dbdgemm.c dbdgemmk.c                  \
+           sbsgemv.c sbsgemm.c sbsgemmk.c                  \
            zbzgemv.c zbzgemm.c                             \
            cbcgemv.c cbcgemm.c                             \
 
 LIBBINNEDBLAS := $(OBJPATH)/libbinnedblas.a
 
+# Kernels that are generated for each vectorization. With runtime dispatch,
+# these are compiled once per instruction set (renaming binnedBLAS_foo to
+# binnedBLAS_foo_AVX, etc.) and dispatch.o provides binnedBLAS_foo itself.
+VECTORIZED := damax damaxm                                \
+              zamax_sub zamaxm_sub                        \
+              samax samaxm                                \
+              camax_sub camaxm_sub                        \
+              dmdsum dmdasum dmdssq dmddot                \
+              zmzsum dmzasum dmzssq zmzdotu zmzdotc       \
+              smssum smsasum smsssq smsdot                \
+              cmcsum smcasum smcssq cmcdotu cmcdotc       \
+              dbdgemmk sbsgemmk                           \
+
+DISPATCH_VECTORIZATIONS := SISD SSE AVX AVX2 AVX512
+
+ifeq ($(strip $(BUILD_DISPATCH)),true)
+  VECTORIZED_OBJS := $(foreach vec,$(DISPATCH_VECTORIZATIONS),$(addsuffix _$(vec).o,$(VECTORIZED))) dispatch.o
+else
+  VECTORIZED_OBJS := $(addsuffix .o,$(VECTORIZED))
+endif
+
 libbinnedblas.a_DEPS = $$(LIBBINNED)                                     \
-                     damax.o damaxm.o                                \
-                     zamax_sub.o zamaxm_sub.o                        \
-                     samax.o samaxm.o                                \
-                     camax_sub.o camaxm_sub.o                        \
-                     dmdsum.o dmdasum.o dmdssq.o dmddot.o            \
-                     zmzsum.o dmzasum.o dmzssq.o zmzdotu.o zmzdotc.o \
-                     smssum.o smsasum.o smsssq.o smsdot.o            \
-                     cmcsum.o smcasum.o smcssq.o cmcdotu.o cmcdotc.o \
+                     $(VECTORIZED_OBJS)                              \
                      dbdsum.o dbdasum.o dbdssq.o dbddot.o            \
                      zbzsum.o dbzasum.o dbzssq.o zbzdotu.o zbzdotc.o \
                      sbssum.o sbsasum.o sbsssq.o sbsdot.o            \
                      cbcsum.o sbcasum.o sbcssq.o cbcdotu.o cbcdotc.o \
                      dbdgemv.o dbdgemm.o                             \
+                       dbdgemm_small.o dbdgemm_batch.o               \
+                       dbdgemm_batch_strided.o                       \
                      zbzgemv.o zbzgemm.o                             \
+                       zbzgemm_small.o zbzgemm_batch.o               \
+                       zbzgemm_batch_strided.o                       \
                      sbsgemv.o sbsgemm.o                             \
-                     cbcgemv.o cbcgemm.o
+                       sbsgemm_small.o sbsgemm_batch.o               \
+                       sbsgemm_batch_strided.o                       \
+                     cbcgemv.o cbcgemm.o                             \
+                       cbcgemm_small.o cbcgemm_batch.o               \
+                       cbcgemm_batch_strided.o                       \
+                     num_threads.o parallel.o vectorization.o
+
+define dispatch_rule
+$(OBJPATH)/%_$(1).o: $(OBJPATH)/%.c | $(OBJPATH)
+	$$(COMPILE.c) $$(DISPATCH_FLAGS_$(1)) -DbinnedBLAS_$$*=binnedBLAS_$$*_$(1) -o $$@ $$<
+endef
+
+ifeq ($(strip $(BUILD_DISPATCH)),true)
+  $(foreach vec,$(DISPATCH_VECTORIZATIONS),$(eval $(call dispatch_rule,$(vec))))
+endif
 
 camax_sub.c_DEPS = camax_sub.ccog
 camaxm_sub.c_DEPS = camaxm_sub.ccog
@@ -59,6 +91,7 @@ cmcsum.c_DEPS = $$(GETTER) cmcsum.ccog
 damax.c_DEPS = damax.ccog
 damaxm.c_DEPS = damaxm.ccog
 dbdgemm.c_DEPS = $$(GETTER) dbdgemm.ccog
+dbdgemmk.c_DEPS = $$(GETTER) dbdgemmk.ccog
 dbdgemv.c_DEPS = $$(GETTER) dbdgemv.ccog
 dmdasum.c_DEPS = $$(GETTER) dmdasum.ccog
 dmddot.c_DEPS = $$(GETTER) dmddot.ccog
@@ -69,6 +102,7 @@ dmzssq.c_DEPS = $$(GETTER) dmzssq.ccog
 samax.c_DEPS = samax.ccog
 samaxm.c_DEPS = samaxm.ccog
 sbsgemm.c_DEPS = $$(GETTER) sbsgemm.ccog
+sbsgemmk.c_DEPS = $$(GETTER) sbsgemmk.ccog
 sbsgemv.c_DEPS = $$(GETTER) sbsgemv.ccog
 smcasum.c_DEPS = $$(GETTER) smcasum.ccog
 smcssq.c_DEPS = $$(GETTER) smcssq.ccog
@@ -0,0 +1,80 @@
+import sys, os
+sys.path.append(os.path.join(os.path.dirname(os.path.realpath(__file__)), "gen"))
+from utils import *
+from dataTypes import *
+from vectorizations import *
+from generate import *
+import itertools
+
+  #MR = number of rows of A in the register block
+  #NR = number of columns of B in the register block
+  #Computes the maximum absolute pairwise product of each of the MR rows of A with each of the NR columns of B, reusing each load across the block.
+class AMaxMGEMM(Target):
+  name = "amaxmGEMM"
+
+  def __init__(self, data_type_class, N_name, A_name, lda_name, B_name, ldb_name, amaxm_name, MR_name, NR_name):
+    super(AMaxMGEMM, self).__init__()
+    assert not data_type_class.is_complex, "gemm microkernel is only for real types"
+    self.data_type_class = data_type_class
+    self.N_name = N_name
+    self.A_name = A_name
+    self.lda_name = lda_name
+    self.B_name = B_name
+    self.ldb_name = ldb_name
+    self.amaxm_name = amaxm_name
+    self.MR_name = MR_name
+    self.NR_name = NR_name
+
+  def get_arguments(self):
+    return [self.MR_name, self.NR_name]
+
+  def get_parameters(self):
+    return []
+
+  def get_metrics(self):
+    return {}
+
+  def write(self, code_block):
+    code_block.write("{")
+    code_block.indent()
+    iterate_all_vectorizations(self.write_vec, code_block.sub_block())
+    code_block.dedent()
+    code_block.write("}")
+
+  def write_vec(self, vec_class, code_block):
+    self.data_type = self.data_type_class(code_block)
+    self.vec = vec_class(code_block, self.data_type_class)
+    MR = self.arguments[self.MR_name]
+    NR = self.arguments[self.NR_name]
+    code_block.write("int i;")
+    self.load_ptrs = ["{}_ptr_{}".format(self.A_name, r) for r in range(MR)] + ["{}_ptr_{}".format(self.B_name, c) for c in range(NR)]
+    code_block.write("const {0} {1};".format(self.data_type.name, ", ".join(["*{} = {}".format(self.load_ptrs[r], mix("+", self.A_name, mix("*", r, self.lda_name), paren=False)) for r in range(MR)])))
+    code_block.write("const {0} {1};".format(self.data_type.name, ", ".join(["*{} = {}".format(self.load_ptrs[MR + c], mix("+", self.B_name, mix("*", c, self.ldb_name), paren=False)) for c in range(NR)])))
+    self.A_vars = ["{}_{}".format(self.A_name, r) for r in range(MR)]
+    self.B_vars = ["{}_{}".format(self.B_name, c) for c in range(NR)]
+    self.m_vars = ["m_{}".format(e) for e in range(MR * NR)]
+    code_block.define_vars(self.vec.type_name, self.A_vars)
+    code_block.define_vars(self.vec.type_name, self.B_vars)
+    code_block.define_vars(self.vec.type_name, self.m_vars)
+    code_block.set_equal(self.m_vars, itertools.repeat(self.vec.zero))
+
+    code_block.new_line()
+
+    def body(n):
+      if type(n) == str:
+        code_block.set_equal(self.A_vars, [self.vec.load_partial(ptr, 0, 1, n)[0] for ptr in self.load_ptrs[:MR]])
+        code_block.set_equal(self.B_vars, [self.vec.load_partial(ptr, 0, 1, n)[0] for ptr in self.load_ptrs[MR:]])
+      else:
+        code_block.set_equal(self.A_vars, [self.vec.load(ptr, 0, 1, n)[0] for ptr in self.load_ptrs[:MR]])
+        code_block.set_equal(self.B_vars, [self.vec.load(ptr, 0, 1, n)[0] for ptr in self.load_ptrs[MR:]])
+      for r in range(MR):
+        for c in range(NR):
+          e = r * NR + c
+          code_block.set_equal([self.m_vars[e]], self.vec.max([self.m_vars[e]], self.vec.abs(self.vec.mul([self.A_vars[r]], [self.B_vars[c]]))))
+
+    self.vec.iterate_unrolled("i", self.N_name, self.load_ptrs, [1] * (MR + NR), max(self.vec.type_size, 1), 1, body)
+
+    code_block.new_line()
+
+    for e in range(MR * NR):
+      self.vec.max_into(self.amaxm_name, e, 1, [self.m_vars[e]])
@@ -0,0 +1,168 @@
+#include <binnedBLAS.h>
+
+/**
+ * @internal
+ * @brief Store alpha times the (conjugated when conjA is set) rows of A in scaled
+ *
+ * The loops match those #binnedBLAS_cbcgemm() uses to scale A, and @p scaled is restrict-qualified like its buffer, so that the compiler evaluates the products the same way in both routines.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void binnedBLAS_cbcgemm_small_scale(const int conjA, const int M, const int K, const void *alpha, const void *A, const int lda, float *restrict scaled){
+  int i;
+  int k;
+
+  if(conjA){
+    for(i = 0; i < M; i++){
+      for(k = 0; k < K; k++){
+        scaled[2 * (i * K + k)] = ((float*)A)[2 * (i * lda + k)] * ((float*)alpha)[0] + ((float*)A)[2 * (i * lda + k) + 1] * ((float*)alpha)[1];
+        scaled[2 * (i * K + k) + 1] = ((float*)A)[2 * (i * lda + k)] * ((float*)alpha)[1] - ((float*)A)[2 * (i * lda + k) + 1] * ((float*)alpha)[0];
+      }
+    }
+  }else{
+    for(i = 0; i < M; i++){
+      for(k = 0; k < K; k++){
+        scaled[2 * (i * K + k)] = ((float*)A)[2 * (i * lda + k)] * ((float*)alpha)[0] - ((float*)A)[2 * (i * lda + k) + 1] * ((float*)alpha)[1];
+        scaled[2 * (i * K + k) + 1] = ((float*)A)[2 * (i * lda + k)] * ((float*)alpha)[1] + ((float*)A)[2 * (i * lda + k) + 1] * ((float*)alpha)[0];
+      }
+    }
+  }
+}
+
+/**
+ * @internal
+ * @brief Add to binned complex single precision matrix C the matrix-matrix product of small complex single precision matrices A and B using caller-provided workspace
+ *
+ * Performs the same operation as #binnedBLAS_cbcgemm(), with the same result, but on the calling thread and without allocating memory. alpha*op(A) and op(B) are packed (when needed) into @p work so that the rows of op(A) and the columns of op(B) are contiguous, and each element of C is accumulated with a single call to #binnedBLAS_cbcdotu() (or #binnedBLAS_cbcdotc() when B is conjugated).
+ *
+ * @param fold the fold of the binned types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param A complex single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B complex single precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C binned complex single precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ * @param work workspace of at least (M + N) * K complex single precision elements
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedBLAS_cbcgemm_small(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const void *alpha, const void *A, const int lda,
+             const void *B, const int ldb,
+             float_complex_binned *C, const int ldc, float *work){
+  const float *opA;
+  const float *opB;
+  const float *a;
+  int ldopA;
+  int ldopB;
+  int rowA;
+  int colB;
+  int conjA;
+  int conjB;
+  int i;
+  int j;
+  int k;
+
+  //early returns
+  if(M == 0 || N == 0 || K == 0 || (((float*)alpha)[0] == 0.0 && ((float*)alpha)[1] == 0.0)){
+    return;
+  }
+
+  //rowA (colB) is set if the rows of op(A) (columns of op(B)) are contiguous
+  switch(Order){
+    case 'r':
+    case 'R':
+      rowA = (TransA == 'n' || TransA == 'N');
+      colB = !(TransB == 'n' || TransB == 'N');
+      break;
+    default:
+      rowA = !(TransA == 'n' || TransA == 'N');
+      colB = (TransB == 'n' || TransB == 'N');
+      break;
+  }
+  conjA = (TransA == 'c' || TransA == 'C');
+  conjB = (TransB == 'c' || TransB == 'C');
+
+  //alpha and the conjugate of A are applied while packing, and the conjugate of B is applied by the dot product
+  if(rowA && !conjA && ((float*)alpha)[0] == 1.0 && ((float*)alpha)[1] == 0.0){
+    opA = (const float*)A;
+    ldopA = lda;
+  }else{
+    if(((float*)alpha)[0] == 1.0 && ((float*)alpha)[1] == 0.0){
+      for(i = 0; i < M; i++){
+        for(k = 0; k < K; k++){
+          a = (const float*)A + 2 * (rowA ? i * lda + k : k * lda + i);
+          work[2 * (i * K + k)] = a[0];
+          work[2 * (i * K + k) + 1] = conjA ? -a[1] : a[1];
+        }
+      }
+    }else if(rowA){
+      binnedBLAS_cbcgemm_small_scale(conjA, M, K, alpha, A, lda, work);
+    }else{
+      if(conjA){
+        for(k = 0; k < K; k++){
+          for(i = 0; i < M; i++){
+            work[2 * (i * K + k)] = ((float*)A)[2 * (k * lda + i)] * ((float*)alpha)[0] + ((float*)A)[2 * (k * lda + i) + 1] * ((float*)alpha)[1];
+            work[2 * (i * K + k) + 1] = ((float*)A)[2 * (k * lda + i)] * ((float*)alpha)[1] - ((float*)A)[2 * (k * lda + i) + 1] * ((float*)alpha)[0];
+          }
+        }
+      }else{
+        for(k = 0; k < K; k++){
+          for(i = 0; i < M; i++){
+            work[2 * (i * K + k)] = ((float*)A)[2 * (k * lda + i)] * ((float*)alpha)[0] - ((float*)A)[2 * (k * lda + i) + 1] * ((float*)alpha)[1];
+            work[2 * (i * K + k) + 1] = ((float*)A)[2 * (k * lda + i)] * ((float*)alpha)[1] + ((float*)A)[2 * (k * lda + i) + 1] * ((float*)alpha)[0];
+          }
+        }
+      }
+    }
+    opA = work;
+    ldopA = K;
+  }
+
+  if(colB){
+    opB = (const float*)B;
+    ldopB = ldb;
+  }else{
+    for(j = 0; j < N; j++){
+      for(k = 0; k < K; k++){
+        work[2 * (M * K + j * K + k)] = ((const float*)B)[2 * (k * ldb + j)];
+        work[2 * (M * K + j * K + k) + 1] = ((const float*)B)[2 * (k * ldb + j) + 1];
+      }
+    }
+    opB = work + 2 * M * K;
+    ldopB = K;
+  }
+
+  for(i = 0; i < M; i++){
+    for(j = 0; j < N; j++){
+      switch(Order){
+        case 'r':
+        case 'R':
+          if(conjB){
+            binnedBLAS_cbcdotc(fold, K, opB + 2 * j * ldopB, 1, opA + 2 * i * ldopA, 1, C + (i * ldc + j) * binned_cbnum(fold));
+          }else{
+            binnedBLAS_cbcdotu(fold, K, opA + 2 * i * ldopA, 1, opB + 2 * j * ldopB, 1, C + (i * ldc + j) * binned_cbnum(fold));
+          }
+          break;
+        default:
+          if(conjB){
+            binnedBLAS_cbcdotc(fold, K, opB + 2 * j * ldopB, 1, opA + 2 * i * ldopA, 1, C + (j * ldc + i) * binned_cbnum(fold));
+          }else{
+            binnedBLAS_cbcdotu(fold, K, opA + 2 * i * ldopA, 1, opB + 2 * j * ldopB, 1, C + (j * ldc + i) * binned_cbnum(fold));
+          }
+          break;
+      }
+    }
+  }
+}
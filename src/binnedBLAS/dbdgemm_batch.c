@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include <limits.h>
+
+#include <binnedBLAS.h>
+
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #binnedBLAS_dbdgemm_batch_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  char Order;
+  char TransA;
+  char TransB;
+  int M;
+  int N;
+  int K;
+  double alpha;
+  const double *const *A;
+  int lda;
+  const double *const *B;
+  int ldb;
+  double_binned *const *C;
+  int ldc;
+  double **works;
+} binnedBLAS_dbdgemm_batch_args;
+
+/**
+ * @internal
+ * @brief Compute product b of the batch (a task of #binnedBLAS_dbdgemm_batch())
+ *
+ * Each thread allocates its workspace the first time it runs a task.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void binnedBLAS_dbdgemm_batch_task(void *args, const int b, const int thread){
+  binnedBLAS_dbdgemm_batch_args *a = (binnedBLAS_dbdgemm_batch_args*)args;
+  double *work;
+
+  if(a->works[thread] == NULL){
+    a->works[thread] = (double*)malloc((a->M + a->N) * (a->K + 1) * sizeof(double));
+  }
+  work = a->works[thread];
+
+  binnedBLAS_dbdgemm_small(a->fold, a->Order, a->TransA, a->TransB, a->M, a->N, a->K, a->alpha, a->A[b], a->lda, a->B[b], a->ldb, a->C[b], a->ldc, work);
+}
+
+/**
+ * @brief Add to each binned double precision matrix in a batch the matrix-matrix product of the corresponding double precision matrices
+ *
+ * For b < batch_count, performs one of the matrix-matrix operations
+ *
+ *   C_b := alpha*op(A_b)*op(B_b) + C_b,
+ *
+ * where A_b = A[b], B_b = B[b] and C_b = C[b], and op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T.
+ *
+ * All matrices of the batch have the same dimensions and leading dimensions.
+ *
+ * The products are computed with #binnedBLAS_dbdgemm_small(), reusing one workspace of (M + N) * (K + 1) elements per thread for the whole batch. Entries of the batch are spread across threads, and the result of each entry is the same as that of #binnedBLAS_dbdgemm(), regardless of the number of threads.
+ *
+ * @param fold the fold of the binned types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix op(A_b) and of the matrix C_b.
+ * @param N number of columns of matrix op(B_b) and of the matrix C_b.
+ * @param K number of columns of matrix op(A_b) and columns of the matrix op(B_b).
+ * @param alpha scalar alpha
+ * @param A array of double precision matrices of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A_b as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B array of double precision matrices of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B_b as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C array of binned double precision matrices of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C_b as declared in the calling program. ldc must be at least N in row major or M in column major.
+ * @param batch_count number of products
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedBLAS_dbdgemm_batch(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const double alpha, const double *const *A, const int lda,
+             const double *const *B, const int ldb,
+             double_binned *const *C, const int ldc,
+             const int batch_count){
+  int num_threads;
+  binnedBLAS_dbdgemm_batch_args args;
+  int t;
+
+  if(M == 0 || N == 0 || K == 0 || alpha == 0.0 || batch_count <= 0){
+    return;
+  }
+
+  num_threads = binnedBLAS_nthreads((int)MIN((double)M * N * K * batch_count, (double)INT_MAX));
+  num_threads = MIN(num_threads, batch_count);
+
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.TransB = TransB;
+  args.M = M;
+  args.N = N;
+  args.K = K;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.B = B;
+  args.ldb = ldb;
+  args.C = C;
+  args.ldc = ldc;
+  args.works = (double**)calloc(num_threads, sizeof(double*));
+  binnedBLAS_parallel(num_threads, batch_count, &binnedBLAS_dbdgemm_batch_task, &args);
+  for(t = 0; t < num_threads; t++){
+    free(args.works[t]);
+  }
+  free(args.works);
+}
@@ -5,9 +5,9 @@ import dataTypes
 import depositM
 
 class DepositDot(depositM.DepositM):
-  def __init__(self, data_type_class, fold_name, N_name, X_name, incX_name, manY_name, incmanY_name, Z_name, incZ_name):
+  def __init__(self, data_type_class, fold_name, N_name, X_name, incX_name, manY_name, incmanY_name, Z_name, incZ_name, amax_name=None):
     assert not data_type_class.is_complex, "dot is only for real types"
-    super(DepositDot, self).__init__(data_type_class, fold_name, N_name, X_name, incX_name, manY_name, incmanY_name, Z_name, incZ_name)
+    super(DepositDot, self).__init__(data_type_class, fold_name, N_name, X_name, incX_name, manY_name, incmanY_name, Z_name, incZ_name, amax_name)
     self.name = "{0}depositDot".format(self.data_type_class.name_char, self.data_type_class.name)
     self.metric_name = "r{0}dot".format(self.data_type_class.name_char, self.data_type_class.name)
 
@@ -0,0 +1,160 @@
+import sys, os
+sys.path.append(os.path.join(os.path.dirname(os.path.realpath(__file__)), "gen"))
+from utils import *
+from dataTypes import *
+from vectorizations import *
+from generate import *
+from src.binned import deposit
+import itertools
+
+  #MR = number of rows of A (and C) in the register block
+  #NR = number of columns of B (and C) in the register block
+  #Each load of a row of A is reused for NR products and each load of a column of B is reused for MR products. Each of the MR*NR binned sums keeps its fold primaries in registers.
+class DepositGEMM(deposit.Deposit):
+  def __init__(self, data_type_class, fold_name, N_name, A_name, lda_name, B_name, ldb_name, priC_name, MR_name, NR_name):
+    assert not data_type_class.is_complex, "gemm microkernel is only for real types"
+    super(DepositGEMM, self).__init__(data_type_class, fold_name, N_name, A_name, lda_name, priC_name, 1)
+    self.B_name = B_name
+    self.ldb_name = ldb_name
+    self.MR_name = MR_name
+    self.NR_name = NR_name
+    self.name = "{0}depositGEMM".format(self.data_type_class.name_char)
+    self.metric_name = "r{0}gemm_AvgTransA_AvgTransB".format(self.data_type_class.name_char)
+
+  def get_arguments(self):
+    arguments = [self.MR_name, self.NR_name]
+    for i in range(2, self.max_expand_fold + 1):
+      for vectorization in vectorization_lookup.values():
+        arguments.append("{}_expand_{}_fold_{}".format(self.name, vectorization.name, i))
+    return arguments
+
+  def get_metrics(self):
+    metrics = {}
+    for i in range(2, self.max_expand_fold + 1):
+      for vectorization in vectorization_lookup.values():
+        metrics["{}_expand_{}_fold_{}".format(self.name, vectorization.name, i)] = ["bench_{}_fold_{}".format(self.metric_name, i)]
+    return metrics
+
+  def get_parameters(self):
+    parameters = []
+    for i in range(2, self.max_expand_fold + 1):
+      for vectorization in vectorization_lookup.values():
+        vec = vectorization(CodeBlock(), self.data_type_class)
+        parameters.append(BooleanParameter("{}_expand_{}_fold_{}".format(self.name, vec.name, i), {"vectorization":vec.name}, i == self.default_fold))
+    return parameters
+
+  def write(self, code_block):
+    code_block.write("{")
+    code_block.indent()
+    self.code_block = code_block.sub_block()
+    iterate_all_vectorizations(self.write_vec, self.code_block)
+    code_block.dedent()
+    code_block.write("}")
+
+  def write_vec(self, vec_class, code_block):
+    self.data_type = self.data_type_class(code_block)
+    self.vec = vec_class(code_block, self.data_type_class)
+    code_block.new_line()
+    expanded_folds = []
+    for i in range(2, self.max_expand_fold + 1):
+      if self.arguments["{}_expand_{}_fold_{}".format(self.name, self.vec.name, i)]:
+        expanded_folds.append(i)
+    expanded_folds.append(0)
+    if len(expanded_folds) == 1:
+      self.write_fold(code_block, 0)
+    else:
+      code_block.write("switch({}){{".format(self.fold_name))
+      code_block.indent()
+      for fold in expanded_folds:
+        if fold == 0:
+          code_block.write("default:")
+        else:
+          code_block.write("case " + str(fold) + ":")
+        code_block.indent()
+        code_block.write("{")
+        code_block.indent()
+        self.write_fold(code_block, fold)
+        code_block.dedent()
+        code_block.write("}")
+        code_block.write("break;")
+        code_block.dedent()
+      code_block.dedent()
+      code_block.write("}")
+
+  def write_fold(self, code_block, fold):
+    MR = self.arguments[self.MR_name]
+    NR = self.arguments[self.NR_name]
+    if fold == 0:
+      code_block.write("int i, j;")
+    else:
+      code_block.write("int i;")
+    self.load_ptrs = ["{}_ptr_{}".format(self.X_name, r) for r in range(MR)] + ["{}_ptr_{}".format(self.B_name, c) for c in range(NR)]
+    code_block.write("const {0} {1};".format(self.data_type.name, ", ".join(["*{} = {}".format(self.load_ptrs[r], mix("+", self.X_name, mix("*", r, self.incX_name), paren=False)) for r in range(MR)])))
+    code_block.write("const {0} {1};".format(self.data_type.name, ", ".join(["*{} = {}".format(self.load_ptrs[MR + c], mix("+", self.B_name, mix("*", c, self.ldb_name), paren=False)) for c in range(NR)])))
+    self.A_vars = ["{}_{}".format(self.X_name, r) for r in range(MR)]
+    self.B_vars = ["{}_{}".format(self.B_name, c) for c in range(NR)]
+    self.P_vars = ["P_0"]
+    code_block.define_vars(self.vec.type_name, self.A_vars)
+    code_block.define_vars(self.vec.type_name, self.B_vars)
+    code_block.define_vars(self.vec.type_name, self.P_vars)
+    self.q_vars = ["q_0"]
+    code_block.define_vars(self.vec.type_name, self.q_vars)
+    self.priCs = ["{}[{}]".format(self.priY_name, e) for e in range(MR * NR)]
+    if fold == 0:
+      self.tile_s_vars = [[["s_0"]] for e in range(MR * NR)]
+      code_block.define_vars(self.vec.type_name, ["s_0"])
+      code_block.write("{0} s_buffer[{1}];".format(self.vec.type_name, mix("*", MR * NR, "binned_{}BMAXFOLD".format(self.data_type.base_type.name_char.upper()))))
+      self.tile_buffer_vars = [["s_buffer[{0}]".format(mix("+", mix("*", e, "binned_{}BMAXFOLD".format(self.data_type.base_type.name_char.upper())), "j"))] for e in range(MR * NR)]
+    else:
+      self.tile_s_vars = [[["s_{0}_{1}".format(e, j)] for j in range(fold)] for e in range(MR * NR)]
+      for j in range(fold):
+        code_block.define_vars(self.vec.type_name, ["s_{0}_{1}".format(e, j) for e in range(MR * NR)])
+
+    code_block.new_line()
+
+    #propagate sums to registers
+    for e in range(MR * NR):
+      if fold == 0:
+        code_block.write("for(j = 0; j < {}; j += 1){{".format(self.fold_name))
+        code_block.indent()
+        self.vec.propagate_into(self.tile_buffer_vars[e], self.priCs[e], "j", 1)
+        code_block.dedent()
+        code_block.write("}")
+      else:
+        for j in range(fold):
+          self.vec.propagate_into(self.tile_s_vars[e][j], self.priCs[e], j, 1)
+
+    code_block.new_line()
+
+    def body(n):
+      if type(n) == str:
+        code_block.set_equal(self.A_vars, [self.vec.load_partial(ptr, 0, 1, n)[0] for ptr in self.load_ptrs[:MR]])
+        code_block.set_equal(self.B_vars, [self.vec.load_partial(ptr, 0, 1, n)[0] for ptr in self.load_ptrs[MR:]])
+      else:
+        code_block.set_equal(self.A_vars, [self.vec.load(ptr, 0, 1, n)[0] for ptr in self.load_ptrs[:MR]])
+        code_block.set_equal(self.B_vars, [self.vec.load(ptr, 0, 1, n)[0] for ptr in self.load_ptrs[MR:]])
+      for r in range(MR):
+        for c in range(NR):
+          e = r * NR + c
+          code_block.set_equal(self.P_vars, self.vec.mul([self.A_vars[r]], [self.B_vars[c]]))
+          self.load_vars = [self.P_vars]
+          self.s_vars = self.tile_s_vars[e]
+          if fold == 0:
+            self.buffer_vars = self.tile_buffer_vars[e]
+          self.process(code_block, fold, 1, 1)
+
+    self.vec.iterate_unrolled("i", self.N_name, self.load_ptrs, [1] * (MR + NR), max(self.vec.type_size, 1), 1, body)
+
+    code_block.new_line()
+
+    #consolidate
+    for e in range(MR * NR):
+      if fold == 0:
+        code_block.write("for(j = 0; j < {}; j += 1){{".format(self.fold_name))
+        code_block.indent()
+        self.vec.consolidate_into(self.priCs[e], "j", 1, self.tile_buffer_vars[e], self.priCs[e], "j", 1)
+        code_block.dedent()
+        code_block.write("}")
+      else:
+        for j in range(fold):
+          self.vec.consolidate_into(self.priCs[e], j, 1, self.tile_s_vars[e][j], self.priCs[e], j, 1)
@@ -7,8 +7,8 @@ from generate import *
 from src.binned import deposit
 
 class DepositM(deposit.Deposit):
-  def __init__(self, data_type_class, fold_name, N_name, X_name, incX_name, manY_name, incmanY_name, Z_name, incZ_name):
-    super(DepositM, self).__init__(data_type_class, fold_name, N_name, X_name, incX_name, manY_name, incmanY_name)
+  def __init__(self, data_type_class, fold_name, N_name, X_name, incX_name, manY_name, incmanY_name, Z_name, incZ_name, amax_name=None):
+    super(DepositM, self).__init__(data_type_class, fold_name, N_name, X_name, incX_name, manY_name, incmanY_name, amax_name)
     self.Z_name = Z_name
     self.incZ_name = incZ_name
 
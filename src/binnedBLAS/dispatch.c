@@ -0,0 +1,91 @@
+#include <binnedBLAS.h>
+
+#include "../common/common.h"
+#include "../../config.h"
+
+/**
+ * @internal
+ * @file  dispatch.c
+ * @brief Runtime dispatch of the vectorized kernels
+ *
+ * When ReproBLAS is built with runtime dispatch, each vectorized kernel binnedBLAS_foo is compiled once for each instruction set as binnedBLAS_foo_SISD, binnedBLAS_foo_SSE, binnedBLAS_foo_AVX, binnedBLAS_foo_AVX2, and binnedBLAS_foo_AVX512. The AVX2 variant is the AVX kernel compiled with AVX2 and FMA, which enables its fused multiply-adds and gathers. The functions defined here forward each call to the variant chosen by #binnedBLAS_get_vectorization().
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+
+#define DISPATCH(RET, NAME, PARAMS, ARGS)\
+  RET NAME##_SISD PARAMS;\
+  RET NAME##_SSE PARAMS;\
+  RET NAME##_AVX PARAMS;\
+  RET NAME##_AVX2 PARAMS;\
+  RET NAME##_AVX512 PARAMS;\
+  RET NAME PARAMS{\
+    switch(binnedBLAS_get_vectorization()){\
+      case reproBLAS_AVX512:\
+        return NAME##_AVX512 ARGS;\
+      case reproBLAS_AVX2:\
+        return NAME##_AVX2 ARGS;\
+      case reproBLAS_AVX:\
+        return NAME##_AVX ARGS;\
+      case reproBLAS_SSE:\
+        return NAME##_SSE ARGS;\
+      default:\
+        return NAME##_SISD ARGS;\
+    }\
+  }
+
+#define DISPATCH_VOID(NAME, PARAMS, ARGS)\
+  void NAME##_SISD PARAMS;\
+  void NAME##_SSE PARAMS;\
+  void NAME##_AVX PARAMS;\
+  void NAME##_AVX2 PARAMS;\
+  void NAME##_AVX512 PARAMS;\
+  void NAME PARAMS{\
+    switch(binnedBLAS_get_vectorization()){\
+      case reproBLAS_AVX512:\
+        NAME##_AVX512 ARGS;\
+        break;\
+      case reproBLAS_AVX2:\
+        NAME##_AVX2 ARGS;\
+        break;\
+      case reproBLAS_AVX:\
+        NAME##_AVX ARGS;\
+        break;\
+      case reproBLAS_SSE:\
+        NAME##_SSE ARGS;\
+        break;\
+      default:\
+        NAME##_SISD ARGS;\
+        break;\
+    }\
+  }
+
+DISPATCH(double, binnedBLAS_damax, (const int N, const double *X, const int incX), (N, X, incX))
+DISPATCH(double, binnedBLAS_damaxm, (const int N, const double *X, const int incX, const double *Y, const int incY), (N, X, incX, Y, incY))
+DISPATCH_VOID(binnedBLAS_zamax_sub, (const int N, const void *X, const int incX, void *amax), (N, X, incX, amax))
+DISPATCH_VOID(binnedBLAS_zamaxm_sub, (const int N, const void *X, const int incX, const void *Y, const int incY, void *amaxm), (N, X, incX, Y, incY, amaxm))
+DISPATCH(float, binnedBLAS_samax, (const int N, const float *X, const int incX), (N, X, incX))
+DISPATCH(float, binnedBLAS_samaxm, (const int N, const float *X, const int incX, const float *Y, const int incY), (N, X, incX, Y, incY))
+DISPATCH_VOID(binnedBLAS_camax_sub, (const int N, const void *X, const int incX, void *amax), (N, X, incX, amax))
+DISPATCH_VOID(binnedBLAS_camaxm_sub, (const int N, const void *X, const int incX, const void *Y, const int incY, void *amaxm), (N, X, incX, Y, incY, amaxm))
+DISPATCH_VOID(binnedBLAS_dmdsum, (const int fold, const int N, const double *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY), (fold, N, X, incX, priY, incpriY, carY, inccarY))
+DISPATCH_VOID(binnedBLAS_dmdasum, (const int fold, const int N, const double *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY), (fold, N, X, incX, priY, incpriY, carY, inccarY))
+DISPATCH(double, binnedBLAS_dmdssq, (const int fold, const int N, const double *X, const int incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY), (fold, N, X, incX, scaleY, priY, incpriY, carY, inccarY))
+DISPATCH_VOID(binnedBLAS_dmddot, (const int fold, const int N, const double *X, const int incX, const double *Y, const int incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ), (fold, N, X, incX, Y, incY, manZ, incmanZ, carZ, inccarZ))
+DISPATCH_VOID(binnedBLAS_zmzsum, (const int fold, const int N, const void *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY), (fold, N, X, incX, priY, incpriY, carY, inccarY))
+DISPATCH_VOID(binnedBLAS_dmzasum, (const int fold, const int N, const void *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY), (fold, N, X, incX, priY, incpriY, carY, inccarY))
+DISPATCH(double, binnedBLAS_dmzssq, (const int fold, const int N, const void *X, const int incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY), (fold, N, X, incX, scaleY, priY, incpriY, carY, inccarY))
+DISPATCH_VOID(binnedBLAS_zmzdotu, (const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ), (fold, N, X, incX, Y, incY, manZ, incmanZ, carZ, inccarZ))
+DISPATCH_VOID(binnedBLAS_zmzdotc, (const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ), (fold, N, X, incX, Y, incY, manZ, incmanZ, carZ, inccarZ))
+DISPATCH_VOID(binnedBLAS_smssum, (const int fold, const int N, const float *X, const int incX, float *priY, const int incpriY, float *carY, const int inccarY), (fold, N, X, incX, priY, incpriY, carY, inccarY))
+DISPATCH_VOID(binnedBLAS_smsasum, (const int fold, const int N, const float *X, const int incX, float *priY, const int incpriY, float *carY, const int inccarY), (fold, N, X, incX, priY, incpriY, carY, inccarY))
+DISPATCH(float, binnedBLAS_smsssq, (const int fold, const int N, const float *X, const int incX, const float scaleY, float *priY, const int incpriY, float *carY, const int inccarY), (fold, N, X, incX, scaleY, priY, incpriY, carY, inccarY))
+DISPATCH_VOID(binnedBLAS_smsdot, (const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ), (fold, N, X, incX, Y, incY, manZ, incmanZ, carZ, inccarZ))
+DISPATCH_VOID(binnedBLAS_cmcsum, (const int fold, const int N, const void *X, const int incX, float *priY, const int incpriY, float *carY, const int inccarY), (fold, N, X, incX, priY, incpriY, carY, inccarY))
+DISPATCH_VOID(binnedBLAS_smcasum, (const int fold, const int N, const void *X, const int incX, float *priY, const int incpriY, float *carY, const int inccarY), (fold, N, X, incX, priY, incpriY, carY, inccarY))
+DISPATCH(float, binnedBLAS_smcssq, (const int fold, const int N, const void *X, const int incX, const float scaleY, float *priY, const int incpriY, float *carY, const int inccarY), (fold, N, X, incX, scaleY, priY, incpriY, carY, inccarY))
+DISPATCH_VOID(binnedBLAS_cmcdotu, (const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ), (fold, N, X, incX, Y, incY, manZ, incmanZ, carZ, inccarZ))
+DISPATCH_VOID(binnedBLAS_cmcdotc, (const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ), (fold, N, X, incX, Y, incY, manZ, incmanZ, carZ, inccarZ))
+DISPATCH_VOID(binnedBLAS_dbdgemmk, (const int fold, const int M, const int N, const int K, const double *A, const int lda, const double *B, const int ldb, double_binned *C, const int incrowC, const int inccolC, double *amax), (fold, M, N, K, A, lda, B, ldb, C, incrowC, inccolC, amax))
+DISPATCH_VOID(binnedBLAS_sbsgemmk, (const int fold, const int M, const int N, const int K, const float *A, const int lda, const float *B, const int ldb, float_binned *C, const int incrowC, const int inccolC, float *amax), (fold, M, N, K, A, lda, B, ldb, C, incrowC, inccolC, amax))
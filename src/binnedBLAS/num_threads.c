@@ -0,0 +1,136 @@
+#include <stdlib.h>
+#include <pthread.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <binnedBLAS.h>
+
+#include "../common/common.h"
+#include "../../config.h"
+
+static int num_threads = 0;
+static int env_num_threads = -1;
+static int thread_grain = 0;
+static int env_thread_grain = -1;
+static pthread_mutex_t env_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @internal
+ * @brief Get the positive integer value of an environment variable, reading it only once
+ *
+ * The first call reads the variable (under a lock, so that concurrent first calls agree) and stores its value in @p cache, which must start out negative. Later calls return the stored value.
+ *
+ * @param name name of the environment variable
+ * @param cache the stored value
+ * @return the value of the variable, or 0 if it is not set to a positive integer
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedBLAS_env_positive(const char *name, int *cache){
+  char *env;
+  int value;
+
+  value = __atomic_load_n(cache, __ATOMIC_ACQUIRE);
+  if(value < 0){
+    pthread_mutex_lock(&env_lock);
+    value = *cache;
+    if(value < 0){
+      env = getenv(name);
+      if(env != NULL && atoi(env) > 0){
+        value = atoi(env);
+      }else{
+        value = 0;
+      }
+      __atomic_store_n(cache, value, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&env_lock);
+  }
+  return value;
+}
+
+/**
+ * @brief Get the number of threads used by threaded routines
+ *
+ * If the number of threads has been set with #binnedBLAS_set_num_threads(), that number is returned. Otherwise, the number of threads is read from the @c REPROBLAS_NUM_THREADS environment variable, and if that is not set, the OpenMP default (@c omp_get_max_threads()) is used. If ReproBLAS was built without OpenMP, the number of threads is always 1.
+ *
+ * The results of all ReproBLAS routines are independent of the number of threads.
+ *
+ * @return number of threads
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+int binnedBLAS_get_num_threads(void){
+#ifdef _OPENMP
+  int env;
+
+  if(num_threads > 0){
+    return num_threads;
+  }
+  env = binnedBLAS_env_positive("REPROBLAS_NUM_THREADS", &env_num_threads);
+  if(env > 0){
+    return env;
+  }
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/**
+ * @brief Set the number of threads used by threaded routines
+ *
+ * The setting overrides the @c REPROBLAS_NUM_THREADS environment variable. If @p N is less than 1, the default number of threads is restored (see #binnedBLAS_get_num_threads()).
+ *
+ * The results of all ReproBLAS routines are independent of the number of threads.
+ *
+ * @param N number of threads
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedBLAS_set_num_threads(const int N){
+  num_threads = MAX(N, 0);
+}
+
+/**
+ * @brief Get the minimum number of elements a thread is given in threaded routines
+ *
+ * If the grain has been set with #binnedBLAS_set_thread_grain(), that number is returned. Otherwise, the grain is read from the @c REPROBLAS_THREAD_GRAIN environment variable, and if that is not set, #THREADGRAIN is used. Reductions over fewer than twice this many elements (and matrix-matrix products with fewer than twice this many multiplications) run on the calling thread.
+ *
+ * @return grain
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+int binnedBLAS_get_thread_grain(void){
+  int env;
+
+  if(thread_grain > 0){
+    return thread_grain;
+  }
+  env = binnedBLAS_env_positive("REPROBLAS_THREAD_GRAIN", &env_thread_grain);
+  if(env > 0){
+    return env;
+  }
+  return THREADGRAIN;
+}
+
+/**
+ * @brief Set the minimum number of elements a thread is given in threaded routines
+ *
+ * The setting overrides the @c REPROBLAS_THREAD_GRAIN environment variable. If @p N is less than 1, the default grain is restored (see #binnedBLAS_get_thread_grain()).
+ *
+ * The results of all ReproBLAS routines are independent of the grain.
+ *
+ * @param N grain
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedBLAS_set_thread_grain(const int N){
+  thread_grain = MAX(N, 0);
+}
@@ -0,0 +1,488 @@
+#if defined(_OPENMP) && defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <binnedBLAS.h>
+
+#include "../common/common.h"
+#include "../../config.h"
+
+#ifdef _OPENMP
+
+/**
+ * @internal
+ * @brief Number of times an idle worker polls for a new job (yielding the processor in between) before it sleeps
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+#define POOLSPIN 4096
+
+/**
+ * @internal
+ * @brief A thread of the pool and the range of tasks [head, tail) it has yet to run
+ *
+ * Slot 0 belongs to the thread that called #binnedBLAS_parallel(), and slot t > 0 to worker t.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct binnedBLAS_slot_{
+  pthread_mutex_t lock;
+  int head;
+  int tail;
+  int thread;
+  unsigned int go;
+  int pinned;
+} binnedBLAS_slot;
+
+static pthread_mutex_t submit_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t sleep_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sleep_cond = PTHREAD_COND_INITIALIZER;
+static int sleepers = 0;
+static int initialized = 0;
+
+static binnedBLAS_slot **slots = NULL;
+static int num_workers = 0;
+
+static void (*job_task)(void *args, const int i, const int thread);
+static void *job_args;
+static int job_threads;
+static unsigned int job_generation = 0;
+static int job_pending;
+
+static int *affinity = NULL;
+static int num_affinity = 0;
+static int affinity_generation = 1;
+#ifdef __linux__
+static cpu_set_t default_affinity;
+#endif
+
+static __thread int in_pool = 0;
+
+/**
+ * @internal
+ * @brief Parse a list of CPUs such as "0,2,4-7"
+ *
+ * @param list the list of CPUs
+ * @param cpus the CPUs (allocated by this function, or NULL if there are none)
+ * @return the number of CPUs
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedBLAS_parse_cpus(const char *list, int **cpus){
+  char *end;
+  int n = 0;
+  int capacity = 0;
+  long lo;
+  long hi;
+
+  *cpus = NULL;
+  while(*list != '\0'){
+    lo = strtol(list, &end, 10);
+    if(end == list || lo < 0){
+      break;
+    }
+    hi = lo;
+    list = end;
+    if(*list == '-'){
+      hi = strtol(list + 1, &end, 10);
+      if(end == list + 1 || hi < lo){
+        break;
+      }
+      list = end;
+    }
+    for(; lo <= hi; lo++){
+      if(n == capacity){
+        capacity = MAX(2 * capacity, 8);
+        *cpus = (int*)realloc(*cpus, capacity * sizeof(int));
+      }
+      (*cpus)[n++] = (int)lo;
+    }
+    if(*list == ','){
+      list++;
+    }
+  }
+  return n;
+}
+
+/**
+ * @internal
+ * @brief Pin the calling worker to its CPU (if the affinity has changed since it was last pinned)
+ *
+ * Worker t is pinned to the CPU (t mod n) of the list of n CPUs set with #binnedBLAS_set_thread_affinity(). If the list is empty, the worker may run on any CPU the process could when the pool was started.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void binnedBLAS_pin(binnedBLAS_slot *slot){
+#ifdef __linux__
+  cpu_set_t set;
+
+  if(slot->pinned == affinity_generation){
+    return;
+  }
+  if(num_affinity > 0){
+    CPU_ZERO(&set);
+    CPU_SET(affinity[slot->thread % num_affinity], &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+  }else{
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &default_affinity);
+  }
+#endif
+  slot->pinned = affinity_generation;
+}
+
+/**
+ * @internal
+ * @brief Run the tasks of the current job until there are none left to run or steal
+ *
+ * Tasks are taken one at a time from the front of the thread's own range. When it is empty, the back half of the range of another thread is stolen.
+ *
+ * @param t the thread (slot) number
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void binnedBLAS_run(const int t){
+  binnedBLAS_slot *own = slots[t];
+  binnedBLAS_slot *victim;
+  int i;
+  int v;
+  int head;
+  int tail;
+
+  in_pool = 1;
+  while(1){
+    pthread_mutex_lock(&own->lock);
+    i = own->head;
+    if(i < own->tail){
+      own->head++;
+      pthread_mutex_unlock(&own->lock);
+      job_task(job_args, i, t);
+      continue;
+    }
+    pthread_mutex_unlock(&own->lock);
+
+    head = 0;
+    tail = 0;
+    for(v = 1; v < job_threads && head == tail; v++){
+      victim = slots[(t + v) % job_threads];
+      pthread_mutex_lock(&victim->lock);
+      if(victim->head < victim->tail){
+        tail = victim->tail;
+        head = victim->head + (victim->tail - victim->head) / 2;
+        victim->tail = head;
+      }
+      pthread_mutex_unlock(&victim->lock);
+    }
+    if(head == tail){
+      break;
+    }
+    pthread_mutex_lock(&own->lock);
+    own->head = head;
+    own->tail = tail;
+    pthread_mutex_unlock(&own->lock);
+  }
+  in_pool = 0;
+}
+
+/**
+ * @internal
+ * @brief Main loop of a worker thread
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void *binnedBLAS_worker(void *arg){
+  binnedBLAS_slot *slot = (binnedBLAS_slot*)arg;
+  unsigned int seen = 0;
+  int spin;
+
+  while(1){
+    for(spin = 0; spin < POOLSPIN && __atomic_load_n(&slot->go, __ATOMIC_ACQUIRE) == seen; spin++){
+      sched_yield();
+    }
+    if(__atomic_load_n(&slot->go, __ATOMIC_ACQUIRE) == seen){
+      pthread_mutex_lock(&sleep_lock);
+      sleepers++;
+      while(__atomic_load_n(&slot->go, __ATOMIC_ACQUIRE) == seen){
+        pthread_cond_wait(&sleep_cond, &sleep_lock);
+      }
+      sleepers--;
+      pthread_mutex_unlock(&sleep_lock);
+    }
+    seen = __atomic_load_n(&slot->go, __ATOMIC_ACQUIRE);
+    binnedBLAS_pin(slot);
+    binnedBLAS_run(slot->thread);
+    __atomic_sub_fetch(&job_pending, 1, __ATOMIC_RELEASE);
+  }
+  return NULL;
+}
+
+/**
+ * @internal
+ * @brief Forget the workers in a child process (they are not copied by fork())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void binnedBLAS_atfork_child(void){
+  slots = NULL;
+  num_workers = 0;
+  sleepers = 0;
+  pthread_mutex_init(&submit_lock, NULL);
+  pthread_mutex_init(&sleep_lock, NULL);
+  pthread_cond_init(&sleep_cond, NULL);
+}
+
+/**
+ * @internal
+ * @brief Allocate a slot
+ *
+ * Slots are aligned to (and padded to a multiple of) #CACHELINE bytes so that threads polling their own slots do not share cache lines.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static binnedBLAS_slot *binnedBLAS_slot_alloc(const int t){
+  binnedBLAS_slot *slot;
+
+  if(posix_memalign((void**)&slot, CACHELINE, (sizeof(binnedBLAS_slot) + CACHELINE - 1) / CACHELINE * CACHELINE) != 0){
+    return NULL;
+  }
+  pthread_mutex_init(&slot->lock, NULL);
+  slot->head = 0;
+  slot->tail = 0;
+  slot->thread = t;
+  slot->go = 0;
+  slot->pinned = 0;
+  return slot;
+}
+
+/**
+ * @internal
+ * @brief Make sure the pool has at least N workers (must be called with submit_lock held)
+ *
+ * @param N number of workers
+ * @return the number of workers (less than N if threads could not be created)
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedBLAS_pool_reserve(const int N){
+  char *env;
+  pthread_t thread;
+  pthread_attr_t attr;
+  int t;
+
+  if(!initialized){
+    pthread_atfork(NULL, NULL, &binnedBLAS_atfork_child);
+#ifdef __linux__
+    sched_getaffinity(0, sizeof(cpu_set_t), &default_affinity);
+#endif
+    if(affinity == NULL){
+      env = getenv("REPROBLAS_AFFINITY");
+      if(env != NULL){
+        num_affinity = binnedBLAS_parse_cpus(env, &affinity);
+      }
+    }
+    initialized = 1;
+  }
+  if(N <= num_workers){
+    return num_workers;
+  }
+  if(slots == NULL){
+    slots = (binnedBLAS_slot**)malloc((N + 1) * sizeof(binnedBLAS_slot*));
+    slots[0] = binnedBLAS_slot_alloc(0);
+  }else{
+    slots = (binnedBLAS_slot**)realloc(slots, (N + 1) * sizeof(binnedBLAS_slot*));
+  }
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+  for(t = num_workers + 1; t <= N; t++){
+    slots[t] = binnedBLAS_slot_alloc(t);
+    if(slots[t] == NULL){
+      break;
+    }
+    if(pthread_create(&thread, &attr, &binnedBLAS_worker, slots[t]) != 0){
+      free(slots[t]);
+      break;
+    }
+    num_workers = t;
+  }
+  pthread_attr_destroy(&attr);
+  return num_workers;
+}
+
+#endif
+
+/**
+ * @brief Run tasks on the library's pool of worker threads
+ *
+ * Calls task(args, i, thread) once for each i in [0, num_tasks), on the calling thread and at most num_threads - 1 workers of a pool shared by all threaded ReproBLAS routines. thread is a number in [0, num_threads) identifying the thread running the task (the calling thread is 0), so that tasks may share per-thread workspace. Returns once all tasks have completed.
+ *
+ * The workers are started the first time they are needed and persist for the life of the process, so a call costs no thread creation. Each thread starts with a contiguous range of tasks, and a thread that runs out of tasks steals half of the remaining range of another. Idle workers briefly poll for new work before they sleep.
+ *
+ * Tasks run on the calling thread alone if num_threads or num_tasks is 1, if the call is made from within a task, or if the pool is busy with a call from another thread. If ReproBLAS was built without OpenMP, tasks always run on the calling thread.
+ *
+ * @param num_threads maximum number of threads
+ * @param num_tasks number of tasks
+ * @param task function to call for each task
+ * @param args argument to pass to task
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedBLAS_parallel(const int num_threads, const int num_tasks, void (*task)(void *args, const int i, const int thread), void *args){
+  int i;
+#ifdef _OPENMP
+  int threads = MIN(num_threads, num_tasks);
+  int t;
+
+  if(threads > 1 && !in_pool && pthread_mutex_trylock(&submit_lock) == 0){
+    threads = MIN(threads, binnedBLAS_pool_reserve(threads - 1) + 1);
+    if(threads > 1){
+      job_task = task;
+      job_args = args;
+      job_threads = threads;
+      job_generation++;
+      __atomic_store_n(&job_pending, threads - 1, __ATOMIC_RELAXED);
+      for(t = 0; t < threads; t++){
+        slots[t]->head = (int)(((long long)num_tasks * t) / threads);
+        slots[t]->tail = (int)(((long long)num_tasks * (t + 1)) / threads);
+      }
+      for(t = 1; t < threads; t++){
+        __atomic_store_n(&slots[t]->go, job_generation, __ATOMIC_RELEASE);
+      }
+      pthread_mutex_lock(&sleep_lock);
+      if(sleepers > 0){
+        pthread_cond_broadcast(&sleep_cond);
+      }
+      pthread_mutex_unlock(&sleep_lock);
+
+      binnedBLAS_run(0);
+      while(__atomic_load_n(&job_pending, __ATOMIC_ACQUIRE) > 0){
+        sched_yield();
+      }
+      pthread_mutex_unlock(&submit_lock);
+      return;
+    }
+    pthread_mutex_unlock(&submit_lock);
+  }
+#else
+  (void)num_threads;
+#endif
+  for(i = 0; i < num_tasks; i++){
+    task(args, i, 0);
+  }
+}
+
+/**
+ * @brief Set the CPUs that the worker threads run on
+ *
+ * Worker t (for t = 1, 2, ... since the calling thread is thread 0) of the pool used by #binnedBLAS_parallel() is pinned to CPU cpus[t mod N]. If N is 0, workers may run on any CPU the process could when the pool was started. The calling thread is never pinned.
+ *
+ * The setting overrides the @c REPROBLAS_AFFINITY environment variable, a list of CPUs such as @c 0,2,4-7. This has no effect unless ReproBLAS was built with OpenMP.
+ *
+ * @param N number of CPUs
+ * @param cpus CPU numbers
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedBLAS_set_thread_affinity(const int N, const int *cpus){
+#ifdef _OPENMP
+  pthread_mutex_lock(&submit_lock);
+  free(affinity);
+  affinity = (int*)malloc(MAX(N, 1) * sizeof(int));
+  num_affinity = MAX(N, 0);
+  if(num_affinity > 0){
+    memcpy(affinity, cpus, num_affinity * sizeof(int));
+  }
+  affinity_generation++;
+  pthread_mutex_unlock(&submit_lock);
+#else
+  (void)N;
+  (void)cpus;
+#endif
+}
+
+/**
+ * @internal
+ * @brief Get the number of threads to use for a reduction
+ *
+ * Returns the number of blocks (one per thread) that a reduction of N elements should be split into. Each block has at least #binnedBLAS_get_thread_grain() elements, and nested calls from within a parallel region or a task of #binnedBLAS_parallel() use only the calling thread.
+ *
+ * @param N number of elements to reduce
+ * @return number of threads
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+int binnedBLAS_nthreads(const int N){
+#ifdef _OPENMP
+  if(in_pool || omp_in_parallel()){
+    return 1;
+  }
+  return MAX(MIN(binnedBLAS_get_num_threads(), N / binnedBLAS_get_thread_grain()), 1);
+#else
+  (void)N;
+  return 1;
+#endif
+}
+
+/**
+ * @internal
+ * @brief Greatest common divisor of two nonnegative numbers (not both zero)
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedBLAS_gcd(int a, int b){
+  int c;
+
+  while(b != 0){
+    c = a % b;
+    a = b;
+    b = c;
+  }
+  return a;
+}
+
+/**
+ * @internal
+ * @brief Get the size of the blocks to split a dimension into, one per thread
+ *
+ * Returns the smallest multiple of block which splits N indices into at most num_threads blocks, and which is also (if possible without exceeding N) a multiple of the number of indices spanning a whole number of cache lines when consecutive indices are stride bytes apart. If the array is aligned to #CACHELINE bytes, no cache line then holds elements of two blocks, so threads that write to their own blocks share no cache lines.
+ *
+ * @param N number of indices
+ * @param num_threads number of threads
+ * @param block a number the block size must be a multiple of
+ * @param stride distance (in bytes) between consecutive indices
+ * @return block size
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+int binnedBLAS_partition(const int N, const int num_threads, const int block, const size_t stride){
+  int size = ((N + num_threads - 1) / num_threads + block - 1) / block * block;
+  int line = CACHELINE / binnedBLAS_gcd(CACHELINE, stride % CACHELINE);
+  int unit = block / binnedBLAS_gcd(block, line) * line;
+  int aligned = (size + unit - 1) / unit * unit;
+
+  if(aligned < N){
+    return aligned;
+  }
+  return size;
+}
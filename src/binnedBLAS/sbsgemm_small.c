@@ -0,0 +1,97 @@
+#include <binnedBLAS.h>
+
+/**
+ * @internal
+ * @brief Add to binned single precision matrix C the matrix-matrix product of small single precision matrices A and B using caller-provided workspace
+ *
+ * Performs the same operation as #binnedBLAS_sbsgemm(), with the same result, but on the calling thread and without allocating memory. alpha*op(A) and op(B) are packed (when needed) into @p work so that the rows of op(A) and the columns of op(B) are contiguous, and the whole product is accumulated with #binnedBLAS_sbsgemmk(), which keeps the maxima of the rows of op(A) and the columns of op(B) in the last M + N elements of @p work.
+ *
+ * @param fold the fold of the binned types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B single precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C binned single precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ * @param work workspace of at least (M + N) * (K + 1) single precision elements
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedBLAS_sbsgemm_small(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const float alpha, const float *A, const int lda,
+             const float *B, const int ldb,
+             float_binned *C, const int ldc, float *work){
+  const float *opA;
+  const float *opB;
+  int ldopA;
+  int ldopB;
+  int rowA;
+  int colB;
+  int i;
+  int j;
+  int k;
+
+  //early returns
+  if(M == 0 || N == 0 || K == 0 || alpha == 0.0){
+    return;
+  }
+
+  //rowA (colB) is set if the rows of op(A) (columns of op(B)) are contiguous
+  switch(Order){
+    case 'r':
+    case 'R':
+      rowA = (TransA == 'n' || TransA == 'N');
+      colB = !(TransB == 'n' || TransB == 'N');
+      break;
+    default:
+      rowA = !(TransA == 'n' || TransA == 'N');
+      colB = (TransB == 'n' || TransB == 'N');
+      break;
+  }
+
+  if(rowA && alpha == 1.0){
+    opA = A;
+    ldopA = lda;
+  }else{
+    for(i = 0; i < M; i++){
+      for(k = 0; k < K; k++){
+        work[i * K + k] = (rowA ? A[i * lda + k] : A[k * lda + i]) * alpha;
+      }
+    }
+    opA = work;
+    ldopA = K;
+  }
+
+  if(colB){
+    opB = B;
+    ldopB = ldb;
+  }else{
+    for(j = 0; j < N; j++){
+      for(k = 0; k < K; k++){
+        work[M * K + j * K + k] = B[k * ldb + j];
+      }
+    }
+    opB = work + M * K;
+    ldopB = K;
+  }
+
+  switch(Order){
+    case 'r':
+    case 'R':
+      binnedBLAS_sbsgemmk(fold, M, N, K, opA, ldopA, opB, ldopB, C, ldc, 1, work + (M + N) * K);
+      break;
+    default:
+      binnedBLAS_sbsgemmk(fold, M, N, K, opA, ldopA, opB, ldopB, C, 1, ldc, work + (M + N) * K);
+      break;
+  }
+}
@@ -0,0 +1,136 @@
+#include <stdlib.h>
+#include <string.h>
+#if defined(reproBLAS_DISPATCH)
+#include <pthread.h>
+#endif
+
+#include <binnedBLAS.h>
+
+#include "../common/common.h"
+#include "../../config.h"
+
+static int vectorization = -1;
+#if defined(reproBLAS_DISPATCH)
+static int env_vectorization = -2;
+static int cpu_vectorization = -1;
+static pthread_mutex_t vectorization_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * @internal
+ * @brief Get the best instruction set supported by the running processor
+ *
+ * With runtime dispatch, the processor is queried once, by the first caller (the operating system must also support the corresponding register state). Without runtime dispatch, the instruction set the kernels were compiled for is returned.
+ *
+ * @return one of #reproBLAS_SISD, #reproBLAS_SSE, #reproBLAS_AVX, #reproBLAS_AVX2, or #reproBLAS_AVX512
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedBLAS_cpu_vectorization(void){
+#if defined(reproBLAS_DISPATCH)
+  int cpu;
+
+  cpu = __atomic_load_n(&cpu_vectorization, __ATOMIC_ACQUIRE);
+  if(cpu < 0){
+    pthread_mutex_lock(&vectorization_lock);
+    cpu = cpu_vectorization;
+    if(cpu < 0){
+      __builtin_cpu_init();
+      if(__builtin_cpu_supports("avx512f")){
+        cpu = reproBLAS_AVX512;
+      }else if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")){
+        cpu = reproBLAS_AVX2;
+      }else if(__builtin_cpu_supports("avx")){
+        cpu = reproBLAS_AVX;
+      }else if(__builtin_cpu_supports("sse2")){
+        cpu = reproBLAS_SSE;
+      }else{
+        cpu = reproBLAS_SISD;
+      }
+      __atomic_store_n(&cpu_vectorization, cpu, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&vectorization_lock);
+  }
+  return cpu;
+#elif (defined(__AVX512F__) && !defined(reproBLAS_no__AVX512F__))
+  return reproBLAS_AVX512;
+#elif (defined(__AVX2__) && defined(__FMA__) && !defined(reproBLAS_no__AVX__))
+  return reproBLAS_AVX2;
+#elif (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+  return reproBLAS_AVX;
+#elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+  return reproBLAS_SSE;
+#else
+  return reproBLAS_SISD;
+#endif
+}
+
+/**
+ * @brief Get the instruction set used by vectorized kernels
+ *
+ * If ReproBLAS was built with runtime dispatch, the instruction set is the one set with #binnedBLAS_set_vectorization(), or if that has not been set, the one named by the @c REPROBLAS_VECTORIZATION environment variable (@c SISD, @c SSE, @c AVX, @c AVX2, or @c AVX512), or if that is not set, the best one supported by the processor. A requested instruction set that the processor does not support is lowered to the best one that it does. Without runtime dispatch, the instruction set the kernels were compiled for is always returned.
+ *
+ * The results of all ReproBLAS routines are independent of the instruction set.
+ *
+ * @return one of #reproBLAS_SISD, #reproBLAS_SSE, #reproBLAS_AVX, #reproBLAS_AVX2, or #reproBLAS_AVX512
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+int binnedBLAS_get_vectorization(void){
+#if defined(reproBLAS_DISPATCH)
+  char *env;
+  int requested;
+
+  if(vectorization >= 0){
+    return MIN(vectorization, binnedBLAS_cpu_vectorization());
+  }
+  //the environment is read once, by the first caller
+  requested = __atomic_load_n(&env_vectorization, __ATOMIC_ACQUIRE);
+  if(requested < -1){
+    pthread_mutex_lock(&vectorization_lock);
+    requested = env_vectorization;
+    if(requested < -1){
+      env = getenv("REPROBLAS_VECTORIZATION");
+      if(env == NULL){
+        requested = -1;
+      }else if(strcmp(env, "AVX512") == 0){
+        requested = reproBLAS_AVX512;
+      }else if(strcmp(env, "AVX2") == 0){
+        requested = reproBLAS_AVX2;
+      }else if(strcmp(env, "AVX") == 0){
+        requested = reproBLAS_AVX;
+      }else if(strcmp(env, "SSE") == 0){
+        requested = reproBLAS_SSE;
+      }else if(strcmp(env, "SISD") == 0){
+        requested = reproBLAS_SISD;
+      }else{
+        requested = -1;
+      }
+      __atomic_store_n(&env_vectorization, requested, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&vectorization_lock);
+  }
+  if(requested >= 0){
+    return MIN(requested, binnedBLAS_cpu_vectorization());
+  }
+#endif
+  return binnedBLAS_cpu_vectorization();
+}
+
+/**
+ * @brief Set the instruction set used by vectorized kernels
+ *
+ * The setting overrides the @c REPROBLAS_VECTORIZATION environment variable. If @p V is negative, the default instruction set is restored (see #binnedBLAS_get_vectorization()). This has no effect unless ReproBLAS was built with runtime dispatch.
+ *
+ * The results of all ReproBLAS routines are independent of the instruction set.
+ *
+ * @param V one of #reproBLAS_SISD, #reproBLAS_SSE, #reproBLAS_AVX, #reproBLAS_AVX2, or #reproBLAS_AVX512
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedBLAS_set_vectorization(const int V){
+  vectorization = MIN(MAX(V, -1), reproBLAS_AVX512);
+}
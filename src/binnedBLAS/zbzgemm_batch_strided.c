@@ -0,0 +1,136 @@
+#include <stddef.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include <binnedBLAS.h>
+
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #binnedBLAS_zbzgemm_batch_strided_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  char Order;
+  char TransA;
+  char TransB;
+  int M;
+  int N;
+  int K;
+  const void *alpha;
+  const void *A;
+  int lda;
+  int strideA;
+  const void *B;
+  int ldb;
+  int strideB;
+  double_complex_binned *C;
+  int ldc;
+  int strideC;
+  double **works;
+} binnedBLAS_zbzgemm_batch_strided_args;
+
+/**
+ * @internal
+ * @brief Compute product b of the batch (a task of #binnedBLAS_zbzgemm_batch_strided())
+ *
+ * Each thread allocates its workspace the first time it runs a task.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void binnedBLAS_zbzgemm_batch_strided_task(void *args, const int b, const int thread){
+  binnedBLAS_zbzgemm_batch_strided_args *a = (binnedBLAS_zbzgemm_batch_strided_args*)args;
+  double *work;
+
+  if(a->works[thread] == NULL){
+    a->works[thread] = (double*)malloc((a->M + a->N) * a->K * 2 * sizeof(double));
+  }
+  work = a->works[thread];
+
+  binnedBLAS_zbzgemm_small(a->fold, a->Order, a->TransA, a->TransB, a->M, a->N, a->K, a->alpha, (const double*)a->A + 2 * (ptrdiff_t)b * a->strideA, a->lda, (const double*)a->B + 2 * (ptrdiff_t)b * a->strideB, a->ldb, a->C + (ptrdiff_t)b * a->strideC * binned_zbnum(a->fold), a->ldc, work);
+}
+
+/**
+ * @brief Add to each binned complex double precision matrix in a strided batch the matrix-matrix product of the corresponding complex double precision matrices
+ *
+ * For b < batch_count, performs one of the matrix-matrix operations
+ *
+ *   C_b := alpha*op(A_b)*op(B_b) + C_b,
+ *
+ * where A_b = A + b * strideA, B_b = B + b * strideB and C_b = C + b * strideC, and op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H.
+ *
+ * All matrices of the batch have the same dimensions and leading dimensions. A stride of 0 reuses the same matrix for every product.
+ *
+ * The products are computed with #binnedBLAS_zbzgemm_small(), reusing one workspace of (M + N) * K complex elements per thread for the whole batch. Entries of the batch are spread across threads, and the result of each entry is the same as that of #binnedBLAS_zbzgemm(), regardless of the number of threads.
+ *
+ * @param fold the fold of the binned types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A_b) and of the matrix C_b.
+ * @param N number of columns of matrix op(B_b) and of the matrix C_b.
+ * @param K number of columns of matrix op(A_b) and columns of the matrix op(B_b).
+ * @param alpha scalar alpha
+ * @param A complex double precision matrices of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A_b as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param strideA distance (in elements) between A_b and A_(b + 1)
+ * @param B complex double precision matrices of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B_b as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param strideB distance (in elements) between B_b and B_(b + 1)
+ * @param C binned complex double precision matrices of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C_b as declared in the calling program. ldc must be at least N in row major or M in column major.
+ * @param strideC distance (in binned elements) between C_b and C_(b + 1)
+ * @param batch_count number of products
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedBLAS_zbzgemm_batch_strided(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const void *alpha, const void *A, const int lda, const int strideA,
+             const void *B, const int ldb, const int strideB,
+             double_complex_binned *C, const int ldc, const int strideC,
+             const int batch_count){
+  int num_threads;
+  binnedBLAS_zbzgemm_batch_strided_args args;
+  int t;
+
+  if(M == 0 || N == 0 || K == 0 || (((double*)alpha)[0] == 0.0 && ((double*)alpha)[1] == 0.0) || batch_count <= 0){
+    return;
+  }
+
+  num_threads = binnedBLAS_nthreads((int)MIN((double)M * N * K * batch_count, (double)INT_MAX));
+  num_threads = MIN(num_threads, batch_count);
+
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.TransB = TransB;
+  args.M = M;
+  args.N = N;
+  args.K = K;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.strideA = strideA;
+  args.B = B;
+  args.ldb = ldb;
+  args.strideB = strideB;
+  args.C = C;
+  args.ldc = ldc;
+  args.strideC = strideC;
+  args.works = (double**)calloc(num_threads, sizeof(double*));
+  binnedBLAS_parallel(num_threads, batch_count, &binnedBLAS_zbzgemm_batch_strided_task, &args);
+  for(t = 0; t < num_threads; t++){
+    free(args.works[t]);
+  }
+  free(args.works);
+}
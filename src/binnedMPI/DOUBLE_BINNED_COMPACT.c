@@ -0,0 +1,67 @@
+#include <mpi.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include <binned.h>
+#include <binnedMPI.h>
+
+#include "../../config.h"
+
+static MPI_Datatype types[binned_DBMAXFOLD + 1];
+static int types_initialized[binned_DBMAXFOLD + 1]; //initializes to 0
+static pthread_mutex_t types_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief  Get an MPI_DATATYPE representing packed binned double precision.
+ *
+ * Creates (if it has not already been created) and returns a datatype handle
+ * for an MPI datatype that represents a packed binned double precision type
+ * (see #binnedMPI_dbpack()).
+ *
+ * This method may call @c MPI_Type_contiguous() and @c MPI_Type_commit().
+ * If there is an error, this method will call @c MPI_Abort().
+ *
+ * @param fold the fold of the binned types
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+MPI_Datatype binnedMPI_DOUBLE_BINNED_COMPACT(const int fold){
+  int rc;
+  if(!__atomic_load_n(types_initialized + fold, __ATOMIC_ACQUIRE)){
+    pthread_mutex_lock(&types_lock);
+    if(types_initialized[fold]){
+      pthread_mutex_unlock(&types_lock);
+      return types[fold];
+    }
+    rc = MPI_Type_contiguous((int)binnedMPI_dbpacksize(fold), MPI_BYTE, types + fold);
+    if(rc != MPI_SUCCESS){
+      if (rc == MPI_ERR_TYPE) {
+        fprintf(stderr, "[%s.%d] ReproBLAS error: MPI_Type_contiguous error: MPI_ERR_TYPE\n", __FILE__, __LINE__);
+      } else if (rc == MPI_ERR_COUNT) {
+        fprintf(stderr, "[%s.%d] ReproBLAS error: MPI_Type_contiguous error: MPI_ERR_COUNT\n", __FILE__, __LINE__);
+      } else if (rc == MPI_ERR_INTERN) {
+        fprintf(stderr, "[%s.%d] ReproBLAS error: MPI_Type_contiguous error: MPI_ERR_INTERN\n", __FILE__, __LINE__);
+      } else {
+        fprintf(stderr, "[%s.%d] ReproBLAS error: MPI_Type_contiguous error: %d\n", __FILE__, __LINE__, rc);
+      }
+      pthread_mutex_unlock(&types_lock);
+      MPI_Abort(MPI_COMM_WORLD, rc);
+      return 0;
+    }
+    rc = MPI_Type_commit(types + fold);
+    if(rc != MPI_SUCCESS){
+      if (rc == MPI_ERR_TYPE) {
+        fprintf(stderr, "[%s.%d] ReproBLAS error: MPI_Type_commit error: MPI_ERR_TYPE\n", __FILE__, __LINE__);
+      } else {
+        fprintf(stderr, "[%s.%d] ReproBLAS error: MPI_Type_commit error: %d\n", __FILE__, __LINE__, rc);
+      }
+      pthread_mutex_unlock(&types_lock);
+      MPI_Abort(MPI_COMM_WORLD, rc);
+      return 0;
+    }
+    __atomic_store_n(types_initialized + fold, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&types_lock);
+  }
+  return types[fold];
+}
@@ -1,4 +1,5 @@
 #include <mpi.h>
+#include <pthread.h>
 #include <stdio.h>
 
 #include <binned.h>
@@ -8,6 +9,7 @@
 
 static MPI_Datatype types[binned_SBMAXFOLD + 1];
 static int types_initialized[binned_SBMAXFOLD + 1]; //initializes to 0
+static pthread_mutex_t types_lock = PTHREAD_MUTEX_INITIALIZER;
 
 /**
  * @brief  Get an MPI_DATATYPE representing binned single precision.
@@ -25,7 +27,12 @@ static int types_initialized[binned_SBMAXFOLD + 1]; //initializes to 0
  */
 MPI_Datatype binnedMPI_FLOAT_BINNED(const int fold){
   int rc;
-  if(!types_initialized[fold]){
+  if(!__atomic_load_n(types_initialized + fold, __ATOMIC_ACQUIRE)){
+    pthread_mutex_lock(&types_lock);
+    if(types_initialized[fold]){
+      pthread_mutex_unlock(&types_lock);
+      return types[fold];
+    }
     rc = MPI_Type_contiguous(binned_sbnum(fold), MPI_FLOAT, types + fold);
     if(rc != MPI_SUCCESS){
       if (rc == MPI_ERR_TYPE) {
@@ -37,6 +44,7 @@ MPI_Datatype binnedMPI_FLOAT_BINNED(const int fold){
       } else {
         fprintf(stderr, "[%s.%d] ReproBLAS error: MPI_Type_contiguous error: %d\n", __FILE__, __LINE__, rc);
       }
+      pthread_mutex_unlock(&types_lock);
       MPI_Abort(MPI_COMM_WORLD, rc);
       return 0;
     }
@@ -47,10 +55,12 @@ MPI_Datatype binnedMPI_FLOAT_BINNED(const int fold){
       } else {
         fprintf(stderr, "[%s.%d] ReproBLAS error: MPI_Type_commit error: %d\n", __FILE__, __LINE__, rc);
       }
+      pthread_mutex_unlock(&types_lock);
       MPI_Abort(MPI_COMM_WORLD, rc);
       return 0;
     }
-    types_initialized[fold] = 1;
+    __atomic_store_n(types_initialized + fold, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&types_lock);
   }
   return types[fold];
 }
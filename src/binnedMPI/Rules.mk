@@ -8,15 +8,18 @@ INSTALL_LIB := $(TARGETS)
 
 LIBBINNEDMPI := $(OBJPATH)/libbinnedmpi.a
 
+ifeq ($(BUILD_MPI),true)
 LDFLAGS += $(MPILDFLAGS)
 CFLAGS += $(MPICFLAGS)
+endif
 
 COGGED = DBDBADD.ccog \
          ZBZBADD.ccog \
          DBDBADDSQ.ccog \
          SBSBADD.ccog \
          CBCBADD.ccog \
-         SBSBADDSQ.ccog
+         SBSBADDSQ.ccog \
+         DBDBADD_COMPACT.ccog
 
 libbinnedmpi.a_DEPS = $$(LIBBINNED) DOUBLE_BINNED.o \
                                 DOUBLE_COMPLEX_BINNED.o \
@@ -29,4 +32,10 @@ libbinnedmpi.a_DEPS = $$(LIBBINNED) DOUBLE_BINNED.o \
                                 DBDBADDSQ.o \
                                 SBSBADD.o \
                                 CBCBADD.o \
-                                SBSBADDSQ.o
+                                SBSBADDSQ.o \
+                                DOUBLE_BINNED_COMPACT.o \
+                                DBDBADD_COMPACT.o \
+                                dbpacksize.o \
+                                dbpack.o \
+                                dbunpack.o \
+                                allreduce.o
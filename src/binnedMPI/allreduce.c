@@ -0,0 +1,268 @@
+#include <mpi.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <binnedMPI.h>
+
+#include "../../config.h"
+
+/**
+ * @internal
+ * @brief Communicators and shared memory used by #binnedMPI_allreduce() on a communicator
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct binnedMPI_hierarchy_{
+  MPI_Comm comm;
+  struct binnedMPI_hierarchy_ *next;
+  MPI_Comm node;
+  MPI_Comm leaders;
+  int node_rank;
+  int node_size;
+  int flat;
+  MPI_Win win;
+  char *base;
+  MPI_Aint capacity;
+} binnedMPI_hierarchy;
+
+static int keyval = MPI_KEYVAL_INVALID;
+static int finalize_keyval = MPI_KEYVAL_INVALID;
+static binnedMPI_hierarchy *hierarchies = NULL;
+static pthread_mutex_t hierarchies_lock = PTHREAD_MUTEX_INITIALIZER;
+
+#define CHECK(call) do{\
+  int rc = (call);\
+  if(rc != MPI_SUCCESS){\
+    fprintf(stderr, "[%s.%d] ReproBLAS error: %s error: %d\n", __FILE__, __LINE__, #call, rc);\
+    MPI_Abort(MPI_COMM_WORLD, rc);\
+    return rc;\
+  }\
+}while(0)
+
+/**
+ * @internal
+ * @brief Free the shared memory window of a hierarchy
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedMPI_hierarchy_free_window(binnedMPI_hierarchy *hierarchy){
+  if(hierarchy->capacity > 0){
+    CHECK(MPI_Win_unlock_all(hierarchy->win));
+    CHECK(MPI_Win_free(&hierarchy->win));
+    hierarchy->base = NULL;
+    hierarchy->capacity = 0;
+  }
+  return MPI_SUCCESS;
+}
+
+/**
+ * @internal
+ * @brief Free a hierarchy when its communicator is freed
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedMPI_hierarchy_delete(MPI_Comm comm, int comm_keyval, void *attribute_val, void *extra_state){
+  binnedMPI_hierarchy *hierarchy = (binnedMPI_hierarchy*)attribute_val;
+  binnedMPI_hierarchy **link;
+  (void)comm;
+  (void)comm_keyval;
+  (void)extra_state;
+
+  pthread_mutex_lock(&hierarchies_lock);
+  for(link = &hierarchies; *link != hierarchy; link = &(*link)->next);
+  *link = hierarchy->next;
+  pthread_mutex_unlock(&hierarchies_lock);
+  CHECK(binnedMPI_hierarchy_free_window(hierarchy));
+  if(hierarchy->leaders != MPI_COMM_NULL){
+    CHECK(MPI_Comm_free(&hierarchy->leaders));
+  }
+  CHECK(MPI_Comm_free(&hierarchy->node));
+  free(hierarchy);
+  return MPI_SUCCESS;
+}
+
+/**
+ * @internal
+ * @brief Free all hierarchies when MPI is finalized
+ *
+ * MPI_Finalize() deletes the attributes of @c MPI_COMM_SELF before any others, while MPI is still fully usable. Hierarchies are freed then, in the (collective) order they were created.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedMPI_hierarchy_finalize(MPI_Comm comm, int comm_keyval, void *attribute_val, void *extra_state){
+  (void)comm;
+  (void)comm_keyval;
+  (void)attribute_val;
+  (void)extra_state;
+
+  while(hierarchies != NULL){
+    CHECK(MPI_Comm_delete_attr(hierarchies->comm, keyval));
+  }
+  return MPI_SUCCESS;
+}
+
+/**
+ * @internal
+ * @brief Get (creating and caching it if necessary) the hierarchy of a communicator
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedMPI_hierarchy_get(MPI_Comm comm, binnedMPI_hierarchy **hierarchy){
+  int rank;
+  int found;
+  int new_keyval;
+  binnedMPI_hierarchy *new_hierarchy;
+
+  if(__atomic_load_n(&keyval, __ATOMIC_ACQUIRE) == MPI_KEYVAL_INVALID){
+    pthread_mutex_lock(&hierarchies_lock);
+    if(keyval == MPI_KEYVAL_INVALID){
+      CHECK(MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &binnedMPI_hierarchy_finalize, &finalize_keyval, NULL));
+      CHECK(MPI_Comm_set_attr(MPI_COMM_SELF, finalize_keyval, NULL));
+      CHECK(MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &binnedMPI_hierarchy_delete, &new_keyval, NULL));
+      __atomic_store_n(&keyval, new_keyval, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&hierarchies_lock);
+  }
+  CHECK(MPI_Comm_get_attr(comm, keyval, hierarchy, &found));
+  if(found){
+    return MPI_SUCCESS;
+  }
+
+  new_hierarchy = (binnedMPI_hierarchy*)malloc(sizeof(binnedMPI_hierarchy));
+  CHECK(MPI_Comm_rank(comm, &rank));
+  CHECK(MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &new_hierarchy->node));
+  CHECK(MPI_Comm_rank(new_hierarchy->node, &new_hierarchy->node_rank));
+  CHECK(MPI_Comm_size(new_hierarchy->node, &new_hierarchy->node_size));
+  CHECK(MPI_Comm_split(comm, new_hierarchy->node_rank == 0 ? 0 : MPI_UNDEFINED, rank, &new_hierarchy->leaders));
+  CHECK(MPI_Allreduce(&new_hierarchy->node_size, &new_hierarchy->flat, 1, MPI_INT, MPI_MAX, comm));
+  new_hierarchy->flat = (new_hierarchy->flat == 1);
+  new_hierarchy->base = NULL;
+  new_hierarchy->capacity = 0;
+  new_hierarchy->comm = comm;
+  pthread_mutex_lock(&hierarchies_lock);
+  new_hierarchy->next = hierarchies;
+  hierarchies = new_hierarchy;
+  pthread_mutex_unlock(&hierarchies_lock);
+  CHECK(MPI_Comm_set_attr(comm, keyval, new_hierarchy));
+  *hierarchy = new_hierarchy;
+  return MPI_SUCCESS;
+}
+
+/**
+ * @internal
+ * @brief Make the shared memory window of a hierarchy at least capacity bytes long
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedMPI_hierarchy_reserve(binnedMPI_hierarchy *hierarchy, const MPI_Aint capacity){
+  MPI_Aint size;
+  int disp_unit;
+  void *base;
+
+  if(hierarchy->capacity >= capacity){
+    return MPI_SUCCESS;
+  }
+  CHECK(binnedMPI_hierarchy_free_window(hierarchy));
+  CHECK(MPI_Win_allocate_shared(hierarchy->node_rank == 0 ? capacity : 0, 1, MPI_INFO_NULL, hierarchy->node, &base, &hierarchy->win));
+  CHECK(MPI_Win_shared_query(hierarchy->win, 0, &size, &disp_unit, &base));
+  CHECK(MPI_Win_lock_all(MPI_MODE_NOCHECK, hierarchy->win));
+  hierarchy->base = (char*)base;
+  hierarchy->capacity = capacity;
+  return MPI_SUCCESS;
+}
+
+/**
+ * @internal
+ * @brief Synchronize the processes of a node and their views of the shared memory window
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedMPI_hierarchy_fence(binnedMPI_hierarchy *hierarchy){
+  CHECK(MPI_Win_sync(hierarchy->win));
+  CHECK(MPI_Barrier(hierarchy->node));
+  CHECK(MPI_Win_sync(hierarchy->win));
+  return MPI_SUCCESS;
+}
+
+/**
+ * @brief  Node-aware reproducible allreduce
+ *
+ * Combines the values in sendbuf of all processes in comm with op and stores the result in recvbuf of every process, like @c MPI_Allreduce(). Instead of passing the user-defined operation to @c MPI_Allreduce() over all of comm, the reduction is performed in three stages:
+ * -# The processes sharing a node copy their values into a shared memory window, and each one reduces a contiguous chunk of the node's values with @c MPI_Reduce_local().
+ * -# One leader process per node calls @c MPI_Allreduce() on the node results over a communicator of leaders.
+ * -# Every process copies the result from the shared memory window.
+ *
+ * op must be commutative. Because binned operations (such as #binnedMPI_DBDBADD) give the same result in any order, the result is the same as that of @c MPI_Allreduce() over comm.
+ *
+ * If every node has only one process of comm, @c MPI_Allreduce() is called over comm.
+ *
+ * The node and leader communicators and the shared memory window are created on the first call with a given communicator, cached as an attribute of the communicator, and freed when it is freed. Threads may call this method at the same time on different communicators.
+ *
+ * This method may call @c MPI_Comm_split_type(), @c MPI_Comm_split(), @c MPI_Win_allocate_shared(), and @c MPI_Comm_create_keyval().
+ * If there is an error, this method will call @c MPI_Abort().
+ *
+ * @param sendbuf values of this process (may be @c MPI_IN_PLACE)
+ * @param recvbuf result (of size count)
+ * @param count number of elements of datatype in sendbuf and recvbuf
+ * @param datatype a contiguous datatype (such as #binnedMPI_DOUBLE_BINNED)
+ * @param op a commutative operation on datatype (such as #binnedMPI_DBDBADD)
+ * @param comm communicator
+ * @return @c MPI_SUCCESS
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+int binnedMPI_allreduce(const void *sendbuf, void *recvbuf, const int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm){
+  binnedMPI_hierarchy *hierarchy;
+  MPI_Aint lb;
+  MPI_Aint extent;
+  MPI_Aint bytes;
+  int chunk;
+  int offset;
+  int length;
+  int i;
+
+  CHECK(binnedMPI_hierarchy_get(comm, &hierarchy));
+  if(hierarchy->flat){
+    CHECK(MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm));
+    return MPI_SUCCESS;
+  }
+  if(sendbuf == MPI_IN_PLACE){
+    sendbuf = recvbuf;
+  }
+
+  CHECK(MPI_Type_get_extent(datatype, &lb, &extent));
+  bytes = extent * count;
+  CHECK(binnedMPI_hierarchy_reserve(hierarchy, bytes * hierarchy->node_size));
+
+  //stage 1: reduce within the node
+  memcpy(hierarchy->base + bytes * hierarchy->node_rank, sendbuf, bytes);
+  CHECK(binnedMPI_hierarchy_fence(hierarchy));
+  chunk = (count + hierarchy->node_size - 1) / hierarchy->node_size;
+  offset = chunk * hierarchy->node_rank;
+  length = count - offset < chunk ? count - offset : chunk;
+  for(i = 1; i < hierarchy->node_size && length > 0; i++){
+    CHECK(MPI_Reduce_local(hierarchy->base + bytes * i + extent * offset, hierarchy->base + extent * offset, length, datatype, op));
+  }
+  CHECK(binnedMPI_hierarchy_fence(hierarchy));
+
+  //stage 2: reduce across nodes
+  if(hierarchy->leaders != MPI_COMM_NULL){
+    CHECK(MPI_Allreduce(MPI_IN_PLACE, hierarchy->base, count, datatype, op, hierarchy->leaders));
+  }
+  CHECK(binnedMPI_hierarchy_fence(hierarchy));
+
+  //stage 3: share the result within the node
+  memcpy(recvbuf, hierarchy->base, bytes);
+  CHECK(binnedMPI_hierarchy_fence(hierarchy));
+  return MPI_SUCCESS;
+}
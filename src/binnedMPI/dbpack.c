@@ -0,0 +1,111 @@
+#include <math.h>
+#include <mpi.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <binned.h>
+#include <binnedMPI.h>
+
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Check if binned double precision can be packed as is
+ *
+ * @param fold the fold of the binned types
+ * @param X binned scalar X
+ * @param bins the bins of X
+ * @return 1 if the primary fields of X lie in the upper half of their bins and the carry fields of X fit in 32-bit integers, 0 otherwise
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static int binnedMPI_dbpackable(const int fold, const double_binned *X, const double *bins){
+  int j;
+  long_double pri;
+  long_double bin;
+
+  for(j = 0; j < fold; j++){
+    pri.d = X[j];
+    bin.d = bins[j];
+    //the range is checked first because converting an out of range carry to int32_t is undefined
+    if((pri.l & ~((1ull << (DBL_MANT_DIG - 3)) - 1)) != bin.l || !(fabs(X[fold + j]) <= INT32_MAX) || X[fold + j] != (double)(int32_t)X[fold + j]){
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * @brief Pack binned double precision into the compact encoding
+ *
+ * Writes each binned double precision number in X as #binnedMPI_dbpacksize() bytes of C. Each primary field of a renormalized binned number shares its exponent and leading mantissa bits with the corresponding bin, so only its low (@c DBL_MANT_DIG - 3) mantissa bits are stored, in a 64-bit word. The index of the binned number is stored in the remaining high bits of the first word and the carry fields are stored as 32-bit integers. Zero, @c NaN, and @c Inf values are flagged in the index bits.
+ *
+ * If X is not renormalized, a renormalized copy (with the same value) is packed instead, so #binnedMPI_dbunpack() returns the renormalized X. The results of binned functions are always renormalized.
+ *
+ * If a carry field of X does not fit in a 32-bit integer (this requires more than 2^42 summands), this method will call @c MPI_Abort().
+ *
+ * @param fold the fold of the binned types
+ * @param N vector length
+ * @param X binned input vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param C packed output (of size N * #binnedMPI_dbpacksize())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedMPI_dbpack(const int fold, const int N, const double_binned *X, const int incX, void *C){
+  int i;
+  int j;
+  int index;
+  size_t size = binnedMPI_dbpacksize(fold);
+  const double *bins;
+  double_binned tmp[2 * binned_DBMAXFOLD];
+  const double_binned *x;
+  long_double pri;
+  uint64_t word;
+  int32_t car;
+  char *c = (char*)C;
+
+  for(i = 0; i < N; i++, X += incX * binned_dbnum(fold), c += size){
+    if(X[0] == 0.0){
+      memset(c, 0, size);
+      word = (uint64_t)binnedMPI_DBPACKZERO << (DBL_MANT_DIG - 3);
+      memcpy(c, &word, sizeof(uint64_t));
+      continue;
+    }
+    if(ISNANINF(X[0])){
+      memset(c, 0, size);
+      word = (uint64_t)binnedMPI_DBPACKNANINF << (DBL_MANT_DIG - 3);
+      memcpy(c, &word, sizeof(uint64_t));
+      memcpy(c + sizeof(uint64_t), X, sizeof(double));
+      continue;
+    }
+    x = X;
+    index = binned_dmindex(x);
+    bins = binned_dmbins(index);
+    if(!binnedMPI_dbpackable(fold, x, bins)){
+      binned_dbdbset(fold, X, tmp);
+      binned_dbrenorm(fold, tmp);
+      x = tmp;
+      index = binned_dmindex(x);
+      bins = binned_dmbins(index);
+      if(!binnedMPI_dbpackable(fold, x, bins)){
+        fprintf(stderr, "[%s.%d] ReproBLAS error: binned double precision cannot be packed\n", __FILE__, __LINE__);
+        MPI_Abort(MPI_COMM_WORLD, MPI_ERR_OTHER);
+        return;
+      }
+    }
+    for(j = 0; j < fold; j++){
+      pri.d = x[j];
+      word = pri.l & ((1ull << (DBL_MANT_DIG - 3)) - 1);
+      if(j == 0){
+        word |= (uint64_t)index << (DBL_MANT_DIG - 3);
+      }
+      car = (int32_t)x[fold + j];
+      memcpy(c + j * sizeof(uint64_t), &word, sizeof(uint64_t));
+      memcpy(c + fold * sizeof(uint64_t) + j * sizeof(int32_t), &car, sizeof(int32_t));
+    }
+  }
+}
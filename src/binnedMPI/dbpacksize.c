@@ -0,0 +1,16 @@
+#include <binnedMPI.h>
+
+/**
+ * @brief packed binned double precision size
+ *
+ * The packed encoding of a binned double precision number of the given fold is written by #binnedMPI_dbpack() and read by #binnedMPI_dbunpack().
+ *
+ * @param fold the fold of the binned type
+ * @return the size (in bytes) of the packed binned type
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+size_t binnedMPI_dbpacksize(const int fold){
+  return fold * (sizeof(uint64_t) + sizeof(int32_t));
+}
@@ -0,0 +1,55 @@
+#include <string.h>
+
+#include <binned.h>
+#include <binnedMPI.h>
+
+#include "../common/common.h"
+
+/**
+ * @brief Unpack binned double precision from the compact encoding
+ *
+ * Reads each binned double precision number in X from #binnedMPI_dbpacksize() bytes of C, as written by #binnedMPI_dbpack().
+ *
+ * @param fold the fold of the binned types
+ * @param N vector length
+ * @param C packed input (of size N * #binnedMPI_dbpacksize())
+ * @param X binned output vector
+ * @param incX X vector stride (use every incX'th element)
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void binnedMPI_dbunpack(const int fold, const int N, const void *C, double_binned *X, const int incX){
+  int i;
+  int j;
+  int index;
+  size_t size = binnedMPI_dbpacksize(fold);
+  const double *bins;
+  long_double pri;
+  uint64_t word;
+  int32_t car;
+  const char *c = (const char*)C;
+
+  for(i = 0; i < N; i++, X += incX * binned_dbnum(fold), c += size){
+    memcpy(&word, c, sizeof(uint64_t));
+    index = (int)(word >> (DBL_MANT_DIG - 3));
+    if(index == binnedMPI_DBPACKZERO){
+      binned_dbsetzero(fold, X);
+      continue;
+    }
+    if(index == binnedMPI_DBPACKNANINF){
+      binned_dbsetzero(fold, X);
+      memcpy(X, c + sizeof(uint64_t), sizeof(double));
+      continue;
+    }
+    bins = binned_dmbins(index);
+    for(j = 0; j < fold; j++){
+      memcpy(&word, c + j * sizeof(uint64_t), sizeof(uint64_t));
+      memcpy(&car, c + fold * sizeof(uint64_t) + j * sizeof(int32_t), sizeof(int32_t));
+      pri.d = bins[j];
+      pri.l |= word & ((1ull << (DBL_MANT_DIG - 3)) - 1);
+      X[j] = pri.d;
+      X[fold + j] = (double)car;
+    }
+  }
+}
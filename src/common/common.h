@@ -5,7 +5,9 @@
 #ifndef COMMON_H_
 #define COMMON_H_
 
+#include <stddef.h>
 #include <stdint.h>
+#include <limits.h>
 #include <float.h>
 
 #ifndef MAX
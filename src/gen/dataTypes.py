@@ -21,7 +21,21 @@ class DataType(object):
   base_size = 0
   is_complex = False
 
+  ##
+  #  @brief a stride that may be scaled without overflow
+  #
+  #  Strided offsets may exceed INT_MAX long before the vector does, so named strides are widened to ptrdiff_t before they are multiplied.
+  #
+  #  @param inc a stride (a name or an integer)
+  #  @return the stride as an expression of type ptrdiff_t (integers are returned as is)
+  #
+  def stride(self, inc):
+    if str(inc).isdigit():
+      return inc
+    return "(ptrdiff_t){}".format(inc)
+
   def index(self, offset, inc, i, base_index = True):
+    inc = self.stride(inc)
     if(self.is_complex and base_index):
       return mix("+", mix("*", self.base_size, inc, mix("+", offset, mix("//", i, 2))), mix("%", i, 2))
     else:
@@ -36,7 +50,7 @@ class DataType(object):
   #  @return a string that performs the increment by i of all source pointers
   #
   def data_increment(self, src_ptrs, src_incs, i):
-    return ", ".join(["{0} += {1}".format(src_ptr, mix("*", src_inc, self.base_size, i)) for (src_ptr, src_inc) in zip(src_ptrs, src_incs)])
+    return ", ".join(["{0} += {1}".format(src_ptr, mix("*", self.stride(src_inc), self.base_size, i)) for (src_ptr, src_inc) in zip(src_ptrs, src_incs)])
 
 class Double(DataType):
   name_char = 'd'
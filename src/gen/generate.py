@@ -197,7 +197,8 @@ class ParameterSpace:
         self.forward_metrics[metric].add(argument)
 
     for parameter in target.get_parameters():
-      if parameter.name in self.parameters:
+      #targets may be generated more than once (for instance, with and without a fused amax), but different parameters may not share a name
+      if parameter.name in self.parameters and parameter.encode() != self.parameters[parameter.name].encode():
         assert False, 'ReproBLAS error: duplicate parameter "{}"'.format(parameter.name)
       self.parameters[parameter.name] = parameter
 
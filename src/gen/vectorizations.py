@@ -2,13 +2,14 @@
 # vectorizations.py                                                            #
 #                                                                              #
 #     A set of classes used to generate generically vectorized code. Currently #
-# supports SISD, Intel SSE, Intel AVX.                                         #
+# supports SISD, Intel SSE, Intel AVX, Intel AVX-512.                          #
 #                                                                              #
 #                                                            Willow Ahrens 2014 #
 ################################################################################
 
 
 import math
+import config
 from utils import *
 from dataTypes import *
 
@@ -16,10 +17,15 @@ class Vectorization(object):
   name = ""
   defined_macro = ""
   header = None
+  #the macro that must be defined for fma to be fast ("" if it always is, None if fma is not supported). The AVX dispatch level defines neither __FMA__ nor __AVX2__, so AVX kernels only use fma and gathers in -mavx2 -mfma builds and at the AVX2 dispatch level
+  fma_macro = None
+  #the macro that must be defined for strided loads to use gathers ("" if they always can, None if gathers are not supported)
+  gather_macro = None
 
   def __init__(self, code_block, data_type_class):
     self.code_block = code_block
     self.data_type = data_type_class(code_block)
+    self.gather = False
 
   def define_unroll_step(self, fold, unroll):
     code_block.write("#define " + self.unroll_step_string(fold) + " " + str(unroll))
@@ -63,6 +69,10 @@ class Vectorization(object):
   def div(self, src_vars, amt_vars):
     raise(NotImplementedError())
 
+  #returns src_vars * amt_vars + add_vars, rounded once
+  def fma(self, src_vars, amt_vars, add_vars):
+    raise(NotImplementedError())
+
   def max(self, src1_vars, src2_vars):
     raise(NotImplementedError())
 
@@ -126,9 +136,12 @@ class Vectorization(object):
 
 class SISD(Vectorization):
   name = "SISD"
+  fma_macro = "FP_FAST_FMA"
 
   def __init__(self, code_block, data_type_class):
     super(SISD, self).__init__(code_block, data_type_class)
+    if self.data_type.base_type.name == "float":
+      self.fma_macro = "FP_FAST_FMAF"
     self.bit_size = self.data_type.base_type.bit_size
     self.byte_size = self.data_type.base_type.byte_size
     self.type_name = self.data_type.base_type.name
@@ -242,6 +255,12 @@ class SISD(Vectorization):
   def div(self, src_vars, amt_vars):
     return ["({0} / {1})".format(src_var, amt_var) for (src_var, amt_var) in zip(src_vars, amt_vars)]
 
+  def fma(self, src_vars, amt_vars, add_vars):
+    if self.data_type.base_type.name == "double":
+      return ["fma({0}, {1}, {2})".format(src_var, amt_var, add_var) for (src_var, amt_var, add_var) in zip(src_vars, amt_vars, add_vars)]
+    else:
+      return ["fmaf({0}, {1}, {2})".format(src_var, amt_var, add_var) for (src_var, amt_var, add_var) in zip(src_vars, amt_vars, add_vars)]
+
   def max(self, src1_vars, src2_vars):
     return ["({0} > {1}? {0}: {1})".format(src1_var, src2_var) for (src1_var, src2_var) in zip(src1_vars, src2_vars)]
 
@@ -280,6 +299,22 @@ class SIMD(Vectorization):
     super(SIMD, self).__init__(code_block, data_type_class)
     self.suf_width = 1
 
+  #contiguous inputs are prefetched once per cache line, strided inputs once per element
+  def prefetch(self, src_ptr, offset, inc, n, stream=False):
+    hint = "_MM_HINT_NTA" if stream else "_MM_HINT_T0"
+    if self.data_type.is_complex:
+      src_ptr = "(({0}*){1})".format(self.data_type.base_type.name, src_ptr)
+    if inc == 1:
+      indices = range(self.data_type.index(offset, 1, 0), self.data_type.index(offset, 1, n * self.data_type.base_size), config.cache_line_size // self.data_type.base_type.byte_size)
+    else:
+      indices = [self.data_type.index(offset, inc, i * self.data_type.base_size) for i in range(n)]
+    for index in indices:
+      self.code_block.write("_mm_prefetch((const char*)({0}), {1});".format(mix("+", src_ptr, index, paren=False), hint))
+
+  #offsets of the elements of one vector from the first, for gathers
+  def gather_offsets(self, inc):
+    return ", ".join([str(self.data_type.index(0, inc, j)) for j in reversed(range(self.base_size))])
+
   def include_max_vars(self):
     self.code_block.include("{0} max_buffer_tmp[{1}] __attribute__((aligned({2}))); (void)max_buffer_tmp;".format(self.data_type.base_type.name, self.base_size, self.byte_size))
 
@@ -554,6 +589,8 @@ class AVX(SIMD):
   name = "AVX"
   defined_macro = "__AVX__"
   header = "immintrin.h"
+  fma_macro = "__FMA__"
+  gather_macro = "__AVX2__"
 
   def __init__(self, code_block, data_type_class):
     super(AVX, self).__init__(code_block, data_type_class)
@@ -716,6 +753,11 @@ class AVX(SIMD):
           result += ["_mm256_load_p{0}({1})".format(self.data_type.base_type.name_char, mix("+", src_ptr, self.data_type.index(offset, inc, i * self.base_size), paren=False))]
         else:
           result += ["_mm256_loadu_p{0}({1})".format(self.data_type.base_type.name_char, mix("+", src_ptr, self.data_type.index(offset, inc, i * self.base_size), paren=False))]
+      elif self.gather:
+        if self.data_type.base_type.name == "float":
+          result += ["_mm256_i32gather_ps({0}, _mm256_set_epi32({1}), 4)".format(mix("+", src_ptr, self.data_type.index(offset, inc, i * self.base_size), paren=False), self.gather_offsets(inc))]
+        elif self.data_type.base_type.name == "double":
+          result += ["_mm256_i64gather_pd({0}, _mm256_set_epi64x({1}), 8)".format(mix("+", src_ptr, self.data_type.index(offset, inc, i * self.base_size), paren=False), self.gather_offsets(inc))]
       else:
         if self.data_type.base_type.name == "float":
           result += ["_mm256_set_ps({0}[{8}], {0}[{7}], {0}[{6}], {0}[{5}], {0}[{4}], {0}[{3}], {0}[{2}], {0}[{1}])".format(src_ptr, self.data_type.index(offset, inc, i * self.base_size), self.data_type.index(offset, inc, i * self.base_size + 1), self.data_type.index(offset, inc, i * self.base_size + 2), self.data_type.index(offset, inc, i * self.base_size + 3), self.data_type.index(offset, inc, i * self.base_size + 4), self.data_type.index(offset, inc, i * self.base_size + 5), self.data_type.index(offset, inc, i * self.base_size + 6), self.data_type.index(offset, inc, i * self.base_size + 7))]
@@ -755,6 +797,9 @@ class AVX(SIMD):
   def div(self, src_vars, amt_vars):
     return ["_mm256_div_p{0}({1}, {2})".format(self.data_type.base_type.name_char, src_var, amt_var) for (src_var, amt_var) in zip(src_vars, amt_vars)]
 
+  def fma(self, src_vars, amt_vars, add_vars):
+    return ["_mm256_fmadd_p{0}({1}, {2}, {3})".format(self.data_type.base_type.name_char, src_var, amt_var, add_var) for (src_var, amt_var, add_var) in zip(src_vars, amt_vars, add_vars)]
+
   def max(self, src1_vars, src2_vars):
     return ["_mm256_max_p{0}({1}, {2})".format(self.data_type.base_type.name_char, src1_var, src2_var) for (src1_var, src2_var) in zip(src1_vars, src2_vars)]
 
@@ -814,10 +859,266 @@ class AVX(SIMD):
                           "  _mm_setcsr(SIMD_daz_ftz_old_tmp);\n"
                           "}")
 
-vectorization_lookup = {"SISD":SISD, "SSE":SSE, "AVX":AVX}
+class AVX512(SIMD):
+  name = "AVX512"
+  defined_macro = "__AVX512F__"
+  header = "immintrin.h"
+  fma_macro = ""
+  gather_macro = ""
+
+  def __init__(self, code_block, data_type_class):
+    super(AVX512, self).__init__(code_block, data_type_class)
+    self.bit_size = 512
+    self.byte_size = 64
+    self.type_name = {"float": "__m512", "double": "__m512d"}[self.data_type.base_type.name]
+    self.base_size = self.bit_size//self.data_type.base_type.bit_size
+    self.type_size = self.bit_size//self.data_type.bit_size
+    self.zero = "_mm512_setzero_p{0}()".format(self.data_type.base_type.name_char)
+    self.mask_name = "__mmask{0}".format(self.base_size)
+
+  #AVX512F has no floating point bitwise operations, so the masks are kept as integer vectors
+  def cast_to_int(self, src_var):
+    return "_mm512_castp{0}_si512({1})".format(self.data_type.base_type.name_char, src_var)
+
+  def cast_from_int(self, src_var):
+    return "_mm512_castsi512_p{0}({1})".format(self.data_type.base_type.name_char, src_var)
+
+  #returns a mask of the first n lanes, where n is given in elements of the data type
+  def lane_mask(self, n):
+    return "({0})((1U << {1}) - 1)".format(self.mask_name, mix("*", n, self.data_type.base_size))
+
+  def include_blp_vars(self):
+    if self.data_type.base_type.name == "double":
+      self.code_block.include("__m512i blp_mask_tmp;\n"
+                              "{\n"
+                              "  __m512i tmp;\n"
+                              "  blp_mask_tmp = _mm512_castpd_si512(_mm512_set1_pd(1.0));\n"
+                              "  tmp = _mm512_castpd_si512(_mm512_set1_pd(1.0 + (DBL_EPSILON * 1.0001)));\n"
+                              "  blp_mask_tmp = _mm512_xor_si512(blp_mask_tmp, tmp);\n"
+                              "}")
+    else:
+      self.code_block.include("__m512i blp_mask_tmp;\n"
+                              "{\n"
+                              "  __m512i tmp;\n"
+                              "  blp_mask_tmp = _mm512_castps_si512(_mm512_set1_ps(1.0));\n"
+                              "  tmp = _mm512_castps_si512(_mm512_set1_ps(1.0 + (FLT_EPSILON * 1.0001)));\n"
+                              "  blp_mask_tmp = _mm512_xor_si512(blp_mask_tmp, tmp);\n"
+                              "}")
+
+  def include_conj_vars(self):
+    if self.data_type.base_type.name == "double":
+      self.code_block.include("__m512i conj_mask_tmp;\n"
+                              "{\n"
+                              "  __m512i tmp;\n"
+                              "  tmp = _mm512_castpd_si512(_mm512_set_pd(1, 0, 1, 0, 1, 0, 1, 0));\n"
+                              "  conj_mask_tmp = _mm512_castpd_si512(_mm512_set_pd(-1, 0, -1, 0, -1, 0, -1, 0));\n"
+                              "  conj_mask_tmp = _mm512_xor_si512(conj_mask_tmp, tmp);\n"
+                              "}")
+    else:
+      self.code_block.include("__m512i conj_mask_tmp;\n"
+                              "{\n"
+                              "  __m512i tmp;\n"
+                              "  tmp = _mm512_castps_si512(_mm512_set_ps(1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0));\n"
+                              "  conj_mask_tmp = _mm512_castps_si512(_mm512_set_ps(-1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0));\n"
+                              "  conj_mask_tmp = _mm512_xor_si512(conj_mask_tmp, tmp);\n"
+                              "}")
+
+  def include_nconj_vars(self):
+    if self.data_type.base_type.name == "double":
+      self.code_block.include("__m512i nconj_mask_tmp;\n"
+                              "{\n"
+                              "  __m512i tmp;\n"
+                              "  tmp = _mm512_castpd_si512(_mm512_set_pd(0, 1, 0, 1, 0, 1, 0, 1));\n"
+                              "  nconj_mask_tmp = _mm512_castpd_si512(_mm512_set_pd(0, -1, 0, -1, 0, -1, 0, -1));\n"
+                              "  nconj_mask_tmp = _mm512_xor_si512(nconj_mask_tmp, tmp);\n"
+                              "}")
+    else:
+      self.code_block.include("__m512i nconj_mask_tmp;\n"
+                              "{\n"
+                              "  __m512i tmp;\n"
+                              "  tmp = _mm512_castps_si512(_mm512_set_ps(0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1));\n"
+                              "  nconj_mask_tmp = _mm512_castps_si512(_mm512_set_ps(0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1));\n"
+                              "  nconj_mask_tmp = _mm512_xor_si512(nconj_mask_tmp, tmp);\n"
+                              "}")
+
+  def include_SIMD_daz_ftz_vars(self):
+    self.code_block.include("unsigned int SIMD_daz_ftz_old_tmp = 0;")
+    self.code_block.include("unsigned int SIMD_daz_ftz_new_tmp = 0;")
+
+  def consolidate_into(self, dst_ptr, offset, inc, src_vars, common_summand_ptr, common_summand_offset, common_summand_inc):
+    self.include_consolidation_vars()
+
+    if self.data_type.is_complex:
+      dst_ptr = "(({0}*){1})".format(self.data_type.base_type.name, dst_ptr)
+      common_summand_ptr = "(({0}*){1})".format(self.data_type.base_type.name, common_summand_ptr)
+
+    #the first element keeps the common summand, every other element has it subtracted
+    summand = ["{0}[{1}]".format(common_summand_ptr, self.data_type.index(common_summand_offset, common_summand_inc, i)) for i in range(self.data_type.base_size)]
+    lanes = ["0"] * self.data_type.base_size + summand * (self.type_size - 1)
+    self.code_block.write("{0} = _mm512_sub_p{1}({0}, _mm512_set_p{1}({2}));".format(src_vars[0], self.data_type.base_type.name_char, ", ".join(reversed(lanes))))
+    if len(src_vars) > 1:
+      self.propagate_into(["cons_tmp"], common_summand_ptr, common_summand_offset, common_summand_inc)
+      for src_var in src_vars[1:]:
+        self.code_block.write("{0} = _mm512_add_p{1}({0}, _mm512_sub_p{1}({2}, cons_tmp));".format(src_vars[0], self.data_type.base_type.name_char, src_var))
+    self.code_block.write("_mm512_store_p{0}(cons_buffer_tmp, {1});".format(self.data_type.base_type.name_char, src_vars[0]))
+    if self.data_type.is_complex:
+      self.code_block.write("{0}[{1}] = {2};".format(dst_ptr, self.data_type.index(offset, inc, 0), " + ".join(["cons_buffer_tmp[{0}]".format(2 * i) for i in range(self.type_size)])))
+      self.code_block.write("{0}[{1}] = {2};".format(dst_ptr, self.data_type.index(offset, inc, 1), " + ".join(["cons_buffer_tmp[{0}]".format(2 * i + 1) for i in range(self.type_size)])))
+    else:
+      self.code_block.write("{0}[{1}] = {2};".format(dst_ptr, self.data_type.index(offset, inc, 0), " + ".join(["cons_buffer_tmp[{0}]".format(i) for i in range(self.base_size)])))
+
+  def max_into(self, dst_ptr, offset, inc, src_vars):
+    self.include_max_vars()
+
+    if self.data_type.is_complex:
+      dst_ptr = "(({0}*){1})".format(self.data_type.base_type.name, dst_ptr)
+
+    for src_var in src_vars[1:]:
+      self.code_block.set_equal(src_vars[:1], self.max(src_vars[:1], [src_var]))
+    self.code_block.write("_mm512_store_p{0}(max_buffer_tmp, {1});".format(self.data_type.base_type.name_char, src_vars[0]))
+    for i in range(self.data_type.base_size, self.base_size):
+      self.code_block.write("max_buffer_tmp[{0}] = (max_buffer_tmp[{0}] > max_buffer_tmp[{1}] ? max_buffer_tmp[{0}]: max_buffer_tmp[{1}]);".format(i % self.data_type.base_size, i))
+    for i in range(self.data_type.base_size):
+      self.code_block.write("{0}[{1}] = max_buffer_tmp[{2}];".format(dst_ptr, self.data_type.index(offset, inc, i, True), i))
+
+  def propagate_into(self, dst_vars, src_ptr, offset, inc):
+    if self.data_type.is_complex:
+      src_ptr = "(({0}*){1})".format(self.data_type.base_type.name, src_ptr)
+
+    if self.data_type.is_complex:
+      broadcast = {"float": "_mm512_castpd_ps(_mm512_set1_pd(*(double *)({0})));", "double": "_mm512_broadcast_f64x4(_mm256_broadcast_pd((__m128d *)({0})));"}[self.data_type.base_type.name]
+    else:
+      broadcast = "_mm512_set1_p{0}(*({{0}}));".format(self.data_type.name_char)
+    self.code_block.write(" = ".join(dst_vars) + " = " + broadcast.format(mix("+", src_ptr, self.data_type.index(offset, inc, 0), paren=False)))
+
+  def add_blp_into(self, dst, src, blp, width):
+    assert len(dst) >= width
+    assert len(src) >= width
+    assert len(blp) >= width
+    self.include_blp_vars()
+    for i in range(width):
+      self.code_block.write("{0} = _mm512_add_p{1}({2}, {3});".format(dst[i], self.data_type.base_type.name_char, src[i], self.cast_from_int("_mm512_or_si512({0}, blp_mask_tmp)".format(self.cast_to_int(blp[i])))))
+
+  def load(self, src_ptr, offset, inc, n, align=False):
+    assert n > 0, "n must be nonzero"
+    assert n % self.type_size == 0, "n must be a multiple of the number of types that fit in a vector"
+
+    if self.data_type.is_complex:
+      src_ptr = "(({0}*){1})".format(self.data_type.base_type.name, src_ptr)
+
+    result = []
+    for i in range(n//self.type_size):
+      if inc == 1 or self.type_size == 1:
+        if align:
+          result += ["_mm512_load_p{0}({1})".format(self.data_type.base_type.name_char, mix("+", src_ptr, self.data_type.index(offset, inc, i * self.base_size), paren=False))]
+        else:
+          result += ["_mm512_loadu_p{0}({1})".format(self.data_type.base_type.name_char, mix("+", src_ptr, self.data_type.index(offset, inc, i * self.base_size), paren=False))]
+      elif self.gather:
+        if self.data_type.base_type.name == "float":
+          result += ["_mm512_i32gather_ps(_mm512_set_epi32({1}), {0}, 4)".format(mix("+", src_ptr, self.data_type.index(offset, inc, i * self.base_size), paren=False), self.gather_offsets(inc))]
+        elif self.data_type.base_type.name == "double":
+          result += ["_mm512_i64gather_pd(_mm512_set_epi64({1}), {0}, 8)".format(mix("+", src_ptr, self.data_type.index(offset, inc, i * self.base_size), paren=False), self.gather_offsets(inc))]
+      else:
+        result += ["_mm512_set_p{0}({1})".format(self.data_type.base_type.name_char, ", ".join(["{0}[{1}]".format(src_ptr, self.data_type.index(offset, inc, i * self.base_size + j)) for j in reversed(range(self.base_size))]))]
+    return result
+
+  #tails are loaded with a lane mask, so the masked out elements are never read
+  def load_partial(self, src_ptr, offset, inc, n):
+    if self.data_type.is_complex:
+      src_ptr = "(({0}*){1})".format(self.data_type.base_type.name, src_ptr)
+
+    if(isinstance(n, int)):
+      assert n > 0, "n must be nonzero"
+      assert n < self.type_size, "n must be less than the number of types that fit in a vector"
+    if inc == 1:
+      return ["_mm512_maskz_loadu_p{0}({1}, {2})".format(self.data_type.base_type.name_char, self.lane_mask(n), mix("+", src_ptr, self.data_type.index(offset, inc, 0), paren=False))]
+    elif self.data_type.name == "float complex":
+      return ["_mm512_castpd_ps(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), (__mmask8)((1U << {1}) - 1), _mm512_set_epi64({2}), (double*){0}, 8))".format(src_ptr, n, ", ".join([str(self.data_type.index(offset, inc, j, False)) for j in reversed(range(self.type_size))]))]
+    elif self.data_type.base_type.name == "double":
+      return ["_mm512_mask_i64gather_pd(_mm512_setzero_pd(), {1}, _mm512_set_epi64({2}), {0}, 8)".format(src_ptr, self.lane_mask(n), ", ".join([str(self.data_type.index(offset, inc, j)) for j in reversed(range(self.base_size))]))]
+    elif self.data_type.base_type.name == "float":
+      #the tail is gathered in two halves with 64 bit offsets, which cannot overflow for long strides
+      halves = ["_mm512_mask_i64gather_ps(_mm256_setzero_ps(), (__mmask8)({1} >> {2}), _mm512_set_epi64({3}), {0}, 4)".format(src_ptr, self.lane_mask(n), h * self.base_size // 2, ", ".join([str(self.data_type.index(offset, inc, j)) for j in reversed(range(h * self.base_size // 2, (h + 1) * self.base_size // 2))])) for h in range(2)]
+      return ["_mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd({0})), _mm256_castps_pd({1}), 1))".format(*halves)]
+
+  def sub(self, src_vars, amt_vars):
+    return ["_mm512_sub_p{0}({1}, {2})".format(self.data_type.base_type.name_char, src_var, amt_var) for (src_var, amt_var) in zip(src_vars, amt_vars)]
+
+  def add(self, src_vars, amt_vars):
+    return ["_mm512_add_p{0}({1}, {2})".format(self.data_type.base_type.name_char, src_var, amt_var) for (src_var, amt_var) in zip(src_vars, amt_vars)]
+
+  def abs(self, src_vars):
+    return ["_mm512_abs_p{0}({1})".format(self.data_type.base_type.name_char, src_var) for src_var in src_vars]
+
+  def mul(self, src_vars, amt_vars):
+    return ["_mm512_mul_p{0}({1}, {2})".format(self.data_type.base_type.name_char, src_var, amt_var) for (src_var, amt_var) in zip(src_vars, amt_vars)]
+
+  def div(self, src_vars, amt_vars):
+    return ["_mm512_div_p{0}({1}, {2})".format(self.data_type.base_type.name_char, src_var, amt_var) for (src_var, amt_var) in zip(src_vars, amt_vars)]
+
+  def fma(self, src_vars, amt_vars, add_vars):
+    return ["_mm512_fmadd_p{0}({1}, {2}, {3})".format(self.data_type.base_type.name_char, src_var, amt_var, add_var) for (src_var, amt_var, add_var) in zip(src_vars, amt_vars, add_vars)]
+
+  def max(self, src1_vars, src2_vars):
+    return ["_mm512_max_p{0}({1}, {2})".format(self.data_type.base_type.name_char, src1_var, src2_var) for (src1_var, src2_var) in zip(src1_vars, src2_vars)]
+
+  def conj(self, src_vars):
+    if self.data_type.is_complex:
+      self.include_conj_vars()
+      return [self.cast_from_int("_mm512_xor_si512({0}, conj_mask_tmp)".format(self.cast_to_int(src_var))) for src_var in src_vars]
+    else:
+      return src_vars
+
+  def nconj(self, src_vars):
+    if self.data_type.is_complex:
+      self.include_nconj_vars()
+      return [self.cast_from_int("_mm512_xor_si512({0}, nconj_mask_tmp)".format(self.cast_to_int(src_var))) for src_var in src_vars]
+    else:
+      return src_vars
+
+  def set(self, src_var):
+    return ["_mm512_set1_p{0}({1})".format(self.data_type.base_type.name_char, src_var)]
+
+  def set_real_imag(self, real_src_var, imag_src_var):
+    assert self.data_type.is_complex, "cannot set real and imaginary portions of noncomplex"
+    return ["_mm512_set_p{0}({1})".format(self.data_type.base_type.name_char, ", ".join(["{1}, {0}".format(real_src_var, imag_src_var)] * self.type_size))]
+
+  def rep_evens(self, src_vars):
+    if self.data_type.base_type.name == "double":
+      return ["_mm512_permute_pd({0}, 0x00)".format(src_var) for src_var in src_vars]
+    elif self.data_type.base_type.name == "float":
+      return ["_mm512_permute_ps({0}, 0xA0)".format(src_var) for src_var in src_vars]
+
+  def rep_odds(self, src_vars):
+    if self.data_type.base_type.name == "double":
+      return ["_mm512_permute_pd({0}, 0xFF)".format(src_var) for src_var in src_vars]
+    elif self.data_type.base_type.name == "float":
+      return ["_mm512_permute_ps({0}, 0xF5)".format(src_var) for src_var in src_vars]
+
+  def swap_pairwise(self, src_vars):
+    if self.data_type.base_type.name == "double":
+      return ["_mm512_permute_pd({0}, 0x55)".format(src_var) for src_var in src_vars]
+    elif self.data_type.base_type.name == "float":
+      return ["_mm512_permute_ps({0}, 0xB1)".format(src_var) for src_var in src_vars]
+
+  def set_SIMD_daz_ftz(self):
+    self.include_SIMD_daz_ftz_vars();
+    self.code_block.write("SIMD_daz_ftz_old_tmp = _mm_getcsr();\n"
+                          "SIMD_daz_ftz_new_tmp = SIMD_daz_ftz_old_tmp | 0x8040;\n"
+                          "if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){\n"
+                          "  _mm_setcsr(SIMD_daz_ftz_new_tmp);\n"
+                          "}")
+
+  def reset_SIMD_daz_ftz(self):
+    self.include_SIMD_daz_ftz_vars();
+    self.code_block.write("if(SIMD_daz_ftz_new_tmp != SIMD_daz_ftz_old_tmp){\n"
+                          "  _mm_setcsr(SIMD_daz_ftz_old_tmp);\n"
+                          "}")
+
+vectorization_lookup = {"SISD":SISD, "SSE":SSE, "AVX":AVX, "AVX512":AVX512}
 
 #all_vectorizations = [AVX, SSE, SISD]
-all_vectorizations = [AVX, SSE, SISD]
+all_vectorizations = [AVX512, AVX, SSE, SISD]
 
 def iterate_all_vectorizations(f, code_block):
   for (i, vectorization) in enumerate(all_vectorizations):
@@ -6,6 +6,10 @@ INSTALL_LIB := $(TARGETS)
 LIBREPROBLAS := $(OBJPATH)/libreproblas.a
 
 libreproblas.a_DEPS = $$(LIBBINNED) $$(LIBBINNEDBLAS)                          \
+                      get_num_threads.o set_num_threads.o                  \
+                        get_thread_grain.o set_thread_grain.o              \
+                        set_thread_affinity.o                              \
+                        get_vectorization.o set_vectorization.o            \
                       rdsum.o rdasum.o rdnrm2.o rddot.o                    \
                       rzsum_sub.o rdzasum.o rdznrm2.o rzdotc_sub.o         \
                         rzdotu_sub.o                                       \
@@ -13,14 +17,22 @@ libreproblas.a_DEPS = $$(LIBBINNED) $$(LIBBINNEDBLAS)                          \
                       rcsum_sub.o rscasum.o rscnrm2.o rcdotc_sub.o         \
                         rcdotu_sub.o                                       \
                       rdgemv.o rdgemm.o                                    \
+                        rdgemm_batch.o rdgemm_batch_strided.o              \
                       rzgemv.o rzgemm.o                                    \
+                        rzgemm_batch.o rzgemm_batch_strided.o              \
                       rsgemv.o rsgemm.o                                    \
+                        rsgemm_batch.o rsgemm_batch_strided.o              \
                       rcgemv.o rcgemm.o                                    \
+                        rcgemm_batch.o rcgemm_batch_strided.o              \
                       dsum.o dasum.o dnrm2.o ddot.o                        \
                       zsum_sub.o dzasum.o dznrm2.o zdotc_sub.o zdotu_sub.o \
                       ssum.o sasum.o snrm2.o sdot.o                        \
                       csum_sub.o scasum.o scnrm2.o cdotc_sub.o cdotu_sub.o \
                       dgemv.o dgemm.o                                      \
+                        dgemm_batch.o dgemm_batch_strided.o                \
                       zgemv.o zgemm.o                                      \
+                        zgemm_batch.o zgemm_batch_strided.o                \
                       sgemv.o sgemm.o                                      \
+                        sgemm_batch.o sgemm_batch_strided.o                \
                       cgemv.o cgemm.o                                      \
+                        cgemm_batch.o cgemm_batch_strided.o                \
@@ -0,0 +1,46 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Add to each complex single precision matrix in a batch the reproducible matrix-matrix product of the corresponding complex single precision matrices
+ *
+ * For b < batch_count, performs one of the matrix-matrix operations
+ *
+ *   C_b := alpha*op(A_b)*op(B_b) + beta*C_b,
+ *
+ * where A_b = A[b], B_b = B[b] and C_b = C[b], and op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H.
+ *
+ * All matrices of the batch have the same dimensions and leading dimensions.
+ *
+ * The products are computed using binned types of default fold with #reproBLAS_rcgemm_batch()
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A_b) and of the matrix C_b.
+ * @param N number of columns of matrix op(B_b) and of the matrix C_b.
+ * @param K number of columns of matrix op(A_b) and columns of the matrix op(B_b).
+ * @param alpha scalar alpha
+ * @param A array of complex single precision matrices of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A_b as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B array of complex single precision matrices of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B_b as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param beta scalar beta
+ * @param C array of complex single precision matrices of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C_b as declared in the calling program. ldc must be at least N in row major or M in column major.
+ * @param batch_count number of products
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void reproBLAS_cgemm_batch(const char Order, const char TransA, const char TransB,
+                     const int M, const int N, const int K,
+                     const void *alpha, const void *const *A, const int lda,
+                     const void *const *B, const int ldb,
+                     const void *beta, void *const *C, const int ldc,
+                     const int batch_count){
+  reproBLAS_rcgemm_batch(SIDEFAULTFOLD, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
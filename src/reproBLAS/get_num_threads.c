@@ -0,0 +1,16 @@
+#include <reproBLAS.h>
+#include <binnedBLAS.h>
+
+/**
+ * @brief Get the number of threads used by threaded routines
+ *
+ * The number of threads is determined by #binnedBLAS_get_num_threads()
+ *
+ * @return number of threads
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+int reproBLAS_get_num_threads(void){
+  return binnedBLAS_get_num_threads();
+}
@@ -0,0 +1,16 @@
+#include <reproBLAS.h>
+#include <binnedBLAS.h>
+
+/**
+ * @brief Get the minimum number of elements a thread is given in threaded routines
+ *
+ * The grain is determined by #binnedBLAS_get_thread_grain()
+ *
+ * @return grain
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+int reproBLAS_get_thread_grain(void){
+  return binnedBLAS_get_thread_grain();
+}
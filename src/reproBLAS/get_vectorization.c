@@ -0,0 +1,16 @@
+#include <reproBLAS.h>
+#include <binnedBLAS.h>
+
+/**
+ * @brief Get the instruction set used by vectorized kernels
+ *
+ * The instruction set is determined by #binnedBLAS_get_vectorization().
+ *
+ * @return one of #reproBLAS_SISD, #reproBLAS_SSE, #reproBLAS_AVX, #reproBLAS_AVX2, or #reproBLAS_AVX512
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+int reproBLAS_get_vectorization(void){
+  return binnedBLAS_get_vectorization();
+}
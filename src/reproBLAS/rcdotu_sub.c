@@ -1,6 +1,43 @@
+#include <stddef.h>
+
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rcdotu_sub_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const void *X;
+  int incX;
+  const void *Y;
+  int incY;
+  float_complex_binned *dotuis;
+} reproBLAS_rcdotu_sub_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rcdotu_sub())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rcdotu_sub_task(void *args, const int i, const int thread){
+  reproBLAS_rcdotu_sub_args *a = (reproBLAS_rcdotu_sub_args*)args;
+  (void)thread;
+
+  binned_cbsetzero(a->fold, a->dotuis + i * binned_cbnum(a->fold));
+  binnedBLAS_cbcdotu(a->fold, MIN(a->block_N, a->N - i * a->block_N), (const float*)a->X + 2 * (ptrdiff_t)i * a->block_N * a->incX, a->incX, (const float*)a->Y + 2 * (ptrdiff_t)i * a->block_N * a->incY, a->incY, a->dotuis + i * binned_cbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible unconjugated dot product of complex single precision vectors X and Y
  *
@@ -8,6 +45,8 @@
  *
  * The reproducible dot product is computed with binned types using #binnedBLAS_cbcdotu()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_cbcbadd()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X complex single precision vector
@@ -21,10 +60,32 @@
  */
 void reproBLAS_rcdotu_sub(const int fold, const int N, const void* X, const int incX, const void *Y, const int incY, void *dotu) {
   float_complex_binned *dotui = binned_cballoc(fold);
+  float_complex_binned *dotuis;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rcdotu_sub_args args;
 
   binned_cbsetzero(fold, dotui);
 
-  binnedBLAS_cbcdotu(fold, N, X, incX, Y, incY, dotui);
+  if(num_threads == 1){
+    binnedBLAS_cbcdotu(fold, N, X, incX, Y, incY, dotui);
+  }else{
+    dotuis = (float_complex_binned*)malloc(num_threads * binned_cbsize(fold));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.Y = Y;
+    args.incY = incY;
+    args.dotuis = dotuis;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rcdotu_sub_task, &args);
+    for(i = 0; i < num_threads; i++){
+      binned_cbcbadd(fold, dotuis + i * binned_cbnum(fold), dotui);
+    }
+    free(dotuis);
+  }
 
   binned_ccbconv_sub(fold, dotui, dotu);
   free(dotui);
@@ -1,9 +1,129 @@
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+#include "../../config.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rcgemm_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  char Order;
+  char TransA;
+  char TransB;
+  int M;
+  int N;
+  int K;
+  const void *alpha;
+  const void *A;
+  int lda;
+  const void *B;
+  int ldb;
+  const void *beta;
+  void *C;
+  int ldc;
+  int num_tiles_N;
+  int rowA;
+  int colB;
+  float_complex_binned **CIs;
+} reproBLAS_rcgemm_args;
+
+/**
+ * @internal
+ * @brief Compute one tile of C (a task of #reproBLAS_rcgemm())
+ *
+ * Each thread allocates its workspace the first time it runs a task.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rcgemm_task(void *args, const int tile, const int thread){
+  reproBLAS_rcgemm_args *a = (reproBLAS_rcgemm_args*)args;
+  float_complex_binned *CI;
+  float *Ct;
+  float betaC[2];
+  int tile_M;
+  int tile_N;
+  int i;
+  int j;
+  int ii;
+  int jj;
+
+  if(a->CIs[thread] == NULL){
+    a->CIs[thread] = (float_complex_binned*)malloc(GEMMTILE * GEMMTILE * binned_cbsize(a->fold));
+  }
+  CI = a->CIs[thread];
+
+  i = (tile / a->num_tiles_N) * GEMMTILE;
+  j = (tile % a->num_tiles_N) * GEMMTILE;
+  tile_M = MIN(GEMMTILE, a->M - i);
+  tile_N = MIN(GEMMTILE, a->N - j);
+  switch(a->Order){
+    case 'r':
+    case 'R':
+      Ct = (float*)a->C + 2 * (i * a->ldc + j);
+      if(((float*)a->beta)[0] == 0.0 && ((float*)a->beta)[1] == 0.0){
+        memset(CI, 0, tile_M * tile_N * binned_cbsize(a->fold));
+      }else if(((float*)a->beta)[0] == 1.0 && ((float*)a->beta)[1] == 0.0){
+        for(ii = 0; ii < tile_M; ii++){
+          for(jj = 0; jj < tile_N; jj++){
+            binned_cbcconv(a->fold, Ct + 2 * (ii * a->ldc + jj), CI + (ii * tile_N + jj) * binned_cbnum(a->fold));
+          }
+        }
+      }else{
+        for(ii = 0; ii < tile_M; ii++){
+          for(jj = 0; jj < tile_N; jj++){
+            betaC[0] = Ct[2 * (ii * a->ldc + jj)] * ((float*)a->beta)[0] - Ct[2 * (ii * a->ldc + jj) + 1] * ((float*)a->beta)[1],
+            betaC[1] = Ct[2 * (ii * a->ldc + jj)] * ((float*)a->beta)[1] + Ct[2 * (ii * a->ldc + jj) + 1] * ((float*)a->beta)[0],
+            binned_cbcconv(a->fold, betaC, CI + (ii * tile_N + jj) * binned_cbnum(a->fold));
+          }
+        }
+      }
+      binnedBLAS_cbcgemm(a->fold, a->Order, a->TransA, a->TransB, tile_M, tile_N, a->K, a->alpha, (const float*)a->A + 2 * i * a->rowA, a->lda, (const float*)a->B + 2 * j * a->colB, a->ldb, CI, tile_N);
+      for(ii = 0; ii < tile_M; ii++){
+        for(jj = 0; jj < tile_N; jj++){
+          binned_ccbconv_sub(a->fold, CI + (ii * tile_N + jj) * binned_cbnum(a->fold), Ct + 2 * (ii * a->ldc + jj));
+        }
+      }
+      break;
+    default:
+      Ct = (float*)a->C + 2 * (j * a->ldc + i);
+      if(((float*)a->beta)[0] == 0.0 && ((float*)a->beta)[1] == 0.0){
+        memset(CI, 0, tile_M * tile_N * binned_cbsize(a->fold));
+      }else if(((float*)a->beta)[0] == 1.0 && ((float*)a->beta)[1] == 0.0){
+        for(jj = 0; jj < tile_N; jj++){
+          for(ii = 0; ii < tile_M; ii++){
+            binned_cbcconv(a->fold, Ct + 2 * (jj * a->ldc + ii), CI + (jj * tile_M + ii) * binned_cbnum(a->fold));
+          }
+        }
+      }else{
+        for(jj = 0; jj < tile_N; jj++){
+          for(ii = 0; ii < tile_M; ii++){
+            betaC[0] = Ct[2 * (jj * a->ldc + ii)] * ((float*)a->beta)[0] - Ct[2 * (jj * a->ldc + ii) + 1] * ((float*)a->beta)[1],
+            betaC[1] = Ct[2 * (jj * a->ldc + ii)] * ((float*)a->beta)[1] + Ct[2 * (jj * a->ldc + ii) + 1] * ((float*)a->beta)[0],
+            binned_cbcconv(a->fold, betaC, CI + (jj * tile_M + ii) * binned_cbnum(a->fold));
+          }
+        }
+      }
+      binnedBLAS_cbcgemm(a->fold, a->Order, a->TransA, a->TransB, tile_M, tile_N, a->K, a->alpha, (const float*)a->A + 2 * i * a->rowA, a->lda, (const float*)a->B + 2 * j * a->colB, a->ldb, CI, tile_M);
+      for(jj = 0; jj < tile_N; jj++){
+        for(ii = 0; ii < tile_M; ii++){
+          binned_ccbconv_sub(a->fold, CI + (jj * tile_M + ii) * binned_cbnum(a->fold), Ct + 2 * (jj * a->ldc + ii));
+        }
+      }
+      break;
+  }
+}
+
 /**
  * @brief Add to complex single precision matrix C the reproducible matrix-matrix product of complex single precision matrices A and B
  *
@@ -19,6 +139,8 @@
  *
  * The matrix-matrix product is computed using binned types with #binnedBLAS_cbcgemm()
  *
+ * C is converted to binned form in tiles of #GEMMTILE by #GEMMTILE elements, so the extra memory used is proportional to the size of a tile (per thread) rather than the size of C. Large products process different tiles on different threads, and when there are fewer tiles than threads the tiles are processed one after another, each with a threaded product. Each element of C is accumulated in the same order regardless of the tiling or the number of threads.
+ *
  * @param fold the fold of the binned types
  * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
  * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
@@ -43,68 +165,61 @@ void reproBLAS_rcgemm(const int fold, const char Order, const char TransA, const
                       const void *alpha, const void *A, const int lda,
                       const void *B, const int ldb,
                       const void *beta, void *C, const int ldc){
-  float_complex_binned *CI;
-  float betaC[2];
-  int i;
-  int j;
+  int num_tiles_M;
+  int num_tiles_N;
+  int num_threads;
+  int rowA;
+  int colB;
+  reproBLAS_rcgemm_args args;
+  int t;
 
   if(M == 0 || N == 0){
     return;
   }
 
-  CI = (float_complex_binned*)malloc(M * N * binned_cbsize(fold));
   switch(Order){
     case 'r':
     case 'R':
-      if(((float*)beta)[0] == 0.0 && ((float*)beta)[1] == 0.0){
-        memset(CI, 0, M * N * binned_cbsize(fold));
-      }else if(((float*)beta)[0] == 1.0 && ((float*)beta)[1] == 0.0){
-        for(i = 0; i < M; i++){
-          for(j = 0; j < N; j++){
-            binned_cbcconv(fold, ((float*)C) + 2 * (i * ldc + j), CI + (i * N + j) * binned_cbnum(fold));
-          }
-        }
-      }else{
-        for(i = 0; i < M; i++){
-          for(j = 0; j < N; j++){
-            betaC[0] = ((float*)C)[2 * (i * ldc + j)] * ((float*)beta)[0] - ((float*)C)[2 * (i * ldc + j) + 1] * ((float*)beta)[1],
-            betaC[1] = ((float*)C)[2 * (i * ldc + j)] * ((float*)beta)[1] + ((float*)C)[2 * (i * ldc + j) + 1] * ((float*)beta)[0],
-            binned_cbcconv(fold, betaC, CI + (i * N + j) * binned_cbnum(fold));
-          }
-        }
-      }
-      binnedBLAS_cbcgemm(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, N);
-      for(i = 0; i < M; i++){
-        for(j = 0; j < N; j++){
-          binned_ccbconv_sub(fold, CI + (i * N + j) * binned_cbnum(fold), ((float*)C) + 2 * (i * ldc + j));
-        }
-      }
+      rowA = (TransA == 'n' || TransA == 'N') ? lda : 1;
+      colB = (TransB == 'n' || TransB == 'N') ? 1 : ldb;
       break;
     default:
-      if(((float*)beta)[0] == 0.0 && ((float*)beta)[1] == 0.0){
-        memset(CI, 0, M * N * binned_cbsize(fold));
-      }else if(((float*)beta)[0] == 1.0 && ((float*)beta)[1] == 0.0){
-        for(j = 0; j < N; j++){
-          for(i = 0; i < M; i++){
-            binned_cbcconv(fold, ((float*)C) + 2 * (j * ldc + i), CI + (j * M + i) * binned_cbnum(fold));
-          }
-        }
-      }else{
-        for(j = 0; j < N; j++){
-          for(i = 0; i < M; i++){
-            betaC[0] = ((float*)C)[2 * (j * ldc + i)] * ((float*)beta)[0] - ((float*)C)[2 * (j * ldc + i) + 1] * ((float*)beta)[1],
-            betaC[1] = ((float*)C)[2 * (j * ldc + i)] * ((float*)beta)[1] + ((float*)C)[2 * (j * ldc + i) + 1] * ((float*)beta)[0],
-            binned_cbcconv(fold, betaC, CI + (j * M + i) * binned_cbnum(fold));
-          }
-        }
-      }
-      binnedBLAS_cbcgemm(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, M);
-      for(j = 0; j < N; j++){
-        for(i = 0; i < M; i++){
-          binned_ccbconv_sub(fold, CI + (j * M + i) * binned_cbnum(fold), ((float*)C) + 2 * (j * ldc + i));
-        }
-      }
+      rowA = (TransA == 'n' || TransA == 'N') ? 1 : lda;
+      colB = (TransB == 'n' || TransB == 'N') ? ldb : 1;
       break;
   }
-  free(CI);
+
+  //C is converted to and from binned form one tile at a time, one tile per thread
+  //nested products are serial, so with fewer tiles than threads the tiles run on the calling thread and each product is threaded instead
+  num_tiles_M = (M + GEMMTILE - 1) / GEMMTILE;
+  num_tiles_N = (N + GEMMTILE - 1) / GEMMTILE;
+  num_threads = binnedBLAS_nthreads((int)MIN((double)M * N * K, (double)INT_MAX));
+  if(num_threads > num_tiles_M * num_tiles_N){
+    num_threads = 1;
+  }
+
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.TransB = TransB;
+  args.M = M;
+  args.N = N;
+  args.K = K;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.B = B;
+  args.ldb = ldb;
+  args.beta = beta;
+  args.C = C;
+  args.ldc = ldc;
+  args.num_tiles_N = num_tiles_N;
+  args.rowA = rowA;
+  args.colB = colB;
+  args.CIs = (float_complex_binned**)calloc(num_threads, sizeof(float_complex_binned*));
+  binnedBLAS_parallel(num_threads, num_tiles_M * num_tiles_N, &reproBLAS_rcgemm_task, &args);
+  for(t = 0; t < num_threads; t++){
+    free(args.CIs[t]);
+  }
+  free(args.CIs);
 }
@@ -1,6 +1,41 @@
+#include <stddef.h>
+
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rcsum_sub_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const void *X;
+  int incX;
+  float_complex_binned *sumis;
+} reproBLAS_rcsum_sub_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rcsum_sub())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rcsum_sub_task(void *args, const int i, const int thread){
+  reproBLAS_rcsum_sub_args *a = (reproBLAS_rcsum_sub_args*)args;
+  (void)thread;
+
+  binned_cbsetzero(a->fold, a->sumis + i * binned_cbnum(a->fold));
+  binnedBLAS_cbcsum(a->fold, MIN(a->block_N, a->N - i * a->block_N), (const float*)a->X + 2 * (ptrdiff_t)i * a->block_N * a->incX, a->incX, a->sumis + i * binned_cbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible sum of complex single precision vector X
  *
@@ -8,6 +43,8 @@
  *
  * The reproducible sum is computed with binned types using #binnedBLAS_cbcsum()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_cbcbadd()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X single precision vector
@@ -19,10 +56,30 @@
  */
 void reproBLAS_rcsum_sub(const int fold, const int N, const void* X, const int incX, void *sum) {
   float_complex_binned *sumi = binned_cballoc(fold);
+  float_complex_binned *sumis;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rcsum_sub_args args;
 
   binned_cbsetzero(fold, sumi);
 
-  binnedBLAS_cbcsum(fold, N, X, incX, sumi);
+  if(num_threads == 1){
+    binnedBLAS_cbcsum(fold, N, X, incX, sumi);
+  }else{
+    sumis = (float_complex_binned*)malloc(num_threads * binned_cbsize(fold));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.sumis = sumis;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rcsum_sub_task, &args);
+    for(i = 0; i < num_threads; i++){
+      binned_cbcbadd(fold, sumis + i * binned_cbnum(fold), sumi);
+    }
+    free(sumis);
+  }
 
   binned_ccbconv_sub(fold, sumi, sum);
   free(sumi);
@@ -1,6 +1,43 @@
+#include <stddef.h>
+
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rddot_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const double *X;
+  int incX;
+  const double *Y;
+  int incY;
+  double_binned *dotis;
+} reproBLAS_rddot_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rddot())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rddot_task(void *args, const int i, const int thread){
+  reproBLAS_rddot_args *a = (reproBLAS_rddot_args*)args;
+  (void)thread;
+
+  binned_dbsetzero(a->fold, a->dotis + i * binned_dbnum(a->fold));
+  binnedBLAS_dbddot(a->fold, MIN(a->block_N, a->N - i * a->block_N), a->X + (ptrdiff_t)i * a->block_N * a->incX, a->incX, a->Y + (ptrdiff_t)i * a->block_N * a->incY, a->incY, a->dotis + i * binned_dbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible dot product of double precision vectors X and Y
  *
@@ -8,6 +45,8 @@
  *
  * The reproducible dot product is computed with binned types using #binnedBLAS_dbddot()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_dbdbadd()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X double precision vector
@@ -21,11 +60,33 @@
  */
 double reproBLAS_rddot(const int fold, const int N, const double* X, const int incX, const double *Y, const int incY) {
   double_binned *doti = binned_dballoc(fold);
+  double_binned *dotis;
   double dot;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rddot_args args;
 
   binned_dbsetzero(fold, doti);
 
-  binnedBLAS_dbddot(fold, N, X, incX, Y, incY, doti);
+  if(num_threads == 1){
+    binnedBLAS_dbddot(fold, N, X, incX, Y, incY, doti);
+  }else{
+    dotis = (double_binned*)malloc(num_threads * binned_dbsize(fold));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.Y = Y;
+    args.incY = incY;
+    args.dotis = dotis;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rddot_task, &args);
+    for(i = 0; i < num_threads; i++){
+      binned_dbdbadd(fold, dotis + i * binned_dbnum(fold), doti);
+    }
+    free(dotis);
+  }
 
   dot = binned_ddbconv(fold, doti);
   free(doti);
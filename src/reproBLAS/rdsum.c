@@ -1,6 +1,41 @@
+#include <stddef.h>
+
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rdsum_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const double *X;
+  int incX;
+  double_binned *sumis;
+} reproBLAS_rdsum_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rdsum())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rdsum_task(void *args, const int i, const int thread){
+  reproBLAS_rdsum_args *a = (reproBLAS_rdsum_args*)args;
+  (void)thread;
+
+  binned_dbsetzero(a->fold, a->sumis + i * binned_dbnum(a->fold));
+  binnedBLAS_dbdsum(a->fold, MIN(a->block_N, a->N - i * a->block_N), a->X + (ptrdiff_t)i * a->block_N * a->incX, a->incX, a->sumis + i * binned_dbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible sum of double precision vector X
  *
@@ -8,6 +43,8 @@
  *
  * The reproducible sum is computed with binned types using #binnedBLAS_dbdsum()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_dbdbadd()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X double precision vector
@@ -19,11 +56,31 @@
  */
 double reproBLAS_rdsum(const int fold, const int N, const double* X, const int incX) {
   double_binned *sumi = binned_dballoc(fold);
+  double_binned *sumis;
   double sum;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rdsum_args args;
 
   binned_dbsetzero(fold, sumi);
 
-  binnedBLAS_dbdsum(fold, N, X, incX, sumi);
+  if(num_threads == 1){
+    binnedBLAS_dbdsum(fold, N, X, incX, sumi);
+  }else{
+    sumis = (double_binned*)malloc(num_threads * binned_dbsize(fold));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.sumis = sumis;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rdsum_task, &args);
+    for(i = 0; i < num_threads; i++){
+      binned_dbdbadd(fold, sumis + i * binned_dbnum(fold), sumi);
+    }
+    free(sumis);
+  }
 
   sum = binned_ddbconv(fold, sumi);
   free(sumi);
@@ -1,6 +1,41 @@
+#include <stddef.h>
+
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rdzasum_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const void *X;
+  int incX;
+  double_binned *asumis;
+} reproBLAS_rdzasum_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rdzasum())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rdzasum_task(void *args, const int i, const int thread){
+  reproBLAS_rdzasum_args *a = (reproBLAS_rdzasum_args*)args;
+  (void)thread;
+
+  binned_dbsetzero(a->fold, a->asumis + i * binned_dbnum(a->fold));
+  binnedBLAS_dbzasum(a->fold, MIN(a->block_N, a->N - i * a->block_N), (const double*)a->X + 2 * (ptrdiff_t)i * a->block_N * a->incX, a->incX, a->asumis + i * binned_dbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible absolute sum of complex double precision vector X
  *
@@ -8,6 +43,8 @@
  *
  * The reproducible absolute sum is computed with binned types using #binnedBLAS_dbzasum()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_dbdbadd()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X complex double precision vector
@@ -19,11 +56,31 @@
  */
 double reproBLAS_rdzasum(const int fold, const int N, const void* X, const int incX) {
   double_binned *asumi = binned_dballoc(fold);
+  double_binned *asumis;
   double asum;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rdzasum_args args;
 
   binned_dbsetzero(fold, asumi);
 
-  binnedBLAS_dbzasum(fold, N, X, incX, asumi);
+  if(num_threads == 1){
+    binnedBLAS_dbzasum(fold, N, X, incX, asumi);
+  }else{
+    asumis = (double_binned*)malloc(num_threads * binned_dbsize(fold));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.asumis = asumis;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rdzasum_task, &args);
+    for(i = 0; i < num_threads; i++){
+      binned_dbdbadd(fold, asumis + i * binned_dbnum(fold), asumi);
+    }
+    free(asumis);
+  }
 
   asum = binned_ddbconv(fold, asumi);
   free(asumi);
@@ -1,8 +1,44 @@
+#include <stddef.h>
+
 #include <math.h>
 
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rdznrm2_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const void *X;
+  int incX;
+  double_binned *ssqs;
+  double *scls;
+} reproBLAS_rdznrm2_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rdznrm2())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rdznrm2_task(void *args, const int i, const int thread){
+  reproBLAS_rdznrm2_args *a = (reproBLAS_rdznrm2_args*)args;
+  (void)thread;
+
+  binned_dbsetzero(a->fold, a->ssqs + i * binned_dbnum(a->fold));
+  a->scls[i] = binnedBLAS_dbzssq(a->fold, MIN(a->block_N, a->N - i * a->block_N), (const double*)a->X + 2 * (ptrdiff_t)i * a->block_N * a->incX, a->incX, 0.0, a->ssqs + i * binned_dbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible Euclidian norm of complex double precision vector X
  *
@@ -10,6 +46,8 @@
  *
  * The reproducible Euclidian norm is computed with scaled binned types using #binnedBLAS_dbzssq()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_dbdbaddsq()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X complex double precision vector
@@ -21,12 +59,37 @@
  */
 double reproBLAS_rdznrm2(const int fold, const int N, const void* X, const int incX) {
   double_binned *ssq = binned_dballoc(fold);
+  double_binned *ssqs;
+  double *scls;
   double scl;
   double nrm2;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rdznrm2_args args;
 
   binned_dbsetzero(fold, ssq);
 
-  scl = binnedBLAS_dbzssq(fold, N, X, incX, 0.0, ssq);
+  if(num_threads == 1){
+    scl = binnedBLAS_dbzssq(fold, N, X, incX, 0.0, ssq);
+  }else{
+    ssqs = (double_binned*)malloc(num_threads * binned_dbsize(fold));
+    scls = (double*)malloc(num_threads * sizeof(double));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.ssqs = ssqs;
+    args.scls = scls;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rdznrm2_task, &args);
+    scl = 0.0;
+    for(i = 0; i < num_threads; i++){
+      scl = binned_dbdbaddsq(fold, scls[i], ssqs + i * binned_dbnum(fold), scl, ssq);
+    }
+    free(scls);
+    free(ssqs);
+  }
 
   nrm2 = scl * sqrt(binned_ddbconv(fold, ssq));
   free(ssq);
@@ -1,6 +1,41 @@
+#include <stddef.h>
+
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rsasum_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const float *X;
+  int incX;
+  float_binned *asumis;
+} reproBLAS_rsasum_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rsasum())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rsasum_task(void *args, const int i, const int thread){
+  reproBLAS_rsasum_args *a = (reproBLAS_rsasum_args*)args;
+  (void)thread;
+
+  binned_sbsetzero(a->fold, a->asumis + i * binned_sbnum(a->fold));
+  binnedBLAS_sbsasum(a->fold, MIN(a->block_N, a->N - i * a->block_N), a->X + (ptrdiff_t)i * a->block_N * a->incX, a->incX, a->asumis + i * binned_sbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible absolute sum of single precision vector X
  *
@@ -8,6 +43,8 @@
  *
  * The reproducible absolute sum is computed with binned types using #binnedBLAS_sbsasum()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_sbsbadd()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X single precision vector
@@ -19,11 +56,31 @@
  */
 float reproBLAS_rsasum(const int fold, const int N, const float* X, const int incX) {
   float_binned *asumi = binned_sballoc(fold);
+  float_binned *asumis;
   float asum;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rsasum_args args;
 
   binned_sbsetzero(fold, asumi);
 
-  binnedBLAS_sbsasum(fold, N, X, incX, asumi);
+  if(num_threads == 1){
+    binnedBLAS_sbsasum(fold, N, X, incX, asumi);
+  }else{
+    asumis = (float_binned*)malloc(num_threads * binned_sbsbze(fold));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.asumis = asumis;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rsasum_task, &args);
+    for(i = 0; i < num_threads; i++){
+      binned_sbsbadd(fold, asumis + i * binned_sbnum(fold), asumi);
+    }
+    free(asumis);
+  }
 
   asum = binned_ssbconv(fold, asumi);
   free(asumi);
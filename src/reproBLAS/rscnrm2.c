@@ -1,8 +1,44 @@
+#include <stddef.h>
+
 #include <math.h>
 
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rscnrm2_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const void *X;
+  int incX;
+  float_binned *ssqs;
+  float *scls;
+} reproBLAS_rscnrm2_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rscnrm2())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rscnrm2_task(void *args, const int i, const int thread){
+  reproBLAS_rscnrm2_args *a = (reproBLAS_rscnrm2_args*)args;
+  (void)thread;
+
+  binned_sbsetzero(a->fold, a->ssqs + i * binned_sbnum(a->fold));
+  a->scls[i] = binnedBLAS_sbcssq(a->fold, MIN(a->block_N, a->N - i * a->block_N), (const float*)a->X + 2 * (ptrdiff_t)i * a->block_N * a->incX, a->incX, 0.0, a->ssqs + i * binned_sbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible Euclidian norm of complex single precision vector X
  *
@@ -10,6 +46,8 @@
  *
  * The reproducible Euclidian norm is computed with scaled binned types using #binnedBLAS_sbcssq()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_sbsbaddsq()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X complex single precision vector
@@ -21,12 +59,37 @@
  */
 float reproBLAS_rscnrm2(const int fold, const int N, const void* X, const int incX) {
   float_binned *ssq = binned_sballoc(fold);
+  float_binned *ssqs;
+  float *scls;
   float scl;
   float nrm2;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rscnrm2_args args;
 
   binned_sbsetzero(fold, ssq);
 
-  scl = binnedBLAS_sbcssq(fold, N, X, incX, 0.0, ssq);
+  if(num_threads == 1){
+    scl = binnedBLAS_sbcssq(fold, N, X, incX, 0.0, ssq);
+  }else{
+    ssqs = (float_binned*)malloc(num_threads * binned_sbsbze(fold));
+    scls = (float*)malloc(num_threads * sizeof(float));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.ssqs = ssqs;
+    args.scls = scls;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rscnrm2_task, &args);
+    scl = 0.0;
+    for(i = 0; i < num_threads; i++){
+      scl = binned_sbsbaddsq(fold, scls[i], ssqs + i * binned_sbnum(fold), scl, ssq);
+    }
+    free(scls);
+    free(ssqs);
+  }
 
   nrm2 = scl * sqrt(binned_ssbconv(fold, ssq));
   free(ssq);
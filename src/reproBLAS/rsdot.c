@@ -1,6 +1,43 @@
+#include <stddef.h>
+
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rsdot_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const float *X;
+  int incX;
+  const float *Y;
+  int incY;
+  float_binned *dotis;
+} reproBLAS_rsdot_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rsdot())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rsdot_task(void *args, const int i, const int thread){
+  reproBLAS_rsdot_args *a = (reproBLAS_rsdot_args*)args;
+  (void)thread;
+
+  binned_sbsetzero(a->fold, a->dotis + i * binned_sbnum(a->fold));
+  binnedBLAS_sbsdot(a->fold, MIN(a->block_N, a->N - i * a->block_N), a->X + (ptrdiff_t)i * a->block_N * a->incX, a->incX, a->Y + (ptrdiff_t)i * a->block_N * a->incY, a->incY, a->dotis + i * binned_sbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible dot product of single precision vectors X and Y
  *
@@ -8,6 +45,8 @@
  *
  * The reproducible dot product is computed with binned types using #binnedBLAS_sbsdot()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_sbsbadd()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X single precision vector
@@ -21,11 +60,33 @@
  */
 float reproBLAS_rsdot(const int fold, const int N, const float* X, const int incX, const float *Y, const int incY) {
   float_binned *doti = binned_sballoc(fold);
+  float_binned *dotis;
   float dot;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rsdot_args args;
 
   binned_sbsetzero(fold, doti);
 
-  binnedBLAS_sbsdot(fold, N, X, incX, Y, incY, doti);
+  if(num_threads == 1){
+    binnedBLAS_sbsdot(fold, N, X, incX, Y, incY, doti);
+  }else{
+    dotis = (float_binned*)malloc(num_threads * binned_sbsbze(fold));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.Y = Y;
+    args.incY = incY;
+    args.dotis = dotis;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rsdot_task, &args);
+    for(i = 0; i < num_threads; i++){
+      binned_sbsbadd(fold, dotis + i * binned_sbnum(fold), doti);
+    }
+    free(dotis);
+  }
 
   dot = binned_ssbconv(fold, doti);
   free(doti);
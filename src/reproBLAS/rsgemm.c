@@ -1,9 +1,124 @@
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+#include "../../config.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rsgemm_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  char Order;
+  char TransA;
+  char TransB;
+  int M;
+  int N;
+  int K;
+  float alpha;
+  const float *A;
+  int lda;
+  const float *B;
+  int ldb;
+  float beta;
+  float *C;
+  int ldc;
+  int num_tiles_N;
+  int rowA;
+  int colB;
+  float_binned **CIs;
+} reproBLAS_rsgemm_args;
+
+/**
+ * @internal
+ * @brief Compute one tile of C (a task of #reproBLAS_rsgemm())
+ *
+ * Each thread allocates its workspace the first time it runs a task.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rsgemm_task(void *args, const int tile, const int thread){
+  reproBLAS_rsgemm_args *a = (reproBLAS_rsgemm_args*)args;
+  float_binned *CI;
+  float *Ct;
+  int tile_M;
+  int tile_N;
+  int i;
+  int j;
+  int ii;
+  int jj;
+
+  if(a->CIs[thread] == NULL){
+    a->CIs[thread] = (float_binned*)malloc(GEMMTILE * GEMMTILE * binned_sbsbze(a->fold));
+  }
+  CI = a->CIs[thread];
+
+  i = (tile / a->num_tiles_N) * GEMMTILE;
+  j = (tile % a->num_tiles_N) * GEMMTILE;
+  tile_M = MIN(GEMMTILE, a->M - i);
+  tile_N = MIN(GEMMTILE, a->N - j);
+  switch(a->Order){
+    case 'r':
+    case 'R':
+      Ct = a->C + i * a->ldc + j;
+      if(a->beta == 0.0){
+        memset(CI, 0, tile_M * tile_N * binned_sbsbze(a->fold));
+      }else if(a->beta == 1.0){
+        for(ii = 0; ii < tile_M; ii++){
+          for(jj = 0; jj < tile_N; jj++){
+            binned_sbsconv(a->fold, Ct[ii * a->ldc + jj], CI + (ii * tile_N + jj) * binned_sbnum(a->fold));
+          }
+        }
+      }else{
+        for(ii = 0; ii < tile_M; ii++){
+          for(jj = 0; jj < tile_N; jj++){
+            binned_sbsconv(a->fold, Ct[ii * a->ldc + jj] * a->beta, CI + (ii * tile_N + jj) * binned_sbnum(a->fold));
+          }
+        }
+      }
+      binnedBLAS_sbsgemm(a->fold, a->Order, a->TransA, a->TransB, tile_M, tile_N, a->K, a->alpha, a->A + i * a->rowA, a->lda, a->B + j * a->colB, a->ldb, CI, tile_N);
+      for(ii = 0; ii < tile_M; ii++){
+        for(jj = 0; jj < tile_N; jj++){
+          Ct[ii * a->ldc + jj] = binned_ssbconv(a->fold, CI + (ii * tile_N + jj) * binned_sbnum(a->fold));
+        }
+      }
+      break;
+    default:
+      Ct = a->C + j * a->ldc + i;
+      if(a->beta == 0.0){
+        memset(CI, 0, tile_M * tile_N * binned_sbsbze(a->fold));
+      }else if(a->beta == 1.0){
+        for(jj = 0; jj < tile_N; jj++){
+          for(ii = 0; ii < tile_M; ii++){
+            binned_sbsconv(a->fold, Ct[jj * a->ldc + ii], CI + (jj * tile_M + ii) * binned_sbnum(a->fold));
+          }
+        }
+      }else{
+        for(jj = 0; jj < tile_N; jj++){
+          for(ii = 0; ii < tile_M; ii++){
+            binned_sbsconv(a->fold, Ct[jj * a->ldc + ii] * a->beta, CI + (jj * tile_M + ii) * binned_sbnum(a->fold));
+          }
+        }
+      }
+      binnedBLAS_sbsgemm(a->fold, a->Order, a->TransA, a->TransB, tile_M, tile_N, a->K, a->alpha, a->A + i * a->rowA, a->lda, a->B + j * a->colB, a->ldb, CI, tile_M);
+      for(jj = 0; jj < tile_N; jj++){
+        for(ii = 0; ii < tile_M; ii++){
+          Ct[jj * a->ldc + ii] = binned_ssbconv(a->fold, CI + (jj * tile_M + ii) * binned_sbnum(a->fold));
+        }
+      }
+      break;
+  }
+}
+
 /**
  * @brief Add to single precision matrix C the reproducible matrix-matrix product of single precision matrices A and B
  *
@@ -19,6 +134,8 @@
  *
  * The matrix-matrix product is computed using binned types with #binnedBLAS_sbsgemm()
  *
+ * C is converted to binned form in tiles of #GEMMTILE by #GEMMTILE elements, so the extra memory used is proportional to the size of a tile (per thread) rather than the size of C. Large products process different tiles on different threads, and when there are fewer tiles than threads the tiles are processed one after another, each with a threaded product. Each element of C is accumulated in the same order regardless of the tiling or the number of threads.
+ *
  * @param fold the fold of the binned types
  * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
  * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
@@ -43,63 +160,61 @@ void reproBLAS_rsgemm(const int fold, const char Order, const char TransA, const
                       const float alpha, const float *A, const int lda,
                       const float *B, const int ldb,
                       const float beta, float *C, const int ldc){
-  float_binned *CI;
-  int i;
-  int j;
+  int num_tiles_M;
+  int num_tiles_N;
+  int num_threads;
+  int rowA;
+  int colB;
+  reproBLAS_rsgemm_args args;
+  int t;
 
   if(M == 0 || N == 0){
     return;
   }
 
-  CI = (float_binned*)malloc(M * N * binned_sbsbze(fold));
   switch(Order){
     case 'r':
     case 'R':
-      if(beta == 0.0){
-        memset(CI, 0, M * N * binned_sbsbze(fold));
-      }else if(beta == 1.0){
-        for(i = 0; i < M; i++){
-          for(j = 0; j < N; j++){
-            binned_sbsconv(fold, C[i * ldc + j], CI + (i * N + j) * binned_sbnum(fold));
-          }
-        }
-      }else{
-        for(i = 0; i < M; i++){
-          for(j = 0; j < N; j++){
-            binned_sbsconv(fold, C[i * ldc + j] * beta, CI + (i * N + j) * binned_sbnum(fold));
-          }
-        }
-      }
-      binnedBLAS_sbsgemm(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, N);
-      for(i = 0; i < M; i++){
-        for(j = 0; j < N; j++){
-          C[i * ldc + j] = binned_ssbconv(fold, CI + (i * N + j) * binned_sbnum(fold));
-        }
-      }
+      rowA = (TransA == 'n' || TransA == 'N') ? lda : 1;
+      colB = (TransB == 'n' || TransB == 'N') ? 1 : ldb;
       break;
     default:
-      if(beta == 0.0){
-        memset(CI, 0, M * N * binned_sbsbze(fold));
-      }else if(beta == 1.0){
-        for(j = 0; j < N; j++){
-          for(i = 0; i < M; i++){
-            binned_sbsconv(fold, C[j * ldc + i], CI + (j * M + i) * binned_sbnum(fold));
-          }
-        }
-      }else{
-        for(j = 0; j < N; j++){
-          for(i = 0; i < M; i++){
-            binned_sbsconv(fold, C[j * ldc + i] * beta, CI + (j * M + i) * binned_sbnum(fold));
-          }
-        }
-      }
-      binnedBLAS_sbsgemm(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, M);
-      for(j = 0; j < N; j++){
-        for(i = 0; i < M; i++){
-          C[j * ldc + i] = binned_ssbconv(fold, CI + (j * M + i) * binned_sbnum(fold));
-        }
-      }
+      rowA = (TransA == 'n' || TransA == 'N') ? 1 : lda;
+      colB = (TransB == 'n' || TransB == 'N') ? ldb : 1;
       break;
   }
-  free(CI);
+
+  //C is converted to and from binned form one tile at a time, one tile per thread
+  //nested products are serial, so with fewer tiles than threads the tiles run on the calling thread and each product is threaded instead
+  num_tiles_M = (M + GEMMTILE - 1) / GEMMTILE;
+  num_tiles_N = (N + GEMMTILE - 1) / GEMMTILE;
+  num_threads = binnedBLAS_nthreads((int)MIN((double)M * N * K, (double)INT_MAX));
+  if(num_threads > num_tiles_M * num_tiles_N){
+    num_threads = 1;
+  }
+
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.TransB = TransB;
+  args.M = M;
+  args.N = N;
+  args.K = K;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.B = B;
+  args.ldb = ldb;
+  args.beta = beta;
+  args.C = C;
+  args.ldc = ldc;
+  args.num_tiles_N = num_tiles_N;
+  args.rowA = rowA;
+  args.colB = colB;
+  args.CIs = (float_binned**)calloc(num_threads, sizeof(float_binned*));
+  binnedBLAS_parallel(num_threads, num_tiles_M * num_tiles_N, &reproBLAS_rsgemm_task, &args);
+  for(t = 0; t < num_threads; t++){
+    free(args.CIs[t]);
+  }
+  free(args.CIs);
 }
@@ -0,0 +1,191 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include <reproBLAS.h>
+#include <binnedBLAS.h>
+
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rsgemm_batch_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  char Order;
+  char TransA;
+  char TransB;
+  int M;
+  int N;
+  int K;
+  float alpha;
+  const float *const *A;
+  int lda;
+  const float *const *B;
+  int ldb;
+  float beta;
+  float *const *C;
+  int ldc;
+  float_binned **CIs;
+  float **works;
+} reproBLAS_rsgemm_batch_args;
+
+/**
+ * @internal
+ * @brief Compute product b of the batch (a task of #reproBLAS_rsgemm_batch())
+ *
+ * Each thread allocates its workspace the first time it runs a task.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rsgemm_batch_task(void *args, const int b, const int thread){
+  reproBLAS_rsgemm_batch_args *a = (reproBLAS_rsgemm_batch_args*)args;
+  float_binned *CI;
+  float *work;
+  float *Cb;
+  int i;
+  int j;
+
+  if(a->CIs[thread] == NULL){
+    a->CIs[thread] = (float_binned*)malloc(a->M * a->N * binned_sbsbze(a->fold));
+  }
+  CI = a->CIs[thread];
+  if(a->works[thread] == NULL){
+    a->works[thread] = (float*)malloc((a->M + a->N) * (a->K + 1) * sizeof(float));
+  }
+  work = a->works[thread];
+
+  Cb = a->C[b];
+  switch(a->Order){
+    case 'r':
+    case 'R':
+      if(a->beta == 0.0){
+        memset(CI, 0, a->M * a->N * binned_sbsbze(a->fold));
+      }else if(a->beta == 1.0){
+        for(i = 0; i < a->M; i++){
+          for(j = 0; j < a->N; j++){
+            binned_sbsconv(a->fold, Cb[i * a->ldc + j], CI + (i * a->N + j) * binned_sbnum(a->fold));
+          }
+        }
+      }else{
+        for(i = 0; i < a->M; i++){
+          for(j = 0; j < a->N; j++){
+            binned_sbsconv(a->fold, Cb[i * a->ldc + j] * a->beta, CI + (i * a->N + j) * binned_sbnum(a->fold));
+          }
+        }
+      }
+      binnedBLAS_sbsgemm_small(a->fold, a->Order, a->TransA, a->TransB, a->M, a->N, a->K, a->alpha, a->A[b], a->lda, a->B[b], a->ldb, CI, a->N, work);
+      for(i = 0; i < a->M; i++){
+        for(j = 0; j < a->N; j++){
+          Cb[i * a->ldc + j] = binned_ssbconv(a->fold, CI + (i * a->N + j) * binned_sbnum(a->fold));
+        }
+      }
+      break;
+    default:
+      if(a->beta == 0.0){
+        memset(CI, 0, a->M * a->N * binned_sbsbze(a->fold));
+      }else if(a->beta == 1.0){
+        for(j = 0; j < a->N; j++){
+          for(i = 0; i < a->M; i++){
+            binned_sbsconv(a->fold, Cb[j * a->ldc + i], CI + (j * a->M + i) * binned_sbnum(a->fold));
+          }
+        }
+      }else{
+        for(j = 0; j < a->N; j++){
+          for(i = 0; i < a->M; i++){
+            binned_sbsconv(a->fold, Cb[j * a->ldc + i] * a->beta, CI + (j * a->M + i) * binned_sbnum(a->fold));
+          }
+        }
+      }
+      binnedBLAS_sbsgemm_small(a->fold, a->Order, a->TransA, a->TransB, a->M, a->N, a->K, a->alpha, a->A[b], a->lda, a->B[b], a->ldb, CI, a->M, work);
+      for(j = 0; j < a->N; j++){
+        for(i = 0; i < a->M; i++){
+          Cb[j * a->ldc + i] = binned_ssbconv(a->fold, CI + (j * a->M + i) * binned_sbnum(a->fold));
+        }
+      }
+      break;
+  }
+}
+
+/**
+ * @brief Add to each single precision matrix in a batch the reproducible matrix-matrix product of the corresponding single precision matrices
+ *
+ * For b < batch_count, performs one of the matrix-matrix operations
+ *
+ *   C_b := alpha*op(A_b)*op(B_b) + beta*C_b,
+ *
+ * where A_b = A[b], B_b = B[b] and C_b = C[b], and op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T.
+ *
+ * All matrices of the batch have the same dimensions and leading dimensions.
+ *
+ * Each product is computed using binned types with #binnedBLAS_sbsgemm_small(). Each thread allocates one binned copy of an M by N matrix and one workspace for the whole batch, and entries of the batch are spread across threads. The result of each entry is the same as that of #reproBLAS_rsgemm(), regardless of the number of threads.
+ *
+ * @param fold the fold of the binned types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix op(A_b) and of the matrix C_b.
+ * @param N number of columns of matrix op(B_b) and of the matrix C_b.
+ * @param K number of columns of matrix op(A_b) and columns of the matrix op(B_b).
+ * @param alpha scalar alpha
+ * @param A array of single precision matrices of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A_b as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B array of single precision matrices of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B_b as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param beta scalar beta
+ * @param C array of single precision matrices of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C_b as declared in the calling program. ldc must be at least N in row major or M in column major.
+ * @param batch_count number of products
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void reproBLAS_rsgemm_batch(const int fold, const char Order, const char TransA, const char TransB,
+                      const int M, const int N, const int K,
+                      const float alpha, const float *const *A, const int lda,
+                      const float *const *B, const int ldb,
+                      const float beta, float *const *C, const int ldc,
+                      const int batch_count){
+  int num_threads;
+  reproBLAS_rsgemm_batch_args args;
+  int t;
+
+  if(M == 0 || N == 0 || batch_count <= 0){
+    return;
+  }
+
+  num_threads = binnedBLAS_nthreads((int)MIN((double)M * N * MAX(K, 1) * batch_count, (double)INT_MAX));
+  num_threads = MIN(num_threads, batch_count);
+
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.TransB = TransB;
+  args.M = M;
+  args.N = N;
+  args.K = K;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.B = B;
+  args.ldb = ldb;
+  args.beta = beta;
+  args.C = C;
+  args.ldc = ldc;
+  args.CIs = (float_binned**)calloc(num_threads, sizeof(float_binned*));
+  args.works = (float**)calloc(num_threads, sizeof(float*));
+  binnedBLAS_parallel(num_threads, batch_count, &reproBLAS_rsgemm_batch_task, &args);
+  for(t = 0; t < num_threads; t++){
+    free(args.CIs[t]);
+    free(args.works[t]);
+  }
+  free(args.CIs);
+  free(args.works);
+}
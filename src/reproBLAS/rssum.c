@@ -1,6 +1,41 @@
+#include <stddef.h>
+
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rssum_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const float *X;
+  int incX;
+  float_binned *sumis;
+} reproBLAS_rssum_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rssum())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rssum_task(void *args, const int i, const int thread){
+  reproBLAS_rssum_args *a = (reproBLAS_rssum_args*)args;
+  (void)thread;
+
+  binned_sbsetzero(a->fold, a->sumis + i * binned_sbnum(a->fold));
+  binnedBLAS_sbssum(a->fold, MIN(a->block_N, a->N - i * a->block_N), a->X + (ptrdiff_t)i * a->block_N * a->incX, a->incX, a->sumis + i * binned_sbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible sum of single precision vector X
  *
@@ -8,6 +43,8 @@
  *
  * The reproducible sum is computed with binned types using #binnedBLAS_sbssum()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_sbsbadd()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X single precision vector
@@ -19,11 +56,31 @@
  */
 float reproBLAS_rssum(const int fold, const int N, const float* X, const int incX) {
   float_binned *sumi = binned_sballoc(fold);
+  float_binned *sumis;
   float sum;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rssum_args args;
 
   binned_sbsetzero(fold, sumi);
 
-  binnedBLAS_sbssum(fold, N, X, incX, sumi);
+  if(num_threads == 1){
+    binnedBLAS_sbssum(fold, N, X, incX, sumi);
+  }else{
+    sumis = (float_binned*)malloc(num_threads * binned_sbsbze(fold));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.sumis = sumis;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rssum_task, &args);
+    for(i = 0; i < num_threads; i++){
+      binned_sbsbadd(fold, sumis + i * binned_sbnum(fold), sumi);
+    }
+    free(sumis);
+  }
 
   sum = binned_ssbconv(fold, sumi);
   free(sumi);
@@ -1,6 +1,43 @@
+#include <stddef.h>
+
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rzdotc_sub_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const void *X;
+  int incX;
+  const void *Y;
+  int incY;
+  double_complex_binned *dotcis;
+} reproBLAS_rzdotc_sub_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rzdotc_sub())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rzdotc_sub_task(void *args, const int i, const int thread){
+  reproBLAS_rzdotc_sub_args *a = (reproBLAS_rzdotc_sub_args*)args;
+  (void)thread;
+
+  binned_zbsetzero(a->fold, a->dotcis + i * binned_zbnum(a->fold));
+  binnedBLAS_zbzdotc(a->fold, MIN(a->block_N, a->N - i * a->block_N), (const double*)a->X + 2 * (ptrdiff_t)i * a->block_N * a->incX, a->incX, (const double*)a->Y + 2 * (ptrdiff_t)i * a->block_N * a->incY, a->incY, a->dotcis + i * binned_zbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible conjugated dot product of complex double precision vectors X and Y
  *
@@ -8,6 +45,8 @@
  *
  * The reproducible dot product is computed with binned types using #binnedBLAS_zbzdotc()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_zbzbadd()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X complex double precision vector
@@ -21,10 +60,32 @@
  */
 void reproBLAS_rzdotc_sub(const int fold, const int N, const void* X, const int incX, const void *Y, const int incY, void *dotc) {
   double_complex_binned *dotci = binned_zballoc(fold);
+  double_complex_binned *dotcis;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rzdotc_sub_args args;
 
   binned_zbsetzero(fold, dotci);
 
-  binnedBLAS_zbzdotc(fold, N, X, incX, Y, incY, dotci);
+  if(num_threads == 1){
+    binnedBLAS_zbzdotc(fold, N, X, incX, Y, incY, dotci);
+  }else{
+    dotcis = (double_complex_binned*)malloc(num_threads * binned_zbsize(fold));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.Y = Y;
+    args.incY = incY;
+    args.dotcis = dotcis;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rzdotc_sub_task, &args);
+    for(i = 0; i < num_threads; i++){
+      binned_zbzbadd(fold, dotcis + i * binned_zbnum(fold), dotci);
+    }
+    free(dotcis);
+  }
 
   binned_zzbconv_sub(fold, dotci, dotc);
   free(dotci);
@@ -1,9 +1,129 @@
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+#include "../../config.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rzgemm_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  char Order;
+  char TransA;
+  char TransB;
+  int M;
+  int N;
+  int K;
+  const void *alpha;
+  const void *A;
+  int lda;
+  const void *B;
+  int ldb;
+  const void *beta;
+  void *C;
+  int ldc;
+  int num_tiles_N;
+  int rowA;
+  int colB;
+  double_complex_binned **CIs;
+} reproBLAS_rzgemm_args;
+
+/**
+ * @internal
+ * @brief Compute one tile of C (a task of #reproBLAS_rzgemm())
+ *
+ * Each thread allocates its workspace the first time it runs a task.
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rzgemm_task(void *args, const int tile, const int thread){
+  reproBLAS_rzgemm_args *a = (reproBLAS_rzgemm_args*)args;
+  double_complex_binned *CI;
+  double *Ct;
+  double betaC[2];
+  int tile_M;
+  int tile_N;
+  int i;
+  int j;
+  int ii;
+  int jj;
+
+  if(a->CIs[thread] == NULL){
+    a->CIs[thread] = (double_complex_binned*)malloc(GEMMTILE * GEMMTILE * binned_zbsize(a->fold));
+  }
+  CI = a->CIs[thread];
+
+  i = (tile / a->num_tiles_N) * GEMMTILE;
+  j = (tile % a->num_tiles_N) * GEMMTILE;
+  tile_M = MIN(GEMMTILE, a->M - i);
+  tile_N = MIN(GEMMTILE, a->N - j);
+  switch(a->Order){
+    case 'r':
+    case 'R':
+      Ct = (double*)a->C + 2 * (i * a->ldc + j);
+      if(((double*)a->beta)[0] == 0.0 && ((double*)a->beta)[1] == 0.0){
+        memset(CI, 0, tile_M * tile_N * binned_zbsize(a->fold));
+      }else if(((double*)a->beta)[0] == 1.0 && ((double*)a->beta)[1] == 0.0){
+        for(ii = 0; ii < tile_M; ii++){
+          for(jj = 0; jj < tile_N; jj++){
+            binned_zbzconv(a->fold, Ct + 2 * (ii * a->ldc + jj), CI + (ii * tile_N + jj) * binned_zbnum(a->fold));
+          }
+        }
+      }else{
+        for(ii = 0; ii < tile_M; ii++){
+          for(jj = 0; jj < tile_N; jj++){
+            betaC[0] = Ct[2 * (ii * a->ldc + jj)] * ((double*)a->beta)[0] - Ct[2 * (ii * a->ldc + jj) + 1] * ((double*)a->beta)[1],
+            betaC[1] = Ct[2 * (ii * a->ldc + jj)] * ((double*)a->beta)[1] + Ct[2 * (ii * a->ldc + jj) + 1] * ((double*)a->beta)[0],
+            binned_zbzconv(a->fold, betaC, CI + (ii * tile_N + jj) * binned_zbnum(a->fold));
+          }
+        }
+      }
+      binnedBLAS_zbzgemm(a->fold, a->Order, a->TransA, a->TransB, tile_M, tile_N, a->K, a->alpha, (const double*)a->A + 2 * i * a->rowA, a->lda, (const double*)a->B + 2 * j * a->colB, a->ldb, CI, tile_N);
+      for(ii = 0; ii < tile_M; ii++){
+        for(jj = 0; jj < tile_N; jj++){
+          binned_zzbconv_sub(a->fold, CI + (ii * tile_N + jj) * binned_zbnum(a->fold), Ct + 2 * (ii * a->ldc + jj));
+        }
+      }
+      break;
+    default:
+      Ct = (double*)a->C + 2 * (j * a->ldc + i);
+      if(((double*)a->beta)[0] == 0.0 && ((double*)a->beta)[1] == 0.0){
+        memset(CI, 0, tile_M * tile_N * binned_zbsize(a->fold));
+      }else if(((double*)a->beta)[0] == 1.0 && ((double*)a->beta)[1] == 0.0){
+        for(jj = 0; jj < tile_N; jj++){
+          for(ii = 0; ii < tile_M; ii++){
+            binned_zbzconv(a->fold, Ct + 2 * (jj * a->ldc + ii), CI + (jj * tile_M + ii) * binned_zbnum(a->fold));
+          }
+        }
+      }else{
+        for(jj = 0; jj < tile_N; jj++){
+          for(ii = 0; ii < tile_M; ii++){
+            betaC[0] = Ct[2 * (jj * a->ldc + ii)] * ((double*)a->beta)[0] - Ct[2 * (jj * a->ldc + ii) + 1] * ((double*)a->beta)[1],
+            betaC[1] = Ct[2 * (jj * a->ldc + ii)] * ((double*)a->beta)[1] + Ct[2 * (jj * a->ldc + ii) + 1] * ((double*)a->beta)[0],
+            binned_zbzconv(a->fold, betaC, CI + (jj * tile_M + ii) * binned_zbnum(a->fold));
+          }
+        }
+      }
+      binnedBLAS_zbzgemm(a->fold, a->Order, a->TransA, a->TransB, tile_M, tile_N, a->K, a->alpha, (const double*)a->A + 2 * i * a->rowA, a->lda, (const double*)a->B + 2 * j * a->colB, a->ldb, CI, tile_M);
+      for(jj = 0; jj < tile_N; jj++){
+        for(ii = 0; ii < tile_M; ii++){
+          binned_zzbconv_sub(a->fold, CI + (jj * tile_M + ii) * binned_zbnum(a->fold), Ct + 2 * (jj * a->ldc + ii));
+        }
+      }
+      break;
+  }
+}
+
 /**
  * @brief Add to complex double precision matrix C the reproducible matrix-matrix product of complex double precision matrices A and B
  *
@@ -19,6 +139,8 @@
  *
  * The matrix-matrix product is computed using binned types with #binnedBLAS_zbzgemm()
  *
+ * C is converted to binned form in tiles of #GEMMTILE by #GEMMTILE elements, so the extra memory used is proportional to the size of a tile (per thread) rather than the size of C. Large products process different tiles on different threads, and when there are fewer tiles than threads the tiles are processed one after another, each with a threaded product. Each element of C is accumulated in the same order regardless of the tiling or the number of threads.
+ *
  * @param fold the fold of the binned types
  * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
  * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
@@ -43,68 +165,61 @@ void reproBLAS_rzgemm(const int fold, const char Order, const char TransA, const
                       const void *alpha, const void *A, const int lda,
                       const void *B, const int ldb,
                       const void *beta, void *C, const int ldc){
-  double_complex_binned *CI;
-  double betaC[2];
-  int i;
-  int j;
+  int num_tiles_M;
+  int num_tiles_N;
+  int num_threads;
+  int rowA;
+  int colB;
+  reproBLAS_rzgemm_args args;
+  int t;
 
   if(M == 0 || N == 0){
     return;
   }
 
-  CI = (double_complex_binned*)malloc(M * N * binned_zbsize(fold));
   switch(Order){
     case 'r':
     case 'R':
-      if(((double*)beta)[0] == 0.0 && ((double*)beta)[1] == 0.0){
-        memset(CI, 0, M * N * binned_zbsize(fold));
-      }else if(((double*)beta)[0] == 1.0 && ((double*)beta)[1] == 0.0){
-        for(i = 0; i < M; i++){
-          for(j = 0; j < N; j++){
-            binned_zbzconv(fold, ((double*)C) + 2 * (i * ldc + j), CI + (i * N + j) * binned_zbnum(fold));
-          }
-        }
-      }else{
-        for(i = 0; i < M; i++){
-          for(j = 0; j < N; j++){
-            betaC[0] = ((double*)C)[2 * (i * ldc + j)] * ((double*)beta)[0] - ((double*)C)[2 * (i * ldc + j) + 1] * ((double*)beta)[1],
-            betaC[1] = ((double*)C)[2 * (i * ldc + j)] * ((double*)beta)[1] + ((double*)C)[2 * (i * ldc + j) + 1] * ((double*)beta)[0],
-            binned_zbzconv(fold, betaC, CI + (i * N + j) * binned_zbnum(fold));
-          }
-        }
-      }
-      binnedBLAS_zbzgemm(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, N);
-      for(i = 0; i < M; i++){
-        for(j = 0; j < N; j++){
-          binned_zzbconv_sub(fold, CI + (i * N + j) * binned_zbnum(fold), ((double*)C) + 2 * (i * ldc + j));
-        }
-      }
+      rowA = (TransA == 'n' || TransA == 'N') ? lda : 1;
+      colB = (TransB == 'n' || TransB == 'N') ? 1 : ldb;
       break;
     default:
-      if(((double*)beta)[0] == 0.0 && ((double*)beta)[1] == 0.0){
-        memset(CI, 0, M * N * binned_zbsize(fold));
-      }else if(((double*)beta)[0] == 1.0 && ((double*)beta)[1] == 0.0){
-        for(j = 0; j < N; j++){
-          for(i = 0; i < M; i++){
-            binned_zbzconv(fold, ((double*)C) + 2 * (j * ldc + i), CI + (j * M + i) * binned_zbnum(fold));
-          }
-        }
-      }else{
-        for(j = 0; j < N; j++){
-          for(i = 0; i < M; i++){
-            betaC[0] = ((double*)C)[2 * (j * ldc + i)] * ((double*)beta)[0] - ((double*)C)[2 * (j * ldc + i) + 1] * ((double*)beta)[1],
-            betaC[1] = ((double*)C)[2 * (j * ldc + i)] * ((double*)beta)[1] + ((double*)C)[2 * (j * ldc + i) + 1] * ((double*)beta)[0],
-            binned_zbzconv(fold, betaC, CI + (j * M + i) * binned_zbnum(fold));
-          }
-        }
-      }
-      binnedBLAS_zbzgemm(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, M);
-      for(j = 0; j < N; j++){
-        for(i = 0; i < M; i++){
-          binned_zzbconv_sub(fold, CI + (j * M + i) * binned_zbnum(fold), ((double*)C) + 2 * (j * ldc + i));
-        }
-      }
+      rowA = (TransA == 'n' || TransA == 'N') ? 1 : lda;
+      colB = (TransB == 'n' || TransB == 'N') ? ldb : 1;
       break;
   }
-  free(CI);
+
+  //C is converted to and from binned form one tile at a time, one tile per thread
+  //nested products are serial, so with fewer tiles than threads the tiles run on the calling thread and each product is threaded instead
+  num_tiles_M = (M + GEMMTILE - 1) / GEMMTILE;
+  num_tiles_N = (N + GEMMTILE - 1) / GEMMTILE;
+  num_threads = binnedBLAS_nthreads((int)MIN((double)M * N * K, (double)INT_MAX));
+  if(num_threads > num_tiles_M * num_tiles_N){
+    num_threads = 1;
+  }
+
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.TransB = TransB;
+  args.M = M;
+  args.N = N;
+  args.K = K;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.B = B;
+  args.ldb = ldb;
+  args.beta = beta;
+  args.C = C;
+  args.ldc = ldc;
+  args.num_tiles_N = num_tiles_N;
+  args.rowA = rowA;
+  args.colB = colB;
+  args.CIs = (double_complex_binned**)calloc(num_threads, sizeof(double_complex_binned*));
+  binnedBLAS_parallel(num_threads, num_tiles_M * num_tiles_N, &reproBLAS_rzgemm_task, &args);
+  for(t = 0; t < num_threads; t++){
+    free(args.CIs[t]);
+  }
+  free(args.CIs);
 }
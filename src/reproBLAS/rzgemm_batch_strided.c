@@ -0,0 +1,71 @@
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+
+/**
+ * @brief Add to each complex double precision matrix in a strided batch the reproducible matrix-matrix product of the corresponding complex double precision matrices
+ *
+ * For b < batch_count, performs one of the matrix-matrix operations
+ *
+ *   C_b := alpha*op(A_b)*op(B_b) + beta*C_b,
+ *
+ * where A_b = A + b * strideA, B_b = B + b * strideB and C_b = C + b * strideC, and op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H.
+ *
+ * All matrices of the batch have the same dimensions and leading dimensions. A stride of 0 for A or B reuses the same matrix for every product.
+ *
+ * The entries of the batch are located once and computed with #reproBLAS_rzgemm_batch(), so the result of each entry is the same as that of #reproBLAS_rzgemm(), regardless of the number of threads.
+ *
+ * @param fold the fold of the binned types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A_b) and of the matrix C_b.
+ * @param N number of columns of matrix op(B_b) and of the matrix C_b.
+ * @param K number of columns of matrix op(A_b) and columns of the matrix op(B_b).
+ * @param alpha scalar alpha
+ * @param A complex double precision matrices of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A_b as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param strideA distance (in complex elements) between A_b and A_(b + 1)
+ * @param B complex double precision matrices of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B_b as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param strideB distance (in complex elements) between B_b and B_(b + 1)
+ * @param beta scalar beta
+ * @param C complex double precision matrices of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C_b as declared in the calling program. ldc must be at least N in row major or M in column major.
+ * @param strideC distance (in complex elements) between C_b and C_(b + 1)
+ * @param batch_count number of products
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void reproBLAS_rzgemm_batch_strided(const int fold, const char Order, const char TransA, const char TransB,
+                      const int M, const int N, const int K,
+                      const void *alpha, const void *A, const int lda, const int strideA,
+                      const void *B, const int ldb, const int strideB,
+                      const void *beta, void *C, const int ldc, const int strideC,
+                      const int batch_count){
+  const void **As;
+  const void **Bs;
+  void **Cs;
+  int b;
+
+  if(M == 0 || N == 0 || batch_count <= 0){
+    return;
+  }
+
+  As = (const void**)malloc(batch_count * sizeof(void*));
+  Bs = (const void**)malloc(batch_count * sizeof(void*));
+  Cs = (void**)malloc(batch_count * sizeof(void*));
+  for(b = 0; b < batch_count; b++){
+    As[b] = (const double*)A + 2 * (ptrdiff_t)b * strideA;
+    Bs[b] = (const double*)B + 2 * (ptrdiff_t)b * strideB;
+    Cs[b] = (double*)C + 2 * (ptrdiff_t)b * strideC;
+  }
+  reproBLAS_rzgemm_batch(fold, Order, TransA, TransB, M, N, K, alpha, As, lda, Bs, ldb, beta, Cs, ldc, batch_count);
+  free(As);
+  free(Bs);
+  free(Cs);
+}
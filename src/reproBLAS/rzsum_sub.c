@@ -1,6 +1,41 @@
+#include <stddef.h>
+
 #include <reproBLAS.h>
 #include <binnedBLAS.h>
 
+#include "../common/common.h"
+
+/**
+ * @internal
+ * @brief Arguments of #reproBLAS_rzsum_sub_task()
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+typedef struct{
+  int fold;
+  int N;
+  int block_N;
+  const void *X;
+  int incX;
+  double_complex_binned *sumis;
+} reproBLAS_rzsum_sub_args;
+
+/**
+ * @internal
+ * @brief Reduce block i of the input into partial result i (a task of #reproBLAS_rzsum_sub())
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+static void reproBLAS_rzsum_sub_task(void *args, const int i, const int thread){
+  reproBLAS_rzsum_sub_args *a = (reproBLAS_rzsum_sub_args*)args;
+  (void)thread;
+
+  binned_zbsetzero(a->fold, a->sumis + i * binned_zbnum(a->fold));
+  binnedBLAS_zbzsum(a->fold, MIN(a->block_N, a->N - i * a->block_N), (const double*)a->X + 2 * (ptrdiff_t)i * a->block_N * a->incX, a->incX, a->sumis + i * binned_zbnum(a->fold));
+}
+
 /**
  * @brief Compute the reproducible sum of complex double precision vector X
  *
@@ -8,6 +43,8 @@
  *
  * The reproducible sum is computed with binned types using #binnedBLAS_zbzsum()
  *
+ * Long vectors are split into blocks that are reduced on separate threads and added together with #binned_zbzbadd()
+ *
  * @param fold the fold of the binned types
  * @param N vector length
  * @param X complex double precision vector
@@ -19,10 +56,30 @@
  */
 void reproBLAS_rzsum_sub(const int fold, const int N, const void* X, const int incX, void *sum) {
   double_complex_binned *sumi = binned_zballoc(fold);
+  double_complex_binned *sumis;
+  int num_threads = binnedBLAS_nthreads(N);
+  int block_N = (N + num_threads - 1) / num_threads;
+  int i;
+  reproBLAS_rzsum_sub_args args;
 
   binned_zbsetzero(fold, sumi);
 
-  binnedBLAS_zbzsum(fold, N, X, incX, sumi);
+  if(num_threads == 1){
+    binnedBLAS_zbzsum(fold, N, X, incX, sumi);
+  }else{
+    sumis = (double_complex_binned*)malloc(num_threads * binned_zbsize(fold));
+    args.fold = fold;
+    args.N = N;
+    args.block_N = block_N;
+    args.X = X;
+    args.incX = incX;
+    args.sumis = sumis;
+    binnedBLAS_parallel(num_threads, num_threads, &reproBLAS_rzsum_sub_task, &args);
+    for(i = 0; i < num_threads; i++){
+      binned_zbzbadd(fold, sumis + i * binned_zbnum(fold), sumi);
+    }
+    free(sumis);
+  }
 
   binned_zzbconv_sub(fold, sumi, sum);
   free(sumi);
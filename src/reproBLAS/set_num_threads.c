@@ -0,0 +1,16 @@
+#include <reproBLAS.h>
+#include <binnedBLAS.h>
+
+/**
+ * @brief Set the number of threads used by threaded routines
+ *
+ * The number of threads is set with #binnedBLAS_set_num_threads(). If @p N is less than 1, the default number of threads is restored.
+ *
+ * @param N number of threads
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void reproBLAS_set_num_threads(const int N){
+  binnedBLAS_set_num_threads(N);
+}
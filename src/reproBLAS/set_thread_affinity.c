@@ -0,0 +1,17 @@
+#include <reproBLAS.h>
+#include <binnedBLAS.h>
+
+/**
+ * @brief Set the CPUs that the worker threads run on
+ *
+ * The CPUs are set with #binnedBLAS_set_thread_affinity(). If @p N is 0, workers may run on any CPU.
+ *
+ * @param N number of CPUs
+ * @param cpus CPU numbers
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void reproBLAS_set_thread_affinity(const int N, const int *cpus){
+  binnedBLAS_set_thread_affinity(N, cpus);
+}
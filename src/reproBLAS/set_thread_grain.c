@@ -0,0 +1,16 @@
+#include <reproBLAS.h>
+#include <binnedBLAS.h>
+
+/**
+ * @brief Set the minimum number of elements a thread is given in threaded routines
+ *
+ * The grain is set with #binnedBLAS_set_thread_grain(). If @p N is less than 1, the default grain is restored.
+ *
+ * @param N grain
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void reproBLAS_set_thread_grain(const int N){
+  binnedBLAS_set_thread_grain(N);
+}
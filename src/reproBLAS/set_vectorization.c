@@ -0,0 +1,16 @@
+#include <reproBLAS.h>
+#include <binnedBLAS.h>
+
+/**
+ * @brief Set the instruction set used by vectorized kernels
+ *
+ * The instruction set is set with #binnedBLAS_set_vectorization(). If @p V is negative, the default instruction set is restored. This has no effect unless ReproBLAS was built with runtime dispatch.
+ *
+ * @param V one of #reproBLAS_SISD, #reproBLAS_SSE, #reproBLAS_AVX, #reproBLAS_AVX2, or #reproBLAS_AVX512
+ *
+ * @author Willow Ahrens
+ * @date   17 Oct 2026
+ */
+void reproBLAS_set_vectorization(const int V){
+  binnedBLAS_set_vectorization(V);
+}
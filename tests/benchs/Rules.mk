@@ -25,7 +25,9 @@ TARGETS := bench_damax$(EXE) bench_damaxm$(EXE)                     \
            bench_dbdbadd$(EXE)                                      \
            bench_zbzbadd$(EXE)                                      \
            bench_sbsbadd$(EXE)                                      \
-           bench_cbcbadd$(EXE)
+           bench_cbcbadd$(EXE)                                      \
+           bench_numa$(EXE)                                         \
+           bench_stream$(EXE)
 
 ifeq ($(BUILD_BLAS),true)
 
@@ -45,6 +47,12 @@ TARGETS += bench_idamax$(EXE)                                  \
            bench_cgemv$(EXE) bench_cgemm$(EXE)
 endif
 
+ifeq ($(BUILD_MPI),true)
+
+TARGETS += bench_prddot_start$(EXE) bench_dbreduce_compact$(EXE) bench_reduce$(EXE) \
+           bench_prdgemm$(EXE) bench_prdgemv$(EXE)
+endif
+
 SUBDIRS :=
 
 bench_camax$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDBLAS) bench_camax.o
@@ -64,6 +72,7 @@ bench_ddot$(EXE)_DEPS = $$(LIBTEST) bench_ddot.o
 bench_dgemm$(EXE)_DEPS = $$(LIBTEST) bench_dgemm.o
 bench_dgemv$(EXE)_DEPS = $$(LIBTEST) bench_dgemv.o
 bench_dbdbadd$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDBLAS) bench_dbdbadd.o
+bench_dbreduce_compact$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDMPI) $$(LIBBINNEDBLAS) bench_dbreduce_compact.o
 bench_dnrm2$(EXE)_DEPS = $$(LIBTEST) bench_dnrm2.o
 bench_dsum$(EXE)_DEPS = $$(LIBTEST) bench_dsum.o
 bench_dzasum$(EXE)_DEPS = $$(LIBTEST) bench_dzasum.o
@@ -72,6 +81,10 @@ bench_icamax$(EXE)_DEPS = $$(LIBTEST) bench_icamax.o
 bench_idamax$(EXE)_DEPS = $$(LIBTEST) bench_idamax.o
 bench_isamax$(EXE)_DEPS = $$(LIBTEST) bench_isamax.o
 bench_izamax$(EXE)_DEPS = $$(LIBTEST) bench_izamax.o
+bench_numa$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDBLAS) bench_numa.o
+bench_prddot_start$(EXE)_DEPS = $$(LIBTEST) $$(LIBMPIREPROBLAS) bench_prddot_start.o
+bench_prdgemm$(EXE)_DEPS = $$(LIBTEST) $$(LIBMPIREPROBLAS) $$(LIBREPROBLAS) bench_prdgemm.o
+bench_prdgemv$(EXE)_DEPS = $$(LIBTEST) $$(LIBMPIREPROBLAS) $$(LIBREPROBLAS) bench_prdgemv.o
 bench_rcdotc$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rcdotc.o
 bench_rcdotu$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rcdotu.o
 bench_rcgemm$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rcgemm.o
@@ -85,6 +98,7 @@ bench_rdnrm2$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rdnrm2.o
 bench_rdsum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rdsum.o
 bench_rdzasum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rdzasum.o
 bench_rdznrm2$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rdznrm2.o
+bench_reduce$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDMPI) bench_reduce.o
 bench_rsasum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rsasum.o
 bench_rscasum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rscasum.o
 bench_rscnrm2$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rscnrm2.o
@@ -110,6 +124,7 @@ bench_sbsbadd$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDBLAS) bench_sbsbadd.o
 bench_snrm2$(EXE)_DEPS = $$(LIBTEST) bench_snrm2.o
 bench_ssbconv$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDBLAS) bench_ssbconv.o
 bench_ssum$(EXE)_DEPS = $$(LIBTEST) bench_ssum.o
+bench_stream$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDBLAS) bench_stream.o
 bench_zamax$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDBLAS) bench_zamax.o
 bench_zamaxm$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDBLAS) bench_zamaxm.o
 bench_zdotc$(EXE)_DEPS = $$(LIBTEST) bench_zdotc.o
@@ -137,6 +152,7 @@ bench_ddot$(EXE)_LIBS = -lm
 bench_dgemm$(EXE)_LIBS = -lm
 bench_dgemv$(EXE)_LIBS = -lm
 bench_dbdbadd$(EXE)_LIBS = -lm
+bench_dbreduce_compact$(EXE)_LIBS = $(MPILDFLAGS) -lm
 bench_dnrm2$(EXE)_LIBS = -lm
 bench_dsum$(EXE)_LIBS = -lm
 bench_dzasum$(EXE)_LIBS = -lm
@@ -145,6 +161,10 @@ bench_icamax$(EXE)_LIBS = -lm
 bench_idamax$(EXE)_LIBS = -lm
 bench_isamax$(EXE)_LIBS = -lm
 bench_izamax$(EXE)_LIBS = -lm
+bench_numa$(EXE)_LIBS = -lm
+bench_prddot_start$(EXE)_LIBS = $(MPILDFLAGS) -lm
+bench_prdgemm$(EXE)_LIBS = $(MPILDFLAGS) -lm
+bench_prdgemv$(EXE)_LIBS = $(MPILDFLAGS) -lm
 bench_rcdotc$(EXE)_LIBS = -lm
 bench_rcdotu$(EXE)_LIBS = -lm
 bench_rcgemm$(EXE)_LIBS = -lm
@@ -158,6 +178,7 @@ bench_rdnrm2$(EXE)_LIBS = -lm
 bench_rdsum$(EXE)_LIBS = -lm
 bench_rdzasum$(EXE)_LIBS = -lm
 bench_rdznrm2$(EXE)_LIBS = -lm
+bench_reduce$(EXE)_LIBS = $(MPILDFLAGS) -lm
 bench_rsasum$(EXE)_LIBS = -lm
 bench_rscasum$(EXE)_LIBS = -lm
 bench_rscnrm2$(EXE)_LIBS = -lm
@@ -183,6 +204,7 @@ bench_sbsbadd$(EXE)_LIBS = -lm
 bench_snrm2$(EXE)_LIBS = -lm
 bench_ssbconv$(EXE)_LIBS = -lm
 bench_ssum$(EXE)_LIBS = -lm
+bench_stream$(EXE)_LIBS = -lm
 bench_zamax$(EXE)_LIBS = -lm
 bench_zamaxm$(EXE)_LIBS = -lm
 bench_zdotc$(EXE)_LIBS = -lm
@@ -19,6 +19,9 @@ bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRDSUMTest(), benchs.Bench
 bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRZSUMTest(), benchs.BenchRDZASUMTest(), benchs.BenchRDZNRM2Test(), benchs.BenchRZDOTUTest(), benchs.BenchRZDOTCTest()], ["N", "fold"], [[4096], [3]], attribute, silent_flags="--FillA rand"))
 bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRSSUMTest(), benchs.BenchRSASUMTest(), benchs.BenchRSNRM2Test(), benchs.BenchRSDOTTest()], ["N", "fold"], [[4096], [3]], attribute, silent_flags="--FillA rand"))
 bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRCSUMTest(), benchs.BenchRSCASUMTest(), benchs.BenchRSCNRM2Test(), benchs.BenchRCDOTUTest(), benchs.BenchRCDOTCTest()], ["N", "fold"], [[4096], [3]], attribute, silent_flags="--FillA rand"))
+bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRDSUMTest(), benchs.BenchRDASUMTest(), benchs.BenchRDNRM2Test(), benchs.BenchRDDOTTest()], ["N", "fold", "incX"], [[4096], [3], [1, 2, 8, 64]], attribute, silent_flags="--FillA rand"))
+bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRSSUMTest(), benchs.BenchRSASUMTest(), benchs.BenchRSNRM2Test(), benchs.BenchRSDOTTest()], ["N", "fold", "incX"], [[4096], [3], [1, 2, 8, 64]], attribute, silent_flags="--FillA rand"))
+bench_harness.add_suite(benchs.BenchSuite([benchs.BenchSTREAMTest()], ["GiB", "fold"], [[1, 2, 4, 8, 16], [3]], "stream(%)", silent_flags="--FillX rand --FillY rand --trials 2"))
 """
 bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRDGEMVTest(), benchs.BenchDGEMVTest()], [("N", "M"), "fold", "Order"], [[(2048, 2048)], [3], ["ColMajor", "RowMajor"]], attribute, silent_flags="--FillA rand --FillX rand"))
 bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRZGEMVTest(), benchs.BenchZGEMVTest()], [("N", "M"), "fold", "Order"], [[(2048, 2048)], [3], ["ColMajor", "RowMajor"]], attribute, silent_flags="--FillA rand --FillX rand"))
@@ -0,0 +1,147 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <mpi.h>
+
+#include <binnedBLAS.h>
+#include <binnedMPI.h>
+
+#include "../common/test_opt.h"
+#include "../common/test_time.h"
+#include "../common/test_metric.h"
+
+#include "../../config.h"
+
+#include "bench_vecvec_fill_header.h"
+
+static opt_option fold;
+static opt_option preN;
+
+static void bench_dbreduce_compact_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = binned_DBMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+
+  preN._int.header.type       = opt_int;
+  preN._int.header.short_name = 'p';
+  preN._int.header.long_name  = "preN";
+  preN._int.header.help       = "number of values summed into each binned accumulator before the reduction";
+  preN._int.required          = 0;
+  preN._int.min               = 1;
+  preN._int.max               = INT_MAX;
+  preN._int.value             = 64;
+}
+
+int bench_vecvec_fill_show_help(void){
+  bench_dbreduce_compact_options_initialize();
+
+  opt_show_option(fold);
+  opt_show_option(preN);
+
+  return 0;
+}
+
+const char* bench_vecvec_fill_name(int argc, char** argv){
+  (void)argc;
+  (void)argv;
+  static char name_buffer[MAX_LINE];
+
+  bench_dbreduce_compact_options_initialize();
+  opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &preN);
+
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Benchmark [dbreduce_compact] (fold = %d, preN = %d)", fold._int.value, preN._int.value);
+  return name_buffer;
+}
+
+int bench_vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY, int trials){
+  (void)FillY;
+  (void)RealScaleY;
+  (void)ImagScaleY;
+  (void)incY;
+  int rc = 0;
+  int i;
+  double time_binned;
+
+  bench_dbreduce_compact_options_initialize();
+  opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &preN);
+
+  util_random_seed();
+
+  int nprocs;
+  int rank;
+  MPI_Init(&argc, &argv);
+  MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  double *preX = util_dvec_alloc(N * preN._int.value, incX);
+  double_binned *X = (double_binned*)util_dvec_alloc(N * binned_dbnum(fold._int.value), 1);
+  double_binned *Y = (double_binned*)util_dvec_alloc(N * binned_dbnum(fold._int.value), 1);
+  double_binned *Y_compact = (double_binned*)util_dvec_alloc(N * binned_dbnum(fold._int.value), 1);
+  void *C = malloc(N * binnedMPI_dbpacksize(fold._int.value));
+  void *D = malloc(N * binnedMPI_dbpacksize(fold._int.value));
+
+  //fill X with different partial sums on each rank
+  util_dvec_fill(N * preN._int.value, preX, incX, FillX, RealScaleX * (rank + 1), ImagScaleX);
+  memset(X, 0, N * binned_dbsize(fold._int.value));
+  for(i = 0; i < N; i++){
+    binnedBLAS_dbdsum(fold._int.value, preN._int.value, preX + i * preN._int.value * incX, incX, X + i * binned_dbnum(fold._int.value));
+  }
+
+  //binned reduction
+  MPI_Barrier(MPI_COMM_WORLD);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    MPI_Allreduce(X, Y, N, binnedMPI_DOUBLE_BINNED(fold._int.value), binnedMPI_DBDBADD(fold._int.value), MPI_COMM_WORLD);
+  }
+  time_toc();
+  time_binned = time_read();
+
+  //packed binned reduction
+  MPI_Barrier(MPI_COMM_WORLD);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    binnedMPI_dbpack(fold._int.value, N, X, 1, C);
+    MPI_Allreduce(C, D, N, binnedMPI_DOUBLE_BINNED_COMPACT(fold._int.value), binnedMPI_DBDBADD_COMPACT(fold._int.value), MPI_COMM_WORLD);
+    binnedMPI_dbunpack(fold._int.value, N, D, Y_compact, 1);
+  }
+  time_toc();
+
+  if(memcmp(Y, Y_compact, N * binned_dbsize(fold._int.value)) != 0){
+    fprintf(stderr, "ReproBLAS error: packed and unpacked binned reductions differ\n");
+    rc = 1;
+  }
+
+  if(rank == 0){
+    double dN = (double)N;
+    metric_load_double("time", time_read());
+    metric_load_double("time_binned", time_binned);
+    metric_load_long_long("bytes", (long long)N * binnedMPI_dbpacksize(fold._int.value));
+    metric_load_long_long("bytes_binned", (long long)N * binned_dbsize(fold._int.value));
+    metric_load_long_long("nprocs", (long long)nprocs);
+    metric_load_double("trials", (double)trials);
+    metric_load_double("input", dN);
+    metric_load_double("output", dN);
+    metric_load_double("normalizer", dN);
+    metric_dump();
+  }
+
+  MPI_Finalize();
+
+  free(preX);
+  free(X);
+  free(Y);
+  free(Y_compact);
+  free(C);
+  free(D);
+  return rc;
+}
@@ -0,0 +1,238 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <binnedBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../common/test_time.h"
+#include "../common/test_metric.h"
+
+#include "../../config.h"
+
+#include "bench_vecvec_fill_header.h"
+
+static opt_option fold;
+static opt_option local;
+static opt_option remote;
+
+static void bench_numa_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = binned_DBMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+
+  local._int.header.type       = opt_int;
+  local._int.header.short_name = 'l';
+  local._int.header.long_name  = "local";
+  local._int.header.help       = "CPU that first touches the data";
+  local._int.required          = 0;
+  local._int.min               = 0;
+  local._int.max               = INT_MAX;
+  local._int.value             = 0;
+
+  remote._int.header.type       = opt_int;
+  remote._int.header.short_name = 'r';
+  remote._int.header.long_name  = "remote";
+  remote._int.header.help       = "CPU that reads the data remotely (-1 for the first CPU on another NUMA node)";
+  remote._int.required          = 0;
+  remote._int.min               = -1;
+  remote._int.max               = INT_MAX;
+  remote._int.value             = -1;
+}
+
+int bench_vecvec_fill_show_help(void){
+  bench_numa_options_initialize();
+
+  opt_show_option(fold);
+  opt_show_option(local);
+  opt_show_option(remote);
+
+  return 0;
+}
+
+const char* bench_vecvec_fill_name(int argc, char** argv){
+  (void)argc;
+  (void)argv;
+  static char name_buffer[MAX_LINE];
+
+  bench_numa_options_initialize();
+  opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &local);
+  opt_eval_option(argc, argv, &remote);
+
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Benchmark [numa] (fold = %d, local = %d, remote = %d)", fold._int.value, local._int.value, remote._int.value);
+  return name_buffer;
+}
+
+//return the NUMA node of a CPU (or -1 if it is not known)
+static int cpu_node(const int cpu){
+#ifdef __linux__
+  char path[MAX_LINE];
+  char list[MAX_LINE];
+  char *s;
+  char *end;
+  long lo;
+  long hi;
+  int node;
+  FILE *file;
+
+  for(node = 0; node < 1024; node++){
+    snprintf(path, MAX_LINE * sizeof(char), "/sys/devices/system/node/node%d/cpulist", node);
+    file = fopen(path, "r");
+    if(file == NULL){
+      continue;
+    }
+    if(fgets(list, MAX_LINE, file) == NULL){
+      list[0] = '\0';
+    }
+    fclose(file);
+    s = list;
+    while(*s != '\0'){
+      lo = strtol(s, &end, 10);
+      if(end == s){
+        break;
+      }
+      hi = lo;
+      s = end;
+      if(*s == '-'){
+        hi = strtol(s + 1, &end, 10);
+        s = end;
+      }
+      if(lo <= cpu && cpu <= hi){
+        return node;
+      }
+      if(*s == ','){
+        s++;
+      }
+    }
+  }
+#else
+  (void)cpu;
+#endif
+  return -1;
+}
+
+//move the calling thread to a CPU
+static void pin(const int cpu){
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  if(sched_setaffinity(0, sizeof(cpu_set_t), &set) != 0){
+    fprintf(stderr, "ReproBLAS warning: could not run on CPU %d\n", cpu);
+  }
+#else
+  (void)cpu;
+#endif
+}
+
+//choose the first CPU available to the process on another NUMA node (or the last one if there is no other node)
+static int remote_cpu(const int cpu){
+  int remote = cpu;
+#ifdef __linux__
+  cpu_set_t set;
+  int i;
+
+  sched_getaffinity(0, sizeof(cpu_set_t), &set);
+  for(i = 0; i < CPU_SETSIZE; i++){
+    if(CPU_ISSET(i, &set)){
+      remote = i;
+      if(i != cpu && cpu_node(i) != cpu_node(cpu)){
+        break;
+      }
+    }
+  }
+#endif
+  return remote;
+}
+
+int bench_vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY, int trials){
+  (void)FillY;
+  (void)RealScaleY;
+  (void)ImagScaleY;
+  (void)incY;
+  int rc = 0;
+  int i;
+  int remote_cpu_value;
+  double time_local;
+  double time_remote;
+  double res_local;
+  double res_remote;
+
+  bench_numa_options_initialize();
+  opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &local);
+  opt_eval_option(argc, argv, &remote);
+
+  remote_cpu_value = remote._int.value >= 0 ? remote._int.value : remote_cpu(local._int.value);
+
+  util_random_seed();
+
+  //first touch X and the binned accumulator on the local CPU
+  pin(local._int.value);
+  double *X = util_dvec_alloc(N, incX);
+  double_binned *Y = binned_dballoc(fold._int.value);
+  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+
+  binned_dbsetzero(fold._int.value, Y);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    binnedBLAS_dbdsum(fold._int.value, N, X, incX, Y);
+  }
+  time_toc();
+  time_local = time_read();
+  res_local = binned_ddbconv(fold._int.value, Y);
+
+  //read X and update the binned accumulator from the remote CPU
+  pin(remote_cpu_value);
+  binned_dbsetzero(fold._int.value, Y);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    binnedBLAS_dbdsum(fold._int.value, N, X, incX, Y);
+  }
+  time_toc();
+  time_remote = time_read();
+  res_remote = binned_ddbconv(fold._int.value, Y);
+
+  if(res_local != res_remote){
+    fprintf(stderr, "ReproBLAS error: local and remote results differ (%g != %g)\n", res_local, res_remote);
+    rc = 1;
+  }
+
+  double dN = (double)N;
+  metric_load_double("time", time_local);
+  metric_load_double("time_remote", time_remote);
+  metric_load_double("bandwidth_local", trials * dN * sizeof(double) / time_local);
+  metric_load_double("bandwidth_remote", trials * dN * sizeof(double) / time_remote);
+  metric_load_long_long("local_cpu", (long long)local._int.value);
+  metric_load_long_long("local_node", (long long)cpu_node(local._int.value));
+  metric_load_long_long("remote_cpu", (long long)remote_cpu_value);
+  metric_load_long_long("remote_node", (long long)cpu_node(remote_cpu_value));
+  metric_load_double("res", res_local);
+  metric_load_double("trials", (double)trials);
+  metric_load_double("input", dN);
+  metric_load_double("output", 1.0);
+  metric_load_double("normalizer", dN);
+  metric_load_double("d_add", (3 * fold._int.value - 2) * dN);
+  metric_load_double("d_orb", fold._int.value * dN);
+  metric_dump();
+
+  free(X);
+  free(Y);
+  return rc;
+}
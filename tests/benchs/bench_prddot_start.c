@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <mpi.h>
+
+#include <binnedBLAS.h>
+#include <MPI_reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../common/test_time.h"
+#include "../common/test_metric.h"
+
+#include "../../config.h"
+
+#include "bench_vecvec_fill_header.h"
+
+static opt_option fold;
+static opt_option work;
+
+static void bench_prddot_start_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = binned_DBMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+
+  work._int.header.type       = opt_int;
+  work._int.header.short_name = 'w';
+  work._int.header.long_name  = "work";
+  work._int.header.help       = "passes of independent local work (an axpy over the vector) overlapped with each reduction";
+  work._int.required          = 0;
+  work._int.min               = 0;
+  work._int.max               = INT_MAX;
+  work._int.value             = 4;
+}
+
+int bench_vecvec_fill_show_help(void){
+  bench_prddot_start_options_initialize();
+
+  opt_show_option(fold);
+  opt_show_option(work);
+
+  return 0;
+}
+
+const char* bench_vecvec_fill_name(int argc, char** argv){
+  (void)argc;
+  (void)argv;
+  static char name_buffer[MAX_LINE];
+
+  bench_prddot_start_options_initialize();
+  opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &work);
+
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Benchmark [prddot_start] (fold = %d, work = %d)", fold._int.value, work._int.value);
+  return name_buffer;
+}
+
+static void local_work(const int N, const double *X, const int incX, double *Z, const int passes, pr_request *request){
+  int i, j;
+  for(j = 0; j < passes; j++){
+    for(i = 0; i < N; i++){
+      Z[i] += 0.5 * X[i * incX];
+    }
+    if(request != NULL){
+      prtest(request);
+    }
+  }
+}
+
+int bench_vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY, int trials){
+  int rc = 0;
+  int i;
+  double res = 0.0;
+  double res_blocking = 0.0;
+  double time_blocking;
+  double time_work;
+  pr_request request;
+
+  bench_prddot_start_options_initialize();
+  opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &work);
+
+  util_random_seed();
+
+  int nprocs;
+  int rank;
+  MPI_Init(&argc, &argv);
+  MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  double *X = util_dvec_alloc(N, incX);
+  double *Y = util_dvec_alloc(N, incY);
+  double *Z = util_dvec_alloc(N, 1);
+
+  //fill X, Y and Z
+  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(N, Y, incY, FillY, RealScaleY, ImagScaleY);
+  util_dvec_fill(N, Z, 1, util_Vec_Constant, 1.0, 0.0);
+
+  //local work alone
+  MPI_Barrier(MPI_COMM_WORLD);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    local_work(N, X, incX, Z, work._int.value, NULL);
+  }
+  time_toc();
+  time_work = time_read();
+
+  //blocking reduction followed by the local work
+  MPI_Barrier(MPI_COMM_WORLD);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    res_blocking = prrddot(fold._int.value, MPI_COMM_WORLD, PR_ALL, N, X, incX, Y, incY);
+    local_work(N, X, incX, Z, work._int.value, NULL);
+  }
+  time_toc();
+  time_blocking = time_read();
+
+  //nonblocking reduction overlapped with the local work
+  MPI_Barrier(MPI_COMM_WORLD);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    prrddot_start(fold._int.value, MPI_COMM_WORLD, PR_ALL, N, X, incX, Y, incY, &request);
+    local_work(N, X, incX, Z, work._int.value, &request);
+    res = prdwait(&request);
+  }
+  time_toc();
+
+  if(res != res_blocking){
+    fprintf(stderr, "ReproBLAS error: nonblocking and blocking results differ (%g != %g)\n", res, res_blocking);
+    rc = 1;
+  }
+
+  if(rank == 0){
+    double dN = (double)N;
+    metric_load_double("time", time_read());
+    metric_load_double("time_blocking", time_blocking);
+    metric_load_double("time_work", time_work);
+    metric_load_double("res", res);
+    metric_load_long_long("nprocs", (long long)nprocs);
+    metric_load_double("trials", (double)trials);
+    metric_load_double("input", 2.0 * dN);
+    metric_load_double("output", 1.0);
+    metric_load_double("normalizer", dN);
+    metric_load_double("d_mul", dN);
+    metric_load_double("d_add", (3 * fold._int.value - 2) * dN);
+    metric_load_double("d_orb", fold._int.value * dN);
+    metric_dump();
+  }
+
+  MPI_Finalize();
+
+  free(X);
+  free(Y);
+  free(Z);
+  return rc;
+}
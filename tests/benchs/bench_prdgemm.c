@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <reproBLAS.h>
+#include <MPI_reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../common/test_time.h"
+#include "../common/test_metric.h"
+
+#include "../../config.h"
+
+#include "bench_matmat_fill_header.h"
+
+static opt_option fold;
+
+static void bench_prdgemm_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = binned_DBMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+int bench_matmat_fill_show_help(void){
+  bench_prdgemm_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* bench_matmat_fill_name(int argc, char** argv){
+  (void)argc;
+  (void)argv;
+  bench_prdgemm_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  static char name_buffer[MAX_LINE];
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Benchmark [prdgemm] (fold = %d)", fold._int.value);
+  return name_buffer;
+}
+
+//the first element and the number of elements of block p of n elements divided among P processes
+static int block_start(const int n, const int P, const int p){
+  return (n / P) * p + (p < n % P ? p : n % P);
+}
+
+static int block_size(const int n, const int P, const int p){
+  return block_start(n, P, p + 1) - block_start(n, P, p);
+}
+
+static int at_least_one(const int n){
+  return n > 1 ? n : 1;
+}
+
+//copy the block of op(X) with rows [i0, i0 + m) and columns [j0, j0 + n) from X (with leading dimension ldx) to Y (with leading dimension ldy)
+static void extract_block(const char Order, const char Trans, const int i0, const int j0, const int m, const int n, const double *X, const int ldx, double *Y, const int ldy){
+  int i;
+  int j;
+  int transposed = !(Trans == 'n' || Trans == 'N');
+  int row_major = (Order == 'r' || Order == 'R');
+  for(i = 0; i < m; i++){
+    for(j = 0; j < n; j++){
+      int r = transposed ? j : i;
+      int c = transposed ? i : j;
+      int rX = transposed ? j0 + j : i0 + i;
+      int cX = transposed ? i0 + i : j0 + j;
+      if(row_major){
+        Y[r * ldy + c] = X[rX * ldx + cX];
+      }else{
+        Y[c * ldy + r] = X[cX * ldx + rX];
+      }
+    }
+  }
+}
+
+int bench_matmat_fill_test(int argc, char** argv, char Order, char TransA, char TransB, int M, int N, int K, double RealAlpha, double ImagAlpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillB, double RealScaleB, double ImagScaleB, int ldb, double RealBeta, double ImagBeta, int FillC, double RealScaleC, double ImagScaleC, int ldc, int trials){
+  int rc = 0;
+  int i;
+
+  bench_prdgemm_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  util_random_seed();
+
+  int nprocs;
+  int rank;
+  int dims[2] = {0, 0};
+  int periods[2] = {0, 0};
+  int coords[2];
+  MPI_Comm grid;
+  MPI_Init(&argc, &argv);
+  MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+  MPI_Dims_create(nprocs, 2, dims);
+  MPI_Cart_create(MPI_COMM_WORLD, 2, dims, periods, 0, &grid);
+  MPI_Comm_rank(grid, &rank);
+  MPI_Cart_coords(grid, rank, 2, coords);
+
+  char NTransA;
+  int opAM;
+  int opAK;
+  int opBK;
+  int opBN;
+
+  switch(TransA){
+    case 'n':
+    case 'N':
+      opAM = M;
+      opAK = K;
+      NTransA = 't';
+      break;
+    default:
+      opAM = K;
+      opAK = M;
+      NTransA = 'n';
+      break;
+  }
+
+  switch(TransB){
+    case 'n':
+    case 'N':
+      opBK = K;
+      opBN = N;
+      break;
+    default:
+      opBK = N;
+      opBN = K;
+      break;
+  }
+
+  double *A  = util_dmat_alloc(Order, opAM, opAK, lda);
+  double *B  = util_dmat_alloc(Order, opBK, opBN, ldb);
+  double *C  = util_dmat_alloc(Order, M, N, ldc);
+  double *ref  = util_dmat_alloc(Order, M, N, ldc);
+  double alpha = RealAlpha;
+  double beta = RealBeta;
+
+  util_dmat_fill(Order, NTransA, opAM, opAK, A, lda, FillA, RealScaleA, ImagScaleA);
+  util_dmat_fill(Order, TransB, opBK, opBN, B, ldb, FillB, RealScaleB, ImagScaleB);
+  util_dmat_fill(Order, 'n', M, N, C, ldc, FillC, RealScaleC, ImagScaleC);
+
+  //each process seeds its own generator, so the global matrices of process 0 are shared with the others
+  MPI_Bcast(A, (Order == 'r' || Order == 'R') ? opAM * lda : lda * opAK, MPI_DOUBLE, 0, grid);
+  MPI_Bcast(B, (Order == 'r' || Order == 'R') ? opBK * ldb : ldb * opBN, MPI_DOUBLE, 0, grid);
+  MPI_Bcast(C, (Order == 'r' || Order == 'R') ? M * ldc : ldc * N, MPI_DOUBLE, 0, grid);
+
+  //the rows of C are divided among the grid rows and the columns among the grid columns. The columns of op(A) are divided among the grid columns and the rows of op(B) among the grid rows.
+  int i0 = block_start(M, dims[0], coords[0]);
+  int j0 = block_start(N, dims[1], coords[1]);
+  int kA0 = block_start(K, dims[1], coords[1]);
+  int kB0 = block_start(K, dims[0], coords[0]);
+  int localM = block_size(M, dims[0], coords[0]);
+  int localN = block_size(N, dims[1], coords[1]);
+  int localKA = block_size(K, dims[1], coords[1]);
+  int localKB = block_size(K, dims[0], coords[0]);
+  int row_major = (Order == 'r' || Order == 'R');
+  int transA = !(TransA == 'n' || TransA == 'N');
+  int transB = !(TransB == 'n' || TransB == 'N');
+  int locallda = at_least_one(row_major != transA ? localKA : localM);
+  int localldb = at_least_one(row_major != transB ? localN : localKB);
+  int localldc = at_least_one(row_major ? localN : localM);
+
+  double *localA = (double*)malloc(at_least_one(localM * localKA) * sizeof(double));
+  double *localB = (double*)malloc(at_least_one(localKB * localN) * sizeof(double));
+  double *localC = (double*)malloc(at_least_one(localM * localN) * sizeof(double));
+  double *res = (double*)malloc(at_least_one(localM * localN) * sizeof(double));
+  double *localref = (double*)malloc(at_least_one(localM * localN) * sizeof(double));
+
+  extract_block(Order, TransA, i0, kA0, localM, localKA, A, lda, localA, locallda);
+  extract_block(Order, TransB, kB0, j0, localKB, localN, B, ldb, localB, localldb);
+  extract_block(Order, 'n', i0, j0, localM, localN, C, ldc, localC, localldc);
+
+  //serial reference
+  switch(Order){
+    case 'r':
+    case 'R':
+      memcpy(ref, C, M * ldc * sizeof(double));
+      break;
+    default:
+      memcpy(ref, C, ldc * N * sizeof(double));
+      break;
+  }
+  reproBLAS_rdgemm(fold._int.value, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, ref, ldc);
+  extract_block(Order, 'n', i0, j0, localM, localN, ref, ldc, localref, localldc);
+
+  MPI_Barrier(grid);
+  time_reset();
+  for(i = 0; i < trials; i++){
+    memcpy(res, localC, localM * localN * sizeof(double));
+    time_tic();
+    prrdgemm(fold._int.value, grid, Order, TransA, TransB, localM, localN, localKA, localKB, alpha, localA, locallda, localB, localldb, beta, res, localldc);
+    time_toc();
+  }
+
+  if(trials > 0 && memcmp(res, localref, localM * localN * sizeof(double)) != 0){
+    fprintf(stderr, "ReproBLAS error: distributed and serial results differ on process (%d, %d)\n", coords[0], coords[1]);
+    rc = 1;
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &rc, 1, MPI_INT, MPI_MAX, grid);
+
+  if(rank == 0){
+    double dM = (double)M;
+    double dN = (double)N;
+    double dK = (double)K;
+    metric_load_double("time", time_read());
+    metric_load_long_long("nprocs", (long long)nprocs);
+    metric_load_long_long("prows", (long long)dims[0]);
+    metric_load_long_long("pcols", (long long)dims[1]);
+    metric_load_double("trials", (double)(trials));
+    metric_load_double("input", dM * dK + dK * dN + dM * dN);
+    metric_load_double("output", dN * dM);
+    metric_load_double("normalizer", dN * dM * dK);
+    metric_load_double("d_mul", dN * dM * dK);
+    metric_load_double("d_add", (3 * fold._int.value - 2) * dN * dM * dK);
+    metric_load_double("d_orb", fold._int.value * dN * dM * dK);
+    metric_dump();
+  }
+
+  MPI_Comm_free(&grid);
+  MPI_Finalize();
+
+  free(A);
+  free(B);
+  free(C);
+  free(ref);
+  free(localA);
+  free(localB);
+  free(localC);
+  free(res);
+  free(localref);
+  return rc;
+}
@@ -0,0 +1,228 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <mpi.h>
+
+#include <binned.h>
+#include <reproBLAS.h>
+#include <MPI_reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../common/test_time.h"
+#include "../common/test_metric.h"
+
+#include "../../config.h"
+
+#include "bench_matvec_fill_header.h"
+
+static opt_option fold;
+
+static void bench_prdgemv_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = binned_DBMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+int bench_matvec_fill_show_help(void){
+  bench_prdgemv_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* bench_matvec_fill_name(int argc, char** argv){
+  (void)argc;
+  (void)argv;
+  bench_prdgemv_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  static char name_buffer[MAX_LINE];
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Benchmark [prdgemv] (fold = %d)", fold._int.value);
+  return name_buffer;
+}
+
+//the first element of block p of n elements divided unevenly among P processes. Blocks grow with p, and block 0 is empty if P > 1.
+static int summed_start(const int n, const int P, const int p){
+  if(P == 1){
+    return p * n;
+  }
+  return (int)(((long long)n * (p - 1 > 0 ? p - 1 : 0) * p) / ((long long)(P - 1) * P));
+}
+
+//the first element of block p of the result, divided so that blocks shrink with p and block P - 1 is empty if P > 1
+static int result_start(const int n, const int P, const int p){
+  return n - summed_start(n, P, P - p);
+}
+
+static int at_least_one(const int n){
+  return n > 1 ? n : 1;
+}
+
+//the block of A starting at element k of the dimension that is summed over
+static const double *summed_block(const char Order, const char TransA, const double *A, const int lda, const int k){
+  int columns = (TransA == 'n' || TransA == 'N');
+  int row_major = (Order == 'r' || Order == 'R');
+  return A + (columns == row_major ? k : k * lda);
+}
+
+//compare the slice of y computed by prrdgemv on this process with the serial result of reproBLAS_rdgemv
+static int check_prrdgemv(MPI_Comm comm, const char Order, const char TransA, const int M, const int N, const double alpha, const double *A, const int lda, const double *X, const int incX, const double beta, const double *Y, const int incY){
+  int rc = 0;
+  int nprocs;
+  int rank;
+  int p;
+  int i;
+  int S;
+  int L;
+
+  MPI_Comm_size(comm, &nprocs);
+  MPI_Comm_rank(comm, &rank);
+
+  switch(TransA){
+    case 'n':
+    case 'N':
+      S = N;
+      L = M;
+      break;
+    default:
+      S = M;
+      L = N;
+      break;
+  }
+
+  int *recvcounts = (int*)malloc(nprocs * sizeof(int));
+  for(p = 0; p < nprocs; p++){
+    recvcounts[p] = result_start(L, nprocs, p + 1) - result_start(L, nprocs, p);
+  }
+  int k0 = summed_start(S, nprocs, rank);
+  int localS = summed_start(S, nprocs, rank + 1) - k0;
+  int localM = (TransA == 'n' || TransA == 'N') ? M : localS;
+  int localN = (TransA == 'n' || TransA == 'N') ? localS : N;
+  int r0 = result_start(L, nprocs, rank);
+
+  double *ref = util_dvec_alloc(L, incY);
+  double *res = (double*)malloc(at_least_one(recvcounts[rank] * incY) * sizeof(double));
+  memcpy(ref, Y, L * incY * sizeof(double));
+  memcpy(res, Y + r0 * incY, recvcounts[rank] * incY * sizeof(double));
+
+  reproBLAS_rdgemv(fold._int.value, Order, TransA, M, N, alpha, A, lda, X, incX, beta, ref, incY);
+  prrdgemv(fold._int.value, comm, Order, TransA, localM, localN, alpha, summed_block(Order, TransA, A, lda, k0), lda, X + k0 * incX, incX, beta, res, incY, recvcounts);
+
+  for(i = 0; i < recvcounts[rank]; i++){
+    if(memcmp(res + i * incY, ref + (r0 + i) * incY, sizeof(double)) != 0){
+      fprintf(stderr, "ReproBLAS error: distributed and serial results differ on process %d (Order = %c, TransA = %c, beta = %g)\n", rank, Order, TransA, beta);
+      rc = 1;
+      break;
+    }
+  }
+
+  free(recvcounts);
+  free(ref);
+  free(res);
+  return rc;
+}
+
+int bench_matvec_fill_test(int argc, char** argv, char Order, char TransA, int M, int N, double RealAlpha, double ImagAlpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillX, double RealScaleX, double ImagScaleX, int incX, double RealBeta, double ImagBeta, int FillY, double RealScaleY, double ImagScaleY, int incY, int trials){
+  int rc = 0;
+  int i;
+  int o;
+  int t;
+  int b;
+
+  bench_prdgemv_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  util_random_seed();
+
+  int nprocs;
+  int rank;
+  MPI_Init(&argc, &argv);
+  MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  //X and Y are long enough for either TransA
+  int NV = at_least_one(M > N ? M : N);
+  double *A  = util_dmat_alloc(Order, M, N, lda);
+  double *X  = util_dvec_alloc(NV, incX);
+  double *Y  = util_dvec_alloc(NV, incY);
+  double alpha = RealAlpha;
+  double beta = RealBeta;
+
+  util_dmat_fill(Order, 'n', M, N, A, lda, FillA, RealScaleA, ImagScaleA);
+  util_dvec_fill(NV, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(NV, Y, incY, FillY, RealScaleY, ImagScaleY);
+
+  //each process seeds its own generator, so the global matrices of process 0 are shared with the others
+  MPI_Bcast(A, (Order == 'r' || Order == 'R') ? M * lda : lda * N, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  MPI_Bcast(X, NV * incX, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  MPI_Bcast(Y, NV * incY, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+  //A stored in one order is its transpose (with the same leading dimension) in the other, so every combination of Order, TransA and beta is checked
+  char Orders[2] = {Order, (Order == 'r' || Order == 'R') ? 'c' : 'r'};
+  char TransAs[2] = {'n', 't'};
+  double betas[3] = {0.0, 1.0, (beta == 0.0 || beta == 1.0) ? -1.5 : beta};
+  for(o = 0; o < 2; o++){
+    for(t = 0; t < 2; t++){
+      for(b = 0; b < 3; b++){
+        rc |= check_prrdgemv(MPI_COMM_WORLD, Orders[o], TransAs[t], o == 0 ? M : N, o == 0 ? N : M, alpha, A, lda, X, incX, betas[b], Y, incY);
+      }
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &rc, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+
+  //the timed products use the requested options and the same distribution as the checks
+  int S = (TransA == 'n' || TransA == 'N') ? N : M;
+  int L = (TransA == 'n' || TransA == 'N') ? M : N;
+  int *recvcounts = (int*)malloc(nprocs * sizeof(int));
+  for(i = 0; i < nprocs; i++){
+    recvcounts[i] = result_start(L, nprocs, i + 1) - result_start(L, nprocs, i);
+  }
+  int k0 = summed_start(S, nprocs, rank);
+  int localS = summed_start(S, nprocs, rank + 1) - k0;
+  int localM = (TransA == 'n' || TransA == 'N') ? M : localS;
+  int localN = (TransA == 'n' || TransA == 'N') ? localS : N;
+  double *localY = Y + result_start(L, nprocs, rank) * incY;
+  double *res = (double*)malloc(at_least_one(recvcounts[rank] * incY) * sizeof(double));
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  time_reset();
+  for(i = 0; i < trials; i++){
+    memcpy(res, localY, recvcounts[rank] * incY * sizeof(double));
+    time_tic();
+    prrdgemv(fold._int.value, MPI_COMM_WORLD, Order, TransA, localM, localN, alpha, summed_block(Order, TransA, A, lda, k0), lda, X + k0 * incX, incX, beta, res, incY, recvcounts);
+    time_toc();
+  }
+
+  if(rank == 0){
+    double dM = (double)M;
+    double dN = (double)N;
+    double dL = (double)L;
+    metric_load_double("time", time_read());
+    metric_load_long_long("nprocs", (long long)nprocs);
+    metric_load_double("trials", (double)trials);
+    metric_load_double("input", dN * dM + dN + dM);
+    metric_load_double("output", dL);
+    metric_load_double("normalizer", dN * dM);
+    metric_load_double("d_mul", dN * dM);
+    metric_load_double("d_add", (3 * fold._int.value - 2) * dN * dM);
+    metric_load_double("d_orb", fold._int.value * dN * dM);
+    metric_dump();
+  }
+
+  MPI_Finalize();
+
+  free(A);
+  free(X);
+  free(Y);
+  free(recvcounts);
+  free(res);
+  return rc;
+}
@@ -1,8 +1,12 @@
 #include <stdio.h>
+#include <string.h>
 #include <stdlib.h>
 #include <math.h>
 #include <mpi.h>
 
+#include <binned.h>
+#include <binnedMPI.h>
+
 #include "../common/test_opt.h"
 #include "../common/test_time.h"
 #include "../common/test_metric.h"
@@ -12,7 +16,24 @@
 
 #include "bench_vecvec_fill_header.h"
 
+static opt_option fold;
+
+static void bench_reduce_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = binned_DBMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
 int bench_vecvec_fill_show_help(void){
+  bench_reduce_options_initialize();
+
+  opt_show_option(fold);
+
   return 0;
 }
 
@@ -20,34 +41,57 @@ const char* bench_vecvec_fill_name(int argc, char** argv){
   (void)argc;
   (void)argv;
   static char name_buffer[MAX_LINE];
-  snprintf(name_buffer, MAX_LINE * sizeof(char), "Benchmark [reduce]");
+
+  bench_reduce_options_initialize();
+  opt_eval_option(argc, argv, &fold);
+
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Benchmark [reduce] (fold = %d)", fold._int.value);
   return name_buffer;
 }
 
 int bench_vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY, int trials){
-  (void)argc;
-  (void)argv;
   (void)FillY;
   (void)RealScaleY;
   (void)ImagScaleY;
   (void)incY;
   int rc = 0;
   int i;
+  double time_allreduce;
+  double time_binned;
+  double time_hierarchical;
+
+  bench_reduce_options_initialize();
+  opt_eval_option(argc, argv, &fold);
 
   util_random_seed();
 
   int nprocs;
   int rank;
+  int nnodes;
+  MPI_Comm node;
   MPI_Init(&argc, &argv);
   MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node);
+  MPI_Comm_rank(node, &i);
+  i = (i == 0);
+  MPI_Allreduce(&i, &nnodes, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Comm_free(&node);
 
   double *X = util_dvec_alloc(N, incX);
   double *Y = util_dvec_alloc(N, incX);
+  double_binned *bX = (double_binned*)util_dvec_alloc(N * binned_dbnum(fold._int.value), 1);
+  double_binned *bY = (double_binned*)util_dvec_alloc(N * binned_dbnum(fold._int.value), 1);
+  double_binned *bY_hierarchical = (double_binned*)util_dvec_alloc(N * binned_dbnum(fold._int.value), 1);
 
   //fill X
-  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(N, X, incX, FillX, RealScaleX * (rank + 1), ImagScaleX);
+  for(i = 0; i < N; i++){
+    binned_dbdconv(fold._int.value, X[i * incX], bX + i * binned_dbnum(fold._int.value));
+  }
 
+  MPI_Barrier(MPI_COMM_WORLD);
+  time_reset();
   time_tic();
   for(i = 0; i < trials; i++){
     MPI_Reduce(X, Y, N, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
@@ -56,6 +100,48 @@ int bench_vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealS
 
   if(rank == 0){
     metric_load_double("time", time_read());
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    MPI_Allreduce(X, Y, N, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  }
+  time_toc();
+  time_allreduce = time_read();
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    MPI_Allreduce(bX, bY, N, binnedMPI_DOUBLE_BINNED(fold._int.value), binnedMPI_DBDBADD(fold._int.value), MPI_COMM_WORLD);
+  }
+  time_toc();
+  time_binned = time_read();
+
+  //the first call creates the node communicators and the shared memory window
+  binnedMPI_allreduce(bX, bY_hierarchical, N, binnedMPI_DOUBLE_BINNED(fold._int.value), binnedMPI_DBDBADD(fold._int.value), MPI_COMM_WORLD);
+  MPI_Barrier(MPI_COMM_WORLD);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    binnedMPI_allreduce(bX, bY_hierarchical, N, binnedMPI_DOUBLE_BINNED(fold._int.value), binnedMPI_DBDBADD(fold._int.value), MPI_COMM_WORLD);
+  }
+  time_toc();
+  time_hierarchical = time_read();
+
+  if(memcmp(bY, bY_hierarchical, N * binned_dbsize(fold._int.value)) != 0){
+    fprintf(stderr, "ReproBLAS error: hierarchical and flat binned allreduce differ\n");
+    rc = 1;
+  }
+
+  if(rank == 0){
+    metric_load_double("time_allreduce", time_allreduce);
+    metric_load_double("time_binned", time_binned);
+    metric_load_double("time_hierarchical", time_hierarchical);
+    metric_load_long_long("nprocs", (long long)nprocs);
+    metric_load_long_long("nnodes", (long long)nnodes);
     metric_load_long_long("trials", (long long)trials);
     metric_load_long_long("input", (long long)1 * N);
     metric_load_long_long("output", (long long)1);
@@ -68,5 +154,8 @@ int bench_vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealS
 
   free(X);
   free(Y);
+  free(bX);
+  free(bY);
+  free(bY_hierarchical);
   return rc;
 }
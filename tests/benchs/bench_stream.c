@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <binnedBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../common/test_time.h"
+#include "../common/test_metric.h"
+
+#include "../../config.h"
+
+#include "bench_vecvec_fill_header.h"
+
+//vectors this large do not fit in an int, so they are processed in pieces of at most STREAM_CHUNK elements
+#define STREAM_CHUNK (1 << 26)
+
+static opt_option fold;
+static opt_option size;
+
+static void bench_stream_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = binned_DBMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+
+  size._double.header.type       = opt_double;
+  size._double.header.short_name = 'g';
+  size._double.header.long_name  = "GiB";
+  size._double.header.help       = "size of each vector in GiB (overrides N)";
+  size._double.required          = 0;
+  size._double.min               = 0.0;
+  size._double.max               = 1024.0;
+  size._double.value             = 1.0;
+}
+
+int bench_vecvec_fill_show_help(void){
+  bench_stream_options_initialize();
+
+  opt_show_option(fold);
+  opt_show_option(size);
+
+  return 0;
+}
+
+const char* bench_vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  bench_stream_options_initialize();
+  opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &size);
+
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Benchmark [stream] (fold = %d, GiB = %g)", fold._int.value, size._double.value);
+  return name_buffer;
+}
+
+//STREAM-style baselines: unreproducible reductions with enough independent sums to keep the loads in flight
+static double stream_sum(const size_t N, const double *X){
+  double s[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  size_t i;
+  int j;
+
+  for(i = 0; i + 8 <= N; i += 8){
+    for(j = 0; j < 8; j++){
+      s[j] += X[i + j];
+    }
+  }
+  for(; i < N; i++){
+    s[0] += X[i];
+  }
+  return ((s[0] + s[1]) + (s[2] + s[3])) + ((s[4] + s[5]) + (s[6] + s[7]));
+}
+
+static double stream_dot(const size_t N, const double *X, const double *Y){
+  double s[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  size_t i;
+  int j;
+
+  for(i = 0; i + 8 <= N; i += 8){
+    for(j = 0; j < 8; j++){
+      s[j] += X[i + j] * Y[i + j];
+    }
+  }
+  for(; i < N; i++){
+    s[0] += X[i] * Y[i];
+  }
+  return ((s[0] + s[1]) + (s[2] + s[3])) + ((s[4] + s[5]) + (s[6] + s[7]));
+}
+
+int bench_vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY, int trials){
+  (void)incX;
+  (void)incY;
+  int rc = 0;
+  int i;
+  size_t j;
+  size_t n;
+  size_t bigN;
+  double time_sum;
+  double time_stream_sum;
+  double time_dot;
+  double time_stream_dot;
+  double res_sum;
+  double res_dot;
+  double res_stream = 0.0;
+
+  bench_stream_options_initialize();
+  opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &size);
+
+  bigN = size._double.value > 0.0 ? (size_t)(size._double.value * (1 << 30) / sizeof(double)) : (size_t)N;
+
+  util_random_seed();
+
+  double *X = (double*)malloc(bigN * sizeof(double));
+  double *Y = (double*)malloc(bigN * sizeof(double));
+  double_binned *Z = binned_dballoc(fold._int.value);
+  if(X == NULL || Y == NULL){
+    fprintf(stderr, "ReproBLAS error: could not allocate two vectors of %zu doubles\n", bigN);
+    free(X);
+    free(Y);
+    free(Z);
+    return 1;
+  }
+  for(j = 0; j < bigN; j += n){
+    n = bigN - j < STREAM_CHUNK ? bigN - j : STREAM_CHUNK;
+    util_dvec_fill(n, X + j, 1, FillX, RealScaleX, ImagScaleX);
+    util_dvec_fill(n, Y + j, 1, FillY, RealScaleY, ImagScaleY);
+  }
+
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    res_stream += stream_sum(bigN, X);
+  }
+  time_toc();
+  time_stream_sum = time_read();
+
+  binned_dbsetzero(fold._int.value, Z);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    for(j = 0; j < bigN; j += n){
+      n = bigN - j < STREAM_CHUNK ? bigN - j : STREAM_CHUNK;
+      binnedBLAS_dbdsum(fold._int.value, n, X + j, 1, Z);
+    }
+  }
+  time_toc();
+  time_sum = time_read();
+  res_sum = binned_ddbconv(fold._int.value, Z);
+
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    res_stream += stream_dot(bigN, X, Y);
+  }
+  time_toc();
+  time_stream_dot = time_read();
+
+  binned_dbsetzero(fold._int.value, Z);
+  time_reset();
+  time_tic();
+  for(i = 0; i < trials; i++){
+    for(j = 0; j < bigN; j += n){
+      n = bigN - j < STREAM_CHUNK ? bigN - j : STREAM_CHUNK;
+      binnedBLAS_dbddot(fold._int.value, n, X + j, 1, Y + j, 1, Z);
+    }
+  }
+  time_toc();
+  time_dot = time_read();
+  res_dot = binned_ddbconv(fold._int.value, Z);
+
+  double dN = (double)bigN;
+  double GB = trials * dN * sizeof(double) * 1e-9;
+  metric_load_double("time", time_sum);
+  metric_load_double("time_dot", time_dot);
+  metric_load_double("sum_GBps", GB / time_sum);
+  metric_load_double("dot_GBps", 2 * GB / time_dot);
+  metric_load_double("stream_sum_GBps", GB / time_stream_sum);
+  metric_load_double("stream_dot_GBps", 2 * GB / time_stream_dot);
+  metric_load_double("res", res_sum);
+  metric_load_double("res_dot", res_dot);
+  metric_load_double("res_stream", res_stream);
+  metric_load_double("trials", (double)trials);
+  metric_load_double("input", dN);
+  metric_load_double("output", 1.0);
+  metric_load_double("normalizer", dN);
+  metric_load_double("d_add", (3 * fold._int.value - 2) * dN);
+  metric_load_double("d_orb", fold._int.value * dN);
+  metric_dump();
+
+  free(X);
+  free(Y);
+  free(Z);
+  return rc;
+}
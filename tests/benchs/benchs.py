@@ -289,6 +289,10 @@ class BenchRCGEMMTest(BenchTest):
   name = "RCGEMM"
   executable = "tests/benchs/bench_rcgemm"
 
+class BenchPRDGEMVTest(BenchTest):
+  name = "PRDGEMV"
+  executable = "tests/benchs/bench_prdgemv"
+
 class BenchDGEMVTest(BenchTest):
   name = "DGEMV"
   executable = "tests/benchs/bench_dgemv"
@@ -321,6 +325,20 @@ class BenchCGEMMTest(BenchTest):
   name = "CGEMM"
   executable = "tests/benchs/bench_cgemm"
 
+class BenchSTREAMTest(BenchTest):
+  name = "STREAM"
+  executable = "tests/benchs/bench_stream"
+
+  def parse_output(self, output):
+    if self.attribute == "sum(GB/s)":
+      return output["sum_GBps"]
+    elif self.attribute == "dot(GB/s)":
+      return output["dot_GBps"]
+    elif self.attribute == "stream(%)":
+      return (100.0 * output["sum_GBps"]) / max(output["stream_sum_GBps"], sys.float_info.min)
+    else:
+      return super(BenchSTREAMTest, self).parse_output(output)
+
 all_benchs = {"bench_camax": (BenchCAMAXTest, [""]),\
               "bench_camaxm": (BenchCAMAXMTest, [""]),\
               "bench_cciconv": (BenchCCICONVTest, [""]),\
@@ -355,6 +373,7 @@ all_benchs = {"bench_camax": (BenchCAMAXTest, [""]),\
               "bench_sbsbadd": (BenchSBSBADDTest, [""]),\
               "bench_snrm2": (BenchSNRM2Test, [""]),\
               "bench_ssbconv": (BenchSSICONVTest, [""]),\
+              "bench_stream": (BenchSTREAMTest, [""]),\
               "bench_zamax": (BenchZAMAXTest, [""]),\
               "bench_zamaxm": (BenchZAMAXMTest, [""]),\
               "bench_zdotc": (BenchZDOTCTest, [""]),\
@@ -371,10 +390,20 @@ for i in range(1, terminal.get_simaxfold() + 1):
     flagss = ["--fold {}".format(j) for j in range(2, terminal.get_simaxfold() + 1)]
   else:
     flagss = ["--fold {}".format(i)]
+  incXflagss = ["--incX {} ".format(incX) + flags for incX in [2, 8, 64] for flags in flagss]
+  largeflagss = ["-N 16777216 --trials 8 " + flags for flags in flagss]
   all_benchs.update({"bench_rssum_fold_{}".format(i): (BenchRSSUMTest, flagss),\
+                     "bench_rssum_incX_fold_{}".format(i): (BenchRSSUMTest, incXflagss),\
+                     "bench_rssum_large_fold_{}".format(i): (BenchRSSUMTest, largeflagss),\
                      "bench_rsasum_fold_{}".format(i): (BenchRSASUMTest, flagss),\
+                     "bench_rsasum_incX_fold_{}".format(i): (BenchRSASUMTest, incXflagss),\
+                     "bench_rsasum_large_fold_{}".format(i): (BenchRSASUMTest, largeflagss),\
                      "bench_rsnrm2_fold_{}".format(i): (BenchRSNRM2Test, flagss),\
+                     "bench_rsnrm2_incX_fold_{}".format(i): (BenchRSNRM2Test, incXflagss),\
+                     "bench_rsnrm2_large_fold_{}".format(i): (BenchRSNRM2Test, largeflagss),\
                      "bench_rsdot_fold_{}".format(i): (BenchRSDOTTest, flagss),\
+                     "bench_rsdot_incX_fold_{}".format(i): (BenchRSDOTTest, incXflagss),\
+                     "bench_rsdot_large_fold_{}".format(i): (BenchRSDOTTest, largeflagss),\
                      "bench_rsgemv_fold_{}".format(i): (BenchRSGEMVTest, flagss),\
                      "bench_rsgemv_TransA_fold_{}".format(i): (BenchRSGEMVTest, ["--TransA Trans " + flags for flags in flagss]),\
                      "bench_rsgemv_AvgTransA_fold_{}".format(i): (BenchRSGEMVTest, flagss + \
@@ -388,10 +417,20 @@ for i in range(1, terminal.get_simaxfold() + 1):
                                                                                              ["--TransA Trans " + flags for flags in flagss] + \
                                                                                              ["--TransA Trans --TransB Trans " + flags for flags in flagss]),\
                      "bench_rcsum_fold_{}".format(i): (BenchRCSUMTest, flagss),\
+                     "bench_rcsum_incX_fold_{}".format(i): (BenchRCSUMTest, incXflagss),\
+                     "bench_rcsum_large_fold_{}".format(i): (BenchRCSUMTest, largeflagss),\
                      "bench_rscasum_fold_{}".format(i): (BenchRSCASUMTest, flagss),\
+                     "bench_rscasum_incX_fold_{}".format(i): (BenchRSCASUMTest, incXflagss),\
+                     "bench_rscasum_large_fold_{}".format(i): (BenchRSCASUMTest, largeflagss),\
                      "bench_rscnrm2_fold_{}".format(i): (BenchRSCNRM2Test, flagss),\
+                     "bench_rscnrm2_incX_fold_{}".format(i): (BenchRSCNRM2Test, incXflagss),\
+                     "bench_rscnrm2_large_fold_{}".format(i): (BenchRSCNRM2Test, largeflagss),\
                      "bench_rcdotu_fold_{}".format(i): (BenchRCDOTUTest, flagss),\
+                     "bench_rcdotu_incX_fold_{}".format(i): (BenchRCDOTUTest, incXflagss),\
+                     "bench_rcdotu_large_fold_{}".format(i): (BenchRCDOTUTest, largeflagss),\
                      "bench_rcdotc_fold_{}".format(i): (BenchRCDOTCTest, flagss),\
+                     "bench_rcdotc_incX_fold_{}".format(i): (BenchRCDOTCTest, incXflagss),\
+                     "bench_rcdotc_large_fold_{}".format(i): (BenchRCDOTCTest, largeflagss),\
                      "bench_rcgemv_fold_{}".format(i): (BenchRCGEMVTest, flagss),\
                      "bench_rcgemv_TransA_fold_{}".format(i): (BenchRCGEMVTest, ["--TransA Trans " + flags for flags in flagss]),\
                      "bench_rcgemv_AvgTransA_fold_{}".format(i): (BenchRCGEMVTest, flagss + \
@@ -412,10 +451,20 @@ for i in range(1, terminal.get_dimaxfold() + 1):
     flagss = ["--fold {}".format(j) for j in range(2, terminal.get_dimaxfold() + 1)]
   else:
     flagss = ["--fold {}".format(i)]
+  incXflagss = ["--incX {} ".format(incX) + flags for incX in [2, 8, 64] for flags in flagss]
+  largeflagss = ["-N 16777216 --trials 8 " + flags for flags in flagss]
   all_benchs.update({"bench_rdsum_fold_{}".format(i): (BenchRDSUMTest, flagss),\
+                     "bench_rdsum_incX_fold_{}".format(i): (BenchRDSUMTest, incXflagss),\
+                     "bench_rdsum_large_fold_{}".format(i): (BenchRDSUMTest, largeflagss),\
                      "bench_rdasum_fold_{}".format(i): (BenchRDASUMTest, flagss),\
+                     "bench_rdasum_incX_fold_{}".format(i): (BenchRDASUMTest, incXflagss),\
+                     "bench_rdasum_large_fold_{}".format(i): (BenchRDASUMTest, largeflagss),\
                      "bench_rdnrm2_fold_{}".format(i): (BenchRDNRM2Test, flagss),\
+                     "bench_rdnrm2_incX_fold_{}".format(i): (BenchRDNRM2Test, incXflagss),\
+                     "bench_rdnrm2_large_fold_{}".format(i): (BenchRDNRM2Test, largeflagss),\
                      "bench_rddot_fold_{}".format(i): (BenchRDDOTTest, flagss),\
+                     "bench_rddot_incX_fold_{}".format(i): (BenchRDDOTTest, incXflagss),\
+                     "bench_rddot_large_fold_{}".format(i): (BenchRDDOTTest, largeflagss),\
                      "bench_rdgemv_fold_{}".format(i): (BenchRDGEMVTest, flagss),\
                      "bench_rdgemv_TransA_fold_{}".format(i): (BenchRDGEMVTest, ["--TransA Trans " + flags for flags in flagss]),\
                      "bench_rdgemv_AvgTransA_fold_{}".format(i): (BenchRDGEMVTest, flagss + \
@@ -432,10 +481,20 @@ for i in range(1, terminal.get_dimaxfold() + 1):
                      "bench_rdgemm_TransA_fold_{}".format(i): (BenchRDGEMMTest, ["--TransA Trans " + flags for flags in flagss]),\
                      "bench_rdgemm_TransA_TransB_fold_{}".format(i): (BenchRDGEMMTest, ["--TransA Trans --TransB Trans " + flags for flags in flagss]),\
                      "bench_rzsum_fold_{}".format(i): (BenchRZSUMTest, flagss),\
+                     "bench_rzsum_incX_fold_{}".format(i): (BenchRZSUMTest, incXflagss),\
+                     "bench_rzsum_large_fold_{}".format(i): (BenchRZSUMTest, largeflagss),\
                      "bench_rdzasum_fold_{}".format(i): (BenchRDZASUMTest, flagss),\
+                     "bench_rdzasum_incX_fold_{}".format(i): (BenchRDZASUMTest, incXflagss),\
+                     "bench_rdzasum_large_fold_{}".format(i): (BenchRDZASUMTest, largeflagss),\
                      "bench_rdznrm2_fold_{}".format(i): (BenchRDZNRM2Test, flagss),\
+                     "bench_rdznrm2_incX_fold_{}".format(i): (BenchRDZNRM2Test, incXflagss),\
+                     "bench_rdznrm2_large_fold_{}".format(i): (BenchRDZNRM2Test, largeflagss),\
                      "bench_rzdotc_fold_{}".format(i): (BenchRZDOTCTest, flagss),\
+                     "bench_rzdotc_incX_fold_{}".format(i): (BenchRZDOTCTest, incXflagss),\
+                     "bench_rzdotc_large_fold_{}".format(i): (BenchRZDOTCTest, largeflagss),\
                      "bench_rzdotu_fold_{}".format(i): (BenchRZDOTUTest, flagss),\
+                     "bench_rzdotu_incX_fold_{}".format(i): (BenchRZDOTUTest, incXflagss),\
+                     "bench_rzdotu_large_fold_{}".format(i): (BenchRZDOTUTest, largeflagss),\
                      "bench_rzgemv_fold_{}".format(i): (BenchRZGEMVTest, flagss),\
                      "bench_rzgemv_TransA_fold_{}".format(i): (BenchRZGEMVTest, ["--TransA Trans " + flags for flags in flagss]),\
                      "bench_rzgemv_AvgTransA_fold_{}".format(i): (BenchRZGEMVTest, flagss + \
@@ -3,7 +3,9 @@ TARGETS := validate_internal_damax$(EXE) validate_internal_zamax$(EXE) validate_
            validate_internal_dscale$(EXE) validate_internal_sscale$(EXE) \
            validate_internal_dindex$(EXE) validate_internal_sindex$(EXE) \
            validate_internal_dmindex$(EXE) validate_internal_smindex$(EXE) \
+           validate_internal_dbindex$(EXE) validate_internal_dbrenorm$(EXE) \
            verify_daugsum$(EXE) verify_zaugsum$(EXE) verify_saugsum$(EXE) verify_caugsum$(EXE) \
+           verify_ompreduce$(EXE) verify_bigstride$(EXE) verify_scalednrm2$(EXE) \
            validate_internal_daugsum$(EXE) validate_internal_zaugsum$(EXE) validate_internal_saugsum$(EXE) validate_internal_caugsum$(EXE) \
            validate_xblas_ddot$(EXE) validate_xblas_zdot$(EXE) validate_xblas_sdot$(EXE) validate_xblas_cdot$(EXE) \
            verify_dbdssq$(EXE) verify_dbzssq$(EXE) verify_sbsssq$(EXE) verify_sbcssq$(EXE) \
@@ -16,6 +18,10 @@ TARGETS := validate_internal_damax$(EXE) validate_internal_zamax$(EXE) validate_
            corroborate_rcgemv$(EXE) \
            corroborate_rcgemm$(EXE) \
 
+ifeq ($(BUILD_MPI),true)
+TARGETS += validate_internal_dbpack$(EXE)
+endif
+
 SUBDIRS :=
 
 LDFLAGS += $(MPILDFLAGS)
@@ -33,10 +39,16 @@ validate_internal_dindex$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNED) validate_interna
 validate_internal_sindex$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNED) validate_internal_sindex.o
 validate_internal_dmindex$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNED) validate_internal_dmindex.o
 validate_internal_smindex$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNED) validate_internal_smindex.o
+validate_internal_dbindex$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNED) validate_internal_dbindex.o
+validate_internal_dbrenorm$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNED) validate_internal_dbrenorm.o
+validate_internal_dbpack$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNEDMPI) validate_internal_dbpack.o
 verify_daugsum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_daugsum.o
 verify_zaugsum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_zaugsum.o
 verify_saugsum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_saugsum.o
 verify_caugsum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_caugsum.o
+verify_ompreduce$(EXE)_DEPS = $$(LIBTEST) $$(LIBBINNED) verify_ompreduce.o
+verify_bigstride$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_bigstride.o
+verify_scalednrm2$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_scalednrm2.o
 validate_internal_daugsum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) validate_internal_daugsum.o
 validate_internal_zaugsum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) validate_internal_zaugsum.o
 validate_internal_saugsum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) validate_internal_saugsum.o
@@ -70,10 +82,16 @@ validate_internal_dindex$(EXE)_LIBS = -lm
 validate_internal_sindex$(EXE)_LIBS = -lm
 validate_internal_dmindex$(EXE)_LIBS = -lm
 validate_internal_smindex$(EXE)_LIBS = -lm
+validate_internal_dbindex$(EXE)_LIBS = -lm
+validate_internal_dbrenorm$(EXE)_LIBS = -lm
+validate_internal_dbpack$(EXE)_LIBS = $(MPILDFLAGS) -lm
 verify_daugsum$(EXE)_LIBS = -lm
 verify_zaugsum$(EXE)_LIBS = -lm
 verify_saugsum$(EXE)_LIBS = -lm
 verify_caugsum$(EXE)_LIBS = -lm
+verify_ompreduce$(EXE)_LIBS = -lm
+verify_bigstride$(EXE)_LIBS = -lm
+verify_scalednrm2$(EXE)_LIBS = -lm
 validate_internal_daugsum$(EXE)_LIBS = -lm
 validate_internal_zaugsum$(EXE)_LIBS = -lm
 validate_internal_saugsum$(EXE)_LIBS = -lm
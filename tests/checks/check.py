@@ -49,6 +49,17 @@ check_suite.add_checks([checks.ValidateInternalDINDEXTest(),\
                        ["N", "incX"],\
                        [[4], [1]])
 
+check_suite.add_checks([checks.ValidateInternalDBINDEXTest(),\
+                        checks.ValidateInternalDBRENORMTest()],\
+                       ["N", "incX"],\
+                       [[1, 7, 2101], [1, 2, 5]])
+
+#the packed encoding of every fold, and the packed sums (built with MPI only)
+if terminal.get_mpi():
+  check_suite.add_checks([checks.ValidateInternalDBPACKTest()],\
+                         ["N", "incX"],\
+                         [[64, 1001], [1, 3]])
+
 check_suite.add_checks([checks.ValidateInternalDAMAXTest(),\
                         checks.ValidateInternalZAMAXTest(),\
                         checks.ValidateInternalSAMAXTest(),\
@@ -60,6 +71,7 @@ check_suite.add_checks([checks.ValidateInternalRDSUMTest(),\
                         checks.ValidateInternalDBDBADDTest(),\
                         checks.ValidateInternalDIDADDTest(),\
                         checks.ValidateInternalDIDDEPOSITTest(),\
+                        checks.ValidateInternalDBSHAREDTest(),\
                         checks.ValidateInternalRSSUMTest(),\
                         checks.ValidateInternalSBSBADDTest(),\
                         checks.ValidateInternalSISADDTest(),\
@@ -188,6 +200,7 @@ check_suite.add_checks([checks.ValidateInternalRDSUMTest(),\
                         checks.ValidateInternalDBDBADDTest(),\
                         checks.ValidateInternalDIDADDTest(),\
                         checks.ValidateInternalDIDDEPOSITTest(),\
+                        checks.ValidateInternalDBSHAREDTest(),\
                         checks.ValidateInternalRSSUMTest(),\
                         checks.ValidateInternalRSASUMTest(),\
                         checks.ValidateInternalRSNRM2Test(),\
@@ -288,6 +301,7 @@ check_suite.add_checks([checks.VerifyRDSUMTest(),\
                         checks.VerifyDBDBADDTest(),\
                         checks.VerifyDIDADDTest(),\
                         checks.VerifyDIDDEPOSITTest(),\
+                        checks.VerifyDBSHAREDTest(),\
                         checks.VerifyRZSUMTest(),\
                         checks.VerifyRDZASUMTest(),\
                         checks.VerifyZBZBADDTest(),\
@@ -314,6 +328,7 @@ check_suite.add_checks([checks.VerifyRDSUMTest(),\
                         checks.VerifyDBDBADDTest(),\
                         checks.VerifyDIDADDTest(),\
                         checks.VerifyDIDDEPOSITTest(),\
+                        checks.VerifyDBSHAREDTest(),\
                         checks.VerifyRZSUMTest(),\
                         checks.VerifyRDZASUMTest(),\
                         checks.VerifyRDZNRM2Test(),\
@@ -360,11 +375,53 @@ check_suite.add_checks([checks.VerifyRDDOTTest(),\
                          "small+grow*big"]])
 
 
+check_suite.add_checks([checks.VerifyRDSUMTest(),\
+                        checks.VerifyRDASUMTest(),\
+                        checks.VerifyRDNRM2Test(),\
+                        checks.VerifyRDDOTTest(),\
+                        checks.VerifyDBSHAREDTest(),\
+                        checks.VerifyRZSUMTest(),\
+                        checks.VerifyRDZASUMTest(),\
+                        checks.VerifyRDZNRM2Test(),\
+                        checks.VerifyRZDOTUTest(),\
+                        checks.VerifyRZDOTCTest(),\
+                        checks.VerifyRSSUMTest(),\
+                        checks.VerifyRSASUMTest(),\
+                        checks.VerifyRSNRM2Test(),\
+                        checks.VerifyRSDOTTest(),\
+                        checks.VerifyRCSUMTest(),\
+                        checks.VerifyRSCASUMTest(),\
+                        checks.VerifyRSCNRM2Test(),\
+                        checks.VerifyRCDOTUTest(),\
+                        checks.VerifyRCDOTCTest()],\
+                       ["N", "fold", "B", "T", "incX", "incY", "FillX", "FillY"],\
+                       [[131071], folds, [16], [2, 3, 8], incs, incs,\
+                        ["rand+(rand-1)"],\
+                        ["sine"]])
+
+check_suite.add_checks([checks.VerifyOMPREDUCETest()],\
+                       ["N", "T", "incX", "incY", "FillX", "FillY"],\
+                       [[1, 7, 4095], [8], incs, incs,\
+                        ["rand+(rand-1)", "small+grow*big"],\
+                        ["sine"]])
+
+#the offsets of the later threads' blocks do not fit in an int
+check_suite.add_checks([checks.VerifyBIGSTRIDETest()],\
+                       ["N", "T", ("incX", "incY")],\
+                       [[64], [2, 4], [(2**26 + 1, 2**26 + 1)]])
+
+#the threads' partial sums of squares have scales far above and below each other
+check_suite.add_checks([checks.VerifySCALEDNRM2Test()],\
+                       ["N", "T", "incX"],\
+                       [[8, 1001, 4096], [2, 3, 4, 8], [1, 3]])
+
+
 for i in range(DBL_BIN_WIDTH + 2):
   check_suite.add_checks([checks.ValidateInternalRDSUMTest(),\
                           checks.ValidateInternalDBDBADDTest(),\
                           checks.ValidateInternalDIDADDTest(),\
                           checks.ValidateInternalDIDDEPOSITTest(),\
+                          checks.ValidateInternalDBSHAREDTest(),\
                           checks.ValidateInternalRDASUMTest(),\
                           checks.ValidateInternalRDNRM2Test(),\
                           checks.ValidateInternalRDDOTTest(),\
@@ -378,6 +435,7 @@ for i in range(DBL_BIN_WIDTH + 2):
                           checks.ValidateInternalDBDBADDTest(),\
                           checks.ValidateInternalDIDADDTest(),\
                           checks.ValidateInternalDIDDEPOSITTest(),\
+                          checks.ValidateInternalDBSHAREDTest(),\
                           checks.ValidateInternalRDASUMTest(),\
                           checks.ValidateInternalRDNRM2Test(),\
                           checks.ValidateInternalRDDOTTest(),\
@@ -571,6 +629,7 @@ for i in range(FLT_BIN_WIDTH + 2):
 check_suite.add_checks([checks.ValidateInternalDBDBADDTest(),\
                         checks.ValidateInternalDIDADDTest(),\
                         checks.ValidateInternalDIDDEPOSITTest(),\
+                        checks.ValidateInternalDBSHAREDTest(),\
                         checks.ValidateInternalRDSUMTest(),\
                         checks.ValidateInternalRDASUMTest(),\
                         checks.ValidateInternalRDDOTTest(),\
@@ -635,6 +694,94 @@ check_suite.add_checks([checks.CorroborateRDGEMMTest(),
                         [(0.0, 0.0), (1.0, 0.0), (2.0, 2.0)],\
                         folds])
 
+check_suite.add_checks([checks.CorroborateRDGEMMTest(),
+                        checks.CorroborateRZGEMMTest(),\
+                        checks.CorroborateRSGEMMTest(),\
+                        checks.CorroborateRCGEMMTest(),\
+                        ],\
+                       ["O", "TransA", "TransB", ("M", "N"), "K", "FillA", "FillB", "FillC", ("RealAlpha", "ImagAlpha"), ("RealBeta", "ImagBeta"), "fold", "threads"],\
+                       [["RowMajor", "ColMajor"], ["ConjTrans", "Trans", "NoTrans"], ["ConjTrans", "Trans", "NoTrans"], [(100, 40), (40, 100)], [64], \
+                        ["rand"],\
+                        ["rand"],\
+                        ["rand"],\
+                        [(1.0, 0.0), (2.0, 2.0)],\
+                        [(1.0, 0.0)],\
+                        folds,\
+                        [3]])
+
+check_suite.add_checks([checks.CorroborateRDGEMMTest(),
+                        checks.CorroborateRZGEMMTest(),\
+                        checks.CorroborateRSGEMMTest(),\
+                        checks.CorroborateRCGEMMTest(),\
+                        ],\
+                       ["O", "TransA", "TransB", ("M", "N"), "K", "ldc", "FillA", "FillB", "FillC", ("RealAlpha", "ImagAlpha"), ("RealBeta", "ImagBeta"), "fold", "threads"],\
+                       [["RowMajor", "ColMajor"], ["Trans", "NoTrans"], ["Trans", "NoTrans"], [(300, 140)], [16], [0, -7],\
+                        ["rand"],\
+                        ["rand"],\
+                        ["rand"],\
+                        [(2.0, 2.0)],\
+                        [(0.0, 0.0), (1.0, 0.0), (2.0, 2.0)],\
+                        folds,\
+                        [1, 3]])
+
+check_suite.add_checks([checks.CorroborateRDGEMMTest(),
+                        checks.CorroborateRZGEMMTest(),\
+                        checks.CorroborateRSGEMMTest(),\
+                        checks.CorroborateRCGEMMTest(),\
+                        ],\
+                       ["O", "TransA", "TransB", ("M", "N"), "K", "ldc", "FillA", "FillB", "FillC", ("RealAlpha", "ImagAlpha"), ("RealBeta", "ImagBeta"), "fold", "threads", "batch"],\
+                       [["RowMajor", "ColMajor"], ["Trans", "NoTrans"], ["Trans", "NoTrans"], [(8, 8), (33, 17)], [64], [0, -7],\
+                        ["rand"],\
+                        ["rand"],\
+                        ["rand"],\
+                        [(1.0, 0.0), (2.0, 2.0)],\
+                        [(0.0, 0.0), (1.0, 0.0), (2.0, 2.0)],\
+                        folds,\
+                        [1, 3],\
+                        [5]])
+
+#with runtime dispatch, the kernels of every instruction set the processor supports are checked
+if terminal.get_dispatch():
+  for vectorization in terminal.get_vectorizations():
+    check_suite.add_checks([checks.VectorizationCheckTest(check, vectorization) for check in\
+                            [checks.VerifyRDSUMTest(),\
+                             checks.VerifyRDASUMTest(),\
+                             checks.VerifyRDNRM2Test(),\
+                             checks.VerifyRDDOTTest(),\
+                             checks.VerifyRZSUMTest(),\
+                             checks.VerifyRDZASUMTest(),\
+                             checks.VerifyRDZNRM2Test(),\
+                             checks.VerifyRZDOTUTest(),\
+                             checks.VerifyRZDOTCTest(),\
+                             checks.VerifyRSSUMTest(),\
+                             checks.VerifyRSASUMTest(),\
+                             checks.VerifyRSNRM2Test(),\
+                             checks.VerifyRSDOTTest(),\
+                             checks.VerifyRCSUMTest(),\
+                             checks.VerifyRSCASUMTest(),\
+                             checks.VerifyRSCNRM2Test(),\
+                             checks.VerifyRCDOTUTest(),\
+                             checks.VerifyRCDOTCTest()]],\
+                           ["N", "fold", "B", "incX", "incY", "FillX", "FillY"],\
+                           [[4095], folds, [256], [1, 2], [1, 2],\
+                            ["rand+(rand-1)",\
+                             "small+grow*big"],\
+                            ["sine"]])
+
+    check_suite.add_checks([checks.VectorizationCheckTest(check, vectorization) for check in\
+                            [checks.CorroborateRDGEMMTest(),\
+                             checks.CorroborateRZGEMMTest(),\
+                             checks.CorroborateRSGEMMTest(),\
+                             checks.CorroborateRCGEMMTest()]],\
+                           ["O", "TransA", "TransB", ("M", "N"), "K", "ldc", "FillA", "FillB", "FillC", ("RealAlpha", "ImagAlpha"), ("RealBeta", "ImagBeta"), "fold"],\
+                           [["RowMajor", "ColMajor"], ["Trans", "NoTrans"], ["Trans", "NoTrans"], [(33, 17)], [64], [0, -7],\
+                            ["rand"],\
+                            ["rand"],\
+                            ["rand"],\
+                            [(2.0, 2.0)],\
+                            [(1.0, 0.0)],\
+                            folds])
+
 check_harness = harness.Harness("check")
 check_harness.add_suite(check_suite)
 check_harness.run()
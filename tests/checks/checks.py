@@ -119,6 +119,24 @@ class CheckTest(harness.ExecutableTest):
     """
     return self.result
 
+class VectorizationCheckTest(CheckTest):
+  """
+  run a check with the kernels of one instruction set (only meaningful if
+  ReproBLAS was built with runtime dispatch)
+  """
+
+  def __init__(self, check, vectorization):
+    self.executable = check.executable
+    self.base_flags = check.base_flags
+    self.vectorization = vectorization
+
+  def get_command_list(self):
+    return ["REPROBLAS_VECTORIZATION={} {}".format(self.vectorization, command) for command in super(VectorizationCheckTest, self).get_command_list()]
+
+  def parse_output_list(self, output_list):
+    super(VectorizationCheckTest, self).parse_output_list(output_list)
+    self.name = "{} ({})\n".format(self.name.rstrip("\n"), self.vectorization)
+
 class ValidateInternalUFPTest(CheckTest):
   executable = "tests/checks/validate_internal_ufp"
   name = "validate_internal_ufp"
@@ -178,6 +196,11 @@ class ValidateInternalDIDDEPOSITTest(CheckTest):
   executable = "tests/checks/validate_internal_daugsum"
   name = "validate_internal_dbddeposit"
 
+class ValidateInternalDBSHAREDTest(CheckTest):
+  base_flags = "-w dbshared"
+  executable = "tests/checks/validate_internal_daugsum"
+  name = "validate_internal_dbshared"
+
 class ValidateInternalRZSUMTest(CheckTest):
   base_flags = "-w rzsum"
   executable = "tests/checks/validate_internal_zaugsum"
@@ -428,6 +451,26 @@ class VerifyDIDDEPOSITTest(CheckTest):
   executable = "tests/checks/verify_daugsum"
   name = "verify_dbddeposit"
 
+class VerifyDBSHAREDTest(CheckTest):
+  base_flags = "-w dbshared"
+  executable = "tests/checks/verify_daugsum"
+  name = "verify_dbshared"
+
+class VerifyOMPREDUCETest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_ompreduce"
+  name = "verify_ompreduce"
+
+class VerifyBIGSTRIDETest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_bigstride"
+  name = "verify_bigstride"
+
+class VerifySCALEDNRM2Test(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_scalednrm2"
+  name = "verify_scalednrm2"
+
 class VerifyRDSUMTest(CheckTest):
   base_flags = "-w rdsum"
   executable = "tests/checks/verify_daugsum"
@@ -648,3 +691,18 @@ class ValidateInternalSMINDEXTest(CheckTest):
   base_flags = ""
   executable = "tests/checks/validate_internal_smindex"
   name = "validate_internal_smindex"
+
+class ValidateInternalDBINDEXTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/validate_internal_dbindex"
+  name = "validate_internal_dbindex"
+
+class ValidateInternalDBRENORMTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/validate_internal_dbrenorm"
+  name = "validate_internal_dbrenorm"
+
+class ValidateInternalDBPACKTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/validate_internal_dbpack"
+  name = "validate_internal_dbpack"
@@ -16,6 +16,8 @@
 static opt_option max_blocks;
 static opt_option shuffles;
 static opt_option fold;
+static opt_option threads;
+static opt_option batch;
 
 static void corroborate_rdgemm_options_initialize(void){
   max_blocks._int.header.type       = opt_int;
@@ -44,6 +46,24 @@ static void corroborate_rdgemm_options_initialize(void){
   fold._int.min               = 2;
   fold._int.max               = binned_DBMAXFOLD;
   fold._int.value             = DIDEFAULTFOLD;
+
+  threads._int.header.type       = opt_int;
+  threads._int.header.short_name = '\0';
+  threads._int.header.long_name  = "threads";
+  threads._int.header.help       = "number of threads";
+  threads._int.required          = 0;
+  threads._int.min               = 1;
+  threads._int.max               = INT_MAX;
+  threads._int.value             = 1;
+
+  batch._int.header.type       = opt_int;
+  batch._int.header.short_name = '\0';
+  batch._int.header.long_name  = "batch";
+  batch._int.header.help       = "number of batched entries to check (0 to skip)";
+  batch._int.required          = 0;
+  batch._int.min               = 0;
+  batch._int.max               = INT_MAX;
+  batch._int.value             = 0;
 }
 
 int corroborate_rdgemm(int fold, char Order, char TransA, char TransB, int M, int N, int K, double alpha, double *A, int lda, double* B, int ldb, double beta, double *C, double_binned *CI, int ldc, double *ref, int max_num_blocks) {
@@ -167,12 +187,198 @@ int corroborate_rdgemm(int fold, char Order, char TransA, char TransB, int M, in
   return 0;
 }
 
+static int corroborate_rdgemm_batch_compare(const char *func, char Order, int M, int N, double *res, int strideC, double *ref, int ldc, int CNM, int batch_count) {
+  int i;
+  int j;
+  int b;
+
+  for(b = 0; b < batch_count; b++){
+    for(i = 0; i < M; i++){
+      for(j = 0; j < N; j++){
+        switch(Order){
+          case 'r':
+          case 'R':
+            if(res[b * strideC + i * ldc + j] != ref[b * CNM + i * ldc + j]){
+              printf("%s[batch=%d] = %g != %g\n", func, b, res[b * strideC + i * ldc + j], ref[b * CNM + i * ldc + j]);
+              return 1;
+            }
+            break;
+          default:
+            if(res[b * strideC + j * ldc + i] != ref[b * CNM + j * ldc + i]){
+              printf("%s[batch=%d] = %g != %g\n", func, b, res[b * strideC + j * ldc + i], ref[b * CNM + j * ldc + i]);
+              return 1;
+            }
+            break;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+int corroborate_rdgemm_batch(int fold, char Order, char TransA, char TransB, int M, int N, int K, double alpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillB, double RealScaleB, double ImagScaleB, int ldb, double beta, int FillC, double RealScaleC, double ImagScaleC, int ldc, int batch_count) {
+  int i;
+  int j;
+  int b;
+  int t;
+  int rc = 0;
+  char NTransA;
+  int opAM;
+  int opAK;
+  int opBK;
+  int opBN;
+  int strideA;
+  int strideB;
+  int strideC;
+  int CNM;
+
+  double *A;
+  double *B;
+  double *C;
+  double_binned *CI;
+  double *ref;
+  double *res;
+  double_binned *Ires;
+  const double **As;
+  const double **Bs;
+  double **Cs;
+  double_binned **CIs;
+
+  switch(TransA){
+    case 'n':
+    case 'N':
+      opAM = M;
+      opAK = K;
+      NTransA = 't';
+      break;
+    default:
+      opAM = K;
+      opAK = M;
+      NTransA = 'n';
+      break;
+  }
+
+  switch(TransB){
+    case 'n':
+    case 'N':
+      opBK = K;
+      opBN = N;
+      break;
+    default:
+      opBK = N;
+      opBN = K;
+      break;
+  }
+
+  //each entry has its own matrices, and the gaps between entries make the strides of A, B and C differ from each other and from the matrix sizes
+  switch(Order){
+    case 'r':
+    case 'R':
+      strideA = opAM * lda + 1;
+      strideB = opBK * ldb + 2;
+      CNM = M * ldc;
+      break;
+    default:
+      strideA = lda * opAK + 1;
+      strideB = ldb * opBN + 2;
+      CNM = ldc * N;
+      break;
+  }
+  strideC = CNM + 3;
+  A = malloc(batch_count * strideA * sizeof(double));
+  B = malloc(batch_count * strideB * sizeof(double));
+  C = malloc(batch_count * strideC * sizeof(double));
+  CI = malloc(batch_count * strideC * binned_dbsize(fold));
+  ref = malloc(batch_count * CNM * sizeof(double));
+  res = malloc(batch_count * strideC * sizeof(double));
+  Ires = malloc(batch_count * strideC * binned_dbsize(fold));
+  As = malloc(batch_count * sizeof(double*));
+  Bs = malloc(batch_count * sizeof(double*));
+  Cs = malloc(batch_count * sizeof(double*));
+  CIs = malloc(batch_count * sizeof(double_binned*));
+  for(b = 0; b < batch_count; b++){
+    util_dmat_fill(Order, NTransA, opAM, opAK, A + b * strideA, lda, FillA, RealScaleA, ImagScaleA);
+    util_dmat_fill(Order, TransB, opBK, opBN, B + b * strideB, ldb, FillB, RealScaleB, ImagScaleB);
+    util_dmat_fill(Order, 'n', M, N, C + b * strideC, ldc, FillC, RealScaleC, ImagScaleC);
+    for(i = 0; i < M; i++){
+      for(j = 0; j < N; j++){
+        switch(Order){
+          case 'r':
+          case 'R':
+            binned_dbdconv(fold, C[b * strideC + i * ldc + j] * beta, CI + (b * strideC + i * ldc + j) * binned_dbnum(fold));
+            break;
+          default:
+            binned_dbdconv(fold, C[b * strideC + j * ldc + i] * beta, CI + (b * strideC + j * ldc + i) * binned_dbnum(fold));
+            break;
+        }
+      }
+    }
+    memcpy(ref + b * CNM, C + b * strideC, CNM * sizeof(double));
+    reproBLAS_rdgemm(fold, Order, TransA, TransB, M, N, K, alpha, A + b * strideA, lda, B + b * strideB, ldb, beta, ref + b * CNM, ldc);
+    As[b] = A + b * strideA;
+    Bs[b] = B + b * strideB;
+    Cs[b] = res + b * strideC;
+    CIs[b] = Ires + b * strideC * binned_dbnum(fold);
+  }
+
+  memcpy(res, C, batch_count * strideC * sizeof(double));
+  reproBLAS_rdgemm_batch_strided(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, beta, res, ldc, strideC, batch_count);
+  rc = corroborate_rdgemm_batch_compare("reproBLAS_rdgemm_batch_strided", Order, M, N, res, strideC, ref, ldc, CNM, batch_count);
+
+  if(rc == 0){
+    memcpy(res, C, batch_count * strideC * sizeof(double));
+    reproBLAS_rdgemm_batch(fold, Order, TransA, TransB, M, N, K, alpha, (double const* const*)As, lda, (double const* const*)Bs, ldb, beta, (double* const*)Cs, ldc, batch_count);
+    rc = corroborate_rdgemm_batch_compare("reproBLAS_rdgemm_batch", Order, M, N, res, strideC, ref, ldc, CNM, batch_count);
+  }
+
+  //the binned batches are checked with pointer arrays (t = 0) and with strides (t = 1)
+  for(t = 0; t < 2 && rc == 0; t++){
+    memcpy(Ires, CI, batch_count * strideC * binned_dbsize(fold));
+    if(t == 0){
+      binnedBLAS_dbdgemm_batch(fold, Order, TransA, TransB, M, N, K, alpha, (double const* const*)As, lda, (double const* const*)Bs, ldb, (double_binned* const*)CIs, ldc, batch_count);
+    }else{
+      binnedBLAS_dbdgemm_batch_strided(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, Ires, ldc, strideC, batch_count);
+    }
+    for(b = 0; b < batch_count; b++){
+      for(i = 0; i < M; i++){
+        for(j = 0; j < N; j++){
+          switch(Order){
+            case 'r':
+            case 'R':
+              res[b * strideC + i * ldc + j] = binned_ddbconv(fold, Ires + (b * strideC + i * ldc + j) * binned_dbnum(fold));
+              break;
+            default:
+              res[b * strideC + j * ldc + i] = binned_ddbconv(fold, Ires + (b * strideC + j * ldc + i) * binned_dbnum(fold));
+              break;
+          }
+        }
+      }
+    }
+    rc = corroborate_rdgemm_batch_compare(t == 0 ? "binnedBLAS_dbdgemm_batch" : "binnedBLAS_dbdgemm_batch_strided", Order, M, N, res, strideC, ref, ldc, CNM, batch_count);
+  }
+
+  free(A);
+  free(B);
+  free(C);
+  free(CI);
+  free(ref);
+  free(res);
+  free(Ires);
+  free(As);
+  free(Bs);
+  free(Cs);
+  free(CIs);
+  return rc;
+}
+
 int matmat_fill_show_help(void){
   corroborate_rdgemm_options_initialize();
 
   opt_show_option(fold);
   opt_show_option(max_blocks);
   opt_show_option(shuffles);
+  opt_show_option(threads);
+  opt_show_option(batch);
   return 0;
 }
 
@@ -200,6 +406,8 @@ int matmat_fill_test(int argc, char** argv, char Order, char TransA, char TransB
   opt_eval_option(argc, argv, &fold);
   opt_eval_option(argc, argv, &max_blocks);
   opt_eval_option(argc, argv, &shuffles);
+  opt_eval_option(argc, argv, &threads);
+  opt_eval_option(argc, argv, &batch);
 
   util_random_seed();
   char NTransA;
@@ -269,16 +477,25 @@ int matmat_fill_test(int argc, char** argv, char Order, char TransA, char TransB
   }
   double *ref  = (double*)malloc(CNM * sizeof(double));
 
-  //compute with unpermuted data
+  //compute with unpermuted data on one thread
+  reproBLAS_set_num_threads(1);
   memcpy(ref, C, CNM * sizeof(double));
 
   wrap_ref_rdgemm(fold._int.value, Order, TransA, TransB, M, N, K, RealAlpha, A, lda, B, ldb, RealBeta, ref, ldc);
+  reproBLAS_set_num_threads(threads._int.value);
 
   rc = corroborate_rdgemm(fold._int.value, Order, TransA, TransB, M, N, K, RealAlpha, A, lda, B, ldb, RealBeta, C, CI, ldc, ref, max_blocks._int.value);
   if(rc != 0){
     return rc;
   }
 
+  if(batch._int.value > 0){
+    rc = corroborate_rdgemm_batch(fold._int.value, Order, TransA, TransB, M, N, K, RealAlpha, FillA, RealScaleA, ImagScaleA, lda, FillB, RealScaleB, ImagScaleB, ldb, RealBeta, FillC, RealScaleC, ImagScaleC, ldc, batch._int.value);
+    if(rc != 0){
+      return rc;
+    }
+  }
+
   P = util_identity_permutation(K);
   util_dmat_row_reverse(Order, NTransA, opAM, opAK, A, lda, P, 1);
   util_dmat_row_permute(Order, TransB, opBK, opBN, B, ldb, P, 1, NULL, 1);
@@ -15,6 +15,8 @@
 static opt_option max_blocks;
 static opt_option shuffles;
 static opt_option fold;
+static opt_option threads;
+static opt_option batch;
 
 static void corroborate_rzgemm_options_initialize(void){
   max_blocks._int.header.type       = opt_int;
@@ -43,6 +45,24 @@ static void corroborate_rzgemm_options_initialize(void){
   fold._int.min               = 2;
   fold._int.max               = binned_DBMAXFOLD;
   fold._int.value             = DIDEFAULTFOLD;
+
+  threads._int.header.type       = opt_int;
+  threads._int.header.short_name = '\0';
+  threads._int.header.long_name  = "threads";
+  threads._int.header.help       = "number of threads";
+  threads._int.required          = 0;
+  threads._int.min               = 1;
+  threads._int.max               = INT_MAX;
+  threads._int.value             = 1;
+
+  batch._int.header.type       = opt_int;
+  batch._int.header.short_name = '\0';
+  batch._int.header.long_name  = "batch";
+  batch._int.header.help       = "number of batched entries to check (0 to skip)";
+  batch._int.required          = 0;
+  batch._int.min               = 0;
+  batch._int.max               = INT_MAX;
+  batch._int.value             = 0;
 }
 
 int corroborate_rzgemm(int fold, char Order, char TransA, char TransB, int M, int N, int K, double complex *alpha, double complex *A, int lda, double complex *B, int ldb, double complex *beta, double complex *C, double_complex_binned *CI, int ldc, double complex *ref, int max_num_blocks) {
@@ -166,12 +186,208 @@ int corroborate_rzgemm(int fold, char Order, char TransA, char TransB, int M, in
   return 0;
 }
 
+static int corroborate_rzgemm_batch_compare(const char *func, char Order, int M, int N, double complex *res, int strideC, double complex *ref, int ldc, int CNM, int batch_count) {
+  int i;
+  int j;
+  int b;
+
+  for(b = 0; b < batch_count; b++){
+    for(i = 0; i < M; i++){
+      for(j = 0; j < N; j++){
+        switch(Order){
+          case 'r':
+          case 'R':
+            if(res[b * strideC + i * ldc + j] != ref[b * CNM + i * ldc + j]){
+              printf("%s[batch=%d] = %g + %gi != %g + %gi\n", func, b, creal(res[b * strideC + i * ldc + j]), cimag(res[b * strideC + i * ldc + j]), creal(ref[b * CNM + i * ldc + j]), cimag(ref[b * CNM + i * ldc + j]));
+              return 1;
+            }
+            break;
+          default:
+            if(res[b * strideC + j * ldc + i] != ref[b * CNM + j * ldc + i]){
+              printf("%s[batch=%d] = %g + %gi != %g + %gi\n", func, b, creal(res[b * strideC + j * ldc + i]), cimag(res[b * strideC + j * ldc + i]), creal(ref[b * CNM + j * ldc + i]), cimag(ref[b * CNM + j * ldc + i]));
+              return 1;
+            }
+            break;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+int corroborate_rzgemm_batch(int fold, char Order, char TransA, char TransB, int M, int N, int K, double complex *alpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillB, double RealScaleB, double ImagScaleB, int ldb, double complex *beta, int FillC, double RealScaleC, double ImagScaleC, int ldc, int batch_count) {
+  int i;
+  int j;
+  int b;
+  int t;
+  int rc = 0;
+  char NTransA;
+  int opAM;
+  int opAK;
+  int opBK;
+  int opBN;
+  int strideA;
+  int strideB;
+  int strideC;
+  int CNM;
+  int k;
+
+  double complex *A;
+  double complex *B;
+  double complex *C;
+  double complex betaC;
+  double_complex_binned *CI;
+  double complex *ref;
+  double complex *res;
+  double_complex_binned *Ires;
+  const void **As;
+  const void **Bs;
+  void **Cs;
+  double_complex_binned **CIs;
+
+  switch(TransA){
+    case 'n':
+    case 'N':
+      opAM = M;
+      opAK = K;
+      NTransA = 't';
+      break;
+    default:
+      opAM = K;
+      opAK = M;
+      NTransA = 'n';
+      break;
+  }
+
+  switch(TransB){
+    case 'n':
+    case 'N':
+      opBK = K;
+      opBN = N;
+      break;
+    default:
+      opBK = N;
+      opBN = K;
+      break;
+  }
+
+  //each entry has its own matrices, and the gaps between entries make the strides of A, B and C differ from each other and from the matrix sizes
+  switch(Order){
+    case 'r':
+    case 'R':
+      strideA = opAM * lda + 1;
+      strideB = opBK * ldb + 2;
+      CNM = M * ldc;
+      break;
+    default:
+      strideA = lda * opAK + 1;
+      strideB = ldb * opBN + 2;
+      CNM = ldc * N;
+      break;
+  }
+  strideC = CNM + 3;
+  A = malloc(batch_count * strideA * sizeof(double complex));
+  B = malloc(batch_count * strideB * sizeof(double complex));
+  C = malloc(batch_count * strideC * sizeof(double complex));
+  CI = malloc(batch_count * strideC * binned_zbsize(fold));
+  ref = malloc(batch_count * CNM * sizeof(double complex));
+  res = malloc(batch_count * strideC * sizeof(double complex));
+  Ires = malloc(batch_count * strideC * binned_zbsize(fold));
+  As = malloc(batch_count * sizeof(void*));
+  Bs = malloc(batch_count * sizeof(void*));
+  Cs = malloc(batch_count * sizeof(void*));
+  CIs = malloc(batch_count * sizeof(double_complex_binned*));
+  for(b = 0; b < batch_count; b++){
+    util_zmat_fill(Order, NTransA, opAM, opAK, A + b * strideA, lda, FillA, RealScaleA, ImagScaleA);
+    util_zmat_fill(Order, TransB, opBK, opBN, B + b * strideB, ldb, FillB, RealScaleB, ImagScaleB);
+    util_zmat_fill(Order, 'n', M, N, C + b * strideC, ldc, FillC, RealScaleC, ImagScaleC);
+    for(i = 0; i < M; i++){
+      for(j = 0; j < N; j++){
+        switch(Order){
+          case 'r':
+          case 'R':
+            k = b * strideC + i * ldc + j;
+            break;
+          default:
+            k = b * strideC + j * ldc + i;
+            break;
+        }
+        if(*beta == 0.0){
+          binned_zbsetzero(fold, CI + k * binned_zbnum(fold));
+        }else if(*beta == 1.0){
+          binned_zbzconv(fold, C + k, CI + k * binned_zbnum(fold));
+        }else{
+          betaC = C[k] * *beta;
+          binned_zbzconv(fold, &betaC, CI + k * binned_zbnum(fold));
+        }
+      }
+    }
+    memcpy(ref + b * CNM, C + b * strideC, CNM * sizeof(double complex));
+    reproBLAS_rzgemm(fold, Order, TransA, TransB, M, N, K, alpha, A + b * strideA, lda, B + b * strideB, ldb, beta, ref + b * CNM, ldc);
+    As[b] = A + b * strideA;
+    Bs[b] = B + b * strideB;
+    Cs[b] = res + b * strideC;
+    CIs[b] = Ires + b * strideC * binned_zbnum(fold);
+  }
+
+  memcpy(res, C, batch_count * strideC * sizeof(double complex));
+  reproBLAS_rzgemm_batch_strided(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, beta, res, ldc, strideC, batch_count);
+  rc = corroborate_rzgemm_batch_compare("reproBLAS_rzgemm_batch_strided", Order, M, N, res, strideC, ref, ldc, CNM, batch_count);
+
+  if(rc == 0){
+    memcpy(res, C, batch_count * strideC * sizeof(double complex));
+    reproBLAS_rzgemm_batch(fold, Order, TransA, TransB, M, N, K, alpha, (void const* const*)As, lda, (void const* const*)Bs, ldb, beta, (void* const*)Cs, ldc, batch_count);
+    rc = corroborate_rzgemm_batch_compare("reproBLAS_rzgemm_batch", Order, M, N, res, strideC, ref, ldc, CNM, batch_count);
+  }
+
+  //the binned batches are checked with pointer arrays (t = 0) and with strides (t = 1)
+  for(t = 0; t < 2 && rc == 0; t++){
+    memcpy(Ires, CI, batch_count * strideC * binned_zbsize(fold));
+    if(t == 0){
+      binnedBLAS_zbzgemm_batch(fold, Order, TransA, TransB, M, N, K, alpha, (void const* const*)As, lda, (void const* const*)Bs, ldb, (double_complex_binned* const*)CIs, ldc, batch_count);
+    }else{
+      binnedBLAS_zbzgemm_batch_strided(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, Ires, ldc, strideC, batch_count);
+    }
+    for(b = 0; b < batch_count; b++){
+      for(i = 0; i < M; i++){
+        for(j = 0; j < N; j++){
+          switch(Order){
+            case 'r':
+            case 'R':
+              binned_zzbconv_sub(fold, Ires + (b * strideC + i * ldc + j) * binned_zbnum(fold), res + b * strideC + i * ldc + j);
+              break;
+            default:
+              binned_zzbconv_sub(fold, Ires + (b * strideC + j * ldc + i) * binned_zbnum(fold), res + b * strideC + j * ldc + i);
+              break;
+          }
+        }
+      }
+    }
+    rc = corroborate_rzgemm_batch_compare(t == 0 ? "binnedBLAS_zbzgemm_batch" : "binnedBLAS_zbzgemm_batch_strided", Order, M, N, res, strideC, ref, ldc, CNM, batch_count);
+  }
+
+  free(A);
+  free(B);
+  free(C);
+  free(CI);
+  free(ref);
+  free(res);
+  free(Ires);
+  free(As);
+  free(Bs);
+  free(Cs);
+  free(CIs);
+  return rc;
+}
+
 int matmat_fill_show_help(void){
   corroborate_rzgemm_options_initialize();
 
   opt_show_option(fold);
   opt_show_option(max_blocks);
   opt_show_option(shuffles);
+  opt_show_option(threads);
+  opt_show_option(batch);
   return 0;
 }
 
@@ -199,6 +415,8 @@ int matmat_fill_test(int argc, char** argv, char Order, char TransA, char TransB
   opt_eval_option(argc, argv, &fold);
   opt_eval_option(argc, argv, &max_blocks);
   opt_eval_option(argc, argv, &shuffles);
+  opt_eval_option(argc, argv, &threads);
+  opt_eval_option(argc, argv, &batch);
 
   util_random_seed();
   char NTransA;
@@ -296,16 +514,25 @@ int matmat_fill_test(int argc, char** argv, char Order, char TransA, char TransB
   }
   double complex *ref  = (double complex*)malloc(CNM * sizeof(double complex));
 
-  //compute with unpermuted data
+  //compute with unpermuted data on one thread
+  reproBLAS_set_num_threads(1);
   memcpy(ref, C, CNM * sizeof(double complex));
 
   wrap_ref_rzgemm(fold._int.value, Order, TransA, TransB, M, N, K, &alpha, A, lda, B, ldb, &beta, ref, ldc);
+  reproBLAS_set_num_threads(threads._int.value);
 
   rc = corroborate_rzgemm(fold._int.value, Order, TransA, TransB, M, N, K, &alpha, A, lda, B, ldb, &beta, C, CI, ldc, ref, max_blocks._int.value);
   if(rc != 0){
     return rc;
   }
 
+  if(batch._int.value > 0){
+    rc = corroborate_rzgemm_batch(fold._int.value, Order, TransA, TransB, M, N, K, &alpha, FillA, RealScaleA, ImagScaleA, lda, FillB, RealScaleB, ImagScaleB, ldb, &beta, FillC, RealScaleC, ImagScaleC, ldc, batch._int.value);
+    if(rc != 0){
+      return rc;
+    }
+  }
+
   P = util_identity_permutation(K);
   util_zmat_row_reverse(Order, NTransA, opAM, opAK, A, lda, P, 1);
   util_zmat_row_permute(Order, TransB, opBK, opBN, B, ldb, P, 1, NULL, 1);
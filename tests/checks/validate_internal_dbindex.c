@@ -0,0 +1,87 @@
+#include <binnedBLAS.h>
+#include <binned.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "../common/test_vecvec_header.h"
+#include "../common/test_util.h"
+
+#include "../../config.h"
+
+
+int vecvec_show_help(void){
+  return 0;
+}
+
+const char* vecvec_name(int argc, char** argv) {
+  (void)argc;
+  (void)argv;
+  return "Verify dbindex";
+}
+
+int vecvec_test(int argc, char** argv, int N, int incX, int incY) {
+  (void)argc;
+  (void)argv;
+  (void)incY;
+  int fold;
+  int i;
+  int k;
+  int index;
+  int *indices;
+  double amax;
+  double_binned *x;
+
+  util_random_seed();
+
+  for (fold = 2; fold <= DIDEFAULTFOLD + 1; fold++) {
+    //allocate vector
+    double_binned *X = (double_binned*)malloc(N * incX * binned_dbsize(fold));
+    for (i = 0; i < N * incX * binned_dbnum(fold); i++) {
+      X[i] = util_drand();
+    }
+
+    //zero, inf, nan, renormalized, and unrenormalized elements in every bin
+    for (i = 0; i < N; i++) {
+      x = X + i * incX * binned_dbnum(fold);
+      binned_dbsetzero(fold, x);
+      amax = ldexp(0.5 + util_drand(), (i % (DBL_MAX_EXP - DBL_MIN_EXP)) + DBL_MIN_EXP);
+      switch (i % 8) {
+        case 0:
+          break;
+        case 1:
+          binned_dbdadd(fold, (i % 16 < 8) ? INFINITY : -INFINITY, x);
+          break;
+        case 2:
+          binned_dbdadd(fold, NAN, x);
+          break;
+        case 3:
+        case 4:
+          binned_dbdadd(fold, amax * (util_drand() - 0.5), x);
+          break;
+        default:
+          binned_dbdupdate(fold, amax, x);
+          for (k = 0; k < 1 + rand() % 1024; k++) {
+            binned_dmddeposit(fold, amax * (2.0 * util_drand() - 1.0), x, 1);
+          }
+          break;
+      }
+    }
+
+    //indices computed all at once must match the indices computed one at a time
+    indices = (int*)malloc(N * sizeof(int));
+    binned_dbindexv(fold, N, X, incX, indices);
+    for (i = 0; i < N; i++) {
+      index = binned_dmindex(X + i * incX * binned_dbnum(fold));
+      if (index != indices[i]){
+        printf("dbindexv(X)[%d] != dmindex(X[%d]) (fold = %d)\n", i, i, fold);
+        printf("%d != %d\n", indices[i], index);
+        return 1;
+      }
+    }
+
+    free(indices);
+    free(X);
+  }
+  return 0;
+}
@@ -0,0 +1,190 @@
+#include <binnedMPI.h>
+#include <binned.h>
+#include <mpi.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../common/test_vecvec_header.h"
+#include "../common/test_util.h"
+
+#include "../../config.h"
+
+
+int vecvec_show_help(void){
+  return 0;
+}
+
+const char* vecvec_name(int argc, char** argv) {
+  (void)argc;
+  (void)argv;
+  return "Validate dbpack/dbunpack and DBDBADD_COMPACT";
+}
+
+//zero, inf, -inf, nan, renormalized, unrenormalized, and renormalized with carries of INT32_MAX and -INT32_MAX
+static void validate_internal_dbpack_fill(const int fold, const int c, double_binned *x){
+  int j;
+  int k;
+  double amax = ldexp(0.5 + util_drand(), (rand() % (DBL_MAX_EXP - DBL_MIN_EXP)) + DBL_MIN_EXP);
+
+  binned_dbsetzero(fold, x);
+  switch (c) {
+    case 0:
+      break;
+    case 1:
+      binned_dbdadd(fold, INFINITY, x);
+      break;
+    case 2:
+      binned_dbdadd(fold, -INFINITY, x);
+      break;
+    case 3:
+      binned_dbdadd(fold, NAN, x);
+      break;
+    case 4:
+      binned_dbdadd(fold, amax * (util_drand() - 0.5), x);
+      break;
+    case 5:
+      binned_dbdupdate(fold, amax, x);
+      for (k = 0; k < 1 + rand() % 1024; k++) {
+        binned_dmddeposit(fold, amax * (2.0 * util_drand() - 1.0), x, 1);
+      }
+      for (j = 0; j < fold; j++) {
+        x[fold + j] = (double)(rand() % 64 - 32);
+      }
+      break;
+    default:
+      binned_dbdadd(fold, amax * (util_drand() - 0.5), x);
+      for (j = 0; j < fold; j++) {
+        x[fold + j] = (c == 6) ? (double)INT32_MAX : -(double)INT32_MAX;
+      }
+      break;
+  }
+}
+
+//what dbunpack(dbpack(x)) should be: zero, the nan or inf alone, or x renormalized
+static void validate_internal_dbpack_expect(const int fold, const double_binned *x, double_binned *z){
+  double naninf;
+
+  binned_dbdbset(fold, x, z);
+  if (z[0] == 0.0) {
+    binned_dbsetzero(fold, z);
+  } else if (isnan(z[0]) || isinf(z[0])) {
+    naninf = z[0];
+    binned_dbsetzero(fold, z);
+    z[0] = naninf;
+  } else {
+    binned_dbrenorm(fold, z);
+  }
+}
+
+static int validate_internal_dbpack_compare(const int fold, const char *what, const int i, const double_binned *res, const double_binned *ref){
+  int j;
+
+  if (memcmp(res, ref, binned_dbsize(fold)) != 0) {
+    printf("%s[%d] is not as expected (fold = %d)\n", what, i, fold);
+    for (j = 0; j < 2 * fold; j++) {
+      printf("%a %a\n", res[j], ref[j]);
+    }
+    return 1;
+  }
+  return 0;
+}
+
+int vecvec_test(int argc, char** argv, int N, int incX, int incY) {
+  (void)incY;
+  int rc = 0;
+  int fold;
+  int i;
+  int j;
+  int cx;
+  int cy;
+  double_binned *x;
+  double_binned *y;
+  double_binned *z;
+
+  util_random_seed();
+
+  MPI_Init(&argc, &argv);
+
+  for (fold = 2; fold <= binned_DBMAXFOLD && rc == 0; fold++) {
+    size_t size = binnedMPI_dbpacksize(fold);
+    double_binned *X = (double_binned*)malloc(N * incX * binned_dbsize(fold));
+    double_binned *Y = (double_binned*)malloc(N * incX * binned_dbsize(fold));
+    double_binned *X1 = (double_binned*)malloc(N * binned_dbsize(fold));
+    double_binned *Y1 = (double_binned*)malloc(N * binned_dbsize(fold));
+    char *CX = (char*)malloc(N * size);
+    char *CY = (char*)malloc(N * size);
+    z = binned_dballoc(fold);
+
+    //the elements between strides are filled too, and must be left alone
+    for (i = 0; i < N * incX * binned_dbnum(fold); i++) {
+      X[i] = util_drand();
+      Y[i] = X[i];
+    }
+    for (i = 0; i < N; i++) {
+      validate_internal_dbpack_fill(fold, i % 8, X + i * incX * binned_dbnum(fold));
+    }
+
+    //every element must survive the round trip through the packed encoding
+    binnedMPI_dbpack(fold, N, X, incX, CX);
+    binnedMPI_dbunpack(fold, N, CX, Y, incX);
+    for (i = 0; i < N * incX && rc == 0; i++) {
+      x = X + i * binned_dbnum(fold);
+      y = Y + i * binned_dbnum(fold);
+      if (i % incX == 0) {
+        validate_internal_dbpack_expect(fold, x, z);
+        rc = validate_internal_dbpack_compare(fold, "dbunpack(dbpack(X))", i, y, z);
+      } else {
+        rc = validate_internal_dbpack_compare(fold, "dbunpack(dbpack(X))", i, y, x);
+      }
+    }
+
+    //the operations of the largest fold are not created
+    if (fold <= binned_DBMAXINDEX && rc == 0) {
+      //every pair of kinds of elements is added, except that carries of INT32_MAX are only added to their negations or to zero, nan and inf
+      for (i = 0; i < N; i++) {
+        x = X1 + i * binned_dbnum(fold);
+        y = Y1 + i * binned_dbnum(fold);
+        cx = i % 8;
+        cy = (i / 8) % 8;
+        validate_internal_dbpack_fill(fold, cx, x);
+        validate_internal_dbpack_fill(fold, cy, y);
+        if (cx >= 6 && cy >= 4) {
+          binned_dbdbset(fold, x, y);
+          for (j = 0; j < fold; j++) {
+            y[fold + j] = -x[fold + j];
+          }
+        } else if (cy >= 6 && cx >= 4) {
+          binned_dbdbset(fold, y, x);
+          for (j = 0; j < fold; j++) {
+            x[fold + j] = -y[fold + j];
+          }
+        }
+      }
+
+      //the packed sum must be the sum of the unpacked elements
+      binnedMPI_dbpack(fold, N, X1, 1, CX);
+      binnedMPI_dbpack(fold, N, Y1, 1, CY);
+      MPI_Reduce_local(CX, CY, N, binnedMPI_DOUBLE_BINNED_COMPACT(fold), binnedMPI_DBDBADD_COMPACT(fold));
+      MPI_Reduce_local(X1, Y1, N, binnedMPI_DOUBLE_BINNED(fold), binnedMPI_DBDBADD(fold));
+      binnedMPI_dbunpack(fold, N, CY, X1, 1);
+      for (i = 0; i < N && rc == 0; i++) {
+        validate_internal_dbpack_expect(fold, Y1 + i * binned_dbnum(fold), z);
+        rc = validate_internal_dbpack_compare(fold, "DBDBADD_COMPACT(X, Y)", i, X1 + i * binned_dbnum(fold), z);
+      }
+    }
+
+    free(z);
+    free(CY);
+    free(CX);
+    free(Y1);
+    free(X1);
+    free(Y);
+    free(X);
+  }
+
+  MPI_Finalize();
+  return rc;
+}
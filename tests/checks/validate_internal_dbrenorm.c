@@ -0,0 +1,99 @@
+#include <binnedBLAS.h>
+#include <binned.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../common/test_vecvec_header.h"
+#include "../common/test_util.h"
+
+#include "../../config.h"
+
+
+int vecvec_show_help(void){
+  return 0;
+}
+
+const char* vecvec_name(int argc, char** argv) {
+  (void)argc;
+  (void)argv;
+  return "Verify dbrenorm";
+}
+
+int vecvec_test(int argc, char** argv, int N, int incX, int incY) {
+  (void)argc;
+  (void)argv;
+  (void)incY;
+  int fold;
+  int i;
+  int j;
+  int k;
+  double amax;
+  double_binned *x;
+  double_binned *z;
+
+  util_random_seed();
+
+  for (fold = 2; fold <= DIDEFAULTFOLD + 1; fold++) {
+    //allocate vectors (the elements between strides are filled too, and must be left alone)
+    double_binned *X = (double_binned*)malloc(N * incX * binned_dbsize(fold));
+    double_binned *Y = (double_binned*)malloc(N * incX * binned_dbsize(fold));
+    z = binned_dballoc(fold);
+    for (i = 0; i < N * incX * binned_dbnum(fold); i++) {
+      X[i] = util_drand();
+    }
+
+    //zero, inf, nan, renormalized, and unrenormalized elements with carries
+    for (i = 0; i < N; i++) {
+      x = X + i * incX * binned_dbnum(fold);
+      binned_dbsetzero(fold, x);
+      amax = ldexp(0.5 + util_drand(), (rand() % (DBL_MAX_EXP - DBL_MIN_EXP)) + DBL_MIN_EXP);
+      switch (i % 8) {
+        case 0:
+          break;
+        case 1:
+          binned_dbdadd(fold, (i % 16 < 8) ? INFINITY : -INFINITY, x);
+          break;
+        case 2:
+          binned_dbdadd(fold, NAN, x);
+          break;
+        case 3:
+          binned_dbdadd(fold, amax * (util_drand() - 0.5), x);
+          break;
+        default:
+          binned_dbdupdate(fold, amax, x);
+          for (k = 0; k < 1 + rand() % 1024; k++) {
+            binned_dmddeposit(fold, amax * (2.0 * util_drand() - 1.0), x, 1);
+          }
+          for (j = 0; j < fold; j++) {
+            x[fold + j] = (double)(rand() % 64 - 32);
+          }
+          break;
+      }
+    }
+
+    //renormalizing all at once must match renormalizing one at a time
+    memcpy(Y, X, N * incX * binned_dbsize(fold));
+    binned_dbrenormv(fold, N, Y, incX);
+    for (i = 0; i < N * incX; i++) {
+      x = X + i * binned_dbnum(fold);
+      binned_dbdbset(fold, x, z);
+      if (i % incX == 0) {
+        binned_dbrenorm(fold, z);
+      }
+      if (memcmp(z, Y + i * binned_dbnum(fold), binned_dbsize(fold)) != 0) {
+        printf("dbrenormv(X)[%d] != dbrenorm(X[%d]) (fold = %d)\n", i, i, fold);
+        for (j = 0; j < 2 * fold; j++) {
+          printf("%a %a\n", Y[i * binned_dbnum(fold) + j], z[j]);
+        }
+        return 1;
+      }
+    }
+
+    free(z);
+    free(Y);
+    free(X);
+  }
+  return 0;
+}
@@ -25,6 +25,7 @@ int vecvec_test(int argc, char** argv, int N, int incX, int incY) {
   (void)incY;
   int i;
   int index;
+  int *indices;
 
   util_random_seed();
 
@@ -36,8 +37,17 @@ int vecvec_test(int argc, char** argv, int N, int incX, int incY) {
     X[i * incX] = ldexp(0.5 + 0.5 * util_drand(), (i/N) + DBL_MIN_EXP);
   }
   X[i * incX] = 0.0;
+
+  //indices computed all at once must match the indices computed one at a time
+  indices = (int*)malloc((N * (DBL_MAX_EXP - DBL_MIN_EXP) + 1) * sizeof(int));
+  binned_dindexv(N * (DBL_MAX_EXP - DBL_MIN_EXP) + 1, X, incX, indices);
   for (i = 0; i < N * (DBL_MAX_EXP - DBL_MIN_EXP) + 1; i++) {
     index = binned_dindex(X[i * incX]);
+    if (index != indices[i]){
+      printf("dindexv(X)[%d] != dindex(X[%d])\n", i, i);
+      printf("%d != %d\n", indices[i], index);
+      return 1;
+    }
     if (index == 0){
       X[i * incX] *= binned_DMCOMPRESSION;
     }
@@ -52,6 +62,7 @@ int vecvec_test(int argc, char** argv, int N, int incX, int incY) {
       return 1;
     }
   }
+  free(indices);
   free(X);
   return 0;
 }
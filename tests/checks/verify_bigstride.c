@@ -0,0 +1,152 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/mman.h>
+
+#include "../common/test_vecvec_header.h"
+#include "../common/test_util.h"
+
+#include "../../config.h"
+
+static opt_option threads;
+
+static void verify_bigstride_options_initialize(void){
+  threads._int.header.type       = opt_int;
+  threads._int.header.short_name = 'T';
+  threads._int.header.long_name  = "threads";
+  threads._int.header.help       = "number of threads";
+  threads._int.required          = 0;
+  threads._int.min               = 1;
+  threads._int.max               = INT_MAX;
+  threads._int.value             = 4;
+}
+
+int vecvec_show_help(void){
+  verify_bigstride_options_initialize();
+
+  opt_show_option(threads);
+  return 0;
+}
+
+const char* vecvec_name(int argc, char** argv) {
+  static char name_buffer[MAX_LINE];
+
+  verify_bigstride_options_initialize();
+
+  opt_eval_option(argc, argv, &threads);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify serial and threaded reductions with N * inc > INT_MAX (T=%d)", threads._int.value);
+  return name_buffer;
+}
+
+//only the pages holding the N elements are touched, so the strided vectors need not fit in memory
+static void *verify_bigstride_alloc(size_t size){
+  void *V = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  return V == MAP_FAILED ? NULL : V;
+}
+
+static void verify_bigstride_fill(int N, double *V, size_t incV, int width){
+  int i;
+  int j;
+  for(i = 0; i < N; i++){
+    for(j = 0; j < width; j++){
+      V[i * incV + j] = sin(1.0 + i + 0.5 * j);
+    }
+  }
+}
+
+static void verify_bigstride_fillf(int N, float *V, size_t incV, int width){
+  int i;
+  int j;
+  for(i = 0; i < N; i++){
+    for(j = 0; j < width; j++){
+      V[i * incV + j] = (float)sin(1.0 + i + 0.5 * j);
+    }
+  }
+}
+
+static int verify_bigstride_compare(const char *func, const char *pass, const void *ref, const void *res, size_t size){
+  if(memcmp(ref, res, size) != 0){
+    printf("%s %s differ from contiguous %s\n", pass, func, func);
+    return 1;
+  }
+  return 0;
+}
+
+int vecvec_test(int argc, char** argv, int N, int incX, int incY) {
+  int rc = 0;
+  int T;
+  int incx;
+  int incy;
+  int fold = DIDEFAULTFOLD;
+  double dref[3][6];
+  float sref[3][6];
+  double complex zref[3][3];
+  float complex cref[3][3];
+  size_t size = (size_t)N * MAX(incX, incY) * sizeof(double complex);
+
+  verify_bigstride_options_initialize();
+  opt_eval_option(argc, argv, &threads);
+
+  double *X = (double*)verify_bigstride_alloc(size);
+  double *Y = (double*)verify_bigstride_alloc(size);
+  if(X == NULL || Y == NULL){
+    printf("could not reserve %zu bytes of address space\n", size);
+    return 125;
+  }
+
+  //contiguous and serial, strided and serial, then strided and threaded
+  reproBLAS_set_thread_grain(1);
+  for(T = 0; T < 3; T++){
+    reproBLAS_set_num_threads(T < 2 ? 1 : threads._int.value);
+    incx = T == 0 ? 1 : incX;
+    incy = T == 0 ? 1 : incY;
+
+    verify_bigstride_fill(N, X, (size_t)incx, 1);
+    verify_bigstride_fill(N, Y, (size_t)incy, 1);
+    dref[T][0] = reproBLAS_rdsum(fold, N, X, incx);
+    dref[T][1] = reproBLAS_rdasum(fold, N, X, incx);
+    dref[T][2] = reproBLAS_rdnrm2(fold, N, X, incx);
+    dref[T][3] = reproBLAS_rddot(fold, N, X, incx, Y, incy);
+
+    verify_bigstride_fillf(N, (float*)X, (size_t)incx, 1);
+    verify_bigstride_fillf(N, (float*)Y, (size_t)incy, 1);
+    sref[T][0] = reproBLAS_rssum(fold, N, (float*)X, incx);
+    sref[T][1] = reproBLAS_rsasum(fold, N, (float*)X, incx);
+    sref[T][2] = reproBLAS_rsnrm2(fold, N, (float*)X, incx);
+    sref[T][3] = reproBLAS_rsdot(fold, N, (float*)X, incx, (float*)Y, incy);
+
+    verify_bigstride_fill(N, X, 2 * (size_t)incx, 2);
+    verify_bigstride_fill(N, Y, 2 * (size_t)incy, 2);
+    reproBLAS_rzsum_sub(fold, N, X, incx, zref[T]);
+    reproBLAS_rzdotu_sub(fold, N, X, incx, Y, incy, zref[T] + 1);
+    reproBLAS_rzdotc_sub(fold, N, X, incx, Y, incy, zref[T] + 2);
+    dref[T][4] = reproBLAS_rdzasum(fold, N, X, incx);
+    dref[T][5] = reproBLAS_rdznrm2(fold, N, X, incx);
+
+    verify_bigstride_fillf(N, (float*)X, 2 * (size_t)incx, 2);
+    verify_bigstride_fillf(N, (float*)Y, 2 * (size_t)incy, 2);
+    reproBLAS_rcsum_sub(fold, N, X, incx, cref[T]);
+    reproBLAS_rcdotu_sub(fold, N, X, incx, Y, incy, cref[T] + 1);
+    reproBLAS_rcdotc_sub(fold, N, X, incx, Y, incy, cref[T] + 2);
+    sref[T][4] = reproBLAS_rscasum(fold, N, X, incx);
+    sref[T][5] = reproBLAS_rscnrm2(fold, N, X, incx);
+  }
+  reproBLAS_set_num_threads(0);
+  reproBLAS_set_thread_grain(0);
+
+  for(T = 1; T < 3; T++){
+    rc |= verify_bigstride_compare("double reductions", T == 1 ? "strided" : "threaded", dref[0], dref[T], sizeof(dref[0]));
+    rc |= verify_bigstride_compare("float reductions", T == 1 ? "strided" : "threaded", sref[0], sref[T], sizeof(sref[0]));
+    rc |= verify_bigstride_compare("double complex reductions", T == 1 ? "strided" : "threaded", zref[0], zref[T], sizeof(zref[0]));
+    rc |= verify_bigstride_compare("float complex reductions", T == 1 ? "strided" : "threaded", cref[0], cref[T], sizeof(cref[0]));
+  }
+
+  munmap(X, size);
+  munmap(Y, size);
+  return rc;
+}
@@ -0,0 +1,166 @@
+#include <binnedOMP.h>
+#include <binned.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+static opt_option threads;
+
+static void verify_ompreduce_options_initialize(void){
+  threads._int.header.type       = opt_int;
+  threads._int.header.short_name = 'T';
+  threads._int.header.long_name  = "threads";
+  threads._int.header.help       = "maximum number of threads";
+  threads._int.required          = 0;
+  threads._int.min               = 1;
+  threads._int.max               = INT_MAX;
+  threads._int.value             = 1;
+}
+
+#ifdef _OPENMP
+#define VERIFY_OMPREDUCE_N_SCHEDULES 5
+static const omp_sched_t verify_ompreduce_kinds[VERIFY_OMPREDUCE_N_SCHEDULES] = {omp_sched_static, omp_sched_static, omp_sched_dynamic, omp_sched_dynamic, omp_sched_guided};
+static const int verify_ompreduce_chunks[VERIFY_OMPREDUCE_N_SCHEDULES] = {0, 3, 1, 7, 2};
+#else
+#define VERIFY_OMPREDUCE_N_SCHEDULES 1
+#endif
+
+static void verify_ompreduce_set_schedule(int schedule){
+#ifdef _OPENMP
+  omp_set_schedule(verify_ompreduce_kinds[schedule], verify_ompreduce_chunks[schedule]);
+#else
+  (void)schedule;
+#endif
+}
+
+//sum X (and (X, Y) as complex numbers) with the reductions of one fold, on 1 to max_threads threads and under several schedules
+#define VERIFY_OMPREDUCE_FOLD(fold)\
+static int verify_ompreduce_##fold(int N, double *X, int incX, double *Y, int incY, int max_threads){\
+  double_binned##fold dacc;\
+  double_complex_binned##fold zacc;\
+  float_binned##fold sacc;\
+  float_complex_binned##fold cacc;\
+  double dref;\
+  double complex zref;\
+  float sref;\
+  float complex cref;\
+  double dres;\
+  double complex zres;\
+  float sres;\
+  float complex cres;\
+  double z[2];\
+  float c[2];\
+  int t;\
+  int schedule;\
+  int i;\
+\
+  binned_dbsetzero(fold, dacc.value);\
+  binned_zbsetzero(fold, zacc.value);\
+  binned_sbsetzero(fold, sacc.value);\
+  binned_cbsetzero(fold, cacc.value);\
+  for(i = 0; i < N; i++){\
+    z[0] = X[i * incX];\
+    z[1] = Y[i * incY];\
+    c[0] = (float)z[0];\
+    c[1] = (float)z[1];\
+    binned_dbdadd(fold, z[0], dacc.value);\
+    binned_zbzadd(fold, z, zacc.value);\
+    binned_sbsadd(fold, c[0], sacc.value);\
+    binned_cbcadd(fold, c, cacc.value);\
+  }\
+  dref = binned_ddbconv(fold, dacc.value);\
+  binned_zzbconv_sub(fold, zacc.value, &zref);\
+  sref = binned_ssbconv(fold, sacc.value);\
+  binned_ccbconv_sub(fold, cacc.value, &cref);\
+\
+  for(t = 1; t <= max_threads; t++){\
+    for(schedule = 0; schedule < VERIFY_OMPREDUCE_N_SCHEDULES; schedule++){\
+      verify_ompreduce_set_schedule(schedule);\
+      binned_dbsetzero(fold, dacc.value);\
+      binned_zbsetzero(fold, zacc.value);\
+      binned_sbsetzero(fold, sacc.value);\
+      binned_cbsetzero(fold, cacc.value);\
+      binnedOMP_PRAGMA(omp parallel for num_threads(t) schedule(runtime) private(z, c) reduction(rdsum##fold:dacc) reduction(rzsum##fold:zacc) reduction(rssum##fold:sacc) reduction(rcsum##fold:cacc))\
+      for(i = 0; i < N; i++){\
+        z[0] = X[i * incX];\
+        z[1] = Y[i * incY];\
+        c[0] = (float)z[0];\
+        c[1] = (float)z[1];\
+        binned_dbdadd(fold, z[0], dacc.value);\
+        binned_zbzadd(fold, z, zacc.value);\
+        binned_sbsadd(fold, c[0], sacc.value);\
+        binned_cbcadd(fold, c, cacc.value);\
+      }\
+      dres = binned_ddbconv(fold, dacc.value);\
+      binned_zzbconv_sub(fold, zacc.value, &zres);\
+      sres = binned_ssbconv(fold, sacc.value);\
+      binned_ccbconv_sub(fold, cacc.value, &cres);\
+      if(dres != dref || zres != zref || sres != sref || cres != cref){\
+        printf("reduction(rdsum%d) (and friends) on %d threads with schedule %d is not reproducible\n", fold, t, schedule);\
+        printf("double: %g != %g\n", dres, dref);\
+        printf("double complex: %g + %gi != %g + %gi\n", creal(zres), cimag(zres), creal(zref), cimag(zref));\
+        printf("float: %g != %g\n", sres, sref);\
+        printf("float complex: %g + %gi != %g + %gi\n", crealf(cres), cimagf(cres), crealf(cref), cimagf(cref));\
+        return 1;\
+      }\
+    }\
+  }\
+  return 0;\
+}
+
+VERIFY_OMPREDUCE_FOLD(2)
+VERIFY_OMPREDUCE_FOLD(3)
+VERIFY_OMPREDUCE_FOLD(21)
+
+int vecvec_fill_show_help(void){
+  verify_ompreduce_options_initialize();
+
+  opt_show_option(threads);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_ompreduce_options_initialize();
+
+  opt_eval_option(argc, argv, &threads);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify OpenMP binned reductions reproducibility threads=%d", threads._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+
+  verify_ompreduce_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &threads);
+
+  double *X = util_dvec_alloc(N, incX);
+  double *Y = util_dvec_alloc(N, incY);
+
+  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(N, Y, incY, FillY, RealScaleY, ImagScaleY);
+
+  rc = verify_ompreduce_2(N, X, incX, Y, incY, threads._int.value);
+  if(rc == 0){
+    rc = verify_ompreduce_3(N, X, incX, Y, incY, threads._int.value);
+  }
+  if(rc == 0){
+    rc = verify_ompreduce_21(N, X, incX, Y, incY, threads._int.value);
+  }
+
+  free(X);
+  free(Y);
+
+  return rc;
+}
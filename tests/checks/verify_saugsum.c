@@ -13,6 +13,7 @@ static opt_option augsum_func;
 static opt_option max_blocks;
 static opt_option shuffles;
 static opt_option fold;
+static opt_option threads;
 
 static void verify_saugsum_options_initialize(void){
   augsum_func._named.header.type       = opt_named;
@@ -51,6 +52,15 @@ static void verify_saugsum_options_initialize(void){
   fold._int.min               = 2;
   fold._int.max               = binned_SBMAXFOLD;
   fold._int.value             = SIDEFAULTFOLD;
+
+  threads._int.header.type       = opt_int;
+  threads._int.header.short_name = 'T';
+  threads._int.header.long_name  = "threads";
+  threads._int.header.help       = "number of threads";
+  threads._int.required          = 0;
+  threads._int.min               = 1;
+  threads._int.max               = INT_MAX;
+  threads._int.value             = 1;
 }
 
 int verify_saugsum_reproducibility(int fold, int N, float* X, int incX, float* Y, int incY, int func, float ref, float_binned *iref, int max_num_blocks) {
@@ -101,6 +111,7 @@ int vecvec_fill_show_help(void){
   opt_show_option(max_blocks);
   opt_show_option(shuffles);
   opt_show_option(fold);
+  opt_show_option(threads);
   return 0;
 }
 
@@ -130,6 +141,7 @@ int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX,
   opt_eval_option(argc, argv, &max_blocks);
   opt_eval_option(argc, argv, &shuffles);
   opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &threads);
 
   iref = binned_sballoc(fold._int.value);
 
@@ -148,10 +160,12 @@ int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX,
   util_svec_fill(N, Y, incY, FillY, RealScaleY, ImagScaleY);
 
 
-  //compute with unpermuted data
+  //compute with unpermuted data on one thread
+  reproBLAS_set_num_threads(1);
   ref  = (wrap_saugsum_func(augsum_func._named.value))(fold._int.value, N, X, incX, Y, incY);
   binned_sbsetzero(fold._int.value, iref);
   (wrap_siaugsum_func(augsum_func._named.value))(fold._int.value, N, X, incX, Y, incY, iref);
+  reproBLAS_set_num_threads(threads._int.value);
 
   P = util_identity_permutation(N);
   util_svec_reverse(N, X, incX, P, 1);
@@ -0,0 +1,152 @@
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../common/test_vecvec_header.h"
+#include "../common/test_util.h"
+
+#include "../../config.h"
+
+static opt_option threads;
+static opt_option calls;
+
+static void verify_scalednrm2_options_initialize(void){
+  threads._int.header.type       = opt_int;
+  threads._int.header.short_name = 'T';
+  threads._int.header.long_name  = "threads";
+  threads._int.header.help       = "number of threads";
+  threads._int.required          = 0;
+  threads._int.min               = 1;
+  threads._int.max               = INT_MAX;
+  threads._int.value             = 4;
+
+  calls._int.header.type       = opt_int;
+  calls._int.header.short_name = 'c';
+  calls._int.header.long_name  = "calls";
+  calls._int.header.help       = "number of threaded calls";
+  calls._int.required          = 0;
+  calls._int.min               = 1;
+  calls._int.max               = INT_MAX;
+  calls._int.value             = 100;
+}
+
+int vecvec_show_help(void){
+  verify_scalednrm2_options_initialize();
+
+  opt_show_option(threads);
+  opt_show_option(calls);
+  return 0;
+}
+
+const char* vecvec_name(int argc, char** argv) {
+  static char name_buffer[MAX_LINE];
+
+  verify_scalednrm2_options_initialize();
+
+  opt_eval_option(argc, argv, &threads);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify threaded nrm2 with partials of different scales (T=%d)", threads._int.value);
+  return name_buffer;
+}
+
+//the vector is cut into 8 runs whose magnitudes jump up and down, so the threads' partial sums of squares have different scales and are merged in every order of scale
+static const int dexps[8] = {0, 600, -600, 300, -900, 900, -300, 60};
+static const int sexps[8] = {0, 60, -60, 30, -90, 90, -30, 6};
+
+static void verify_scalednrm2_fill(int N, double *X, int incX, int width, const int *exps){
+  int i;
+  int j;
+  for(i = 0; i < N; i++){
+    for(j = 0; j < width; j++){
+      X[(size_t)i * incX * width + j] = ldexp(sin(1.0 + i + 0.5 * j), exps[(int)(((long long)i * 8) / N)]);
+    }
+  }
+}
+
+static void verify_scalednrm2_fillf(int N, float *X, int incX, int width, const int *exps){
+  int i;
+  int j;
+  for(i = 0; i < N; i++){
+    for(j = 0; j < width; j++){
+      X[(size_t)i * incX * width + j] = (float)ldexp(sin(1.0 + i + 0.5 * j), exps[(int)(((long long)i * 8) / N)]);
+    }
+  }
+}
+
+int vecvec_test(int argc, char** argv, int N, int incX, int incY) {
+  int rc = 0;
+  int fold = DIDEFAULTFOLD;
+  int i;
+  double dref[2];
+  double dres[2];
+  float sref[2];
+  float sres[2];
+  (void)incY;
+
+  verify_scalednrm2_options_initialize();
+  opt_eval_option(argc, argv, &threads);
+  opt_eval_option(argc, argv, &calls);
+
+  double *X = (double*)malloc((size_t)N * incX * 2 * sizeof(double));
+  float *Xf = (float*)malloc((size_t)N * incX * 2 * sizeof(float));
+  double *Z = (double*)malloc((size_t)N * incX * 2 * sizeof(double));
+  float *Zf = (float*)malloc((size_t)N * incX * 2 * sizeof(float));
+
+  verify_scalednrm2_fill(N, X, incX, 1, dexps);
+  verify_scalednrm2_fillf(N, Xf, incX, 1, sexps);
+  verify_scalednrm2_fill(N, Z, incX, 2, dexps);
+  verify_scalednrm2_fillf(N, Zf, incX, 2, sexps);
+
+  reproBLAS_set_num_threads(1);
+  dref[0] = reproBLAS_rdnrm2(fold, N, X, incX);
+  dref[1] = reproBLAS_rdznrm2(fold, N, Z, incX);
+  sref[0] = reproBLAS_rsnrm2(fold, N, Xf, incX);
+  sref[1] = reproBLAS_rscnrm2(fold, N, Zf, incX);
+
+  //every block is reduced on its own thread, and the calls are repeated so that leaks in the merge show up under a leak checker
+  reproBLAS_set_thread_grain(1);
+  reproBLAS_set_num_threads(threads._int.value);
+  for(i = 0; i < calls._int.value && rc == 0; i++){
+    dres[0] = reproBLAS_rdnrm2(fold, N, X, incX);
+    dres[1] = reproBLAS_rdznrm2(fold, N, Z, incX);
+    sres[0] = reproBLAS_rsnrm2(fold, N, Xf, incX);
+    sres[1] = reproBLAS_rscnrm2(fold, N, Zf, incX);
+    if(memcmp(dref, dres, sizeof(dref)) != 0){
+      printf("threaded rdnrm2/rdznrm2 (%g, %g) differ from serial (%g, %g)\n", dres[0], dres[1], dref[0], dref[1]);
+      rc = 1;
+    }
+    if(memcmp(sref, sres, sizeof(sref)) != 0){
+      printf("threaded rsnrm2/rscnrm2 (%g, %g) differ from serial (%g, %g)\n", sres[0], sres[1], sref[0], sref[1]);
+      rc = 1;
+    }
+  }
+  reproBLAS_set_num_threads(0);
+  reproBLAS_set_thread_grain(0);
+
+  //the largest nonempty run dominates by far, so the norm of the whole vector must be the norm of that run up to rounding
+  int run = 0;
+  for(i = 0; i < N; i++){
+    if(dexps[((long long)i * 8) / N] > dexps[run]){
+      run = (int)(((long long)i * 8) / N);
+    }
+  }
+  int start = (int)(((long long)run * N + 7) / 8);
+  int run_N = (int)((((long long)run + 1) * N + 7) / 8) - start;
+  dres[0] = reproBLAS_rdnrm2(fold, run_N, X + (size_t)start * incX, incX);
+  dres[1] = reproBLAS_rdznrm2(fold, run_N, Z + 2 * (size_t)start * incX, incX);
+  sres[0] = reproBLAS_rsnrm2(fold, run_N, Xf + (size_t)start * incX, incX);
+  sres[1] = reproBLAS_rscnrm2(fold, run_N, Zf + 2 * (size_t)start * incX, incX);
+  for(i = 0; i < 2; i++){
+    if(!(fabs(dref[i] - dres[i]) <= 1e-12 * dres[i]) || !(fabsf(sref[i] - sres[i]) <= 1e-5f * sres[i])){
+      printf("norms (%g, %g) are not the norms of their largest runs (%g, %g)\n", dref[i], (double)sref[i], dres[i], (double)sres[i]);
+      rc = 1;
+    }
+  }
+
+  free(X);
+  free(Xf);
+  free(Z);
+  free(Zf);
+  return rc;
+}
@@ -5,6 +5,9 @@
 #include <binnedBLAS.h>
 #include <binned.h>
 #include "../../config.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "../common/test_util.h"
 
@@ -15,26 +18,29 @@ typedef enum wrap_daugsum_func {
   wrap_daugsum_RDDOT,
   wrap_daugsum_DBDBADD,
   wrap_daugsum_DIDADD,
-  wrap_daugsum_DIDDEPOSIT
+  wrap_daugsum_DIDDEPOSIT,
+  wrap_daugsum_DBSHARED
 } wrap_daugsum_func_t;
 
 typedef double (*wrap_daugsum)(int, int, double*, int, double*, int);
 typedef void (*wrap_diaugsum)(int, int, double*, int, double*, int, double_binned*);
-static const int wrap_daugsum_func_n_names = 7;
+static const int wrap_daugsum_func_n_names = 8;
 static const char* wrap_daugsum_func_names[] = {"rdsum",
                                                 "rdasum",
                                                 "rdnrm2",
                                                 "rddot",
                                                 "dbdbadd",
                                                 "dbdadd",
-                                                "dbddeposit"};
+                                                "dbddeposit",
+                                                "dbshared"};
 static const char* wrap_daugsum_func_descs[] = {"rdsum",
                                                 "rdasum",
                                                 "rdnrm2",
                                                 "rddot",
                                                 "dbdbadd",
                                                 "dbdadd",
-                                                "dbddeposit"};
+                                                "dbddeposit",
+                                                "dbshared"};
 
 double wrap_rdsum(int fold, int N, double *x, int incx, double *y, int incy) {
   (void)y;
@@ -189,6 +195,59 @@ void wrap_dbddeposit(int fold, int N, double *x, int incx, double *y, int incy,
   binned_dbrenorm(fold, z);
 }
 
+void wrap_dbshared(int fold, int N, double *x, int incx, double *y, int incy, double_binned *z) {
+  (void)y;
+  (void)incy;
+  double_binned_shared *shared = binned_dbshared_alloc(fold);
+  double_binned *itmp = binned_dballoc(fold);
+  //every thread produces, alternating single values with binned partials and publishing as it goes, while thread 0 also reads snapshots
+#ifdef _OPENMP
+  #pragma omp parallel num_threads(reproBLAS_get_num_threads())
+#endif
+  {
+    double_binned_producer *producer = binned_dbshared_join(shared);
+    double_binned *ipart = binned_dballoc(fold);
+    double_binned *isnap = binned_dballoc(fold);
+    int i;
+#ifdef _OPENMP
+    int thread = omp_get_thread_num();
+    #pragma omp for schedule(dynamic, 61)
+#else
+    int thread = 0;
+#endif
+    for(i = 0; i < N; i++){
+      if(i % 2 == 0){
+        binned_dbshared_dadd(producer, x[i * incx]);
+      }else{
+        binned_dbdconv(fold, x[i * incx], ipart);
+        binned_dbshared_dbadd(producer, ipart);
+      }
+      if(i % 128 == 0){
+        binned_dbshared_publish(producer);
+        if(thread == 0){
+          binned_dbshared_snapshot(shared, isnap);
+        }
+      }
+    }
+    binned_dbshared_publish(producer);
+    free(ipart);
+    free(isnap);
+  }
+  binned_dbshared_snapshot(shared, itmp);
+  binned_dbdbadd(fold, itmp, z);
+  binned_dbshared_free(shared);
+  free(itmp);
+}
+
+double wrap_rdbshared(int fold, int N, double *x, int incx, double *y, int incy) {
+  double_binned *ires = binned_dballoc(fold);
+  binned_dbsetzero(fold, ires);
+  wrap_dbshared(fold, N, x, incx, y, incy, ires);
+  double res = binned_ddbconv(fold, ires);
+  free(ires);
+  return res;
+}
+
 wrap_daugsum wrap_daugsum_func(wrap_daugsum_func_t func) {
   switch(func){
     case wrap_daugsum_RDSUM:
@@ -205,6 +264,8 @@ wrap_daugsum wrap_daugsum_func(wrap_daugsum_func_t func) {
       return wrap_rdbdadd;
     case wrap_daugsum_DIDDEPOSIT:
       return wrap_rdbddeposit;
+    case wrap_daugsum_DBSHARED:
+      return wrap_rdbshared;
   }
   return NULL;
 }
@@ -225,6 +286,8 @@ wrap_diaugsum wrap_diaugsum_func(wrap_daugsum_func_t func) {
       return wrap_dbdadd;
     case wrap_daugsum_DIDDEPOSIT:
       return wrap_dbddeposit;
+    case wrap_daugsum_DBSHARED:
+      return wrap_dbshared;
   }
   return NULL;
 }
@@ -237,6 +300,7 @@ double wrap_daugsum_result(int N, wrap_daugsum_func_t func, util_vec_fill_t Fill
     case wrap_daugsum_DBDBADD:
     case wrap_daugsum_DIDADD:
     case wrap_daugsum_DIDDEPOSIT:
+    case wrap_daugsum_DBSHARED:
       switch(FillX){
         case util_Vec_Constant:
           return N * RealScaleX;
@@ -466,6 +530,7 @@ double wrap_daugsum_bound(int fold, int N, wrap_daugsum_func_t func, double *X,
     case wrap_daugsum_DBDBADD:
     case wrap_daugsum_DIDADD:
     case wrap_daugsum_DIDDEPOSIT:
+    case wrap_daugsum_DBSHARED:
     case wrap_daugsum_RDASUM:
       return binned_dbbound(fold, N, binnedBLAS_damax(N, X, incX), res);
     case wrap_daugsum_RDNRM2:
@@ -183,6 +183,46 @@ def main():
                                                                "bench_rcdotu_fold_{}".format(fold),
                                                                "bench_rcdotc_fold_{}".format(fold)]]
   run(apis)
+  apis = []
+  for fold in [0] + list(range(2, terminal.get_dimaxfold() + 1)):
+    apis += [create_benchmark_api(benchmark) for benchmark in ["bench_rdsum_incX_fold_{}".format(fold),
+                                                               "bench_rdsum_large_fold_{}".format(fold),
+                                                               "bench_rdasum_incX_fold_{}".format(fold),
+                                                               "bench_rdasum_large_fold_{}".format(fold),
+                                                               "bench_rdnrm2_incX_fold_{}".format(fold),
+                                                               "bench_rdnrm2_large_fold_{}".format(fold),
+                                                               "bench_rddot_incX_fold_{}".format(fold),
+                                                               "bench_rddot_large_fold_{}".format(fold),
+                                                               "bench_rzsum_incX_fold_{}".format(fold),
+                                                               "bench_rzsum_large_fold_{}".format(fold),
+                                                               "bench_rdzasum_incX_fold_{}".format(fold),
+                                                               "bench_rdzasum_large_fold_{}".format(fold),
+                                                               "bench_rdznrm2_incX_fold_{}".format(fold),
+                                                               "bench_rdznrm2_large_fold_{}".format(fold),
+                                                               "bench_rzdotu_incX_fold_{}".format(fold),
+                                                               "bench_rzdotu_large_fold_{}".format(fold),
+                                                               "bench_rzdotc_incX_fold_{}".format(fold),
+                                                               "bench_rzdotc_large_fold_{}".format(fold)]]
+  for fold in [0] + list(range(2, terminal.get_simaxfold() + 1)):
+    apis += [create_benchmark_api(benchmark) for benchmark in ["bench_rssum_incX_fold_{}".format(fold),
+                                                               "bench_rssum_large_fold_{}".format(fold),
+                                                               "bench_rsasum_incX_fold_{}".format(fold),
+                                                               "bench_rsasum_large_fold_{}".format(fold),
+                                                               "bench_rsnrm2_incX_fold_{}".format(fold),
+                                                               "bench_rsnrm2_large_fold_{}".format(fold),
+                                                               "bench_rsdot_incX_fold_{}".format(fold),
+                                                               "bench_rsdot_large_fold_{}".format(fold),
+                                                               "bench_rcsum_incX_fold_{}".format(fold),
+                                                               "bench_rcsum_large_fold_{}".format(fold),
+                                                               "bench_rscasum_incX_fold_{}".format(fold),
+                                                               "bench_rscasum_large_fold_{}".format(fold),
+                                                               "bench_rscnrm2_incX_fold_{}".format(fold),
+                                                               "bench_rscnrm2_large_fold_{}".format(fold),
+                                                               "bench_rcdotu_incX_fold_{}".format(fold),
+                                                               "bench_rcdotu_large_fold_{}".format(fold),
+                                                               "bench_rcdotc_incX_fold_{}".format(fold),
+                                                               "bench_rcdotc_large_fold_{}".format(fold)]]
+  run(apis)
   apis = [create_benchmark_api(benchmark) for benchmark in ["bench_rdgemv_fold_{}".format(terminal.get_didefaultfold()),
                                                             "bench_rdgemv_TransA_fold_{}".format(terminal.get_didefaultfold()),
                                                             "bench_rdgemm_AvgTransA_AvgTransB_fold_{}".format(terminal.get_didefaultfold()),